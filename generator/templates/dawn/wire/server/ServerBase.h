@@ -28,15 +28,70 @@
 #ifndef DAWNWIRE_SERVER_SERVERBASE_H_
 #define DAWNWIRE_SERVER_SERVERBASE_H_
 
+#include <variant>
+#include <vector>
+
 #include "dawn/dawn_proc_table.h"
 #include "dawn/wire/ChunkedCommandHandler.h"
+#include "dawn/wire/ObjectType_autogen.h"
 #include "dawn/wire/Wire.h"
 #include "dawn/wire/WireCmd_autogen.h"
 #include "dawn/wire/WireDeserializeAllocator.h"
 #include "dawn/wire/server/ObjectStorage.h"
+#include "partition_alloc/pointers/raw_ptr.h"
 
 namespace dawn::wire::server {
 
+    //* An object referenced by a command that was deserialized before its execution. |out| points
+    //* inside the deserialized command and receives the handle of the object when the command is
+    //* about to be executed.
+    struct DeferredObject {
+        ObjectType type;
+        ObjectId id;
+        bool optional;
+        raw_ptr<void> out;
+    };
+
+    //* A command deserialized ahead of its execution when the server decodes commands on a
+    //* separate thread. The allocator owns the memory the command points to and is reset once the
+    //* command has been executed.
+    struct DecodedCommand {
+        WireCmd id;
+        std::variant<std::monostate
+            {%- for command in cmd_records["command"] -%}
+                , {{command.name.CamelCase()}}Cmd
+            {%- endfor -%}
+        > cmd;
+        WireDeserializeAllocator allocator;
+        std::vector<DeferredObject> objects;
+    };
+
+    //* An ObjectIdResolver that records where the objects of a command go instead of looking them
+    //* up. This allows deserializing a command before the commands creating its objects have been
+    //* executed. ServerBase::ResolveDeferredObjects looks the objects up right before execution.
+    class DeferredObjectIdResolver final : public ObjectIdResolver {
+      public:
+        explicit DeferredObjectIdResolver(std::vector<DeferredObject>* objects)
+            : mObjects(objects) {}
+
+        {% for type in by_category["object"] %}
+            WireResult GetFromId(ObjectId id, {{as_cType(type.name)}}* out) const override {
+                mObjects->push_back({ObjectType::{{type.name.CamelCase()}}, id, false, out});
+                *out = nullptr;
+                return WireResult::Success;
+            }
+
+            WireResult GetOptionalFromId(ObjectId id, {{as_cType(type.name)}}* out) const override {
+                mObjects->push_back({ObjectType::{{type.name.CamelCase()}}, id, true, out});
+                *out = nullptr;
+                return WireResult::Success;
+            }
+        {% endfor %}
+
+      private:
+        raw_ptr<std::vector<DeferredObject>> mObjects;
+    };
+
     class ServerBase : public ChunkedCommandHandler, public ObjectIdResolver {
       public:
         ServerBase() = default;
@@ -71,6 +126,23 @@ namespace dawn::wire::server {
             }
         {% endfor %}
 
+        //* Looks up the objects recorded by a DeferredObjectIdResolver.
+        WireResult ResolveDeferredObjects(const std::vector<DeferredObject>& objects) const {
+            for (const DeferredObject& object : objects) {
+                switch (object.type) {
+                    {% for type in by_category["object"] %}
+                        case ObjectType::{{type.name.CamelCase()}}: {
+                            auto* out = static_cast<{{as_cType(type.name)}}*>(object.out.get());
+                            WIRE_TRY(object.optional ? GetOptionalFromId(object.id, out)
+                                                     : GetFromId(object.id, out));
+                            break;
+                        }
+                    {% endfor %}
+                }
+            }
+            return WireResult::Success;
+        }
+
       private:
         // Implementation of the ObjectIdResolver interface
         {% for type in by_category["object"] %}
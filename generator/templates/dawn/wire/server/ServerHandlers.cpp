@@ -43,6 +43,10 @@ namespace dawn::wire::server {
                     , *this
                 {%- endif -%}
             ));
+            return Execute{{Suffix}}(cmd);
+        }
+
+        WireResult Server::Execute{{Suffix}}({{Suffix}}Cmd& cmd) {
             {% if Suffix in server_custom_pre_handler_commands %}
                 WIRE_TRY(PreHandle{{Suffix}}(cmd));
             {%- endif -%}
@@ -86,7 +90,45 @@ namespace dawn::wire::server {
         }
     {% endfor %}
 
+    WireResult Server::DecodeCommand(WireCmd cmdId,
+                                     DeserializeBuffer* deserializeBuffer,
+                                     DecodedCommand* decoded) {
+        decoded->id = cmdId;
+        DeferredObjectIdResolver resolver(&decoded->objects);
+        switch (cmdId) {
+            {% for command in cmd_records["command"] %}
+                {% set Suffix = command.name.CamelCase() %}
+                case WireCmd::{{Suffix}}:
+                    return decoded->cmd.emplace<{{Suffix}}Cmd>().Deserialize(
+                        deserializeBuffer, &decoded->allocator
+                        {%- if command.may_have_dawn_object -%}
+                            , resolver
+                        {%- endif -%}
+                    );
+            {% endfor %}
+            default:
+                return WireResult::FatalError;
+        }
+    }
+
+    WireResult Server::ExecuteCommand(DecodedCommand* decoded) {
+        WIRE_TRY(ResolveDeferredObjects(decoded->objects));
+        switch (decoded->id) {
+            {% for command in cmd_records["command"] %}
+                {% set Suffix = command.name.CamelCase() %}
+                case WireCmd::{{Suffix}}:
+                    return Execute{{Suffix}}(std::get<{{Suffix}}Cmd>(decoded->cmd));
+            {% endfor %}
+            default:
+                return WireResult::FatalError;
+        }
+    }
+
     const volatile char* Server::HandleCommandsImpl(const volatile char* commands, size_t size) {
+        if (mCommandDecoder != nullptr) {
+            return HandleCommandsPipelined(commands, size);
+        }
+
         DeserializeBuffer deserializeBuffer(commands, size);
 
         while (deserializeBuffer.AvailableSize() >= sizeof(CmdHeader) + sizeof(WireCmd)) {
@@ -123,10 +165,8 @@ namespace dawn::wire::server {
         // After the server handles all the commands from the stream, we additionally run
         // ProcessEvents on all known Instances so that any work done on the server side can be
         // forwarded through to the client.
-        for (auto instance : InstanceObjects().GetAllHandles()) {
-            if (DoInstanceProcessEvents(instance) != WireResult::Success) {
-                return nullptr;
-            }
+        if (ProcessInstanceEvents() != WireResult::Success) {
+            return nullptr;
         }
 
         if (deserializeBuffer.AvailableSize() != 0) {
@@ -141,6 +141,12 @@ struct DAWN_NATIVE_EXPORT DawnInstanceDescriptor : wgpu::ChainedStruct {
     bool beginCaptureOnStartup = false;
     bool enableAdapterBlocklist = false;
 
+    // Built-in blob caches shared by all the devices of the instance, looked up before the
+    // device's cache callbacks. A budget of 0 disables the in-memory cache. The directory must
+    // exist and is used for a persistent, compressed cache. A nullptr directory disables it.
+    size_t blobCacheMemoryBudget = 0;
+    const char* blobCacheDirectory = nullptr;
+
     // Equality operators, mostly for testing. Note that this tests
     // strict pointer-pointer equality if the struct contains member pointers.
     bool operator==(const DawnInstanceDescriptor& rhs) const;
@@ -198,6 +204,28 @@ DAWN_NATIVE_EXPORT std::vector<const char*> GetTogglesUsed(WGPUDevice device);
 // Backdoor to get the number of lazy clears for testing
 DAWN_NATIVE_EXPORT size_t GetLazyClearCountForTesting(WGPUDevice device);
 
+// Backdoor to get the number of malloc/free calls made for the device's command blocks for testing
+DAWN_NATIVE_EXPORT uint64_t GetCommandBlockAllocatorCallCountForTesting(WGPUDevice device);
+
+// Counters of the built-in blob caches of an instance. See DawnInstanceDescriptor.
+struct DAWN_NATIVE_EXPORT BlobCacheStats {
+    uint64_t memoryHits = 0;
+    uint64_t memoryMisses = 0;
+    // The number of bytes of keys and values currently held in memory.
+    uint64_t memoryBytes = 0;
+
+    uint64_t diskHits = 0;
+    uint64_t diskMisses = 0;
+    // The number of bytes of values stored to disk, before and after compression.
+    uint64_t diskBytesStored = 0;
+    uint64_t diskBytesWritten = 0;
+};
+
+DAWN_NATIVE_EXPORT BlobCacheStats GetBlobCacheStats(WGPUInstance instance);
+
+// Writes the blobs that were stored in the instance's disk cache but not written yet.
+DAWN_NATIVE_EXPORT void FlushBlobCache(WGPUInstance instance);
+
 // Backdoor to get the number of deprecation warnings for testing
 DAWN_NATIVE_EXPORT size_t GetDeprecationWarningCountForTesting(WGPUDevice device);
 
@@ -45,6 +45,10 @@ struct DAWN_WIRE_EXPORT WireServerDescriptor {
     const DawnProcTable* procs;
     CommandSerializer* serializer;
     server::MemoryTransferService* memoryTransferService = nullptr;
+    // If true, HandleCommands deserializes commands on a separate thread while it executes the
+    // previously deserialized ones. Commands are still executed in order on the thread calling
+    // HandleCommands.
+    bool useCommandDecoderThread = false;
 };
 
 class DAWN_WIRE_EXPORT WireServer : public CommandHandler {
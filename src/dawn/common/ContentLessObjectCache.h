@@ -28,6 +28,7 @@
 #ifndef SRC_DAWN_COMMON_CONTENTLESSOBJECTCACHE_H_
 #define SRC_DAWN_COMMON_CONTENTLESSOBJECTCACHE_H_
 
+#include <array>
 #include <mutex>
 #include <tuple>
 #include <type_traits>
@@ -49,6 +50,9 @@ class ContentLessObjectCache;
 
 namespace detail {
 
+template <typename RefCountedT>
+struct ContentLessObjectCacheShard;
+
 // Tagged-type to force special path for EqualityFunc when dealing with Erase. When erasing, we only
 // care about pointer equality, not value equality. This is also particularly important because
 // trying to promote on the Erase path can cause failures as the object's last ref could've been
@@ -106,7 +110,7 @@ struct ContentLessObjectCacheKeyFuncs {
     };
 
     struct EqualityFunc {
-        explicit EqualityFunc(ContentLessObjectCache<RefCountedT>* cache) : mCache(cache) {}
+        explicit EqualityFunc(ContentLessObjectCacheShard<RefCountedT>* shard) : mShard(shard) {}
 
         bool operator()(const ContentLessObjectCacheKey<RefCountedT>& a,
                         const ContentLessObjectCacheKey<RefCountedT>& b) const {
@@ -158,18 +162,49 @@ struct ContentLessObjectCacheKeyFuncs {
             }
 
             if (aRef != nullptr) {
-                mCache->TrackTemporaryRef(std::move(aRef));
+                mShard->TrackTemporaryRef(std::move(aRef));
             }
             if (bRef != nullptr) {
-                mCache->TrackTemporaryRef(std::move(bRef));
+                mShard->TrackTemporaryRef(std::move(bRef));
             }
             return result;
         }
 
-        raw_ptr<ContentLessObjectCache<RefCountedT>> mCache = nullptr;
+        raw_ptr<ContentLessObjectCacheShard<RefCountedT>> mShard = nullptr;
     };
 };
 
+// A ContentLessObjectCache is split in shards, each with its own lock and set, so that threads
+// looking up objects with different hashes don't contend on the same lock.
+template <typename RefCountedT>
+struct ContentLessObjectCacheShard {
+    using CacheKeyFuncs = ContentLessObjectCacheKeyFuncs<RefCountedT>;
+
+    // Constructor needs to pass in 'this' to the EqualityFunc. Since the default bucket_count on
+    // sets is implementation defined, creating a temporary unused set to get the value. The actual
+    // type of the temporary does not matter.
+    ContentLessObjectCacheShard()
+        : cache(std::unordered_set<int>().bucket_count(),
+                typename CacheKeyFuncs::HashFunc(),
+                typename CacheKeyFuncs::EqualityFunc(this)) {}
+
+    void TrackTemporaryRef(Ref<RefCountedT> ref) { (*temporaryRefs)->push_back(std::move(ref)); }
+
+    std::mutex mutex;
+    std::unordered_set<ContentLessObjectCacheKey<RefCountedT>,
+                       typename CacheKeyFuncs::HashFunc,
+                       typename CacheKeyFuncs::EqualityFunc>
+        cache;
+
+    // The shard has a pointer to a StackVector of temporary Refs that are by-products of Promotes
+    // inside the EqualityFunc. These Refs need to outlive the EqualityFunc calls because otherwise,
+    // they could be the last living Ref of the object resulting in a re-entrant Erase call that
+    // deadlocks on the mutex. Since the default max_load_factor of most std::unordered_set
+    // implementations should be 1.0 (roughly 1 element per bucket), a StackVector of length 4
+    // should be enough space in most cases. See dawn:1993 for more details.
+    raw_ptr<StackVector<Ref<RefCountedT>, 4>> temporaryRefs = nullptr;
+};
+
 }  // namespace detail
 
 template <typename RefCountedT>
@@ -182,13 +217,7 @@ class ContentLessObjectCache {
     using CacheKeyFuncs = detail::ContentLessObjectCacheKeyFuncs<RefCountedT>;
 
   public:
-    // Constructor needs to pass in 'this' to the EqualityFunc. Since the default bucket_count on
-    // sets is implementation defined, creating a temporary unused set to get the value. The actual
-    // type of the temporary does not matter.
-    ContentLessObjectCache()
-        : mCache(std::unordered_set<int>().bucket_count(),
-                 typename CacheKeyFuncs::HashFunc(),
-                 typename CacheKeyFuncs::EqualityFunc(this)) {}
+    ContentLessObjectCache() = default;
 
     // The dtor asserts that the cache is empty to aid in finding pointer leaks that can be
     // possible if the RefCountedT doesn't correctly implement the DeleteThis function to Uncache.
@@ -198,10 +227,11 @@ class ContentLessObjectCache {
     // inserted or existing object, and the second is a bool that is true if we inserted
     // `object` and false otherwise.
     std::pair<Ref<RefCountedT>, bool> Insert(RefCountedT* obj) {
-        return WithLockAndCleanup([&]() -> std::pair<Ref<RefCountedT>, bool> {
-            detail::WeakRefAndHash<RefCountedT> weakref =
-                std::make_pair(GetWeakRef(obj), typename RefCountedT::HashFunc()(obj));
-            auto [it, inserted] = mCache.insert(weakref);
+        size_t hash = typename RefCountedT::HashFunc()(obj);
+        Shard& shard = GetShard(hash);
+        return WithLockAndCleanup(shard, [&]() -> std::pair<Ref<RefCountedT>, bool> {
+            detail::WeakRefAndHash<RefCountedT> weakref = std::make_pair(GetWeakRef(obj), hash);
+            auto [it, inserted] = shard.cache.insert(weakref);
             if (inserted) {
                 obj->mCache = this;
                 return {obj, inserted};
@@ -213,8 +243,8 @@ class ContentLessObjectCache {
                 if (ref != nullptr) {
                     return {ref, false};
                 } else {
-                    mCache.erase(it);
-                    auto result = mCache.insert(weakref);
+                    shard.cache.erase(it);
+                    auto result = shard.cache.insert(weakref);
                     DAWN_ASSERT(result.second);
                     obj->mCache = this;
                     return {obj, true};
@@ -225,9 +255,10 @@ class ContentLessObjectCache {
 
     // Returns a valid Ref<T> if we can Promote the underlying WeakRef. Returns nullptr otherwise.
     Ref<RefCountedT> Find(RefCountedT* blueprint) {
-        return WithLockAndCleanup([&]() -> Ref<RefCountedT> {
-            auto it = mCache.find(blueprint);
-            if (it != mCache.end()) {
+        Shard& shard = GetShard(typename RefCountedT::HashFunc()(blueprint));
+        return WithLockAndCleanup(shard, [&]() -> Ref<RefCountedT> {
+            auto it = shard.cache.find(blueprint);
+            if (it != shard.cache.end()) {
                 return std::get<detail::WeakRefAndHash<RefCountedT>>(*it).first.Promote();
             }
             return nullptr;
@@ -238,54 +269,57 @@ class ContentLessObjectCache {
     // modify the cache. Since Erase never Promotes any WeakRefs, it does not need to be wrapped by
     // a WithLockAndCleanup, and a simple lock is enough.
     void Erase(RefCountedT* obj) {
-        std::lock_guard<std::mutex> lock(mMutex);
-        auto it = mCache.find(detail::ForErase<RefCountedT>(obj));
-        if (it == mCache.end()) {
+        Shard& shard = GetShard(typename RefCountedT::HashFunc()(obj));
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.cache.find(detail::ForErase<RefCountedT>(obj));
+        if (it == shard.cache.end()) {
             return;
         }
         obj->mCache = nullptr;
-        mCache.erase(it);
+        shard.cache.erase(it);
     }
 
     // Returns true iff the cache is empty.
     bool Empty() {
-        std::lock_guard<std::mutex> lock(mMutex);
-        return mCache.empty();
+        for (Shard& shard : mShards) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            if (!shard.cache.empty()) {
+                return false;
+            }
+        }
+        return true;
     }
 
   private:
-    friend struct CacheKeyFuncs::EqualityFunc;
+    using Shard = detail::ContentLessObjectCacheShard<RefCountedT>;
+
+    // Objects are spread over the shards using their hash, which is immutable, so the shard of an
+    // object is the same when it is inserted, found and erased.
+    static constexpr size_t kShardCount = 8;
+
+    Shard& GetShard(size_t hash) {
+        // Mix in the upper bits because the sets inside each shard bucket objects with the lower
+        // bits.
+        return mShards[(hash ^ (hash >> 16)) % kShardCount];
+    }
 
-    void TrackTemporaryRef(Ref<RefCountedT> ref) { (*mTemporaryRefs)->push_back(std::move(ref)); }
     template <typename F>
-    auto WithLockAndCleanup(F func) {
+    auto WithLockAndCleanup(Shard& shard, F func) {
         using RetType = decltype(func());
         RetType result;
 
         // Creates and owns a temporary StackVector that we point to internally to track Refs.
         StackVector<Ref<RefCountedT>, 4> temps;
         {
-            std::lock_guard<std::mutex> lock(mMutex);
-            mTemporaryRefs = &temps;
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            shard.temporaryRefs = &temps;
             result = func();
-            mTemporaryRefs = nullptr;
+            shard.temporaryRefs = nullptr;
         }
         return result;
     }
 
-    std::mutex mMutex;
-    std::unordered_set<detail::ContentLessObjectCacheKey<RefCountedT>,
-                       typename CacheKeyFuncs::HashFunc,
-                       typename CacheKeyFuncs::EqualityFunc>
-        mCache;
-
-    // The cache has a pointer to a StackVector of temporary Refs that are by-products of Promotes
-    // inside the EqualityFunc. These Refs need to outlive the EqualityFunc calls because otherwise,
-    // they could be the last living Ref of the object resulting in a re-entrant Erase call that
-    // deadlocks on the mutex. Since the default max_load_factor of most std::unordered_set
-    // implementations should be 1.0 (roughly 1 element per bucket), a StackVector of length 4
-    // should be enough space in most cases. See dawn:1993 for more details.
-    raw_ptr<StackVector<Ref<RefCountedT>, 4>> mTemporaryRefs = nullptr;
+    std::array<Shard, kShardCount> mShards;
 };
 
 }  // namespace dawn
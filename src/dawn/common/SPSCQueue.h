@@ -0,0 +1,134 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_DAWN_COMMON_SPSCQUEUE_H_
+#define SRC_DAWN_COMMON_SPSCQUEUE_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "dawn/common/Assert.h"
+#include "dawn/common/Math.h"
+#include "dawn/common/NonCopyable.h"
+
+namespace dawn {
+
+// SPSCQueue is a bounded queue between exactly one producer thread and one consumer thread.
+// Its elements are allocated once and reused: the producer fills the element returned by
+// BeginPush() in place and publishes it with EndPush(), and the consumer reads Front() in place
+// and gives it back with Pop(). This lets elements keep expensive state, such as allocators,
+// from one use to the next.
+// Both sides spin for a short while before blocking on a condition variable so that handing
+// elements between two busy threads doesn't need a syscall.
+template <typename T>
+class SPSCQueue : NonMovable {
+  public:
+    // |capacity| must be a power of two.
+    explicit SPSCQueue(size_t capacity) : mStorage(capacity) {
+        DAWN_ASSERT(IsPowerOfTwo(capacity));
+    }
+
+    // Producer side. Returns the element to fill, blocking while the queue is full.
+    T* BeginPush() {
+        uint64_t tail = mTail.load(std::memory_order_relaxed);
+        Wait(&mProducerWaiting, [&] { return tail - mHead.load() < mStorage.size(); });
+        return &mStorage[tail & (mStorage.size() - 1)];
+    }
+
+    // Producer side. Makes the element returned by BeginPush() visible to the consumer.
+    void EndPush() {
+        mTail.store(mTail.load(std::memory_order_relaxed) + 1);
+        Wake(&mConsumerWaiting);
+    }
+
+    // Producer side. Blocks until the consumer popped every element.
+    void WaitUntilEmpty() {
+        uint64_t tail = mTail.load(std::memory_order_relaxed);
+        Wait(&mProducerWaiting, [&] { return mHead.load() == tail; });
+    }
+
+    // Consumer side. Returns the oldest element, blocking while the queue is empty.
+    T* Front() {
+        uint64_t head = mHead.load(std::memory_order_relaxed);
+        Wait(&mConsumerWaiting, [&] { return mTail.load() != head; });
+        return &mStorage[head & (mStorage.size() - 1)];
+    }
+
+    // Consumer side. Gives the element returned by Front() back to the producer.
+    void Pop() {
+        mHead.store(mHead.load(std::memory_order_relaxed) + 1);
+        Wake(&mProducerWaiting);
+    }
+
+    size_t GetCapacity() const { return mStorage.size(); }
+
+  private:
+    static constexpr uint32_t kSpinCount = 256;
+
+    // The waiting flags and the head and tail use sequentially consistent operations so that
+    // either the waiter sees the update of the other side, or the other side sees the flag and
+    // notifies the condition variable.
+    template <typename Predicate>
+    void Wait(std::atomic<bool>* waiting, Predicate isReady) {
+        for (uint32_t i = 0; i < kSpinCount; ++i) {
+            if (isReady()) {
+                return;
+            }
+        }
+
+        std::unique_lock<std::mutex> lock(mMutex);
+        waiting->store(true);
+        mCondition.wait(lock, isReady);
+        waiting->store(false);
+    }
+
+    void Wake(std::atomic<bool>* waiting) {
+        if (waiting->load()) {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mCondition.notify_all();
+        }
+    }
+
+    std::vector<T> mStorage;
+
+    // The head is only written by the consumer and the tail only by the producer. They are
+    // monotonically increasing indices, the element index is their value modulo the capacity.
+    alignas(64) std::atomic<uint64_t> mHead = 0;
+    alignas(64) std::atomic<uint64_t> mTail = 0;
+
+    std::atomic<bool> mProducerWaiting = false;
+    std::atomic<bool> mConsumerWaiting = false;
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+};
+
+}  // namespace dawn
+
+#endif  // SRC_DAWN_COMMON_SPSCQUEUE_H_
@@ -27,6 +27,10 @@
 
 #include "dawn/native/BindGroup.h"
 
+#include <algorithm>
+#include <functional>
+#include <tuple>
+
 #include "dawn/common/Assert.h"
 #include "dawn/common/MatchVariant.h"
 #include "dawn/common/Math.h"
@@ -295,6 +299,28 @@ void ForEachUnverifiedBufferBindingIndexImpl(const BindGroupLayoutInternalBase*
     }
 }
 
+// Sorts the |count| usages with |less| and merges the usages that compare equal, returning the
+// number of usages left.
+template <typename Usage, typename Less>
+uint32_t SortAndMergeUsages(Usage* usages, uint32_t count, Less less) {
+    if (count == 0) {
+        return 0;
+    }
+    std::sort(usages, usages + count, less);
+
+    uint32_t mergedCount = 1;
+    for (uint32_t i = 1; i < count; ++i) {
+        Usage& previous = usages[mergedCount - 1];
+        if (!less(previous, usages[i])) {
+            previous.usage |= usages[i].usage;
+            previous.shaderStages |= usages[i].shaderStages;
+        } else {
+            usages[mergedCount++] = usages[i];
+        }
+    }
+    return mergedCount;
+}
+
 }  // anonymous namespace
 
 MaybeError ValidateBindGroupDescriptor(DeviceBase* device,
@@ -494,6 +520,8 @@ BindGroupBase::BindGroupBase(DeviceBase* device,
                                                     mBindingData.bufferData[bindingIndex].size;
                                             });
 
+    ComputeResourceUsage();
+
     GetObjectTrackingList()->Track(this);
 }
 
@@ -505,6 +533,7 @@ void BindGroupBase::DestroyImpl() {
         for (BindingIndex i{0}; i < GetLayout()->GetBindingCount(); ++i) {
             mBindingData.bindings[i].~Ref<ObjectBase>();
         }
+        mResourceUsage = {};
     }
 }
 
@@ -516,6 +545,105 @@ void BindGroupBase::DeleteThis() {
     ApiObjectBase::DeleteThis();
 }
 
+void BindGroupBase::ComputeResourceUsage() {
+    // One usage is recorded per binding in the storage allocated after the bindings, then the
+    // usages of the same buffer or texture subresource range are sorted next to each other and
+    // merged.
+    uint32_t bufferCount = 0;
+    uint32_t textureCount = 0;
+    auto AddBufferUsage = [&](BufferBase* buffer, wgpu::BufferUsage usage,
+                              wgpu::ShaderStage shaderStages) {
+        mBindingData.bufferUsages[bufferCount++] = {buffer, usage, shaderStages};
+    };
+    auto AddTextureViewUsage = [&](TextureViewBase* view, wgpu::TextureUsage usage,
+                                   wgpu::ShaderStage shaderStages) {
+        mBindingData.textureUsages[textureCount++] = {view->GetTexture(),
+                                                      view->GetSubresourceRange(), usage,
+                                                      shaderStages};
+    };
+
+    const BindGroupLayoutInternalBase* layout = GetLayout();
+    for (BindingIndex bindingIndex{0}; bindingIndex < layout->GetBindingCount(); ++bindingIndex) {
+        const BindingInfo& bindingInfo = layout->GetBindingInfo(bindingIndex);
+
+        MatchVariant(
+            bindingInfo.bindingLayout,
+            [&](const BufferBindingLayout& bufferLayout) {
+                BufferBase* buffer = GetBindingAsBufferBinding(bindingIndex).buffer;
+                switch (bufferLayout.type) {
+                    case wgpu::BufferBindingType::Uniform:
+                        AddBufferUsage(buffer, wgpu::BufferUsage::Uniform, bindingInfo.visibility);
+                        break;
+                    case wgpu::BufferBindingType::Storage:
+                        AddBufferUsage(buffer, wgpu::BufferUsage::Storage, bindingInfo.visibility);
+                        break;
+                    case kInternalStorageBufferBinding:
+                        AddBufferUsage(buffer, kInternalStorageBuffer, bindingInfo.visibility);
+                        break;
+                    case wgpu::BufferBindingType::ReadOnlyStorage:
+                        AddBufferUsage(buffer, kReadOnlyStorageBuffer, bindingInfo.visibility);
+                        break;
+                    case wgpu::BufferBindingType::Undefined:
+                        DAWN_UNREACHABLE();
+                }
+            },
+            [&](const TextureBindingLayout& textureLayout) {
+                TextureViewBase* view = GetBindingAsTextureView(bindingIndex);
+                switch (textureLayout.sampleType) {
+                    case kInternalResolveAttachmentSampleType:
+                        AddTextureViewUsage(view, kResolveAttachmentLoadingUsage,
+                                            bindingInfo.visibility);
+                        break;
+                    default:
+                        AddTextureViewUsage(view, wgpu::TextureUsage::TextureBinding,
+                                            bindingInfo.visibility);
+                        break;
+                }
+            },
+            [&](const StorageTextureBindingLayout& storageTextureLayout) {
+                TextureViewBase* view = GetBindingAsTextureView(bindingIndex);
+                switch (storageTextureLayout.access) {
+                    case wgpu::StorageTextureAccess::WriteOnly:
+                        AddTextureViewUsage(view, kWriteOnlyStorageTexture,
+                                            bindingInfo.visibility);
+                        break;
+                    case wgpu::StorageTextureAccess::ReadWrite:
+                        AddTextureViewUsage(view, wgpu::TextureUsage::StorageBinding,
+                                            bindingInfo.visibility);
+                        break;
+                    case wgpu::StorageTextureAccess::ReadOnly:
+                        AddTextureViewUsage(view, kReadOnlyStorageTexture, bindingInfo.visibility);
+                        break;
+                    case wgpu::StorageTextureAccess::Undefined:
+                        DAWN_UNREACHABLE();
+                }
+            },
+            [](const SamplerBindingLayout&) {});
+    }
+
+    bufferCount = SortAndMergeUsages(
+        mBindingData.bufferUsages.data(), bufferCount,
+        [](const BindGroupResourceUsage::BufferUsage& a,
+           const BindGroupResourceUsage::BufferUsage& b) {
+            return std::less<BufferBase*>()(a.buffer, b.buffer);
+        });
+    textureCount = SortAndMergeUsages(
+        mBindingData.textureUsages.data(), textureCount,
+        [](const BindGroupResourceUsage::TextureUsage& a,
+           const BindGroupResourceUsage::TextureUsage& b) {
+            if (a.texture != b.texture) {
+                return std::less<TextureBase*>()(a.texture, b.texture);
+            }
+            return std::tie(a.range.aspects, a.range.baseArrayLayer, a.range.layerCount,
+                            a.range.baseMipLevel, a.range.levelCount) <
+                   std::tie(b.range.aspects, b.range.baseArrayLayer, b.range.layerCount,
+                            b.range.baseMipLevel, b.range.levelCount);
+        });
+
+    mResourceUsage = {{mBindingData.bufferUsages.data(), bufferCount},
+                      {mBindingData.textureUsages.data(), textureCount}};
+}
+
 BindGroupBase::BindGroupBase(DeviceBase* device, ObjectBase::ErrorTag tag, const char* label)
     : ApiObjectBase(device, tag, label), mBindingData() {}
 
@@ -588,6 +716,15 @@ const std::vector<Ref<ExternalTextureBase>>& BindGroupBase::GetBoundExternalText
     return mBoundExternalTextures;
 }
 
+const BindGroupResourceUsage& BindGroupBase::GetResourceUsage() const {
+    DAWN_ASSERT(!IsError());
+    return mResourceUsage;
+}
+
+SyncScopeUsageStamp& BindGroupBase::GetSyncScopeUsageStamp() {
+    return mSyncScopeUsageStamp;
+}
+
 void BindGroupBase::ForEachUnverifiedBufferBindingIndex(
     std::function<void(BindingIndex, uint32_t)> fn) const {
     ForEachUnverifiedBufferBindingIndexImpl(GetLayout(), fn);
@@ -708,12 +708,23 @@ size_t BindGroupLayoutInternalBase::GetBindingDataSize() const {
     // Followed by:
     // |---------buffer size array--------|
     // |-uint64_t[mUnverifiedBufferCount]-|
+    // Followed by the storage for the BindGroupResourceUsage:
+    // | --------- buffer usages ---------| -------------- texture usages --------------|
+    // | ---- BufferUsage[bufferCount] ---| - TextureUsage[totalCount - bufferCount] ---|
     size_t objectPointerStart = mBindingCounts.bufferCount * sizeof(BufferBindingData);
     DAWN_ASSERT(IsAligned(objectPointerStart, alignof(Ref<ObjectBase>)));
     size_t bufferSizeArrayStart = Align(
         objectPointerStart + mBindingCounts.totalCount * sizeof(Ref<ObjectBase>), sizeof(uint64_t));
     DAWN_ASSERT(IsAligned(bufferSizeArrayStart, alignof(uint64_t)));
-    return bufferSizeArrayStart + mBindingCounts.unverifiedBufferCount * sizeof(uint64_t);
+    size_t bufferUsageStart =
+        Align(bufferSizeArrayStart + mBindingCounts.unverifiedBufferCount * sizeof(uint64_t),
+              alignof(BindGroupResourceUsage::BufferUsage));
+    size_t textureUsageStart =
+        Align(bufferUsageStart +
+                  mBindingCounts.bufferCount * sizeof(BindGroupResourceUsage::BufferUsage),
+              alignof(BindGroupResourceUsage::TextureUsage));
+    return textureUsageStart + (mBindingCounts.totalCount - mBindingCounts.bufferCount) *
+                                   sizeof(BindGroupResourceUsage::TextureUsage);
 }
 
 BindGroupLayoutInternalBase::BindingDataPointers
@@ -722,6 +733,12 @@ BindGroupLayoutInternalBase::ComputeBindingDataPointers(void* dataStart) const {
     auto bindings = reinterpret_cast<Ref<ObjectBase>*>(bufferData + mBindingCounts.bufferCount);
     uint64_t* unverifiedBufferSizes = AlignPtr(
         reinterpret_cast<uint64_t*>(bindings + mBindingCounts.totalCount), sizeof(uint64_t));
+    auto bufferUsages = AlignPtr(reinterpret_cast<BindGroupResourceUsage::BufferUsage*>(
+                                     unverifiedBufferSizes + mBindingCounts.unverifiedBufferCount),
+                                 alignof(BindGroupResourceUsage::BufferUsage));
+    auto textureUsages = AlignPtr(reinterpret_cast<BindGroupResourceUsage::TextureUsage*>(
+                                      bufferUsages + mBindingCounts.bufferCount),
+                                  alignof(BindGroupResourceUsage::TextureUsage));
 
     DAWN_ASSERT(IsPtrAligned(bufferData, alignof(BufferBindingData)));
     DAWN_ASSERT(IsPtrAligned(bindings, alignof(Ref<ObjectBase>)));
@@ -729,7 +746,9 @@ BindGroupLayoutInternalBase::ComputeBindingDataPointers(void* dataStart) const {
 
     return {{bufferData, GetBufferCount()},
             {bindings, GetBindingCount()},
-            {unverifiedBufferSizes, mBindingCounts.unverifiedBufferCount}};
+            {unverifiedBufferSizes, mBindingCounts.unverifiedBufferCount},
+            {bufferUsages, mBindingCounts.bufferCount},
+            {textureUsages, mBindingCounts.totalCount - mBindingCounts.bufferCount}};
 }
 
 bool BindGroupLayoutInternalBase::IsStorageBufferBinding(BindingIndex bindingIndex) const {
@@ -43,6 +43,7 @@
 #include "dawn/native/Error.h"
 #include "dawn/native/Forward.h"
 #include "dawn/native/ObjectBase.h"
+#include "dawn/native/PassResourceUsage.h"
 
 #include "dawn/native/dawn_platform.h"
 
@@ -121,6 +122,10 @@ class BindGroupLayoutInternalBase : public ApiObjectBase,
         ityp::span<BindingIndex, BufferBindingData> const bufferData = {};
         ityp::span<BindingIndex, Ref<ObjectBase>> const bindings = {};
         ityp::span<uint32_t, uint64_t> const unverifiedBufferSizes = {};
+        // Storage for the BindGroupResourceUsage of the bind group, with room for one usage per
+        // binding before bindings of the same resource are merged.
+        ityp::span<uint32_t, BindGroupResourceUsage::BufferUsage> bufferUsages = {};
+        ityp::span<uint32_t, BindGroupResourceUsage::TextureUsage> textureUsages = {};
     };
 
     // Compute the amount of space / alignment required to store bindings for a bind group of
@@ -128,6 +133,8 @@ class BindGroupLayoutInternalBase : public ApiObjectBase,
     size_t GetBindingDataSize() const;
     static constexpr size_t GetBindingDataAlignment() {
         static_assert(alignof(Ref<ObjectBase>) <= alignof(BufferBindingData));
+        static_assert(alignof(BindGroupResourceUsage::BufferUsage) <= alignof(BufferBindingData));
+        static_assert(alignof(BindGroupResourceUsage::TextureUsage) <= alignof(BufferBindingData));
         return alignof(BufferBindingData);
     }
 
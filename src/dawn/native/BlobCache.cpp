@@ -28,28 +28,71 @@
 #include "dawn/native/BlobCache.h"
 
 #include <algorithm>
+#include <string_view>
 
 #include "dawn/common/Assert.h"
 #include "dawn/common/Version_autogen.h"
 #include "dawn/native/CacheKey.h"
+#include "dawn/native/DiskBlobCache.h"
 #include "dawn/native/Instance.h"
+#include "dawn/native/MemoryBlobCache.h"
 #include "dawn/platform/DawnPlatform.h"
 
 namespace dawn::native {
 
-BlobCache::BlobCache(const dawn::native::DawnCacheDeviceDescriptor& desc)
-    : mLoadFunction(desc.loadDataFunction),
+namespace {
+
+std::string_view AsStringView(const CacheKey& key) {
+    return std::string_view(reinterpret_cast<const char*>(key.data()), key.size());
+}
+
+}  // anonymous namespace
+
+BlobCache::BlobCache(const dawn::native::DawnCacheDeviceDescriptor& desc,
+                     MemoryBlobCache* memoryCache,
+                     DiskBlobCache* diskCache)
+    : mMemoryCache(memoryCache),
+      mDiskCache(diskCache),
+      mLoadFunction(desc.loadDataFunction),
       mStoreFunction(desc.storeDataFunction),
       mFunctionUserdata(desc.functionUserdata) {}
 
 Blob BlobCache::Load(const CacheKey& key) {
-    std::lock_guard<std::mutex> lock(mMutex);
-    return LoadInternal(key);
+    DAWN_ASSERT(ValidateCacheKey(key));
+
+    if (mMemoryCache != nullptr) {
+        Blob result = mMemoryCache->Load(AsStringView(key));
+        if (!result.Empty()) {
+            return result;
+        }
+    }
+    if (mDiskCache != nullptr) {
+        Blob result = mDiskCache->Load(AsStringView(key));
+        if (!result.Empty()) {
+            if (mMemoryCache != nullptr) {
+                mMemoryCache->Store(AsStringView(key), result.Size(), result.Data());
+            }
+            return result;
+        }
+    }
+
+    Blob result;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        result = LoadInternal(key);
+    }
+    if (!result.Empty()) {
+        StoreInBuiltinCaches(key, result.Size(), result.Data());
+    }
+    return result;
 }
 
 void BlobCache::Store(const CacheKey& key, size_t valueSize, const void* value) {
-    std::lock_guard<std::mutex> lock(mMutex);
-    StoreInternal(key, valueSize, value);
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        StoreInternal(key, valueSize, value);
+    }
+    StoreInBuiltinCaches(key, valueSize, value);
 }
 
 void BlobCache::Store(const CacheKey& key, const Blob& value) {
@@ -84,6 +127,15 @@ void BlobCache::StoreInternal(const CacheKey& key, size_t valueSize, const void*
     mStoreFunction(key.data(), key.size(), value, valueSize, mFunctionUserdata);
 }
 
+void BlobCache::StoreInBuiltinCaches(const CacheKey& key, size_t valueSize, const void* value) {
+    if (mMemoryCache != nullptr) {
+        mMemoryCache->Store(AsStringView(key), valueSize, value);
+    }
+    if (mDiskCache != nullptr) {
+        mDiskCache->Store(AsStringView(key), valueSize, value);
+    }
+}
+
 bool BlobCache::ValidateCacheKey(const CacheKey& key) {
     return std::search(key.begin(), key.end(), kDawnVersion.begin(), kDawnVersion.end()) !=
            key.end();
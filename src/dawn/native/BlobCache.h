@@ -33,6 +33,7 @@
 #include "dawn/common/Platform.h"
 #include "dawn/native/Blob.h"
 #include "dawn/native/CacheResult.h"
+#include "partition_alloc/pointers/raw_ptr.h"
 #include "partition_alloc/pointers/raw_ptr_exclusion.h"
 
 namespace dawn::platform {
@@ -42,12 +43,19 @@ class CachingInterface;
 namespace dawn::native {
 
 class CacheKey;
+class DiskBlobCache;
 class InstanceBase;
+class MemoryBlobCache;
 
 // This class should always be thread-safe because it may be called asynchronously.
+// Blobs are looked up in the instance's built-in memory and disk caches first, when they are
+// enabled, and then with the embedder's load function. Blobs found or stored through the embedder
+// functions are also added to the built-in caches.
 class BlobCache {
   public:
-    explicit BlobCache(const dawn::native::DawnCacheDeviceDescriptor& desc);
+    explicit BlobCache(const dawn::native::DawnCacheDeviceDescriptor& desc,
+                       MemoryBlobCache* memoryCache = nullptr,
+                       DiskBlobCache* diskCache = nullptr);
 
     // Returns empty blob if the key is not found in the cache.
     Blob Load(const CacheKey& key);
@@ -70,12 +78,17 @@ class BlobCache {
     // these helpers need to make sure that these are entered with `mMutex` held.
     Blob LoadInternal(const CacheKey& key);
     void StoreInternal(const CacheKey& key, size_t valueSize, const void* value);
+    // Thread-safe, the built-in caches do their own locking.
+    void StoreInBuiltinCaches(const CacheKey& key, size_t valueSize, const void* value);
 
     // Validates the cache key for this version of Dawn. At the moment, this is naively checking
     // that the cache key contains the dawn version string in it.
     bool ValidateCacheKey(const CacheKey& key);
 
-    // Protects thread safety of access to mCache.
+    raw_ptr<MemoryBlobCache> mMemoryCache;
+    raw_ptr<DiskBlobCache> mDiskCache;
+
+    // Serializes the calls to the embedder functions which may not be thread-safe.
     std::mutex mMutex;
     // TODO(https://crbug.com/dawn/2365): Convert these members to `raw_ptr`.
     RAW_PTR_EXCLUSION WGPUDawnLoadCacheDataFunction mLoadFunction;
@@ -0,0 +1,204 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dawn/native/BlobCompression.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#include "dawn/common/Assert.h"
+
+namespace dawn::native {
+
+namespace {
+
+constexpr size_t kMinMatchLength = 4;
+constexpr size_t kMaxMatchOffset = 0xFFFF;
+constexpr uint32_t kHashBits = 12;
+constexpr uint32_t kLengthNibbleMax = 0xF;
+
+uint32_t Read32(const uint8_t* ptr) {
+    uint32_t value;
+    memcpy(&value, ptr, sizeof(value));
+    return value;
+}
+
+uint32_t HashSequence(uint32_t sequence) {
+    return (sequence * 2654435761u) >> (32 - kHashBits);
+}
+
+// Writes the remainder of a length that didn't fit in its token nibble.
+void WriteLengthExtension(std::vector<uint8_t>* out, size_t length) {
+    DAWN_ASSERT(length >= kLengthNibbleMax);
+    length -= kLengthNibbleMax;
+    while (length >= 0xFF) {
+        out->push_back(0xFF);
+        length -= 0xFF;
+    }
+    out->push_back(static_cast<uint8_t>(length));
+}
+
+bool ReadLengthExtension(const uint8_t** ptr, const uint8_t* end, size_t* length) {
+    uint8_t byte;
+    do {
+        if (*ptr == end) {
+            return false;
+        }
+        byte = *(*ptr)++;
+        *length += byte;
+    } while (byte == 0xFF);
+    return true;
+}
+
+// Emits the literals in [literals, literals + literalLength) followed by a match of
+// |matchLength| bytes at |offset| bytes back. A |matchLength| of 0 marks the last sequence, which
+// only contains literals.
+void EmitSequence(std::vector<uint8_t>* out,
+                  const uint8_t* literals,
+                  size_t literalLength,
+                  size_t offset,
+                  size_t matchLength) {
+    size_t matchCode = matchLength == 0 ? 0 : matchLength - kMinMatchLength;
+    uint8_t token = static_cast<uint8_t>(std::min<size_t>(literalLength, kLengthNibbleMax) << 4 |
+                                         std::min<size_t>(matchCode, kLengthNibbleMax));
+    out->push_back(token);
+    if (literalLength >= kLengthNibbleMax) {
+        WriteLengthExtension(out, literalLength);
+    }
+    out->insert(out->end(), literals, literals + literalLength);
+
+    if (matchLength == 0) {
+        return;
+    }
+    out->push_back(static_cast<uint8_t>(offset & 0xFF));
+    out->push_back(static_cast<uint8_t>(offset >> 8));
+    if (matchCode >= kLengthNibbleMax) {
+        WriteLengthExtension(out, matchCode);
+    }
+}
+
+}  // anonymous namespace
+
+std::vector<uint8_t> CompressBlobData(const uint8_t* data, size_t size) {
+    std::vector<uint8_t> out;
+    out.reserve(size / 2 + 16);
+
+    // Positions of the last occurrence of each hashed 4-byte sequence, offset by one so that 0
+    // means that the sequence wasn't seen yet.
+    std::array<size_t, size_t(1) << kHashBits> lastPositions = {};
+
+    size_t anchor = 0;
+    size_t position = 0;
+    while (position + kMinMatchLength <= size) {
+        uint32_t sequence = Read32(data + position);
+        size_t& lastPosition = lastPositions[HashSequence(sequence)];
+        size_t candidate = lastPosition;
+        lastPosition = position + 1;
+
+        if (candidate == 0 || position - (candidate - 1) > kMaxMatchOffset ||
+            Read32(data + candidate - 1) != sequence) {
+            position++;
+            continue;
+        }
+        candidate--;
+
+        size_t matchLength = kMinMatchLength;
+        while (position + matchLength < size &&
+               data[candidate + matchLength] == data[position + matchLength]) {
+            matchLength++;
+        }
+
+        EmitSequence(&out, data + anchor, position - anchor, position - candidate, matchLength);
+        position += matchLength;
+        anchor = position;
+    }
+
+    if (anchor < size) {
+        EmitSequence(&out, data + anchor, size - anchor, 0, 0);
+    }
+    return out;
+}
+
+bool DecompressBlobData(const uint8_t* data,
+                        size_t size,
+                        uint8_t* out,
+                        size_t decompressedSize) {
+    const uint8_t* ptr = data;
+    const uint8_t* end = data + size;
+    size_t outPosition = 0;
+
+    while (ptr < end) {
+        uint8_t token = *ptr++;
+
+        size_t literalLength = token >> 4;
+        if (literalLength == kLengthNibbleMax && !ReadLengthExtension(&ptr, end, &literalLength)) {
+            return false;
+        }
+        if (literalLength > static_cast<size_t>(end - ptr) ||
+            literalLength > decompressedSize - outPosition) {
+            return false;
+        }
+        memcpy(out + outPosition, ptr, literalLength);
+        ptr += literalLength;
+        outPosition += literalLength;
+
+        // The last sequence only contains literals.
+        if (ptr == end) {
+            break;
+        }
+
+        if (end - ptr < 2) {
+            return false;
+        }
+        size_t offset = ptr[0] | (size_t(ptr[1]) << 8);
+        ptr += 2;
+        if (offset == 0 || offset > outPosition) {
+            return false;
+        }
+
+        size_t matchLength = token & kLengthNibbleMax;
+        if (matchLength == kLengthNibbleMax && !ReadLengthExtension(&ptr, end, &matchLength)) {
+            return false;
+        }
+        matchLength += kMinMatchLength;
+        if (matchLength > decompressedSize - outPosition) {
+            return false;
+        }
+
+        // The match may overlap the bytes being written, so copy byte by byte.
+        const uint8_t* matchPtr = out + outPosition - offset;
+        for (size_t i = 0; i < matchLength; i++) {
+            out[outPosition + i] = matchPtr[i];
+        }
+        outPosition += matchLength;
+    }
+
+    return outPosition == decompressedSize;
+}
+
+}  // namespace dawn::native
@@ -0,0 +1,56 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_DAWN_NATIVE_BLOBCOMPRESSION_H_
+#define SRC_DAWN_NATIVE_BLOBCOMPRESSION_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace dawn::native {
+
+// A small and fast LZ77 compressor for cached blobs, using a block format in the spirit of LZ4:
+// the output is a sequence of [token, literal length, literals, match offset, match length]
+// where the token packs the short literal and match lengths in two nibbles. Compression favors
+// speed over ratio since it runs on the thread storing to the cache. It works well on shader
+// binaries and pipeline caches which contain a lot of repeated instruction patterns.
+
+// Returns the compressed representation of |data|. The result may be larger than |size| if the
+// data is not compressible.
+std::vector<uint8_t> CompressBlobData(const uint8_t* data, size_t size);
+
+// Decompresses |data| into exactly |decompressedSize| bytes at |out|. Returns false if the
+// compressed data is malformed or doesn't decompress to |decompressedSize| bytes.
+bool DecompressBlobData(const uint8_t* data,
+                        size_t size,
+                        uint8_t* out,
+                        size_t decompressedSize);
+
+}  // namespace dawn::native
+
+#endif  // SRC_DAWN_NATIVE_BLOBCOMPRESSION_H_
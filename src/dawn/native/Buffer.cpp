@@ -863,6 +863,10 @@ void BufferBase::MarkUsedInPendingCommands() {
     mLastUsageSerial = serial;
 }
 
+SyncScopeUsageStamp& BufferBase::GetSyncScopeUsageStamp() {
+    return mSyncScopeUsageStamp;
+}
+
 bool BufferBase::IsFullBufferRange(uint64_t offset, uint64_t size) const {
     return offset == 0 && size == GetSize();
 }
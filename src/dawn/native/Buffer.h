@@ -38,6 +38,7 @@
 #include "dawn/native/Forward.h"
 #include "dawn/native/IntegerTypes.h"
 #include "dawn/native/ObjectBase.h"
+#include "dawn/native/PassResourceUsage.h"
 #include "dawn/native/UsageValidationMode.h"
 
 #include "dawn/native/dawn_platform.h"
@@ -101,6 +102,8 @@ class BufferBase : public ApiObjectBase {
     void SetIsDataInitialized();
     void MarkUsedInPendingCommands();
 
+    SyncScopeUsageStamp& GetSyncScopeUsageStamp();
+
     virtual void* GetMappedPointer() = 0;
     void* GetMappedRange(size_t offset, size_t size, bool writable = true);
     MaybeError Unmap();
@@ -169,6 +172,8 @@ class BufferBase : public ApiObjectBase {
     // i.e. buffer->mStagingBuffer->mStagingBuffer... is not possible.
     Ref<BufferBase> mStagingBuffer;
 
+    SyncScopeUsageStamp mSyncScopeUsageStamp;
+
     WGPUBufferMapCallback mMapCallback = nullptr;
     // TODO(https://crbug.com/dawn/2349): Investigate DanglingUntriaged in dawn/native.
     raw_ptr<void, DanglingUntriaged> mMapUserdata = nullptr;
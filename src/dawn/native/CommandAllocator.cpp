@@ -37,6 +37,141 @@
 
 namespace dawn::native {
 
+namespace {
+
+uint8_t* AllocateBlock(CommandBlockPool* pool, size_t size) {
+    if (pool != nullptr) {
+        return pool->Allocate(size);
+    }
+    return static_cast<uint8_t*>(malloc(size));
+}
+
+void FreeBlocks(CommandBlockPool* pool, CommandBlocks* blocks) {
+    for (BlockDef& block : *blocks) {
+        if (pool != nullptr) {
+            pool->Deallocate(block.block, block.size);
+        } else {
+            free(block.block);
+        }
+    }
+    blocks->clear();
+}
+
+// Returns the index of the size class for blocks of |size| bytes, or kSizeClassCount if blocks
+// of that size are not pooled.
+template <size_t kSizeClassCount>
+size_t GetSizeClassIndex(size_t size) {
+    if (size < detail::kMinCommandBlockSize || size > detail::kMaxCommandBlockSize ||
+        !IsPowerOfTwo(size)) {
+        return kSizeClassCount;
+    }
+    return Log2(uint64_t(size)) - ConstexprLog2(detail::kMinCommandBlockSize);
+}
+
+}  // anonymous namespace
+
+// CommandBlockPool
+
+CommandBlockPool::CommandBlockPool() = default;
+
+CommandBlockPool::~CommandBlockPool() {
+    mSizeClasses.Use([&](auto sizeClasses) {
+        for (SizeClass& sizeClass : *sizeClasses) {
+            for (uint8_t* block : sizeClass.freeBlocks) {
+                free(block);
+            }
+            sizeClass.freeBlocks.clear();
+        }
+    });
+}
+
+uint8_t* CommandBlockPool::Allocate(size_t size) {
+    size_t index = GetSizeClassIndex<kSizeClassCount>(size);
+    if (index < kSizeClassCount) {
+        uint8_t* block = mSizeClasses.Use([&](auto sizeClasses) -> uint8_t* {
+            SizeClass& sizeClass = (*sizeClasses)[index];
+            sizeClass.blocksInUse++;
+            sizeClass.highWaterBlocksInUse =
+                std::max(sizeClass.highWaterBlocksInUse, sizeClass.blocksInUse);
+            if (sizeClass.freeBlocks.empty()) {
+                return nullptr;
+            }
+            uint8_t* cached = sizeClass.freeBlocks.back();
+            sizeClass.freeBlocks.pop_back();
+            return cached;
+        });
+        if (block != nullptr) {
+            return block;
+        }
+    }
+
+    mSystemAllocatorCallCount++;
+    uint8_t* block = static_cast<uint8_t*>(malloc(size));
+    if (DAWN_UNLIKELY(block == nullptr) && index < kSizeClassCount) {
+        mSizeClasses.Use([&](auto sizeClasses) { (*sizeClasses)[index].blocksInUse--; });
+    }
+    return block;
+}
+
+void CommandBlockPool::Deallocate(uint8_t* block, size_t size) {
+    size_t index = GetSizeClassIndex<kSizeClassCount>(size);
+    if (index < kSizeClassCount) {
+        bool cached = mSizeClasses.Use([&](auto sizeClasses) {
+            SizeClass& sizeClass = (*sizeClasses)[index];
+            DAWN_ASSERT(sizeClass.blocksInUse > 0);
+            sizeClass.blocksInUse--;
+            if (sizeClass.freeBlocks.size() >= kMaxCachedBlocksPerSizeClass) {
+                return false;
+            }
+            sizeClass.freeBlocks.push_back(block);
+            return true;
+        });
+        if (cached) {
+            return;
+        }
+    }
+
+    mSystemAllocatorCallCount++;
+    free(block);
+}
+
+void CommandBlockPool::Trim() {
+    std::vector<uint8_t*> blocksToFree;
+    mSizeClasses.Use([&](auto sizeClasses) {
+        for (SizeClass& sizeClass : *sizeClasses) {
+            // Keep enough blocks to serve the peak usage seen during the last period again
+            // without calling malloc.
+            DAWN_ASSERT(sizeClass.highWaterBlocksInUse >= sizeClass.blocksInUse);
+            size_t blocksToKeep = sizeClass.highWaterBlocksInUse - sizeClass.blocksInUse;
+            while (sizeClass.freeBlocks.size() > blocksToKeep) {
+                blocksToFree.push_back(sizeClass.freeBlocks.back());
+                sizeClass.freeBlocks.pop_back();
+            }
+            sizeClass.highWaterBlocksInUse = sizeClass.blocksInUse;
+        }
+    });
+
+    // Free outside of the lock to not block threads that are encoding commands.
+    mSystemAllocatorCallCount += blocksToFree.size();
+    for (uint8_t* block : blocksToFree) {
+        free(block);
+    }
+}
+
+uint64_t CommandBlockPool::GetSystemAllocatorCallCount() const {
+    return mSystemAllocatorCallCount.load();
+}
+
+size_t CommandBlockPool::GetCachedBlockCountForTesting() const {
+    return mSizeClasses.Use([&](auto sizeClasses) {
+        size_t count = 0;
+        for (const SizeClass& sizeClass : *sizeClasses) {
+            count += sizeClass.freeBlocks.size();
+        }
+        return count;
+    });
+}
+
 // TODO(cwallez@chromium.org): figure out a way to have more type safety for the iterator
 
 CommandIterator::CommandIterator() {
@@ -50,6 +185,8 @@ CommandIterator::~CommandIterator() {
 CommandIterator::CommandIterator(CommandIterator&& other) {
     if (!other.IsEmpty()) {
         mBlocks = std::move(other.mBlocks);
+        mPool = other.mPool;
+        other.mPool = nullptr;
         other.Reset();
     }
     Reset();
@@ -59,13 +196,16 @@ CommandIterator& CommandIterator::operator=(CommandIterator&& other) {
     DAWN_ASSERT(IsEmpty());
     if (!other.IsEmpty()) {
         mBlocks = std::move(other.mBlocks);
+        mPool = other.mPool;
+        other.mPool = nullptr;
         other.Reset();
     }
     Reset();
     return *this;
 }
 
-CommandIterator::CommandIterator(CommandAllocator allocator) : mBlocks(allocator.AcquireBlocks()) {
+CommandIterator::CommandIterator(CommandAllocator allocator)
+    : mBlocks(allocator.AcquireBlocks()), mPool(allocator.mPool) {
     Reset();
 }
 
@@ -75,6 +215,8 @@ void CommandIterator::AcquireCommandBlocks(std::vector<CommandAllocator> allocat
     for (CommandAllocator& allocator : allocators) {
         CommandBlocks blocks = allocator.AcquireBlocks();
         if (!blocks.empty()) {
+            DAWN_ASSERT(mPool == nullptr || mPool == allocator.mPool);
+            mPool = allocator.mPool;
             mBlocks.reserve(mBlocks.size() + blocks.size());
             for (BlockDef& block : blocks) {
                 mBlocks.push_back(std::move(block));
@@ -115,10 +257,8 @@ void CommandIterator::MakeEmptyAsDataWasDestroyed() {
         return;
     }
 
-    for (BlockDef& block : mBlocks) {
-        free(block.block);
-    }
-    mBlocks.clear();
+    FreeBlocks(mPool, &mBlocks);
+    mPool = nullptr;
     Reset();
     DAWN_ASSERT(IsEmpty());
 }
@@ -141,12 +281,18 @@ CommandAllocator::CommandAllocator() {
     ResetPointers();
 }
 
+CommandAllocator::CommandAllocator(CommandBlockPool* pool) : mPool(pool) {
+    ResetPointers();
+}
+
 CommandAllocator::~CommandAllocator() {
     Reset();
 }
 
 CommandAllocator::CommandAllocator(CommandAllocator&& other)
-    : mBlocks(std::move(other.mBlocks)), mLastAllocationSize(other.mLastAllocationSize) {
+    : mBlocks(std::move(other.mBlocks)),
+      mLastAllocationSize(other.mLastAllocationSize),
+      mPool(other.mPool) {
     other.mBlocks.clear();
     if (!other.IsEmpty()) {
         mCurrentPtr = other.mCurrentPtr;
@@ -159,6 +305,7 @@ CommandAllocator::CommandAllocator(CommandAllocator&& other)
 
 CommandAllocator& CommandAllocator::operator=(CommandAllocator&& other) {
     Reset();
+    mPool = other.mPool;
     if (!other.IsEmpty()) {
         std::swap(mBlocks, other.mBlocks);
         mLastAllocationSize = other.mLastAllocationSize;
@@ -170,10 +317,7 @@ CommandAllocator& CommandAllocator::operator=(CommandAllocator&& other) {
 }
 
 void CommandAllocator::Reset() {
-    for (BlockDef& block : mBlocks) {
-        free(block.block);
-    }
-    mBlocks.clear();
+    FreeBlocks(mPool, &mBlocks);
     mLastAllocationSize = kDefaultBaseAllocationSize;
     ResetPointers();
 }
@@ -218,9 +362,10 @@ uint8_t* CommandAllocator::AllocateInNewBlock(uint32_t commandId,
 
 bool CommandAllocator::GetNewBlock(size_t minimumSize) {
     // Allocate blocks doubling sizes each time, to a maximum of 16k (or at least minimumSize).
-    mLastAllocationSize = std::max(minimumSize, std::min(mLastAllocationSize * 2, size_t(16384)));
+    mLastAllocationSize = std::max(
+        minimumSize, std::min(mLastAllocationSize * 2, detail::kMaxCommandBlockSize));
 
-    uint8_t* block = static_cast<uint8_t*>(malloc(mLastAllocationSize));
+    uint8_t* block = AllocateBlock(mPool, mLastAllocationSize);
     if (DAWN_UNLIKELY(block == nullptr)) {
         return false;
     }
@@ -28,6 +28,8 @@
 #ifndef SRC_DAWN_NATIVE_COMMANDALLOCATOR_H_
 #define SRC_DAWN_NATIVE_COMMANDALLOCATOR_H_
 
+#include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
@@ -35,6 +37,7 @@
 
 #include "dawn/common/Assert.h"
 #include "dawn/common/Math.h"
+#include "dawn/common/MutexProtected.h"
 #include "dawn/common/NonCopyable.h"
 #include "partition_alloc/pointers/raw_ptr.h"
 
@@ -79,10 +82,55 @@ using CommandBlocks = std::vector<BlockDef>;
 namespace detail {
 constexpr uint32_t kEndOfBlock = std::numeric_limits<uint32_t>::max();
 constexpr uint32_t kAdditionalData = std::numeric_limits<uint32_t>::max() - 1;
+
+// Blocks are allocated with doubling sizes starting at kMinCommandBlockSize up to
+// kMaxCommandBlockSize, unless a single command needs more space.
+constexpr size_t kMinCommandBlockSize = 4096;
+constexpr size_t kMaxCommandBlockSize = 16384;
 }  // namespace detail
 
 class CommandAllocator;
 
+// A per-device cache of command blocks that is shared by all the CommandAllocators of the device.
+// Each encoder starts allocating from the smallest block size again, so applications recording
+// many short encoders per frame would otherwise constantly malloc and free the same few block
+// sizes. Blocks of the standard sizes are kept in per-size-class free lists and reused; blocks of
+// any other size go straight to the system allocator. This class is thread-safe since command
+// buffers can be encoded and freed on any thread.
+class CommandBlockPool : public NonCopyable {
+  public:
+    CommandBlockPool();
+    ~CommandBlockPool();
+
+    uint8_t* Allocate(size_t size);
+    void Deallocate(uint8_t* block, size_t size);
+
+    // Frees the cached blocks of each size class that exceed the high-water mark of blocks in use
+    // since the previous call to Trim. Expected to be called periodically, like on device ticks.
+    void Trim();
+
+    // Returns the number of calls to malloc and free made so far on behalf of the pool.
+    uint64_t GetSystemAllocatorCallCount() const;
+
+    size_t GetCachedBlockCountForTesting() const;
+
+  private:
+    static constexpr size_t kSizeClassCount =
+        ConstexprLog2(detail::kMaxCommandBlockSize / detail::kMinCommandBlockSize) + 1;
+    // Upper bound of blocks kept in each size class, even if more were in use at some point.
+    static constexpr size_t kMaxCachedBlocksPerSizeClass = 64;
+
+    struct SizeClass {
+        std::vector<uint8_t*> freeBlocks;
+        size_t blocksInUse = 0;
+        size_t highWaterBlocksInUse = 0;
+    };
+    using SizeClasses = std::array<SizeClass, kSizeClassCount>;
+
+    MutexProtected<SizeClasses> mSizeClasses;
+    std::atomic<uint64_t> mSystemAllocatorCallCount = 0;
+};
+
 class CommandIterator : public NonCopyable {
   public:
     CommandIterator();
@@ -94,6 +142,7 @@ class CommandIterator : public NonCopyable {
     // Shorthand constructor for acquiring CommandBlocks from a single CommandAllocator.
     explicit CommandIterator(CommandAllocator allocator);
 
+    // All the allocators must use the same CommandBlockPool, if any.
     void AcquireCommandBlocks(std::vector<CommandAllocator> allocators);
 
     template <typename E>
@@ -156,6 +205,8 @@ class CommandIterator : public NonCopyable {
     }
 
     CommandBlocks mBlocks;
+    // The pool the blocks are returned to when they are destroyed, if any.
+    raw_ptr<CommandBlockPool> mPool = nullptr;
     // TODO(https://crbug.com/dawn/2349): Investigate DanglingUntriaged in dawn/native.
     raw_ptr<uint8_t, AllowPtrArithmetic | DanglingUntriaged> mCurrentPtr = nullptr;
     size_t mCurrentBlock = 0;
@@ -166,9 +217,13 @@ class CommandIterator : public NonCopyable {
 class CommandAllocator : public NonCopyable {
   public:
     CommandAllocator();
+    // Blocks are allocated from and returned to |pool| instead of the system allocator. |pool|
+    // must outlive both the allocator and the CommandIterators its blocks are moved to.
+    explicit CommandAllocator(CommandBlockPool* pool);
     ~CommandAllocator();
 
-    // NOTE: A moved-from CommandAllocator is reset to its initial empty state.
+    // NOTE: A moved-from CommandAllocator is reset to its initial empty state but keeps using the
+    // same CommandBlockPool.
     CommandAllocator(CommandAllocator&&);
     CommandAllocator& operator=(CommandAllocator&&);
 
@@ -204,6 +259,25 @@ class CommandAllocator : public NonCopyable {
         return result;
     }
 
+    // Grows the data returned by the last call to AllocateData, made of |dataCount| elements
+    // starting at |data|, by |count| elements in place. Returns a pointer to the first new element
+    // or nullptr if something else was allocated since or if the current block doesn't have enough
+    // space left, in which case the caller must allocate new data instead.
+    template <typename T>
+    T* TryExtendData(T* data, size_t dataCount, size_t count) {
+        static_assert(alignof(T) <= kMaxSupportedAlignment);
+        T* result =
+            reinterpret_cast<T*>(TryExtendData(reinterpret_cast<uint8_t*>(data + dataCount),
+                                               sizeof(T) * count));
+        if (!result) {
+            return nullptr;
+        }
+        for (size_t i = 0; i < count; i++) {
+            new (result + i) T;
+        }
+        return result;
+    }
+
   private:
     // This is used for some internal computations and can be any power of two as long as code
     // using the CommandAllocator passes the static_asserts.
@@ -265,12 +339,31 @@ class CommandAllocator : public NonCopyable {
         return Allocate(detail::kAdditionalData, commandSize, commandAlignment);
     }
 
+    DAWN_FORCE_INLINE uint8_t* TryExtendData(uint8_t* dataEnd, size_t extensionSize) {
+        // The data can only grow if it is the last thing allocated in the current block.
+        if (AlignPtr(dataEnd, alignof(uint32_t)) != mCurrentPtr.get()) {
+            return nullptr;
+        }
+
+        // Like in Allocate, there must still be space for the padding and the next ID after the
+        // extension.
+        constexpr size_t kAdditionalSize = alignof(uint32_t) + sizeof(uint32_t);
+        size_t remainingSize = static_cast<size_t>(mEndPtr - dataEnd);
+        if (remainingSize < kAdditionalSize || remainingSize - kAdditionalSize < extensionSize) {
+            return nullptr;
+        }
+
+        mCurrentPtr = AlignPtr(dataEnd + extensionSize, alignof(uint32_t));
+        return dataEnd;
+    }
+
     bool GetNewBlock(size_t minimumSize);
 
     void ResetPointers();
 
     CommandBlocks mBlocks;
     size_t mLastAllocationSize = kDefaultBaseAllocationSize;
+    raw_ptr<CommandBlockPool> mPool = nullptr;
 
     // Data used for the block range at initialization so that the first call to Allocate sees
     // there is not enough space and calls GetNewBlock. This avoids having to special case the
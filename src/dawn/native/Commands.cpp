@@ -89,14 +89,16 @@ void FreeCommands(CommandIterator* commands) {
                 dispatch->~DispatchIndirectCmd();
                 break;
             }
-            case Command::Draw: {
-                DrawCmd* draw = commands->NextCommand<DrawCmd>();
-                draw->~DrawCmd();
+            case Command::DrawBatch: {
+                DrawBatchCmd* batch = commands->NextCommand<DrawBatchCmd>();
+                commands->NextData<DrawCmd>(batch->drawCount);
+                batch->~DrawBatchCmd();
                 break;
             }
-            case Command::DrawIndexed: {
-                DrawIndexedCmd* draw = commands->NextCommand<DrawIndexedCmd>();
-                draw->~DrawIndexedCmd();
+            case Command::DrawIndexedBatch: {
+                DrawIndexedBatchCmd* batch = commands->NextCommand<DrawIndexedBatchCmd>();
+                commands->NextData<DrawIndexedCmd>(batch->drawCount);
+                batch->~DrawIndexedBatchCmd();
                 break;
             }
             case Command::DrawIndirect: {
@@ -269,13 +271,17 @@ void SkipCommand(CommandIterator* commands, Command type) {
             commands->NextCommand<DispatchIndirectCmd>();
             break;
 
-        case Command::Draw:
-            commands->NextCommand<DrawCmd>();
+        case Command::DrawBatch: {
+            DrawBatchCmd* batch = commands->NextCommand<DrawBatchCmd>();
+            commands->NextData<DrawCmd>(batch->drawCount);
             break;
+        }
 
-        case Command::DrawIndexed:
-            commands->NextCommand<DrawIndexedCmd>();
+        case Command::DrawIndexedBatch: {
+            DrawIndexedBatchCmd* batch = commands->NextCommand<DrawIndexedBatchCmd>();
+            commands->NextData<DrawIndexedCmd>(batch->drawCount);
             break;
+        }
 
         case Command::DrawIndirect:
             commands->NextCommand<DrawIndirectCmd>();
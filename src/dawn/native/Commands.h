@@ -59,8 +59,8 @@ enum class Command {
     CopyTextureToTexture,
     Dispatch,
     DispatchIndirect,
-    Draw,
-    DrawIndexed,
+    DrawBatch,
+    DrawIndexedBatch,
     DrawIndirect,
     DrawIndexedIndirect,
     EndComputePass,
@@ -246,6 +246,17 @@ struct DrawIndexedCmd {
     uint32_t firstInstance;
 };
 
+// Draws are recorded in batches followed by drawCount DrawCmds (resp. DrawIndexedCmds) of data.
+// Consecutive draws with no other command in between are appended to the same batch, so the
+// state used by all the draws of a batch is the same and only needs to be applied once.
+struct DrawBatchCmd {
+    uint32_t drawCount;
+};
+
+struct DrawIndexedBatchCmd {
+    uint32_t drawCount;
+};
+
 struct DrawIndirectCmd {
     DrawIndirectCmd();
     ~DrawIndirectCmd();
@@ -152,10 +152,12 @@ DawnInstanceDescriptor::DawnInstanceDescriptor() {
 bool DawnInstanceDescriptor::operator==(const DawnInstanceDescriptor& rhs) const {
     return (nextInChain == rhs.nextInChain) &&
            std::tie(additionalRuntimeSearchPathsCount, additionalRuntimeSearchPaths, platform,
-                    backendValidationLevel, beginCaptureOnStartup, enableAdapterBlocklist) ==
+                    backendValidationLevel, beginCaptureOnStartup, enableAdapterBlocklist,
+                    blobCacheMemoryBudget, blobCacheDirectory) ==
                std::tie(rhs.additionalRuntimeSearchPathsCount, rhs.additionalRuntimeSearchPaths,
                         rhs.platform, rhs.backendValidationLevel, rhs.beginCaptureOnStartup,
-                        rhs.enableAdapterBlocklist);
+                        rhs.enableAdapterBlocklist, rhs.blobCacheMemoryBudget,
+                        rhs.blobCacheDirectory);
 }
 
 // Instance
@@ -223,6 +225,18 @@ size_t GetLazyClearCountForTesting(WGPUDevice device) {
     return FromAPI(device)->GetLazyClearCountForTesting();
 }
 
+uint64_t GetCommandBlockAllocatorCallCountForTesting(WGPUDevice device) {
+    return FromAPI(device)->GetCommandBlockPool()->GetSystemAllocatorCallCount();
+}
+
+BlobCacheStats GetBlobCacheStats(WGPUInstance instance) {
+    return FromAPI(instance)->GetBlobCacheStats();
+}
+
+void FlushBlobCache(WGPUInstance instance) {
+    FromAPI(instance)->FlushBlobCache();
+}
+
 size_t GetDeprecationWarningCountForTesting(WGPUDevice device) {
     return FromAPI(device)->GetDeprecationWarningCountForTesting();
 }
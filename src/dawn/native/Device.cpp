@@ -210,7 +210,10 @@ ResultOrError<Ref<PipelineLayoutBase>> ValidateLayoutAndGetRenderPipelineDescrip
 DeviceBase::DeviceBase(AdapterBase* adapter,
                        const UnpackedPtr<DeviceDescriptor>& descriptor,
                        const TogglesState& deviceToggles)
-    : mAdapter(adapter), mToggles(deviceToggles), mNextPipelineCompatibilityToken(1) {
+    : mAdapter(adapter),
+      mCommandBlockPool(std::make_unique<CommandBlockPool>()),
+      mToggles(deviceToggles),
+      mNextPipelineCompatibilityToken(1) {
     DAWN_ASSERT(descriptor);
 
     mDeviceLostCallback = descriptor->deviceLostCallback;
@@ -243,6 +246,9 @@ DeviceBase::DeviceBase(AdapterBase* adapter,
         cacheDesc.functionUserdata = GetPlatform()->GetCachingInterface();
     }
 
+    MemoryBlobCache* memoryBlobCache = GetInstance()->GetMemoryBlobCache();
+    DiskBlobCache* diskBlobCache = GetInstance()->GetDiskBlobCache();
+
     // Disable caching if the toggle is passed, or the WGSL writer is not enabled.
     // TODO(crbug.com/dawn/1481): Shader caching currently has a dependency on the WGSL writer to
     // generate cache keys. We can lift the dependency once we also cache frontend parsing,
@@ -255,8 +261,10 @@ DeviceBase::DeviceBase(AdapterBase* adapter,
         cacheDesc.loadDataFunction = nullptr;
         cacheDesc.storeDataFunction = nullptr;
         cacheDesc.functionUserdata = nullptr;
+        memoryBlobCache = nullptr;
+        diskBlobCache = nullptr;
     }
-    mBlobCache = std::make_unique<BlobCache>(cacheDesc);
+    mBlobCache = std::make_unique<BlobCache>(cacheDesc, memoryBlobCache, diskBlobCache);
 
     if (descriptor->requiredLimits != nullptr) {
         mLimits.v1 =
@@ -283,7 +291,10 @@ DeviceBase::DeviceBase(AdapterBase* adapter,
              mToggles, cacheDesc);
 }
 
-DeviceBase::DeviceBase() : mState(State::Alive), mToggles(ToggleStage::Device) {
+DeviceBase::DeviceBase()
+    : mCommandBlockPool(std::make_unique<CommandBlockPool>()),
+      mState(State::Alive),
+      mToggles(ToggleStage::Device) {
     GetDefaultLimits(&mLimits.v1, FeatureLevel::Core);
     mFormatTable = BuildFormatTable(this);
 }
@@ -1448,6 +1459,7 @@ MaybeError DeviceBase::Tick() {
     // reclaiming resources one tick earlier.
     mDynamicUploader->Deallocate(mQueue->GetCompletedCommandSerial());
     mQueue->Tick(mQueue->GetCompletedCommandSerial());
+    mCommandBlockPool->Trim();
 
     return {};
 }
@@ -2070,6 +2082,10 @@ DynamicUploader* DeviceBase::GetDynamicUploader() const {
     return mDynamicUploader.get();
 }
 
+CommandBlockPool* DeviceBase::GetCommandBlockPool() const {
+    return mCommandBlockPool.get();
+}
+
 // The Toggle device facility
 
 std::vector<const char*> DeviceBase::GetTogglesUsed() const {
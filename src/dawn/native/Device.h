@@ -39,6 +39,7 @@
 #include "dawn/common/ContentLessObjectCache.h"
 #include "dawn/common/Mutex.h"
 #include "dawn/native/CacheKey.h"
+#include "dawn/native/CommandAllocator.h"
 #include "dawn/native/Commands.h"
 #include "dawn/native/ComputePipeline.h"
 #include "dawn/native/Error.h"
@@ -349,6 +350,7 @@ class DeviceBase : public RefCountedWithExternalCount {
                                         const Extent3D& copySizePixels);
 
     DynamicUploader* GetDynamicUploader() const;
+    CommandBlockPool* GetCommandBlockPool() const;
 
     // The device state which is a combination of creation state and loss state.
     //
@@ -584,6 +586,9 @@ class DeviceBase : public RefCountedWithExternalCount {
 
     Ref<AdapterBase> mAdapter;
 
+    // Declared early so that it outlives all the members that could still hold command blocks.
+    std::unique_ptr<CommandBlockPool> mCommandBlockPool;
+
     // The object caches aren't exposed in the header as they would require a lot of
     // additional includes.
     struct Caches;
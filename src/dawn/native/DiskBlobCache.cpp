@@ -0,0 +1,314 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dawn/native/DiskBlobCache.h"
+
+#include <cstring>
+#include <utility>
+
+#include "dawn/common/Assert.h"
+#include "dawn/native/BlobCompression.h"
+
+namespace dawn::native {
+
+namespace {
+
+constexpr char kDataFileName[] = "dawn_blob_cache.data";
+constexpr char kIndexFileName[] = "dawn_blob_cache.index";
+
+// Identifies the format of the files. Bump the version when it changes so that caches written
+// by other versions are discarded instead of misread.
+constexpr uint32_t kIndexMagic = 0x43424E44;  // "DNBC"
+constexpr uint32_t kIndexVersion = 1;
+
+constexpr uint32_t kRecordFlagCompressed = 1;
+
+// The size of the batch of pending blobs above which they are written to disk.
+constexpr size_t kMaxPendingSize = 1024 * 1024;
+
+struct IndexHeader {
+    uint32_t magic;
+    uint32_t version;
+};
+
+// The hash is persisted in the index so it must be stable across processes, unlike std::hash.
+uint64_t HashKey(std::string_view key) {
+    // 64-bit FNV-1a.
+    uint64_t hash = 0xCBF29CE484222325ull;
+    for (char c : key) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+}  // anonymous namespace
+
+// static
+ResultOrError<std::unique_ptr<DiskBlobCache>> DiskBlobCache::Create(const std::string& directory) {
+    std::unique_ptr<DiskBlobCache> cache(new DiskBlobCache());
+    DAWN_TRY(cache->Initialize(directory));
+    return cache;
+}
+
+DiskBlobCache::DiskBlobCache() = default;
+
+DiskBlobCache::~DiskBlobCache() {
+    Flush();
+}
+
+MaybeError DiskBlobCache::Initialize(const std::string& directory) {
+    const std::string dataPath = directory + "/" + kDataFileName;
+    const std::string indexPath = directory + "/" + kIndexFileName;
+
+    // Read the existing index, if any and if it has the expected format.
+    std::vector<IndexRecord> records;
+    bool validIndex = false;
+    bool partialRecord = false;
+    {
+        std::ifstream indexFile(indexPath, std::ios::binary);
+        IndexHeader header;
+        if (indexFile.read(reinterpret_cast<char*>(&header), sizeof(header)) &&
+            header.magic == kIndexMagic && header.version == kIndexVersion) {
+            validIndex = true;
+            IndexRecord record;
+            while (indexFile.read(reinterpret_cast<char*>(&record), sizeof(record))) {
+                records.push_back(record);
+            }
+            partialRecord = indexFile.gcount() != 0;
+        }
+    }
+
+    // Start over with empty files if the index is missing or is from another version. A process
+    // that crashed while appending to the index may have left a partial record at its end. The
+    // index is then rewritten without it so that the records appended next stay aligned.
+    const bool rewriteIndex = !validIndex || partialRecord;
+    std::ofstream(dataPath, std::ios::binary | (validIndex ? std::ios::app : std::ios::trunc))
+        .close();
+    mDataFile.open(dataPath, std::ios::binary | std::ios::in | std::ios::out);
+    mIndexFile.open(indexPath,
+                    std::ios::binary | (rewriteIndex ? std::ios::trunc : std::ios::app));
+    DAWN_INVALID_IF(!mDataFile.is_open() || !mIndexFile.is_open(),
+                    "Failed to open the blob cache files in \"%s\".", directory);
+
+    if (rewriteIndex) {
+        IndexHeader header = {kIndexMagic, kIndexVersion};
+        mIndexFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        mIndexFile.write(reinterpret_cast<const char*>(records.data()),
+                         records.size() * sizeof(IndexRecord));
+        mIndexFile.flush();
+        DAWN_INVALID_IF(!mIndexFile, "Failed to write the blob cache index in \"%s\".", directory);
+    }
+
+    mDataFile.seekg(0, std::ios::end);
+    mDataFileSize = static_cast<uint64_t>(mDataFile.tellg());
+
+    // Records written after data that didn't make it to disk are dropped. Later records for the
+    // same key replace earlier ones. The bounds are checked without overflowing on corrupt records.
+    for (const IndexRecord& record : records) {
+        if (record.offset <= mDataFileSize && record.keySize <= mDataFileSize - record.offset &&
+            record.storedSize <= mDataFileSize - record.offset - record.keySize) {
+            mRecords[record.keyHash] = record;
+        }
+    }
+    return {};
+}
+
+Blob DiskBlobCache::Load(std::string_view key) {
+    uint64_t keyHash = HashKey(key);
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    Blob result;
+    if (auto it = mPendingIndices.find(keyHash); it != mPendingIndices.end()) {
+        const PendingBlob& pending = mPendingBlobs[it->second];
+        if (pending.key == key) {
+            result = LoadFromStoredValue(pending.record, pending.storedValue.data());
+        }
+    } else if (auto recordIt = mRecords.find(keyHash); recordIt != mRecords.end()) {
+        result = LoadFromDataFile(key, recordIt->second);
+    }
+
+    if (result.Empty()) {
+        mMissCount++;
+    } else {
+        mHitCount++;
+    }
+    return result;
+}
+
+Blob DiskBlobCache::LoadFromDataFile(std::string_view key, const IndexRecord& record) {
+    if (record.keySize != key.size()) {
+        return Blob();
+    }
+
+    std::vector<uint8_t> data(record.keySize + record.storedSize);
+    mDataFile.clear();
+    mDataFile.seekg(static_cast<std::streamoff>(record.offset));
+    if (!mDataFile.read(reinterpret_cast<char*>(data.data()), data.size())) {
+        mDataFile.clear();
+        return Blob();
+    }
+
+    // Check the full key to guard against hash collisions.
+    if (memcmp(data.data(), key.data(), key.size()) != 0) {
+        return Blob();
+    }
+    return LoadFromStoredValue(record, data.data() + record.keySize);
+}
+
+Blob DiskBlobCache::LoadFromStoredValue(const IndexRecord& record, const uint8_t* storedValue) {
+    // Uncompressed values are stored as is. A size mismatch means the files are corrupt, which is
+    // treated as a cache miss.
+    bool compressed = record.flags & kRecordFlagCompressed;
+    if (!compressed && record.storedSize != record.valueSize) {
+        return Blob();
+    }
+
+    Blob result = CreateBlob(record.valueSize);
+    if (compressed) {
+        if (!DecompressBlobData(storedValue, record.storedSize, result.Data(),
+                                record.valueSize)) {
+            return Blob();
+        }
+    } else {
+        memcpy(result.Data(), storedValue, record.valueSize);
+    }
+    return result;
+}
+
+void DiskBlobCache::Store(std::string_view key, size_t valueSize, const void* value) {
+    DAWN_ASSERT(value != nullptr);
+    DAWN_ASSERT(valueSize > 0);
+    if (key.size() > UINT32_MAX || valueSize > UINT32_MAX) {
+        return;
+    }
+
+    uint64_t keyHash = HashKey(key);
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        // Keys are derived from the content so a blob with the same key doesn't need to be
+        // written again.
+        if (mWriteFailed || mRecords.contains(keyHash) || mPendingIndices.contains(keyHash)) {
+            return;
+        }
+    }
+
+    // Compress outside of the lock since it is the most expensive part of storing.
+    const uint8_t* valueBytes = static_cast<const uint8_t*>(value);
+    PendingBlob pending;
+    pending.key = std::string(key);
+    pending.storedValue = CompressBlobData(valueBytes, valueSize);
+    pending.record.flags = kRecordFlagCompressed;
+    if (pending.storedValue.size() >= valueSize) {
+        pending.storedValue.assign(valueBytes, valueBytes + valueSize);
+        pending.record.flags = 0;
+    }
+    pending.record.keyHash = keyHash;
+    pending.record.offset = 0;
+    pending.record.keySize = static_cast<uint32_t>(key.size());
+    pending.record.storedSize = static_cast<uint32_t>(pending.storedValue.size());
+    pending.record.valueSize = static_cast<uint32_t>(valueSize);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (mWriteFailed || mRecords.contains(keyHash) || mPendingIndices.contains(keyHash)) {
+        return;
+    }
+    mStoredBytes += valueSize;
+    mPendingSize += pending.key.size() + pending.storedValue.size();
+    mPendingIndices[keyHash] = mPendingBlobs.size();
+    mPendingBlobs.push_back(std::move(pending));
+
+    if (mPendingSize >= kMaxPendingSize) {
+        FlushLocked();
+    }
+}
+
+void DiskBlobCache::Flush() {
+    std::lock_guard<std::mutex> lock(mMutex);
+    FlushLocked();
+}
+
+void DiskBlobCache::FlushLocked() {
+    if (mPendingBlobs.empty()) {
+        return;
+    }
+
+    // Append all the keys and values first, then the index records pointing to them.
+    mDataFile.clear();
+    mDataFile.seekp(0, std::ios::end);
+    uint64_t offset = mDataFileSize;
+    for (PendingBlob& pending : mPendingBlobs) {
+        pending.record.offset = offset;
+        mDataFile.write(pending.key.data(), pending.key.size());
+        mDataFile.write(reinterpret_cast<const char*>(pending.storedValue.data()),
+                        pending.storedValue.size());
+        offset += pending.key.size() + pending.storedValue.size();
+    }
+    mDataFile.flush();
+
+    if (mDataFile) {
+        for (const PendingBlob& pending : mPendingBlobs) {
+            mIndexFile.write(reinterpret_cast<const char*>(&pending.record),
+                             sizeof(pending.record));
+        }
+        mIndexFile.flush();
+    }
+
+    if (!mDataFile || !mIndexFile) {
+        // Don't risk writing records that point to the wrong data. The blobs of this batch and
+        // the following ones stay uncached on disk.
+        mWriteFailed = true;
+    } else {
+        mWrittenBytes += offset - mDataFileSize;
+        mDataFileSize = offset;
+        for (const PendingBlob& pending : mPendingBlobs) {
+            mRecords[pending.record.keyHash] = pending.record;
+        }
+    }
+
+    mPendingBlobs.clear();
+    mPendingIndices.clear();
+    mPendingSize = 0;
+}
+
+uint64_t DiskBlobCache::GetHitCount() const {
+    return mHitCount.load();
+}
+
+uint64_t DiskBlobCache::GetMissCount() const {
+    return mMissCount.load();
+}
+
+uint64_t DiskBlobCache::GetStoredBytes() const {
+    return mStoredBytes.load();
+}
+
+uint64_t DiskBlobCache::GetWrittenBytes() const {
+    return mWrittenBytes.load();
+}
+
+}  // namespace dawn::native
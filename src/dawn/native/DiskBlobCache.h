@@ -0,0 +1,118 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_DAWN_NATIVE_DISKBLOBCACHE_H_
+#define SRC_DAWN_NATIVE_DISKBLOBCACHE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "dawn/native/Blob.h"
+#include "dawn/native/Error.h"
+
+namespace dawn::native {
+
+// A persistent blob cache stored in a directory as two files:
+//   - an append-only data file holding each key followed by its (possibly compressed) value,
+//   - an index file with a fixed-size record per blob pointing into the data file.
+// The index is read in memory when the cache is opened so lookups cost a single positioned read.
+// Stores are batched in memory and appended to the files when the batch gets large, on Flush()
+// and on destruction, so that storing many pipelines at startup doesn't cost one write per blob.
+// The data is always written before the index records that reference it, and records pointing
+// past the end of the data file are ignored, so a process dying mid-write only loses the last
+// batch. File accesses are serialized with a single lock; concurrent hot lookups are expected
+// to be served by the MemoryBlobCache in front of it.
+class DiskBlobCache {
+  public:
+    // Opens the cache in |directory|, which must already exist, creating the files if needed.
+    static ResultOrError<std::unique_ptr<DiskBlobCache>> Create(const std::string& directory);
+    ~DiskBlobCache();
+
+    // Returns an empty blob if the key is not in the cache.
+    Blob Load(std::string_view key);
+    void Store(std::string_view key, size_t valueSize, const void* value);
+
+    // Writes the pending batch of stored blobs to disk.
+    void Flush();
+
+    uint64_t GetHitCount() const;
+    uint64_t GetMissCount() const;
+    // Returns the number of bytes of values stored, before and after compression.
+    uint64_t GetStoredBytes() const;
+    uint64_t GetWrittenBytes() const;
+
+  private:
+    struct IndexRecord {
+        uint64_t keyHash;
+        // Offset of the key in the data file. The stored value follows it.
+        uint64_t offset;
+        uint32_t keySize;
+        uint32_t storedSize;
+        uint32_t valueSize;
+        uint32_t flags;
+    };
+    struct PendingBlob {
+        IndexRecord record;
+        std::string key;
+        std::vector<uint8_t> storedValue;
+    };
+
+    DiskBlobCache();
+    MaybeError Initialize(const std::string& directory);
+
+    Blob LoadFromDataFile(std::string_view key, const IndexRecord& record);
+    Blob LoadFromStoredValue(const IndexRecord& record, const uint8_t* storedValue);
+    void FlushLocked();
+
+    std::mutex mMutex;
+    std::fstream mDataFile;
+    std::ofstream mIndexFile;
+    uint64_t mDataFileSize = 0;
+    // Set if a write failed, in which case stores are ignored from then on.
+    bool mWriteFailed = false;
+
+    absl::flat_hash_map<uint64_t, IndexRecord> mRecords;
+    absl::flat_hash_map<uint64_t, size_t> mPendingIndices;
+    std::vector<PendingBlob> mPendingBlobs;
+    size_t mPendingSize = 0;
+
+    std::atomic<uint64_t> mHitCount = 0;
+    std::atomic<uint64_t> mMissCount = 0;
+    std::atomic<uint64_t> mStoredBytes = 0;
+    std::atomic<uint64_t> mWrittenBytes = 0;
+};
+
+}  // namespace dawn::native
+
+#endif  // SRC_DAWN_NATIVE_DISKBLOBCACHE_H_
@@ -27,6 +27,7 @@
 
 #include "dawn/native/DynamicUploader.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "dawn/common/Math.h"
@@ -36,9 +37,23 @@
 
 namespace dawn::native {
 
+namespace {
+
+// Large staging buffers are rounded up to a multiple of a quarter of the previous power of two
+// (so there are four size classes per power of two) so that buffers of similar sizes can be reused
+// for each other while wasting at most 25% of the memory. The size class is clamped to
+// |maxBufferSize| so that rounding up never makes a valid upload fail buffer validation.
+uint64_t GetLargeBufferSizeClass(uint64_t size, uint64_t maxBufferSize) {
+    uint64_t sizeClass = Align(size, std::max(NextPowerOfTwo(size) / 8, uint64_t(4)));
+    return std::max(Align(size, 4), std::min(sizeClass, maxBufferSize));
+}
+
+}  // anonymous namespace
+
 DynamicUploader::DynamicUploader(DeviceBase* device) : mDevice(device) {
-    mRingBuffers.emplace_back(
-        std::unique_ptr<RingBuffer>(new RingBuffer{nullptr, RingBufferAllocator(kRingBufferSize)}));
+    mRingBuffers.emplace_back(std::unique_ptr<RingBuffer>(
+        new RingBuffer{nullptr, RingBufferAllocator(kMinRingBufferSize)}));
+    mNextRingBufferSize = std::min(kMinRingBufferSize * 2, kMaxRingBufferSize);
 }
 
 void DynamicUploader::ReleaseStagingBuffer(Ref<BufferBase> stagingBuffer) {
@@ -46,27 +61,51 @@ void DynamicUploader::ReleaseStagingBuffer(Ref<BufferBase> stagingBuffer) {
                                     mDevice->GetQueue()->GetPendingCommandSerial());
 }
 
+ResultOrError<Ref<BufferBase>> DynamicUploader::CreateStagingBuffer(uint64_t size) {
+    BufferDescriptor bufferDesc = {};
+    bufferDesc.usage = wgpu::BufferUsage::CopySrc | wgpu::BufferUsage::MapWrite;
+    bufferDesc.size = Align(size, 4);
+    bufferDesc.mappedAtCreation = true;
+    bufferDesc.label = "Dawn_DynamicUploaderStaging";
+
+    IgnoreLazyClearCountScope scope(mDevice);
+    return mDevice->CreateBuffer(&bufferDesc);
+}
+
+ResultOrError<UploadHandle> DynamicUploader::AllocateLargeBuffer(uint64_t allocationSize,
+                                                                 ExecutionSerial serial) {
+    uint64_t sizeClass =
+        GetLargeBufferSizeClass(allocationSize, mDevice->GetLimits().v1.maxBufferSize);
+
+    // Reuse the most recently used free buffer of the size class, if any.
+    Ref<BufferBase> stagingBuffer;
+    auto it = mFreeLargeBuffers.find(sizeClass);
+    if (it != mFreeLargeBuffers.end()) {
+        DAWN_ASSERT(!it->second.empty());
+        stagingBuffer = std::move(it->second.back().buffer);
+        it->second.pop_back();
+        if (it->second.empty()) {
+            mFreeLargeBuffers.erase(it);
+        }
+        mFreeLargeBufferSize -= sizeClass;
+    } else {
+        DAWN_TRY_ASSIGN(stagingBuffer, CreateStagingBuffer(sizeClass));
+    }
+
+    UploadHandle uploadHandle;
+    uploadHandle.mappedBuffer = static_cast<uint8_t*>(stagingBuffer->GetMappedPointer());
+    uploadHandle.stagingBuffer = stagingBuffer.Get();
+
+    mInFlightLargeBuffers.Enqueue(LargeBuffer{std::move(stagingBuffer), serial}, serial);
+    return uploadHandle;
+}
+
 ResultOrError<UploadHandle> DynamicUploader::AllocateInternal(uint64_t allocationSize,
                                                               ExecutionSerial serial,
                                                               uint64_t offsetAlignment) {
     // Disable further sub-allocation should the request be too large.
-    if (allocationSize > kRingBufferSize) {
-        BufferDescriptor bufferDesc = {};
-        bufferDesc.usage = wgpu::BufferUsage::CopySrc | wgpu::BufferUsage::MapWrite;
-        bufferDesc.size = Align(allocationSize, 4);
-        bufferDesc.mappedAtCreation = true;
-        bufferDesc.label = "Dawn_DynamicUploaderStaging";
-
-        IgnoreLazyClearCountScope scope(mDevice);
-        Ref<BufferBase> stagingBuffer;
-        DAWN_TRY_ASSIGN(stagingBuffer, mDevice->CreateBuffer(&bufferDesc));
-
-        UploadHandle uploadHandle;
-        uploadHandle.mappedBuffer = static_cast<uint8_t*>(stagingBuffer->GetMappedPointer());
-        uploadHandle.stagingBuffer = stagingBuffer.Get();
-
-        ReleaseStagingBuffer(std::move(stagingBuffer));
-        return uploadHandle;
+    if (allocationSize > kMaxRingBufferSize) {
+        return AllocateLargeBuffer(allocationSize, serial);
     }
 
     // Note: Validation ensures size is already aligned.
@@ -84,11 +123,15 @@ ResultOrError<UploadHandle> DynamicUploader::AllocateInternal(uint64_t allocatio
         }
     }
 
-    // Upon failure, append a newly created ring buffer to fulfill the
-    // request.
+    // Upon failure, append a newly created ring buffer, larger than the previous ones, to fulfill
+    // the request.
     if (startOffset == RingBufferAllocator::kInvalidOffset) {
+        uint64_t ringBufferSize = std::max(mNextRingBufferSize, NextPowerOfTwo(allocationSize));
+        DAWN_ASSERT(ringBufferSize <= kMaxRingBufferSize);
+        mNextRingBufferSize = std::min(ringBufferSize * 2, kMaxRingBufferSize);
+
         mRingBuffers.emplace_back(std::unique_ptr<RingBuffer>(
-            new RingBuffer{nullptr, RingBufferAllocator(kRingBufferSize)}));
+            new RingBuffer{nullptr, RingBufferAllocator(ringBufferSize)}));
 
         targetRingBuffer = mRingBuffers.back().get();
         startOffset = targetRingBuffer->mAllocator.Allocate(allocationSize, serial);
@@ -99,15 +142,8 @@ ResultOrError<UploadHandle> DynamicUploader::AllocateInternal(uint64_t allocatio
     // Allocate the staging buffer backing the ringbuffer.
     // Note: the first ringbuffer will be lazily created.
     if (targetRingBuffer->mStagingBuffer == nullptr) {
-        BufferDescriptor bufferDesc = {};
-        bufferDesc.usage = wgpu::BufferUsage::CopySrc | wgpu::BufferUsage::MapWrite;
-        bufferDesc.size = Align(targetRingBuffer->mAllocator.GetSize(), 4);
-        bufferDesc.mappedAtCreation = true;
-        bufferDesc.label = "Dawn_DynamicUploaderStaging";
-
-        IgnoreLazyClearCountScope scope(mDevice);
         Ref<BufferBase> stagingBuffer;
-        DAWN_TRY_ASSIGN(stagingBuffer, mDevice->CreateBuffer(&bufferDesc));
+        DAWN_TRY_ASSIGN(stagingBuffer, CreateStagingBuffer(targetRingBuffer->mAllocator.GetSize()));
         targetRingBuffer->mStagingBuffer = std::move(stagingBuffer);
     }
 
@@ -122,18 +158,59 @@ ResultOrError<UploadHandle> DynamicUploader::AllocateInternal(uint64_t allocatio
     return uploadHandle;
 }
 
+void DynamicUploader::RecycleLargeBuffers(ExecutionSerial lastCompletedSerial) {
+    // Return the large buffers the GPU is done with to the free lists, unless too much memory
+    // would be kept around.
+    for (LargeBuffer& largeBuffer : mInFlightLargeBuffers.IterateUpTo(lastCompletedSerial)) {
+        uint64_t sizeClass = largeBuffer.buffer->GetSize();
+        if (mFreeLargeBufferSize + sizeClass > kMaxFreeLargeBufferSize) {
+            continue;
+        }
+        mFreeLargeBufferSize += sizeClass;
+        mFreeLargeBuffers[sizeClass].push_back(std::move(largeBuffer));
+    }
+    mInFlightLargeBuffers.ClearUpTo(lastCompletedSerial);
+
+    // Release the buffers that haven't been reused for a while. Free lists are ordered from the
+    // least to the most recently used so only their front needs to be checked.
+    for (auto it = mFreeLargeBuffers.begin(); it != mFreeLargeBuffers.end();) {
+        std::vector<LargeBuffer>& freeBuffers = it->second;
+        auto firstKept = std::find_if(
+            freeBuffers.begin(), freeBuffers.end(), [&](const LargeBuffer& largeBuffer) {
+                return uint64_t(lastCompletedSerial) - uint64_t(largeBuffer.lastUsedSerial) <=
+                       kMaxLargeBufferIdleSerials;
+            });
+        mFreeLargeBufferSize -= it->first * (firstKept - freeBuffers.begin());
+        freeBuffers.erase(freeBuffers.begin(), firstKept);
+
+        if (freeBuffers.empty()) {
+            it = mFreeLargeBuffers.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void DynamicUploader::ReleaseFreeLargeBuffers() {
+    mFreeLargeBuffers.clear();
+    mFreeLargeBufferSize = 0;
+}
+
 void DynamicUploader::Deallocate(ExecutionSerial lastCompletedSerial) {
     // Reclaim memory within the ring buffers by ticking (or removing requests no longer
     // in-flight).
-    for (size_t i = 0; i < mRingBuffers.size(); ++i) {
+    for (size_t i = 0; i < mRingBuffers.size();) {
         mRingBuffers[i]->mAllocator.Deallocate(lastCompletedSerial);
 
         // Never erase the last buffer as to prevent re-creating smaller buffers
         // again. The last buffer is the largest.
         if (mRingBuffers[i]->mAllocator.Empty() && i < mRingBuffers.size() - 1) {
             mRingBuffers.erase(mRingBuffers.begin() + i);
+        } else {
+            ++i;
         }
     }
+    RecycleLargeBuffers(lastCompletedSerial);
     mReleasedStagingBuffers.ClearUpTo(lastCompletedSerial);
 }
 
@@ -147,15 +224,22 @@ ResultOrError<UploadHandle> DynamicUploader::Allocate(uint64_t allocationSize,
 bool DynamicUploader::ShouldFlush() {
     uint64_t kTotalAllocatedSizeThreshold = 64 * 1024 * 1024;
     // We use total allocated size instead of pending-upload size to prevent Dawn from allocating
-    // too much GPU memory so that the risk of OOM can be minimized.
+    // too much GPU memory so that the risk of OOM can be minimized. Flushing doesn't help release
+    // the unused large buffers so they are released first.
+    if (GetTotalAllocatedSize() > kTotalAllocatedSizeThreshold) {
+        ReleaseFreeLargeBuffers();
+    }
     return GetTotalAllocatedSize() > kTotalAllocatedSizeThreshold;
 }
 
 uint64_t DynamicUploader::GetTotalAllocatedSize() {
-    uint64_t size = 0;
+    uint64_t size = mFreeLargeBufferSize;
     for (const auto& buffer : mReleasedStagingBuffers.IterateAll()) {
         size += buffer->GetSize();
     }
+    for (const LargeBuffer& largeBuffer : mInFlightLargeBuffers.IterateAll()) {
+        size += largeBuffer.buffer->GetSize();
+    }
     for (const auto& buffer : mRingBuffers) {
         if (buffer->mStagingBuffer != nullptr) {
             size += buffer->mStagingBuffer->GetSize();
@@ -28,10 +28,12 @@
 #ifndef SRC_DAWN_NATIVE_DYNAMICUPLOADER_H_
 #define SRC_DAWN_NATIVE_DYNAMICUPLOADER_H_
 
+#include <map>
 #include <memory>
 #include <vector>
 
 #include "dawn/common/Ref.h"
+#include "dawn/common/SerialQueue.h"
 #include "dawn/native/Error.h"
 #include "dawn/native/Forward.h"
 #include "dawn/native/IntegerTypes.h"
@@ -69,7 +71,20 @@ class DynamicUploader {
     bool ShouldFlush();
 
   private:
-    static constexpr uint64_t kRingBufferSize = 4 * 1024 * 1024;
+    // The first ring buffer is kMinRingBufferSize. Each time all the ring buffers are full, the
+    // new one is twice as large as the previous one, up to kMaxRingBufferSize, so that upload
+    // heavy workloads end up using a few large rings instead of many small ones.
+    static constexpr uint64_t kMinRingBufferSize = 4 * 1024 * 1024;
+    static constexpr uint64_t kMaxRingBufferSize = 16 * 1024 * 1024;
+
+    // Allocations that don't fit in a ring buffer get a dedicated staging buffer. These are
+    // recycled by size class once the GPU is done with them, and released after not being
+    // reused for kMaxLargeBufferIdleSerials serials or when more than kMaxFreeLargeBufferSize
+    // bytes of them are unused. The unused ones count toward the total allocated size and are
+    // released first when it exceeds the flush threshold.
+    static constexpr uint64_t kMaxLargeBufferIdleSerials = 16;
+    static constexpr uint64_t kMaxFreeLargeBufferSize = 64 * 1024 * 1024;
+
     uint64_t GetTotalAllocatedSize();
 
     struct RingBuffer {
@@ -77,11 +92,28 @@ class DynamicUploader {
         RingBufferAllocator mAllocator;
     };
 
+    struct LargeBuffer {
+        Ref<BufferBase> buffer;
+        ExecutionSerial lastUsedSerial;
+    };
+
     ResultOrError<UploadHandle> AllocateInternal(uint64_t allocationSize,
                                                  ExecutionSerial serial,
                                                  uint64_t offsetAlignment);
+    ResultOrError<UploadHandle> AllocateLargeBuffer(uint64_t allocationSize,
+                                                    ExecutionSerial serial);
+    ResultOrError<Ref<BufferBase>> CreateStagingBuffer(uint64_t size);
+    void RecycleLargeBuffers(ExecutionSerial lastCompletedSerial);
+    void ReleaseFreeLargeBuffers();
 
     std::vector<std::unique_ptr<RingBuffer>> mRingBuffers;
+    uint64_t mNextRingBufferSize = kMinRingBufferSize;
+
+    SerialQueue<ExecutionSerial, LargeBuffer> mInFlightLargeBuffers;
+    // Unused large buffers by size class, ordered from the least to the most recently used.
+    std::map<uint64_t, std::vector<LargeBuffer>> mFreeLargeBuffers;
+    uint64_t mFreeLargeBufferSize = 0;
+
     SerialQueue<ExecutionSerial, Ref<BufferBase>> mReleasedStagingBuffers;
     raw_ptr<DeviceBase> mDevice;
 };
@@ -144,18 +144,15 @@ class SystemEventAndReadyStateIterator {
     WrappedIter mWrappedIt;
 };
 
-// Wait/poll the queue for futures in range [begin, end). `waitSerial` should be
-// the serial after which at least one future should be complete. All futures must
-// have completion data of type QueueAndSerial.
-// Returns true if at least one future is ready. If no futures are ready or the wait
-// timed out, returns false.
-bool WaitQueueSerialsImpl(DeviceBase* device,
-                          QueueBase* queue,
-                          ExecutionSerial waitSerial,
-                          std::vector<TrackedFutureWaitInfo>::iterator begin,
-                          std::vector<TrackedFutureWaitInfo>::iterator end,
-                          Nanoseconds timeout) {
-    bool success = false;
+// Flushes commands up to `waitSerial` if needed and updates the completed serial of the queue,
+// waiting at most `timeout` for `waitSerial` to pass. Returns the completed serial of the queue. If
+// there was an error, the device is lost and kMaxExecutionSerial is returned so that all the futures
+// of the queue are considered ready.
+ExecutionSerial UpdateQueueCompletedSerial(DeviceBase* device,
+                                           QueueBase* queue,
+                                           ExecutionSerial waitSerial,
+                                           Nanoseconds timeout) {
+    ExecutionSerial completedSerial;
     if (device->ConsumedError([&]() -> MaybeError {
             if (waitSerial > queue->GetLastSubmittedCommandSerial()) {
                 // Serial has not been submitted yet. Submit it now.
@@ -167,34 +164,49 @@ bool WaitQueueSerialsImpl(DeviceBase* device,
                 DAWN_TRY(device->Tick());
             }
             // Check the completed serial.
-            ExecutionSerial completedSerial = queue->GetCompletedCommandSerial();
+            completedSerial = queue->GetCompletedCommandSerial();
             if (completedSerial < waitSerial) {
                 if (timeout > Nanoseconds(0)) {
                     // Wait on the serial if it hasn't passed yet.
-                    DAWN_TRY_ASSIGN(success, queue->WaitForQueueSerial(waitSerial, timeout));
+                    [[maybe_unused]] bool waitResult;
+                    DAWN_TRY_ASSIGN(waitResult, queue->WaitForQueueSerial(waitSerial, timeout));
                 }
                 // Update completed serials.
                 DAWN_TRY(queue->CheckPassedSerials());
                 completedSerial = queue->GetCompletedCommandSerial();
             }
-            // Poll futures for completion.
-            for (auto it = begin; it != end; ++it) {
-                ExecutionSerial serial =
-                    std::get<QueueAndSerial>(it->event->GetCompletionData()).completionSerial;
-                if (serial <= completedSerial) {
-                    success = true;
-                    it->ready = true;
-                }
-            }
             return {};
         }())) {
         // There was an error. Pending submit may have failed or waiting for fences
         // may have lost the device. The device is lost inside ConsumedError.
-        // Mark all futures as ready.
-        for (auto it = begin; it != end; ++it) {
+        return kMaxExecutionSerial;
+    }
+    return completedSerial;
+}
+
+// Wait/poll the queue for futures in range [begin, end). `waitSerial` should be
+// the serial after which at least one future should be complete. All futures must
+// have completion data of type QueueAndSerial.
+// Returns true if at least one future is ready. If no futures are ready or the wait
+// timed out, returns false.
+bool WaitQueueSerialsImpl(DeviceBase* device,
+                          QueueBase* queue,
+                          ExecutionSerial waitSerial,
+                          std::vector<TrackedFutureWaitInfo>::iterator begin,
+                          std::vector<TrackedFutureWaitInfo>::iterator end,
+                          Nanoseconds timeout) {
+    ExecutionSerial completedSerial =
+        UpdateQueueCompletedSerial(device, queue, waitSerial, timeout);
+
+    // Poll futures for completion.
+    bool success = false;
+    for (auto it = begin; it != end; ++it) {
+        ExecutionSerial serial =
+            std::get<QueueAndSerial>(it->event->GetCompletionData()).completionSerial;
+        if (serial <= completedSerial) {
+            success = true;
             it->ready = true;
         }
-        success = true;
     }
     return success;
 }
@@ -344,7 +356,7 @@ FutureID EventManager::TrackEvent(Ref<TrackedEvent>&& future) {
         return futureID;
     }
 
-    mEvents->Use([&](auto events) { events->emplace(futureID, std::move(future)); });
+    mEvents->Use([&](auto events) { events->Track(futureID, std::move(future)); });
     return futureID;
 }
 
@@ -352,46 +364,46 @@ bool EventManager::ProcessPollEvents() {
     DAWN_ASSERT(mEvents.has_value());
 
     std::vector<TrackedFutureWaitInfo> futures;
-    wgpu::WaitStatus waitStatus;
-    auto readyEnd = mEvents->Use([&](auto events) {
-        // Iterate all events and record poll events and spontaneous events since they are both
-        // allowed to be completed in the ProcessPoll call. Note that spontaneous events are allowed
-        // to trigger anywhere which is why we include them in the call.
-        futures.reserve(events->size());
-        for (auto& [futureID, event] : *events) {
-            if (event->mCallbackMode != wgpu::CallbackMode::WaitAnyOnly) {
-                futures.push_back(
-                    TrackedFutureWaitInfo{futureID, TrackedEvent::WaitRef{event.Get()}, 0, false});
+    bool hasPollEvents = mEvents->Use([&](auto events) {
+        // Only look at the poll events and spontaneous events since they are both allowed to be
+        // completed in the ProcessPoll call. Note that spontaneous events are allowed to trigger
+        // anywhere which is why we include them in the call.
+        for (auto& [queue, serialEvents] : events->queueSerialPollEvents) {
+            DAWN_ASSERT(!serialEvents.empty());
+            // The events are sorted by serial so only the ones up to the completed serial need to
+            // be visited.
+            ExecutionSerial completedSerial = UpdateQueueCompletedSerial(
+                queue->GetDevice(), queue, serialEvents.begin()->first, Nanoseconds(0));
+            for (auto it = serialEvents.begin();
+                 it != serialEvents.end() && it->first <= completedSerial; ++it) {
+                FutureID futureID = it->second;
+                futures.push_back(TrackedFutureWaitInfo{
+                    futureID, TrackedEvent::WaitRef{events->events.at(futureID).Get()}, 0, true});
             }
         }
-
-        // If there wasn't anything to wait on, we can skip the wait and just return the end.
-        if (futures.size() == 0) {
-            return futures.end();
-        }
-
-        waitStatus = WaitImpl(futures, Nanoseconds(0));
-        if (waitStatus == wgpu::WaitStatus::TimedOut) {
-            // Return the beginning to indicate that nothing completed.
-            return futures.begin();
+        for (FutureID futureID : events->systemEventPollEvents) {
+            TrackedEvent* event = events->events.at(futureID).Get();
+            if (std::get<Ref<SystemEvent>>(event->GetCompletionData())->IsSignaled()) {
+                futures.push_back(
+                    TrackedFutureWaitInfo{futureID, TrackedEvent::WaitRef{event}, 0, true});
+            }
         }
-        DAWN_ASSERT(waitStatus == wgpu::WaitStatus::Success);
 
         // Enforce callback ordering.
-        auto readyEnd = PrepareReadyCallbacks(futures);
+        PrepareReadyCallbacks(futures);
 
         // For all the futures we are about to complete, first ensure they're untracked.
-        for (auto it = futures.begin(); it != readyEnd; ++it) {
-            events->erase(it->futureID);
+        for (const TrackedFutureWaitInfo& future : futures) {
+            events->Untrack(future.futureID);
         }
-        return readyEnd;
+        return events->HasPollEvents();
     });
 
     // Finally, call callbacks.
-    for (auto it = futures.begin(); it != readyEnd; ++it) {
-        it->event->EnsureComplete(EventCompletionType::Ready);
+    for (TrackedFutureWaitInfo& future : futures) {
+        future.event->EnsureComplete(EventCompletionType::Ready);
     }
-    return readyEnd != futures.end();
+    return hasPollEvents;
 }
 
 wgpu::WaitStatus EventManager::WaitAny(size_t count, FutureWaitInfo* infos, Nanoseconds timeout) {
@@ -428,8 +440,8 @@ wgpu::WaitStatus EventManager::WaitAny(size_t count, FutureWaitInfo* infos, Nano
             // same time (unless it's already completed).
 
             // Try to find the event.
-            auto it = events->find(futureID);
-            if (it == events->end()) {
+            auto it = events->events.find(futureID);
+            if (it == events->events.end()) {
                 infos[i].completed = true;
                 anyCompleted = true;
             } else {
@@ -461,7 +473,7 @@ wgpu::WaitStatus EventManager::WaitAny(size_t count, FutureWaitInfo* infos, Nano
     // something actually isn't tracked anymore (because it completed elsewhere while waiting.)
     mEvents->Use([&](auto events) {
         for (auto it = futures.begin(); it != readyEnd; ++it) {
-            events->erase(it->futureID);
+            events->Untrack(it->futureID);
         }
     });
 
@@ -475,6 +487,50 @@ wgpu::WaitStatus EventManager::WaitAny(size_t count, FutureWaitInfo* infos, Nano
     return wgpu::WaitStatus::Success;
 }
 
+// EventManager::TrackedEvents
+
+void EventManager::TrackedEvents::Track(FutureID futureID, Ref<TrackedEvent>&& event) {
+    if (event->mCallbackMode != wgpu::CallbackMode::WaitAnyOnly) {
+        const auto& completionData = event->GetCompletionData();
+        if (std::holds_alternative<QueueAndSerial>(completionData)) {
+            const auto& queueAndSerial = std::get<QueueAndSerial>(completionData);
+            queueSerialPollEvents[queueAndSerial.queue.Get()].emplace(
+                queueAndSerial.completionSerial, futureID);
+        } else {
+            systemEventPollEvents.insert(futureID);
+        }
+    }
+    events.emplace(futureID, std::move(event));
+}
+
+void EventManager::TrackedEvents::Untrack(FutureID futureID) {
+    auto it = events.find(futureID);
+    if (it == events.end()) {
+        return;
+    }
+
+    TrackedEvent* event = it->second.Get();
+    if (event->mCallbackMode != wgpu::CallbackMode::WaitAnyOnly) {
+        const auto& completionData = event->GetCompletionData();
+        if (std::holds_alternative<QueueAndSerial>(completionData)) {
+            const auto& queueAndSerial = std::get<QueueAndSerial>(completionData);
+            auto queueIt = queueSerialPollEvents.find(queueAndSerial.queue.Get());
+            DAWN_ASSERT(queueIt != queueSerialPollEvents.end());
+            queueIt->second.erase({queueAndSerial.completionSerial, futureID});
+            if (queueIt->second.empty()) {
+                queueSerialPollEvents.erase(queueIt);
+            }
+        } else {
+            systemEventPollEvents.erase(futureID);
+        }
+    }
+    events.erase(it);
+}
+
+bool EventManager::TrackedEvents::HasPollEvents() const {
+    return !queueSerialPollEvents.empty() || !systemEventPollEvents.empty();
+}
+
 // EventManager::TrackedEvent
 
 EventManager::TrackedEvent::TrackedEvent(wgpu::CallbackMode callbackMode,
@@ -32,9 +32,12 @@
 #include <cstdint>
 #include <mutex>
 #include <optional>
+#include <set>
+#include <utility>
 #include <variant>
 
 #include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
 #include "dawn/common/FutureUtils.h"
 #include "dawn/common/MutexProtected.h"
 #include "dawn/common/NonCopyable.h"
@@ -87,10 +90,29 @@ class EventManager final : NonMovable {
     // Only 1 thread is allowed to call ProcessEvents at a time. This lock ensures that.
     std::mutex mProcessEventLock;
 
+    using EventMap = absl::flat_hash_map<FutureID, Ref<TrackedEvent>>;
+
+    // All the tracked events, along with an index of the ones that ProcessEvents is allowed to
+    // complete. The index is organized by how events complete so that ProcessPollEvents only looks
+    // at events that may be ready instead of at every tracked event.
+    struct TrackedEvents {
+        void Track(FutureID futureID, Ref<TrackedEvent>&& event);
+        // Stops tracking the event if it is still tracked.
+        void Untrack(FutureID futureID);
+        bool HasPollEvents() const;
+
+        EventMap events;
+        // Queue serial events for each queue, sorted by completion serial. The queues are kept
+        // alive by the events themselves.
+        absl::flat_hash_map<QueueBase*, std::set<std::pair<ExecutionSerial, FutureID>>>
+            queueSerialPollEvents;
+        // System events may be signaled from any thread, so they are still checked one by one.
+        absl::flat_hash_set<FutureID> systemEventPollEvents;
+    };
+
     // Freed once the user has dropped their last ref to the Instance, so can't call WaitAny or
     // ProcessEvents anymore. This breaks reference cycles.
-    using EventMap = absl::flat_hash_map<FutureID, Ref<TrackedEvent>>;
-    std::optional<MutexProtected<EventMap>> mEvents;
+    std::optional<MutexProtected<TrackedEvents>> mEvents;
 };
 
 struct QueueAndSerial {
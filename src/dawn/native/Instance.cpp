@@ -38,7 +38,9 @@
 #include "dawn/native/CallbackTaskManager.h"
 #include "dawn/native/ChainUtils.h"
 #include "dawn/native/Device.h"
+#include "dawn/native/DiskBlobCache.h"
 #include "dawn/native/ErrorData.h"
+#include "dawn/native/MemoryBlobCache.h"
 #include "dawn/native/Surface.h"
 #include "dawn/native/Toggles.h"
 #include "dawn/native/ValidationUtils_autogen.h"
@@ -223,6 +225,13 @@ MaybeError InstanceBase::Initialize(const UnpackedPtr<InstanceDescriptor>& descr
         mBackendValidationLevel = dawnDesc->backendValidationLevel;
         mBeginCaptureOnStartup = dawnDesc->beginCaptureOnStartup;
         mEnableAdapterBlocklist = dawnDesc->enableAdapterBlocklist;
+
+        if (dawnDesc->blobCacheMemoryBudget > 0) {
+            mMemoryBlobCache = std::make_unique<MemoryBlobCache>(dawnDesc->blobCacheMemoryBudget);
+        }
+        if (dawnDesc->blobCacheDirectory != nullptr) {
+            DAWN_TRY_ASSIGN(mDiskBlobCache, DiskBlobCache::Create(dawnDesc->blobCacheDirectory));
+        }
     }
 
     // Default paths to search are next to the shared library, next to the executable, and
@@ -568,6 +577,36 @@ EventManager* InstanceBase::GetEventManager() {
     return &mEventManager;
 }
 
+MemoryBlobCache* InstanceBase::GetMemoryBlobCache() const {
+    return mMemoryBlobCache.get();
+}
+
+DiskBlobCache* InstanceBase::GetDiskBlobCache() const {
+    return mDiskBlobCache.get();
+}
+
+BlobCacheStats InstanceBase::GetBlobCacheStats() const {
+    BlobCacheStats stats;
+    if (mMemoryBlobCache != nullptr) {
+        stats.memoryHits = mMemoryBlobCache->GetHitCount();
+        stats.memoryMisses = mMemoryBlobCache->GetMissCount();
+        stats.memoryBytes = mMemoryBlobCache->GetSize();
+    }
+    if (mDiskBlobCache != nullptr) {
+        stats.diskHits = mDiskBlobCache->GetHitCount();
+        stats.diskMisses = mDiskBlobCache->GetMissCount();
+        stats.diskBytesStored = mDiskBlobCache->GetStoredBytes();
+        stats.diskBytesWritten = mDiskBlobCache->GetWrittenBytes();
+    }
+    return stats;
+}
+
+void InstanceBase::FlushBlobCache() {
+    if (mDiskBlobCache != nullptr) {
+        mDiskBlobCache->Flush();
+    }
+}
+
 void InstanceBase::ConsumeError(std::unique_ptr<ErrorData> error) {
     DAWN_ASSERT(error != nullptr);
     dawn::ErrorLog() << error->GetFormattedMessage();
@@ -60,6 +60,8 @@ namespace dawn::native {
 class AHBFunctions;
 class CallbackTaskManager;
 class DeviceBase;
+class DiskBlobCache;
+class MemoryBlobCache;
 class Surface;
 class X11Functions;
 
@@ -156,6 +158,12 @@ class InstanceBase final : public RefCountedWithExternalCount {
     const Ref<CallbackTaskManager>& GetCallbackTaskManager() const;
     EventManager* GetEventManager();
 
+    // The built-in blob caches shared by the devices. Null if they are disabled.
+    MemoryBlobCache* GetMemoryBlobCache() const;
+    DiskBlobCache* GetDiskBlobCache() const;
+    BlobCacheStats GetBlobCacheStats() const;
+    void FlushBlobCache();
+
     // Get backend-independent libraries that need to be loaded dynamically.
     const X11Functions* GetOrLoadX11Functions();
     const AHBFunctions* GetOrLoadAHBFunctions();
@@ -235,6 +243,9 @@ class InstanceBase final : public RefCountedWithExternalCount {
     std::unique_ptr<AHBFunctions> mAHBFunctions;
 #endif  // DAWN_PLATFORM_IS(ANDROID)
 
+    std::unique_ptr<MemoryBlobCache> mMemoryBlobCache;
+    std::unique_ptr<DiskBlobCache> mDiskBlobCache;
+
     Ref<CallbackTaskManager> mCallbackTaskManager;
     EventManager mEventManager;
 
@@ -0,0 +1,123 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dawn/native/MemoryBlobCache.h"
+
+#include <cstring>
+#include <functional>
+#include <utility>
+
+#include "dawn/common/Assert.h"
+
+namespace dawn::native {
+
+MemoryBlobCache::MemoryBlobCache(size_t budget)
+    : mBudget(budget), mShardBudget(budget / kShardCount) {}
+
+MemoryBlobCache::~MemoryBlobCache() = default;
+
+MemoryBlobCache::Shard& MemoryBlobCache::GetShard(std::string_view key) {
+    return mShards[std::hash<std::string_view>{}(key) % kShardCount];
+}
+
+Blob MemoryBlobCache::Load(std::string_view key) {
+    Shard& shard = GetShard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto it = shard.index.find(key);
+    if (it == shard.index.end()) {
+        mMissCount++;
+        return Blob();
+    }
+    mHitCount++;
+
+    // Move the entry to the front of the list to mark it as the most recently used.
+    shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+
+    // Return a copy so that callers are free to modify or keep the blob after it is evicted.
+    const std::vector<uint8_t>& value = it->second->value;
+    Blob result = CreateBlob(value.size());
+    memcpy(result.Data(), value.data(), value.size());
+    return result;
+}
+
+void MemoryBlobCache::Store(std::string_view key, size_t valueSize, const void* value) {
+    DAWN_ASSERT(value != nullptr);
+    DAWN_ASSERT(valueSize > 0);
+
+    size_t entrySize = key.size() + valueSize;
+    if (entrySize > mShardBudget) {
+        return;
+    }
+
+    Shard& shard = GetShard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto it = shard.index.find(key);
+    if (it != shard.index.end()) {
+        // Keys are derived from the content so the value is the same. Only mark it as used.
+        shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+        return;
+    }
+
+    while (shard.size + entrySize > mShardBudget) {
+        DAWN_ASSERT(!shard.entries.empty());
+        const Entry& evicted = shard.entries.back();
+        shard.size -= evicted.key.size() + evicted.value.size();
+        shard.index.erase(evicted.key);
+        shard.entries.pop_back();
+    }
+
+    const uint8_t* valueBytes = static_cast<const uint8_t*>(value);
+    shard.entries.push_front(
+        Entry{std::string(key), std::vector<uint8_t>(valueBytes, valueBytes + valueSize)});
+    shard.index.emplace(shard.entries.front().key, shard.entries.begin());
+    shard.size += entrySize;
+}
+
+size_t MemoryBlobCache::GetBudget() const {
+    return mBudget;
+}
+
+size_t MemoryBlobCache::GetSize() const {
+    size_t size = 0;
+    for (const Shard& shard : mShards) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        size += shard.size;
+    }
+    return size;
+}
+
+uint64_t MemoryBlobCache::GetHitCount() const {
+    return mHitCount.load();
+}
+
+uint64_t MemoryBlobCache::GetMissCount() const {
+    return mMissCount.load();
+}
+
+}  // namespace dawn::native
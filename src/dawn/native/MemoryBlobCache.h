@@ -0,0 +1,96 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_DAWN_NATIVE_MEMORYBLOBCACHE_H_
+#define SRC_DAWN_NATIVE_MEMORYBLOBCACHE_H_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "dawn/native/Blob.h"
+
+namespace dawn::native {
+
+// An in-process cache of blobs bounded by a budget in bytes, evicting the least recently used
+// blobs first. It is shared by all the devices of an instance and sits in front of the disk
+// cache and of the embedder's cache callbacks. Keys are spread over independently locked shards
+// so that concurrent lookups from different devices and threads rarely contend.
+//
+// Each shard gets an equal part of the budget, so a blob whose key and value together are bigger
+// than budget / kShardCount is never stored in memory. Loads of such blobs always fall through to
+// the tiers behind this cache.
+class MemoryBlobCache {
+  public:
+    explicit MemoryBlobCache(size_t budget);
+    ~MemoryBlobCache();
+
+    // Returns an empty blob if the key is not in the cache.
+    Blob Load(std::string_view key);
+    void Store(std::string_view key, size_t valueSize, const void* value);
+
+    size_t GetBudget() const;
+    // Returns the number of bytes of keys and values currently held in the cache.
+    size_t GetSize() const;
+    uint64_t GetHitCount() const;
+    uint64_t GetMissCount() const;
+
+  private:
+    static constexpr size_t kShardCount = 16;
+
+    struct Entry {
+        std::string key;
+        std::vector<uint8_t> value;
+    };
+    struct Shard {
+        mutable std::mutex mutex;
+        // Ordered from the most to the least recently used. The index points into the list whose
+        // nodes never move, so it can reference the keys stored in the entries.
+        std::list<Entry> entries;
+        absl::flat_hash_map<std::string_view, std::list<Entry>::iterator> index;
+        size_t size = 0;
+    };
+
+    Shard& GetShard(std::string_view key);
+
+    const size_t mBudget;
+    const size_t mShardBudget;
+    std::array<Shard, kShardCount> mShards;
+
+    std::atomic<uint64_t> mHitCount = 0;
+    std::atomic<uint64_t> mMissCount = 0;
+};
+
+}  // namespace dawn::native
+
+#endif  // SRC_DAWN_NATIVE_MEMORYBLOBCACHE_H_
@@ -28,9 +28,12 @@
 #ifndef SRC_DAWN_NATIVE_PASSRESOURCEUSAGE_H_
 #define SRC_DAWN_NATIVE_PASSRESOURCEUSAGE_H_
 
+#include <atomic>
+#include <cstdint>
 #include <vector>
 
 #include "absl/container/flat_hash_set.h"
+#include "dawn/common/ityp_span.h"
 #include "dawn/native/SubresourceStorage.h"
 #include "dawn/native/dawn_platform.h"
 
@@ -63,6 +66,53 @@ bool operator==(const TextureSyncInfo& a, const TextureSyncInfo& b);
 // The texture usage inside passes must be tracked per-subresource.
 using TextureSubresourceSyncInfo = SubresourceStorage<TextureSyncInfo>;
 
+// Intrusive stamp stored in buffers and textures that remembers the SyncScopeUsageTracker that
+// last recorded the resource, and at which index of its resource vectors. It lets the tracker find
+// the usage of a resource without hashing it. Multiple trackers can be live at the same time (for
+// example a render pass and a render bundle being encoded, possibly on different threads) and
+// overwrite each other's stamps, so the stamp is only a hint that the tracker must validate.
+class SyncScopeUsageStamp {
+  public:
+    // Returns true and sets |index| if the stamp was last set by the scope |scopeId|.
+    bool Lookup(uint32_t scopeId, uint32_t* index) const {
+        uint64_t value = mValue.load(std::memory_order_relaxed);
+        if (static_cast<uint32_t>(value >> 32) != scopeId) {
+            return false;
+        }
+        *index = static_cast<uint32_t>(value);
+        return true;
+    }
+
+    void Set(uint32_t scopeId, uint32_t index) {
+        mValue.store((uint64_t(scopeId) << 32) | index, std::memory_order_relaxed);
+    }
+
+  private:
+    std::atomic<uint64_t> mValue{0};
+};
+
+// How the buffers and textures of a bind group are used, computed when the bind group is created so
+// that the pass encoders can track the usages of a SetBindGroup without walking its bindings.
+// Bindings of the same buffer, or of the same texture subresource range, are merged together. The
+// usages are stored after the bindings of the bind group, see
+// BindGroupLayoutInternalBase::GetBindingDataSize.
+struct BindGroupResourceUsage {
+    struct BufferUsage {
+        BufferBase* buffer;
+        wgpu::BufferUsage usage;
+        wgpu::ShaderStage shaderStages;
+    };
+    struct TextureUsage {
+        TextureBase* texture;
+        SubresourceRange range;
+        wgpu::TextureUsage usage;
+        wgpu::ShaderStage shaderStages;
+    };
+
+    ityp::span<uint32_t, BufferUsage> buffers;
+    ityp::span<uint32_t, TextureUsage> textures;
+};
+
 // Which resources are used by a synchronization scope and how they are used. The command
 // buffer validation pre-computes this information so that backends with explicit barriers
 // don't have to re-compute it.
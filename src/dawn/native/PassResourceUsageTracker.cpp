@@ -27,9 +27,10 @@
 
 #include "dawn/native/PassResourceUsageTracker.h"
 
+#include <algorithm>
+#include <atomic>
 #include <utility>
 
-#include "dawn/common/MatchVariant.h"
 #include "dawn/native/BindGroup.h"
 #include "dawn/native/Buffer.h"
 #include "dawn/native/EnumMaskIterator.h"
@@ -40,7 +41,73 @@
 
 namespace dawn::native {
 
-SyncScopeUsageTracker::SyncScopeUsageTracker() = default;
+namespace {
+
+// Once a scope holds this number of resources of a kind, resources whose stamp was overwritten by
+// another scope are looked up in a hash map instead of with a linear search.
+constexpr size_t kMaxLinearSearchResourceCount = 16;
+
+uint32_t AcquireSyncScopeId() {
+    // Scope IDs are process-wide because resources can be used by encoders of different devices
+    // and threads. Wrapping around is harmless since stamps are always validated.
+    static std::atomic<uint32_t> sNextScopeId{1};
+    return sNextScopeId.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Returns the index of |resource| in |resources|, appending it if it isn't part of the scope yet
+// in which case |added| is set to true. The caller must then append its sync info at that index.
+template <typename T>
+uint32_t GetOrAddResourceIndex(uint32_t scopeId,
+                               T* resource,
+                               std::vector<T*>* resources,
+                               absl::flat_hash_map<T*, uint32_t>* indices,
+                               bool* added) {
+    *added = false;
+
+    // Fast path: the resource was already recorded in this scope and its stamp is still ours.
+    SyncScopeUsageStamp& stamp = resource->GetSyncScopeUsageStamp();
+    uint32_t index;
+    if (stamp.Lookup(scopeId, &index) && index < resources->size() &&
+        (*resources)[index] == resource) {
+        return index;
+    }
+
+    // The resource is either new in this scope or its stamp was overwritten by another scope
+    // that is being recorded at the same time.
+    if (resources->size() < kMaxLinearSearchResourceCount) {
+        auto it = std::find(resources->begin(), resources->end(), resource);
+        if (it != resources->end()) {
+            index = static_cast<uint32_t>(it - resources->begin());
+            stamp.Set(scopeId, index);
+            return index;
+        }
+    } else {
+        // The hash map is only filled once the scope is too big for a linear search, then a
+        // single lookup both finds the resource and reserves its index if it is new.
+        if (indices->empty()) {
+            for (uint32_t i = 0; i < resources->size(); ++i) {
+                indices->emplace((*resources)[i], i);
+            }
+        }
+        auto [it, inserted] =
+            indices->try_emplace(resource, static_cast<uint32_t>(resources->size()));
+        if (!inserted) {
+            index = it->second;
+            stamp.Set(scopeId, index);
+            return index;
+        }
+    }
+
+    index = static_cast<uint32_t>(resources->size());
+    resources->push_back(resource);
+    stamp.Set(scopeId, index);
+    *added = true;
+    return index;
+}
+
+}  // anonymous namespace
+
+SyncScopeUsageTracker::SyncScopeUsageTracker() : mScopeId(AcquireSyncScopeId()) {}
 
 SyncScopeUsageTracker::SyncScopeUsageTracker(SyncScopeUsageTracker&&) = default;
 
@@ -51,14 +118,46 @@ SyncScopeUsageTracker& SyncScopeUsageTracker::operator=(SyncScopeUsageTracker&&)
 void SyncScopeUsageTracker::BufferUsedAs(BufferBase* buffer,
                                          wgpu::BufferUsage usage,
                                          wgpu::ShaderStage shaderStages) {
-    // std::map's operator[] will create a new element using the default constructor
-    // if the key didn't exist before.
-    BufferSyncInfo& bufferSyncInfo = mBufferSyncInfos[buffer];
+    if (mUsage.buffers.empty()) {
+        // Consecutive scopes, like the dispatches of a compute pass, usually use a similar number
+        // of resources. Reserve for as many as the previous scope used so that the vectors don't
+        // grow one resource at a time.
+        mUsage.buffers.reserve(mPreviousBufferCount);
+        mUsage.bufferSyncInfos.reserve(mPreviousBufferCount);
+    }
+
+    bool added;
+    uint32_t index =
+        GetOrAddResourceIndex(mScopeId, buffer, &mUsage.buffers, &mBufferIndices, &added);
+    if (added) {
+        mUsage.bufferSyncInfos.emplace_back();
+    }
+    BufferSyncInfo& bufferSyncInfo = mUsage.bufferSyncInfos[index];
 
     bufferSyncInfo.usage |= usage;
     bufferSyncInfo.shaderStages |= shaderStages;
 }
 
+TextureSubresourceSyncInfo& SyncScopeUsageTracker::GetOrCreateTextureSyncInfo(
+    TextureBase* texture) {
+    if (mUsage.textures.empty()) {
+        mUsage.textures.reserve(mPreviousTextureCount);
+        mUsage.textureSyncInfos.reserve(mPreviousTextureCount);
+    }
+
+    bool added;
+    uint32_t index =
+        GetOrAddResourceIndex(mScopeId, texture, &mUsage.textures, &mTextureIndices, &added);
+    if (added) {
+        // Create a new TextureSubresourceSyncInfo for that texture (initially filled with
+        // wgpu::TextureUsage::None and WGPUShaderStage_None)
+        mUsage.textureSyncInfos.emplace_back(
+            texture->GetFormat().aspects, texture->GetArrayLayers(), texture->GetNumMipLevels(),
+            TextureSyncInfo{wgpu::TextureUsage::None, wgpu::ShaderStage::None});
+    }
+    return mUsage.textureSyncInfos[index];
+}
+
 void SyncScopeUsageTracker::TextureViewUsedAs(TextureViewBase* view,
                                               wgpu::TextureUsage usage,
                                               wgpu::ShaderStage shaderStages) {
@@ -69,13 +168,7 @@ void SyncScopeUsageTracker::TextureRangeUsedAs(TextureBase* texture,
                                                const SubresourceRange& range,
                                                wgpu::TextureUsage usage,
                                                wgpu::ShaderStage shaderStages) {
-    // Get or create a new TextureSubresourceSyncInfo for that texture (initially filled with
-    // wgpu::TextureUsage::None and WGPUShaderStage_None)
-    auto it = mTextureSyncInfos.try_emplace(
-        texture, texture->GetFormat().aspects, texture->GetArrayLayers(),
-        texture->GetNumMipLevels(),
-        TextureSyncInfo{wgpu::TextureUsage::None, wgpu::ShaderStage::None});
-    TextureSubresourceSyncInfo& textureSyncInfo = it.first->second;
+    TextureSubresourceSyncInfo& textureSyncInfo = GetOrCreateTextureSyncInfo(texture);
 
     textureSyncInfo.Update(
         range, [usage, shaderStages](const SubresourceRange&, TextureSyncInfo* storedSyncInfo) {
@@ -87,13 +180,7 @@ void SyncScopeUsageTracker::TextureRangeUsedAs(TextureBase* texture,
 void SyncScopeUsageTracker::AddRenderBundleTextureUsage(
     TextureBase* texture,
     const TextureSubresourceSyncInfo& textureSyncInfo) {
-    // Get or create a new TextureSubresourceSyncInfo for that texture (initially filled with
-    // wgpu::TextureUsage::None and WGPUShaderStage_None)
-    auto it = mTextureSyncInfos.try_emplace(
-        texture, texture->GetFormat().aspects, texture->GetArrayLayers(),
-        texture->GetNumMipLevels(),
-        TextureSyncInfo{wgpu::TextureUsage::None, wgpu::ShaderStage::None});
-    TextureSubresourceSyncInfo* passTextureSyncInfo = &it.first->second;
+    TextureSubresourceSyncInfo* passTextureSyncInfo = &GetOrCreateTextureSyncInfo(texture);
 
     passTextureSyncInfo->Merge(
         textureSyncInfo, [](const SubresourceRange&, TextureSyncInfo* storedSyncInfo,
@@ -105,62 +192,19 @@ void SyncScopeUsageTracker::AddRenderBundleTextureUsage(
 }
 
 void SyncScopeUsageTracker::AddBindGroup(BindGroupBase* group) {
-    for (BindingIndex bindingIndex{0}; bindingIndex < group->GetLayout()->GetBindingCount();
-         ++bindingIndex) {
-        const BindingInfo& bindingInfo = group->GetLayout()->GetBindingInfo(bindingIndex);
-
-        MatchVariant(
-            bindingInfo.bindingLayout,
-            [&](const BufferBindingLayout& layout) {
-                BufferBase* buffer = group->GetBindingAsBufferBinding(bindingIndex).buffer;
-                switch (layout.type) {
-                    case wgpu::BufferBindingType::Uniform:
-                        BufferUsedAs(buffer, wgpu::BufferUsage::Uniform, bindingInfo.visibility);
-                        break;
-                    case wgpu::BufferBindingType::Storage:
-                        BufferUsedAs(buffer, wgpu::BufferUsage::Storage, bindingInfo.visibility);
-                        break;
-                    case kInternalStorageBufferBinding:
-                        BufferUsedAs(buffer, kInternalStorageBuffer, bindingInfo.visibility);
-                        break;
-                    case wgpu::BufferBindingType::ReadOnlyStorage:
-                        BufferUsedAs(buffer, kReadOnlyStorageBuffer, bindingInfo.visibility);
-                        break;
-                    case wgpu::BufferBindingType::Undefined:
-                        DAWN_UNREACHABLE();
-                }
-            },
-            [&](const TextureBindingLayout& layout) {
-                TextureViewBase* view = group->GetBindingAsTextureView(bindingIndex);
-                switch (layout.sampleType) {
-                    case kInternalResolveAttachmentSampleType:
-                        TextureViewUsedAs(view, kResolveAttachmentLoadingUsage,
-                                          bindingInfo.visibility);
-                        break;
-                    default:
-                        TextureViewUsedAs(view, wgpu::TextureUsage::TextureBinding,
-                                          bindingInfo.visibility);
-                        break;
-                }
-            },
-            [&](const StorageTextureBindingLayout& layout) {
-                TextureViewBase* view = group->GetBindingAsTextureView(bindingIndex);
-                switch (layout.access) {
-                    case wgpu::StorageTextureAccess::WriteOnly:
-                        TextureViewUsedAs(view, kWriteOnlyStorageTexture, bindingInfo.visibility);
-                        break;
-                    case wgpu::StorageTextureAccess::ReadWrite:
-                        TextureViewUsedAs(view, wgpu::TextureUsage::StorageBinding,
-                                          bindingInfo.visibility);
-                        break;
-                    case wgpu::StorageTextureAccess::ReadOnly:
-                        TextureViewUsedAs(view, kReadOnlyStorageTexture, bindingInfo.visibility);
-                        break;
-                    case wgpu::StorageTextureAccess::Undefined:
-                        DAWN_UNREACHABLE();
-                }
-            },
-            [&](const SamplerBindingLayout&) {});
+    bool added;
+    GetOrAddResourceIndex(mScopeId, group, &mBindGroups, &mBindGroupIndices, &added);
+    if (!added) {
+        return;
+    }
+
+    const BindGroupResourceUsage& usage = group->GetResourceUsage();
+    for (const BindGroupResourceUsage::BufferUsage& bufferUsage : usage.buffers) {
+        BufferUsedAs(bufferUsage.buffer, bufferUsage.usage, bufferUsage.shaderStages);
+    }
+    for (const BindGroupResourceUsage::TextureUsage& textureUsage : usage.textures) {
+        TextureRangeUsedAs(textureUsage.texture, textureUsage.range, textureUsage.usage,
+                           textureUsage.shaderStages);
     }
 
     for (const Ref<ExternalTextureBase>& externalTexture : group->GetBoundExternalTextures()) {
@@ -169,29 +213,19 @@ void SyncScopeUsageTracker::AddBindGroup(BindGroupBase* group) {
 }
 
 SyncScopeResourceUsage SyncScopeUsageTracker::AcquireSyncScopeUsage() {
-    SyncScopeResourceUsage result;
-    result.buffers.reserve(mBufferSyncInfos.size());
-    result.bufferSyncInfos.reserve(mBufferSyncInfos.size());
-    result.textures.reserve(mTextureSyncInfos.size());
-    result.textureSyncInfos.reserve(mTextureSyncInfos.size());
-
-    for (auto& [buffer, syncInfo] : mBufferSyncInfos) {
-        result.buffers.push_back(buffer);
-        result.bufferSyncInfos.push_back(std::move(syncInfo));
-    }
-
-    for (auto& [texture, syncInfo] : mTextureSyncInfos) {
-        result.textures.push_back(texture);
-        result.textureSyncInfos.push_back(std::move(syncInfo));
-    }
-
-    for (auto* const it : mExternalTextureUsages) {
-        result.externalTextures.push_back(it);
-    }
-
-    mBufferSyncInfos.clear();
-    mTextureSyncInfos.clear();
+    SyncScopeResourceUsage result = std::move(mUsage);
+    result.externalTextures.assign(mExternalTextureUsages.begin(), mExternalTextureUsages.end());
+
+    // Start a new scope so that the stamps set by the acquired one are ignored.
+    mScopeId = AcquireSyncScopeId();
+    mUsage = {};
+    mPreviousBufferCount = result.buffers.size();
+    mPreviousTextureCount = result.textures.size();
     mExternalTextureUsages.clear();
+    mBufferIndices.clear();
+    mTextureIndices.clear();
+    mBindGroups.clear();
+    mBindGroupIndices.clear();
 
     return result;
 }
@@ -209,23 +243,12 @@ void ComputePassResourceUsageTracker::AddReferencedBuffer(BufferBase* buffer) {
 }
 
 void ComputePassResourceUsageTracker::AddResourcesReferencedByBindGroup(BindGroupBase* group) {
-    for (BindingIndex index{0}; index < group->GetLayout()->GetBindingCount(); ++index) {
-        const BindingInfo& bindingInfo = group->GetLayout()->GetBindingInfo(index);
-
-        MatchVariant(
-            bindingInfo.bindingLayout,
-            [&](const BufferBindingLayout&) {
-                mUsage.referencedBuffers.insert(group->GetBindingAsBufferBinding(index).buffer);
-            },
-            [&](const TextureBindingLayout&) {
-                mUsage.referencedTextures.insert(
-                    group->GetBindingAsTextureView(index)->GetTexture());
-            },
-            [&](const StorageTextureBindingLayout&) {
-                mUsage.referencedTextures.insert(
-                    group->GetBindingAsTextureView(index)->GetTexture());
-            },
-            [](const SamplerBindingLayout&) {});
+    const BindGroupResourceUsage& usage = group->GetResourceUsage();
+    for (const BindGroupResourceUsage::BufferUsage& bufferUsage : usage.buffers) {
+        mUsage.referencedBuffers.insert(bufferUsage.buffer);
+    }
+    for (const BindGroupResourceUsage::TextureUsage& textureUsage : usage.textures) {
+        mUsage.referencedTextures.insert(textureUsage.texture);
     }
 
     for (const Ref<ExternalTextureBase>& externalTexture : group->GetBoundExternalTextures()) {
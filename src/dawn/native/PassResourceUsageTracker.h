@@ -68,16 +68,38 @@ class SyncScopeUsageTracker {
     void AddRenderBundleTextureUsage(TextureBase* texture,
                                      const TextureSubresourceSyncInfo& textureSyncInfo);
 
-    // Walks the bind groups and tracks all its resources.
+    // Tracks all the resources of the bind group, unless it was already added to this scope.
     void AddBindGroup(BindGroupBase* group);
 
     // Returns the per-pass usage for use by backends for APIs with explicit barriers.
     SyncScopeResourceUsage AcquireSyncScopeUsage();
 
   private:
-    absl::flat_hash_map<BufferBase*, BufferSyncInfo> mBufferSyncInfos;
-    absl::flat_hash_map<TextureBase*, TextureSubresourceSyncInfo> mTextureSyncInfos;
+    TextureSubresourceSyncInfo& GetOrCreateTextureSyncInfo(TextureBase* texture);
+
+    // Identifies this scope in the SyncScopeUsageStamp of the resources it records, so that the
+    // usage of a resource can be found in the dense vectors of mUsage without hashing it.
+    uint32_t mScopeId;
+
+    // The buffers and textures are stored directly in the layout of SyncScopeResourceUsage. The
+    // external textures are deduplicated with a set and only added on AcquireSyncScopeUsage.
+    SyncScopeResourceUsage mUsage;
     absl::flat_hash_set<ExternalTextureBase*> mExternalTextureUsages;
+
+    // The number of buffers and textures of the previously acquired scope, used to reserve the
+    // vectors of the next one.
+    size_t mPreviousBufferCount = 0;
+    size_t mPreviousTextureCount = 0;
+
+    // Fallback to find the index of resources whose stamp was overwritten by another scope. They
+    // are only filled when the scope is too big for a linear search to be efficient.
+    absl::flat_hash_map<BufferBase*, uint32_t> mBufferIndices;
+    absl::flat_hash_map<TextureBase*, uint32_t> mTextureIndices;
+
+    // The bind groups already added to this scope, found with the same stamp mechanism as
+    // resources. Bind groups are immutable so adding the same one again doesn't change the usage.
+    std::vector<BindGroupBase*> mBindGroups;
+    absl::flat_hash_map<BindGroupBase*, uint32_t> mBindGroupIndices;
 };
 
 // Helper class to build ComputePassResourceUsages
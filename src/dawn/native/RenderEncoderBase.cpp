@@ -29,6 +29,7 @@
 
 #include <math.h>
 #include <cstring>
+#include <limits>
 #include <utility>
 
 #include "dawn/common/Constants.h"
@@ -98,6 +99,31 @@ Ref<AttachmentState> RenderEncoderBase::AcquireAttachmentState() {
     return std::move(mAttachmentState);
 }
 
+// static
+template <typename BatchCmd, typename DrawCmdType>
+DrawCmdType* RenderEncoderBase::RecordBatchedDraw(CommandAllocator* allocator,
+                                                  Command batchCommand,
+                                                  LastDrawBatch<BatchCmd, DrawCmdType>* lastBatch) {
+    if (lastBatch->drawCount > 0 && lastBatch->drawCount < std::numeric_limits<uint32_t>::max()) {
+        DrawCmdType* draw =
+            allocator->TryExtendData(lastBatch->draws.get(), lastBatch->drawCount, 1);
+        if (draw != nullptr) {
+            lastBatch->drawCount++;
+            lastBatch->batch->drawCount = lastBatch->drawCount;
+            return draw;
+        }
+    }
+
+    BatchCmd* batch = allocator->Allocate<BatchCmd>(batchCommand);
+    batch->drawCount = 1;
+    DrawCmdType* draw = allocator->AllocateData<DrawCmdType>(1);
+
+    lastBatch->batch = batch;
+    lastBatch->draws = draw;
+    lastBatch->drawCount = 1;
+    return draw;
+}
+
 void RenderEncoderBase::APIDraw(uint32_t vertexCount,
                                 uint32_t instanceCount,
                                 uint32_t firstVertex,
@@ -130,7 +156,7 @@ void RenderEncoderBase::APIDraw(uint32_t vertexCount,
                                                                                     firstInstance));
             }
 
-            DrawCmd* draw = allocator->Allocate<DrawCmd>(Command::Draw);
+            DrawCmd* draw = RecordBatchedDraw(allocator, Command::DrawBatch, &mLastDrawBatch);
             draw->vertexCount = vertexCount;
             draw->instanceCount = instanceCount;
             draw->firstVertex = firstVertex;
@@ -181,7 +207,8 @@ void RenderEncoderBase::APIDrawIndexed(uint32_t indexCount,
                                                                                     firstInstance));
             }
 
-            DrawIndexedCmd* draw = allocator->Allocate<DrawIndexedCmd>(Command::DrawIndexed);
+            DrawIndexedCmd* draw =
+                RecordBatchedDraw(allocator, Command::DrawIndexedBatch, &mLastDrawIndexedBatch);
             draw->indexCount = indexCount;
             draw->instanceCount = instanceCount;
             draw->firstIndex = firstIndex;
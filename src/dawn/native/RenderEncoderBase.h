@@ -30,6 +30,7 @@
 
 #include "dawn/native/AttachmentState.h"
 #include "dawn/native/CommandBufferStateTracker.h"
+#include "dawn/native/Commands.h"
 #include "dawn/native/Error.h"
 #include "dawn/native/IndirectDrawMetadata.h"
 #include "dawn/native/PassResourceUsageTracker.h"
@@ -94,6 +95,22 @@ class RenderEncoderBase : public ProgrammableEncoder {
     uint64_t mDrawCount = 0;
 
   private:
+    // The batch of draws recorded last and its data. A draw is appended to it if nothing else was
+    // recorded since, which the allocator checks before mLastDrawBatch is used.
+    template <typename BatchCmd, typename DrawCmdType>
+    struct LastDrawBatch {
+        raw_ptr<BatchCmd> batch = nullptr;
+        raw_ptr<DrawCmdType, AllowPtrArithmetic> draws = nullptr;
+        uint32_t drawCount = 0;
+    };
+    template <typename BatchCmd, typename DrawCmdType>
+    static DrawCmdType* RecordBatchedDraw(CommandAllocator* allocator,
+                                          Command batchCommand,
+                                          LastDrawBatch<BatchCmd, DrawCmdType>* lastBatch);
+
+    LastDrawBatch<DrawBatchCmd, DrawCmd> mLastDrawBatch;
+    LastDrawBatch<DrawIndexedBatchCmd, DrawIndexedCmd> mLastDrawIndexedBatch;
+
     Ref<AttachmentState> mAttachmentState;
     const bool mDisableBaseVertex;
     const bool mDisableBaseInstance;
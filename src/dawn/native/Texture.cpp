@@ -1150,6 +1150,10 @@ SharedTextureMemoryContents* TextureBase::GetSharedTextureMemoryContents() const
     return mSharedTextureMemoryContents.Get();
 }
 
+SyncScopeUsageStamp& TextureBase::GetSyncScopeUsageStamp() {
+    return mSyncScopeUsageStamp;
+}
+
 void TextureBase::APIDestroy() {
     Destroy();
 }
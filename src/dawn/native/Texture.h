@@ -37,6 +37,7 @@
 #include "dawn/native/Format.h"
 #include "dawn/native/Forward.h"
 #include "dawn/native/ObjectBase.h"
+#include "dawn/native/PassResourceUsage.h"
 #include "dawn/native/SharedTextureMemory.h"
 #include "dawn/native/Subresource.h"
 #include "partition_alloc/pointers/raw_ref.h"
@@ -149,6 +150,8 @@ class TextureBase : public ApiObjectBase {
 
     SharedTextureMemoryContents* GetSharedTextureMemoryContents() const;
 
+    SyncScopeUsageStamp& GetSyncScopeUsageStamp();
+
     // Dawn API
     TextureViewBase* APICreateView(const TextureViewDescriptor* descriptor = nullptr);
     TextureViewBase* APICreateErrorView(const TextureViewDescriptor* descriptor = nullptr);
@@ -203,6 +206,8 @@ class TextureBase : public ApiObjectBase {
 
     // TODO(crbug.com/dawn/845): Use a more optimized data structure to save space
     std::vector<bool> mIsSubresourceContentInitializedAtIndex;
+
+    SyncScopeUsageStamp mSyncScopeUsageStamp;
 };
 
 class TextureViewBase : public ApiObjectBase {
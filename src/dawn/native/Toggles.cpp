@@ -521,6 +521,20 @@ static constexpr ToggleEnumAndInfoList kToggleNameAndInfoList = {{
       "waiting for the next Tick. This enables using the stack trace in which the uncaptured error "
       "occured when breaking into the uncaptured error callback.",
       "https://crbug.com/dawn/1789", ToggleStage::Device}},
+    {Toggle::VulkanUseTimelineSemaphore,
+     {"vulkan_use_timeline_semaphore",
+      "Track the completion of queue submits with a single timeline semaphore signaled to the "
+      "submit's serial instead of a VkFence per submit, when VK_KHR_timeline_semaphore is "
+      "supported.",
+      "https://crbug.com/dawn/1413", ToggleStage::Device}},
+    {Toggle::VulkanUseDynamicRendering,
+     {"vulkan_use_dynamic_rendering",
+      "Begin render passes with vkCmdBeginRendering and create render pipelines with "
+      "VkPipelineRenderingCreateInfo instead of using VkRenderPass and VkFramebuffer objects, when "
+      "VK_KHR_dynamic_rendering is supported.",
+      "https://registry.khronos.org/vulkan/specs/1.3-extensions/man/html/"
+      "VK_KHR_dynamic_rendering.html",
+      ToggleStage::Device}},
     {Toggle::NoWorkaroundSampleMaskBecomesZeroForAllButLastColorTarget,
      {"no_workaround_sample_mask_becomes_zero_for_all_but_last_color_target",
       "MacOS 12.0+ Intel has a bug where the sample mask is only applied for the last color "
@@ -632,29 +632,37 @@ MaybeError CommandBuffer::ExecuteRenderPass(
 
     auto DoRenderBundleCommand = [&](CommandIterator* iter, Command type) -> MaybeError {
         switch (type) {
-            case Command::Draw: {
-                DrawCmd* draw = iter->NextCommand<DrawCmd>();
+            case Command::DrawBatch: {
+                DrawBatchCmd* batch = iter->NextCommand<DrawBatchCmd>();
+                DrawCmd* draws = iter->NextData<DrawCmd>(batch->drawCount);
 
                 DAWN_TRY(bindGroupTracker.Apply());
                 vertexBufferTracker.Apply(lastPipeline);
-                DAWN_TRY(RecordFirstIndexOffset(lastPipeline, commandContext, draw->firstVertex,
-                                                draw->firstInstance));
-                commandContext->GetD3D11DeviceContext4()->DrawInstanced(
-                    draw->vertexCount, draw->instanceCount, draw->firstVertex, draw->firstInstance);
+                for (uint32_t i = 0; i < batch->drawCount; ++i) {
+                    const DrawCmd& draw = draws[i];
+                    DAWN_TRY(RecordFirstIndexOffset(lastPipeline, commandContext, draw.firstVertex,
+                                                    draw.firstInstance));
+                    commandContext->GetD3D11DeviceContext4()->DrawInstanced(
+                        draw.vertexCount, draw.instanceCount, draw.firstVertex, draw.firstInstance);
+                }
 
                 break;
             }
 
-            case Command::DrawIndexed: {
-                DrawIndexedCmd* draw = iter->NextCommand<DrawIndexedCmd>();
+            case Command::DrawIndexedBatch: {
+                DrawIndexedBatchCmd* batch = iter->NextCommand<DrawIndexedBatchCmd>();
+                DrawIndexedCmd* draws = iter->NextData<DrawIndexedCmd>(batch->drawCount);
 
                 DAWN_TRY(bindGroupTracker.Apply());
                 vertexBufferTracker.Apply(lastPipeline);
-                DAWN_TRY(RecordFirstIndexOffset(lastPipeline, commandContext, draw->baseVertex,
-                                                draw->firstInstance));
-                commandContext->GetD3D11DeviceContext4()->DrawIndexedInstanced(
-                    draw->indexCount, draw->instanceCount, draw->firstIndex, draw->baseVertex,
-                    draw->firstInstance);
+                for (uint32_t i = 0; i < batch->drawCount; ++i) {
+                    const DrawIndexedCmd& draw = draws[i];
+                    DAWN_TRY(RecordFirstIndexOffset(lastPipeline, commandContext, draw.baseVertex,
+                                                    draw.firstInstance));
+                    commandContext->GetD3D11DeviceContext4()->DrawIndexedInstanced(
+                        draw.indexCount, draw.instanceCount, draw.firstIndex, draw.baseVertex,
+                        draw.firstInstance);
+                }
 
                 break;
             }
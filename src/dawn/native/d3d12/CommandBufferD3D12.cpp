@@ -1541,28 +1541,36 @@ MaybeError CommandBuffer::RecordRenderPass(CommandRecordingContext* commandConte
 
     auto EncodeRenderBundleCommand = [&](CommandIterator* iter, Command type) -> MaybeError {
         switch (type) {
-            case Command::Draw: {
-                DrawCmd* draw = iter->NextCommand<DrawCmd>();
+            case Command::DrawBatch: {
+                DrawBatchCmd* batch = iter->NextCommand<DrawBatchCmd>();
+                DrawCmd* draws = iter->NextData<DrawCmd>(batch->drawCount);
 
                 DAWN_TRY(bindingTracker->Apply(commandContext));
                 vertexBufferTracker.Apply(commandList, lastPipeline);
-                RecordFirstIndexOffset(commandList, lastPipeline, draw->firstVertex,
-                                       draw->firstInstance);
-                commandList->DrawInstanced(draw->vertexCount, draw->instanceCount,
-                                           draw->firstVertex, draw->firstInstance);
+                for (uint32_t i = 0; i < batch->drawCount; ++i) {
+                    const DrawCmd& draw = draws[i];
+                    RecordFirstIndexOffset(commandList, lastPipeline, draw.firstVertex,
+                                           draw.firstInstance);
+                    commandList->DrawInstanced(draw.vertexCount, draw.instanceCount,
+                                               draw.firstVertex, draw.firstInstance);
+                }
                 break;
             }
 
-            case Command::DrawIndexed: {
-                DrawIndexedCmd* draw = iter->NextCommand<DrawIndexedCmd>();
+            case Command::DrawIndexedBatch: {
+                DrawIndexedBatchCmd* batch = iter->NextCommand<DrawIndexedBatchCmd>();
+                DrawIndexedCmd* draws = iter->NextData<DrawIndexedCmd>(batch->drawCount);
 
                 DAWN_TRY(bindingTracker->Apply(commandContext));
                 vertexBufferTracker.Apply(commandList, lastPipeline);
-                RecordFirstIndexOffset(commandList, lastPipeline, draw->baseVertex,
-                                       draw->firstInstance);
-                commandList->DrawIndexedInstanced(draw->indexCount, draw->instanceCount,
-                                                  draw->firstIndex, draw->baseVertex,
-                                                  draw->firstInstance);
+                for (uint32_t i = 0; i < batch->drawCount; ++i) {
+                    const DrawIndexedCmd& draw = draws[i];
+                    RecordFirstIndexOffset(commandList, lastPipeline, draw.baseVertex,
+                                           draw.firstInstance);
+                    commandList->DrawIndexedInstanced(draw.indexCount, draw.instanceCount,
+                                                      draw.firstIndex, draw.baseVertex,
+                                                      draw.firstInstance);
+                }
                 break;
             }
 
@@ -1484,65 +1484,73 @@ MaybeError CommandBuffer::EncodeRenderPass(id<MTLRenderCommandEncoder> encoder,
 
     auto EncodeRenderBundleCommand = [&](CommandIterator* iter, Command type) {
         switch (type) {
-            case Command::Draw: {
-                DrawCmd* draw = iter->NextCommand<DrawCmd>();
+            case Command::DrawBatch: {
+                DrawBatchCmd* batch = iter->NextCommand<DrawBatchCmd>();
+                DrawCmd* draws = iter->NextData<DrawCmd>(batch->drawCount);
 
                 vertexBuffers.Apply(encoder, lastPipeline, enableVertexPulling);
                 bindGroups.Apply(encoder);
                 storageBufferLengths.Apply(encoder, lastPipeline, enableVertexPulling);
-
-                // The instance count must be non-zero, otherwise no-op
-                if (draw->instanceCount != 0) {
-                    // MTLFeatureSet_iOS_GPUFamily3_v1 does not support baseInstance
-                    if (draw->firstInstance == 0) {
-                        [encoder drawPrimitives:lastPipeline->GetMTLPrimitiveTopology()
-                                    vertexStart:draw->firstVertex
-                                    vertexCount:draw->vertexCount
-                                  instanceCount:draw->instanceCount];
-                        didDrawInCurrentOcclusionQuery = true;
-                    } else {
-                        [encoder drawPrimitives:lastPipeline->GetMTLPrimitiveTopology()
-                                    vertexStart:draw->firstVertex
-                                    vertexCount:draw->vertexCount
-                                  instanceCount:draw->instanceCount
-                                   baseInstance:draw->firstInstance];
-                        didDrawInCurrentOcclusionQuery = true;
+                for (uint32_t i = 0; i < batch->drawCount; ++i) {
+                    DrawCmd* draw = &draws[i];
+
+                    // The instance count must be non-zero, otherwise no-op
+                    if (draw->instanceCount != 0) {
+                        // MTLFeatureSet_iOS_GPUFamily3_v1 does not support baseInstance
+                        if (draw->firstInstance == 0) {
+                            [encoder drawPrimitives:lastPipeline->GetMTLPrimitiveTopology()
+                                        vertexStart:draw->firstVertex
+                                        vertexCount:draw->vertexCount
+                                      instanceCount:draw->instanceCount];
+                            didDrawInCurrentOcclusionQuery = true;
+                        } else {
+                            [encoder drawPrimitives:lastPipeline->GetMTLPrimitiveTopology()
+                                        vertexStart:draw->firstVertex
+                                        vertexCount:draw->vertexCount
+                                      instanceCount:draw->instanceCount
+                                       baseInstance:draw->firstInstance];
+                            didDrawInCurrentOcclusionQuery = true;
+                        }
                     }
                 }
                 break;
             }
 
-            case Command::DrawIndexed: {
-                DrawIndexedCmd* draw = iter->NextCommand<DrawIndexedCmd>();
+            case Command::DrawIndexedBatch: {
+                DrawIndexedBatchCmd* batch = iter->NextCommand<DrawIndexedBatchCmd>();
+                DrawIndexedCmd* draws = iter->NextData<DrawIndexedCmd>(batch->drawCount);
 
                 vertexBuffers.Apply(encoder, lastPipeline, enableVertexPulling);
                 bindGroups.Apply(encoder);
                 storageBufferLengths.Apply(encoder, lastPipeline, enableVertexPulling);
-
-                // The index and instance count must be non-zero, otherwise no-op
-                if (draw->indexCount != 0 && draw->instanceCount != 0) {
-                    // MTLFeatureSet_iOS_GPUFamily3_v1 does not support baseInstance and
-                    // baseVertex.
-                    if (draw->baseVertex == 0 && draw->firstInstance == 0) {
-                        [encoder drawIndexedPrimitives:lastPipeline->GetMTLPrimitiveTopology()
-                                            indexCount:draw->indexCount
-                                             indexType:indexBufferType
-                                           indexBuffer:indexBuffer
-                                     indexBufferOffset:indexBufferBaseOffset +
-                                                       draw->firstIndex * indexFormatSize
-                                         instanceCount:draw->instanceCount];
-                        didDrawInCurrentOcclusionQuery = true;
-                    } else {
-                        [encoder drawIndexedPrimitives:lastPipeline->GetMTLPrimitiveTopology()
-                                            indexCount:draw->indexCount
-                                             indexType:indexBufferType
-                                           indexBuffer:indexBuffer
-                                     indexBufferOffset:indexBufferBaseOffset +
-                                                       draw->firstIndex * indexFormatSize
-                                         instanceCount:draw->instanceCount
-                                            baseVertex:draw->baseVertex
-                                          baseInstance:draw->firstInstance];
-                        didDrawInCurrentOcclusionQuery = true;
+                for (uint32_t i = 0; i < batch->drawCount; ++i) {
+                    DrawIndexedCmd* draw = &draws[i];
+
+                    // The index and instance count must be non-zero, otherwise no-op
+                    if (draw->indexCount != 0 && draw->instanceCount != 0) {
+                        // MTLFeatureSet_iOS_GPUFamily3_v1 does not support baseInstance and
+                        // baseVertex.
+                        if (draw->baseVertex == 0 && draw->firstInstance == 0) {
+                            [encoder drawIndexedPrimitives:lastPipeline->GetMTLPrimitiveTopology()
+                                                indexCount:draw->indexCount
+                                                 indexType:indexBufferType
+                                               indexBuffer:indexBuffer
+                                         indexBufferOffset:indexBufferBaseOffset +
+                                                           draw->firstIndex * indexFormatSize
+                                             instanceCount:draw->instanceCount];
+                            didDrawInCurrentOcclusionQuery = true;
+                        } else {
+                            [encoder drawIndexedPrimitives:lastPipeline->GetMTLPrimitiveTopology()
+                                                indexCount:draw->indexCount
+                                                 indexType:indexBufferType
+                                               indexBuffer:indexBuffer
+                                         indexBufferOffset:indexBufferBaseOffset +
+                                                           draw->firstIndex * indexFormatSize
+                                             instanceCount:draw->instanceCount
+                                                baseVertex:draw->baseVertex
+                                              baseInstance:draw->firstInstance];
+                            didDrawInCurrentOcclusionQuery = true;
+                        }
                     }
                 }
                 break;
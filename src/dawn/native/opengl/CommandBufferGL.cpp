@@ -1106,70 +1106,80 @@ MaybeError CommandBuffer::ExecuteRenderPass(BeginRenderPassCmd* renderPass) {
 
     auto DoRenderBundleCommand = [&](CommandIterator* iter, Command type) {
         switch (type) {
-            case Command::Draw: {
-                DrawCmd* draw = iter->NextCommand<DrawCmd>();
+            case Command::DrawBatch: {
+                DrawBatchCmd* batch = iter->NextCommand<DrawBatchCmd>();
+                DrawCmd* draws = iter->NextData<DrawCmd>(batch->drawCount);
                 vertexStateBufferBindingTracker.Apply(gl);
                 bindGroupTracker.Apply(gl);
 
-                if (lastPipeline->UsesInstanceIndex()) {
-                    gl.Uniform1ui(PipelineLayout::PushConstantLocation::FirstInstance,
-                                  draw->firstInstance);
-                }
-                if (gl.DrawArraysInstancedBaseInstanceANGLE) {
-                    gl.DrawArraysInstancedBaseInstanceANGLE(
-                        lastPipeline->GetGLPrimitiveTopology(), draw->firstVertex,
-                        draw->vertexCount, draw->instanceCount, draw->firstInstance);
-                } else if (draw->firstInstance > 0) {
-                    gl.DrawArraysInstancedBaseInstance(lastPipeline->GetGLPrimitiveTopology(),
-                                                       draw->firstVertex, draw->vertexCount,
-                                                       draw->instanceCount, draw->firstInstance);
-                } else {
-                    // This branch is only needed on OpenGL < 4.2
-                    gl.DrawArraysInstanced(lastPipeline->GetGLPrimitiveTopology(),
-                                           draw->firstVertex, draw->vertexCount,
-                                           draw->instanceCount);
+                for (uint32_t i = 0; i < batch->drawCount; ++i) {
+                    DrawCmd* draw = &draws[i];
+                    if (lastPipeline->UsesInstanceIndex()) {
+                        gl.Uniform1ui(PipelineLayout::PushConstantLocation::FirstInstance,
+                                      draw->firstInstance);
+                    }
+                    if (gl.DrawArraysInstancedBaseInstanceANGLE) {
+                        gl.DrawArraysInstancedBaseInstanceANGLE(
+                            lastPipeline->GetGLPrimitiveTopology(), draw->firstVertex,
+                            draw->vertexCount, draw->instanceCount, draw->firstInstance);
+                    } else if (draw->firstInstance > 0) {
+                        gl.DrawArraysInstancedBaseInstance(
+                            lastPipeline->GetGLPrimitiveTopology(), draw->firstVertex,
+                            draw->vertexCount, draw->instanceCount, draw->firstInstance);
+                    } else {
+                        // This branch is only needed on OpenGL < 4.2
+                        gl.DrawArraysInstanced(lastPipeline->GetGLPrimitiveTopology(),
+                                               draw->firstVertex, draw->vertexCount,
+                                               draw->instanceCount);
+                    }
                 }
                 break;
             }
 
-            case Command::DrawIndexed: {
-                DrawIndexedCmd* draw = iter->NextCommand<DrawIndexedCmd>();
+            case Command::DrawIndexedBatch: {
+                DrawIndexedBatchCmd* batch = iter->NextCommand<DrawIndexedBatchCmd>();
+                DrawIndexedCmd* draws = iter->NextData<DrawIndexedCmd>(batch->drawCount);
                 vertexStateBufferBindingTracker.Apply(gl);
                 bindGroupTracker.Apply(gl);
 
-                if (lastPipeline->UsesInstanceIndex()) {
-                    gl.Uniform1ui(PipelineLayout::PushConstantLocation::FirstInstance,
-                                  draw->firstInstance);
-                }
-                if (gl.DrawElementsInstancedBaseVertexBaseInstanceANGLE) {
-                    gl.DrawElementsInstancedBaseVertexBaseInstanceANGLE(
-                        lastPipeline->GetGLPrimitiveTopology(), draw->indexCount, indexBufferFormat,
-                        reinterpret_cast<void*>(draw->firstIndex * indexFormatSize +
-                                                indexBufferBaseOffset),
-                        draw->instanceCount, draw->baseVertex, draw->firstInstance);
-                } else if (draw->firstInstance > 0) {
-                    gl.DrawElementsInstancedBaseVertexBaseInstance(
-                        lastPipeline->GetGLPrimitiveTopology(), draw->indexCount, indexBufferFormat,
-                        reinterpret_cast<void*>(draw->firstIndex * indexFormatSize +
-                                                indexBufferBaseOffset),
-                        draw->instanceCount, draw->baseVertex, draw->firstInstance);
-                } else {
-                    // This branch is only needed on OpenGL < 4.2; ES < 3.2
-                    if (draw->baseVertex != 0) {
-                        gl.DrawElementsInstancedBaseVertex(
+                for (uint32_t i = 0; i < batch->drawCount; ++i) {
+                    DrawIndexedCmd* draw = &draws[i];
+                    if (lastPipeline->UsesInstanceIndex()) {
+                        gl.Uniform1ui(PipelineLayout::PushConstantLocation::FirstInstance,
+                                      draw->firstInstance);
+                    }
+                    if (gl.DrawElementsInstancedBaseVertexBaseInstanceANGLE) {
+                        gl.DrawElementsInstancedBaseVertexBaseInstanceANGLE(
                             lastPipeline->GetGLPrimitiveTopology(), draw->indexCount,
                             indexBufferFormat,
                             reinterpret_cast<void*>(draw->firstIndex * indexFormatSize +
                                                     indexBufferBaseOffset),
-                            draw->instanceCount, draw->baseVertex);
-                    } else {
-                        // This branch is only needed on OpenGL < 3.2; ES < 3.2
-                        gl.DrawElementsInstanced(
+                            draw->instanceCount, draw->baseVertex, draw->firstInstance);
+                    } else if (draw->firstInstance > 0) {
+                        gl.DrawElementsInstancedBaseVertexBaseInstance(
                             lastPipeline->GetGLPrimitiveTopology(), draw->indexCount,
                             indexBufferFormat,
                             reinterpret_cast<void*>(draw->firstIndex * indexFormatSize +
                                                     indexBufferBaseOffset),
-                            draw->instanceCount);
+                            draw->instanceCount, draw->baseVertex, draw->firstInstance);
+                    } else {
+                        // This branch is only needed on OpenGL < 4.2; ES < 3.2
+                        if (draw->baseVertex != 0) {
+                            gl.DrawElementsInstancedBaseVertex(
+                                lastPipeline->GetGLPrimitiveTopology(), draw->indexCount,
+                                indexBufferFormat,
+                                reinterpret_cast<void*>(draw->firstIndex * indexFormatSize +
+                                                        indexBufferBaseOffset),
+                                draw->instanceCount, draw->baseVertex);
+                        } else {
+                            // This branch is only needed on OpenGL < 3.2; ES < 3.2
+                            gl.DrawElementsInstanced(
+                                lastPipeline->GetGLPrimitiveTopology(), draw->indexCount,
+                                indexBufferFormat,
+                                reinterpret_cast<void*>(draw->firstIndex * indexFormatSize +
+                                                        indexBufferBaseOffset),
+                                draw->instanceCount);
+                        }
                     }
                 }
                 break;
@@ -133,6 +133,41 @@ MaybeError BindGroupLayout::Initialize() {
                                                                  nullptr, &*mHandle),
                             "CreateDescriptorSetLayout"));
 
+    // Precompute a descriptor update template so that bind groups can write all their
+    // descriptors from a flat array of DescriptorInfo instead of building a VkWriteDescriptorSet
+    // per binding.
+    if (device->GetDeviceInfo().HasExt(DeviceExt::DescriptorUpdateTemplate) &&
+        GetBindingCount() > BindingIndex(0)) {
+        ityp::vector<BindingIndex, VkDescriptorUpdateTemplateEntry> entries(GetBindingCount());
+        for (BindingIndex bindingIndex{0}; bindingIndex < GetBindingCount(); ++bindingIndex) {
+            VkDescriptorUpdateTemplateEntry& entry = entries[bindingIndex];
+            entry.dstBinding = static_cast<uint32_t>(bindingIndex);
+            entry.dstArrayElement = 0;
+            entry.descriptorCount = 1;
+            entry.descriptorType = VulkanDescriptorType(GetBindingInfo(bindingIndex));
+            entry.offset = static_cast<uint32_t>(bindingIndex) * sizeof(DescriptorInfo);
+            entry.stride = sizeof(DescriptorInfo);
+        }
+
+        VkDescriptorUpdateTemplateCreateInfo templateCreateInfo;
+        templateCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO;
+        templateCreateInfo.pNext = nullptr;
+        templateCreateInfo.flags = 0;
+        templateCreateInfo.descriptorUpdateEntryCount = static_cast<uint32_t>(entries.size());
+        templateCreateInfo.pDescriptorUpdateEntries = entries.data();
+        templateCreateInfo.templateType = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+        templateCreateInfo.descriptorSetLayout = mHandle;
+        // The remaining members are only used for push descriptor templates.
+        templateCreateInfo.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+        templateCreateInfo.pipelineLayout = VK_NULL_HANDLE;
+        templateCreateInfo.set = 0;
+
+        DAWN_TRY(CheckVkSuccess(
+            device->fn.CreateDescriptorUpdateTemplate(device->GetVkDevice(), &templateCreateInfo,
+                                                      nullptr, &*mUpdateTemplate),
+            "CreateDescriptorUpdateTemplate"));
+    }
+
     // Compute the size of descriptor pools used for this layout.
     absl::flat_hash_map<VkDescriptorType, uint32_t> descriptorCountPerType;
 
@@ -174,6 +209,12 @@ void BindGroupLayout::DestroyImpl() {
         device->fn.DestroyDescriptorSetLayout(device->GetVkDevice(), mHandle, nullptr);
         mHandle = VK_NULL_HANDLE;
     }
+    // Like the VkDescriptorSetLayout, the update template is only used on the CPU.
+    if (mUpdateTemplate != VK_NULL_HANDLE) {
+        device->fn.DestroyDescriptorUpdateTemplate(device->GetVkDevice(), mUpdateTemplate,
+                                                   nullptr);
+        mUpdateTemplate = VK_NULL_HANDLE;
+    }
     mDescriptorSetAllocator = nullptr;
 }
 
@@ -181,6 +222,10 @@ VkDescriptorSetLayout BindGroupLayout::GetHandle() const {
     return mHandle;
 }
 
+VkDescriptorUpdateTemplate BindGroupLayout::GetUpdateTemplate() const {
+    return mUpdateTemplate;
+}
+
 ResultOrError<Ref<BindGroup>> BindGroupLayout::AllocateBindGroup(
     Device* device,
     const BindGroupDescriptor* descriptor) {
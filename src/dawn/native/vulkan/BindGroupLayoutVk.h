@@ -48,6 +48,13 @@ class Device;
 
 VkDescriptorType VulkanDescriptorType(const BindingInfo& bindingInfo);
 
+// The data written for a single binding of a bind group. The payload given to the descriptor
+// update template of a BindGroupLayout is an array of these indexed by BindingIndex.
+union DescriptorInfo {
+    VkDescriptorBufferInfo buffer;
+    VkDescriptorImageInfo image;
+};
+
 // In Vulkan descriptor pools have to be sized to an exact number of descriptors. This means
 // it's hard to have something where we can mix different types of descriptor sets because
 // we don't know if their vector of number of descriptors will be similar.
@@ -68,6 +75,9 @@ class BindGroupLayout final : public BindGroupLayoutInternalBase {
     BindGroupLayout(DeviceBase* device, const BindGroupLayoutDescriptor* descriptor);
 
     VkDescriptorSetLayout GetHandle() const;
+    // Returns VK_NULL_HANDLE if VK_KHR_descriptor_update_template isn't supported or the layout
+    // has no bindings.
+    VkDescriptorUpdateTemplate GetUpdateTemplate() const;
 
     ResultOrError<Ref<BindGroup>> AllocateBindGroup(Device* device,
                                                     const BindGroupDescriptor* descriptor);
@@ -83,6 +93,7 @@ class BindGroupLayout final : public BindGroupLayoutInternalBase {
     void SetLabelImpl() override;
 
     VkDescriptorSetLayout mHandle = VK_NULL_HANDLE;
+    VkDescriptorUpdateTemplate mUpdateTemplate = VK_NULL_HANDLE;
 
     MutexProtected<SlabAllocator<BindGroup>> mBindGroupAllocator;
     MutexProtected<Ref<DescriptorSetAllocator>> mDescriptorSetAllocator;
@@ -27,8 +27,11 @@
 
 #include "dawn/native/vulkan/BindGroupVk.h"
 
+#include <variant>
+
 #include "dawn/common/BitSetIterator.h"
 #include "dawn/common/MatchVariant.h"
+#include "dawn/common/ityp_bitset.h"
 #include "dawn/common/ityp_stack_vec.h"
 #include "dawn/native/ExternalTexture.h"
 #include "dawn/native/vulkan/BindGroupLayoutVk.h"
@@ -53,33 +56,20 @@ BindGroup::BindGroup(Device* device,
                      const BindGroupDescriptor* descriptor,
                      DescriptorSetAllocation descriptorSetAllocation)
     : BindGroupBase(this, device, descriptor), mDescriptorSetAllocation(descriptorSetAllocation) {
-    // Now do a write of a single descriptor set with all possible chained data allocated on the
-    // stack.
-    const uint32_t bindingCount = static_cast<uint32_t>((GetLayout()->GetBindingCount()));
-    ityp::stack_vec<uint32_t, VkWriteDescriptorSet, kMaxOptimalBindingsPerGroup> writes(
-        bindingCount);
-    ityp::stack_vec<uint32_t, VkDescriptorBufferInfo, kMaxOptimalBindingsPerGroup> writeBufferInfo(
-        bindingCount);
-    ityp::stack_vec<uint32_t, VkDescriptorImageInfo, kMaxOptimalBindingsPerGroup> writeImageInfo(
+    BindGroupLayout* layout = ToBackend(GetLayout());
+    const BindingIndex bindingCount = layout->GetBindingCount();
+
+    // Gather the data of all descriptors in a single contiguous array indexed by BindingIndex,
+    // which is the payload layout expected by the layout's descriptor update template.
+    ityp::stack_vec<BindingIndex, DescriptorInfo, kMaxOptimalBindingsPerGroup> descriptors(
         bindingCount);
+    ityp::bitset<BindingIndex, kMaxBindingsPerBindGroup> isValidDescriptor;
+
+    for (BindingIndex bindingIndex{0}; bindingIndex < bindingCount; ++bindingIndex) {
+        const BindingInfo& bindingInfo = layout->GetBindingInfo(bindingIndex);
+        DescriptorInfo& info = descriptors[bindingIndex];
 
-    uint32_t numWrites = 0;
-    for (const auto& bindingItem : GetLayout()->GetBindingMap()) {
-        // We cannot use structured binding here because lambda expressions can only capture
-        // variables, while structured binding doesn't introduce variables.
-        BindingIndex bindingIndex = bindingItem.second;
-        const BindingInfo& bindingInfo = GetLayout()->GetBindingInfo(bindingIndex);
-
-        auto& write = writes[numWrites];
-        write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        write.pNext = nullptr;
-        write.dstSet = GetHandle();
-        write.dstBinding = static_cast<uint32_t>(bindingIndex);
-        write.dstArrayElement = 0;
-        write.descriptorCount = 1;
-        write.descriptorType = VulkanDescriptorType(bindingInfo);
-
-        bool isValidDescriptorSet = MatchVariant(
+        bool isValid = MatchVariant(
             bindingInfo.bindingLayout,
             [&](const BufferBindingLayout&) -> bool {
                 BufferBinding binding = GetBindingAsBufferBinding(bindingIndex);
@@ -92,16 +82,14 @@ BindGroup::BindGroup(Device* device,
                     // resources.
                     return false;
                 }
-                writeBufferInfo[numWrites].buffer = handle;
-                writeBufferInfo[numWrites].offset = binding.offset;
-                writeBufferInfo[numWrites].range = binding.size;
-                write.pBufferInfo = &writeBufferInfo[numWrites];
+                info.buffer.buffer = handle;
+                info.buffer.offset = binding.offset;
+                info.buffer.range = binding.size;
                 return true;
             },
             [&](const SamplerBindingLayout&) -> bool {
                 Sampler* sampler = ToBackend(GetBindingAsSampler(bindingIndex));
-                writeImageInfo[numWrites].sampler = sampler->GetHandle();
-                write.pImageInfo = &writeImageInfo[numWrites];
+                info.image.sampler = sampler->GetHandle();
                 return true;
             },
             [&](const TextureBindingLayout&) -> bool {
@@ -116,11 +104,9 @@ BindGroup::BindGroup(Device* device,
                     // resources.
                     return false;
                 }
-                writeImageInfo[numWrites].imageView = handle;
-                writeImageInfo[numWrites].imageLayout = VulkanImageLayout(
-                    view->GetTexture()->GetFormat(), wgpu::TextureUsage::TextureBinding);
-
-                write.pImageInfo = &writeImageInfo[numWrites];
+                info.image.imageView = handle;
+                info.image.imageLayout = VulkanImageLayout(view->GetTexture()->GetFormat(),
+                                                           wgpu::TextureUsage::TextureBinding);
                 return true;
             },
             [&](const StorageTextureBindingLayout&) -> bool {
@@ -140,20 +126,51 @@ BindGroup::BindGroup(Device* device,
                     // resources.
                     return false;
                 }
-                writeImageInfo[numWrites].imageView = handle;
-                writeImageInfo[numWrites].imageLayout = VK_IMAGE_LAYOUT_GENERAL;
-
-                write.pImageInfo = &writeImageInfo[numWrites];
+                info.image.imageView = handle;
+                info.image.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
                 return true;
             });
 
-        if (isValidDescriptorSet) {
+        isValidDescriptor.set(bindingIndex, isValid);
+    }
+
+    // The update template writes every binding, so it can only be used when none of the
+    // descriptors have to be skipped.
+    if (layout->GetUpdateTemplate() != VK_NULL_HANDLE &&
+        isValidDescriptor.count() == static_cast<size_t>(bindingCount)) {
+        device->fn.UpdateDescriptorSetWithTemplate(device->GetVkDevice(), GetHandle(),
+                                                   layout->GetUpdateTemplate(), descriptors.data());
+    } else {
+        // Otherwise do a write of a single descriptor set with all the valid descriptors.
+        ityp::stack_vec<uint32_t, VkWriteDescriptorSet, kMaxOptimalBindingsPerGroup> writes(
+            static_cast<uint32_t>(bindingCount));
+
+        uint32_t numWrites = 0;
+        for (BindingIndex bindingIndex{0}; bindingIndex < bindingCount; ++bindingIndex) {
+            if (!isValidDescriptor.test(bindingIndex)) {
+                continue;
+            }
+
+            const BindingInfo& bindingInfo = layout->GetBindingInfo(bindingIndex);
+            auto& write = writes[numWrites];
+            write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            write.pNext = nullptr;
+            write.dstSet = GetHandle();
+            write.dstBinding = static_cast<uint32_t>(bindingIndex);
+            write.dstArrayElement = 0;
+            write.descriptorCount = 1;
+            write.descriptorType = VulkanDescriptorType(bindingInfo);
+            if (std::holds_alternative<BufferBindingLayout>(bindingInfo.bindingLayout)) {
+                write.pBufferInfo = &descriptors[bindingIndex].buffer;
+            } else {
+                write.pImageInfo = &descriptors[bindingIndex].image;
+            }
             numWrites++;
         }
-    }
 
-    // TODO(crbug.com/dawn/855): Batch these updates
-    device->fn.UpdateDescriptorSets(device->GetVkDevice(), numWrites, writes.data(), 0, nullptr);
+        device->fn.UpdateDescriptorSets(device->GetVkDevice(), numWrites, writes.data(), 0,
+                                        nullptr);
+    }
 
     SetLabelImpl();
 }
@@ -30,6 +30,7 @@
 #include <algorithm>
 #include <vector>
 
+#include "dawn/common/Range.h"
 #include "dawn/native/BindGroupTracker.h"
 #include "dawn/native/CommandEncoder.h"
 #include "dawn/native/CommandValidation.h"
@@ -358,11 +359,150 @@ void RecordResolveQuerySetCmd(VkCommandBuffer commands,
     }
 }
 
+VkClearColorValue VulkanClearColorValue(TextureComponentType baseType,
+                                        const dawn::native::Color& clearColor) {
+    VkClearColorValue clearValue;
+    switch (baseType) {
+        case TextureComponentType::Float: {
+            const std::array<float, 4> appliedClearColor = ConvertToFloatColor(clearColor);
+            for (uint32_t j = 0; j < 4; ++j) {
+                clearValue.float32[j] = appliedClearColor[j];
+            }
+            break;
+        }
+        case TextureComponentType::Uint: {
+            const std::array<uint32_t, 4> appliedClearColor =
+                ConvertToUnsignedIntegerColor(clearColor);
+            for (uint32_t j = 0; j < 4; ++j) {
+                clearValue.uint32[j] = appliedClearColor[j];
+            }
+            break;
+        }
+        case TextureComponentType::Sint: {
+            const std::array<int32_t, 4> appliedClearColor =
+                ConvertToSignedIntegerColor(clearColor);
+            for (uint32_t j = 0; j < 4; ++j) {
+                clearValue.int32[j] = appliedClearColor[j];
+            }
+            break;
+        }
+    }
+    return clearValue;
+}
+
+// Begins the render pass with vkCmdBeginRendering. The attachments are given directly so no
+// VkRenderPass or VkFramebuffer needs to be looked up or created.
+MaybeError RecordBeginRendering(CommandRecordingContext* recordingContext,
+                                Device* device,
+                                BeginRenderPassCmd* renderPass) {
+    // Holes in the color attachments are left with a VK_NULL_HANDLE image view, which matches the
+    // VK_FORMAT_UNDEFINED formats used for them in the pipelines.
+    PerColorAttachment<VkRenderingAttachmentInfoKHR> colorAttachments;
+    auto colorAttachmentCount =
+        GetHighestBitIndexPlusOne(renderPass->attachmentState->GetColorAttachmentsMask());
+    for (auto i : Range(colorAttachmentCount)) {
+        VkRenderingAttachmentInfoKHR& attachment = colorAttachments[i];
+        attachment.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR;
+        attachment.pNext = nullptr;
+        attachment.imageView = VK_NULL_HANDLE;
+        attachment.imageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+        attachment.resolveMode = VK_RESOLVE_MODE_NONE;
+        attachment.resolveImageView = VK_NULL_HANDLE;
+        attachment.resolveImageLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        attachment.loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        attachment.storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        attachment.clearValue = {};
+    }
+
+    for (auto i : IterateBitSet(renderPass->attachmentState->GetColorAttachmentsMask())) {
+        auto& attachmentInfo = renderPass->colorAttachments[i];
+        TextureView* view = ToBackend(attachmentInfo.view.Get());
+        VkRenderingAttachmentInfoKHR& attachment = colorAttachments[i];
+
+        if (view->GetDimension() == wgpu::TextureViewDimension::e3D) {
+            DAWN_TRY_ASSIGN(attachment.imageView,
+                            view->GetOrCreate2DViewOn3D(attachmentInfo.depthSlice));
+        } else {
+            attachment.imageView = view->GetHandle();
+        }
+        attachment.loadOp = VulkanAttachmentLoadOp(attachmentInfo.loadOp);
+        attachment.storeOp = VulkanAttachmentStoreOp(attachmentInfo.storeOp);
+        attachment.clearValue.color = VulkanClearColorValue(
+            view->GetFormat().GetAspectInfo(Aspect::Color).baseType, attachmentInfo.clearColor);
+
+        if (attachmentInfo.resolveTarget != nullptr) {
+            TextureView* resolveView = ToBackend(attachmentInfo.resolveTarget.Get());
+            attachment.resolveMode = VK_RESOLVE_MODE_AVERAGE_BIT_KHR;
+            attachment.resolveImageView = resolveView->GetHandle();
+            attachment.resolveImageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+        }
+    }
+
+    VkRenderingAttachmentInfoKHR depthAttachment;
+    VkRenderingAttachmentInfoKHR stencilAttachment;
+    const VkRenderingAttachmentInfoKHR* pDepthAttachment = nullptr;
+    const VkRenderingAttachmentInfoKHR* pStencilAttachment = nullptr;
+    if (renderPass->attachmentState->HasDepthStencilAttachment()) {
+        auto& attachmentInfo = renderPass->depthStencilAttachment;
+        TextureView* view = ToBackend(attachmentInfo.view.Get());
+        const Format& format = view->GetTexture()->GetFormat();
+
+        depthAttachment.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR;
+        depthAttachment.pNext = nullptr;
+        depthAttachment.imageView = view->GetHandle();
+        depthAttachment.imageLayout = VulkanImageLayoutForDepthStencilAttachment(
+            format, attachmentInfo.depthReadOnly, attachmentInfo.stencilReadOnly);
+        depthAttachment.resolveMode = VK_RESOLVE_MODE_NONE;
+        depthAttachment.resolveImageView = VK_NULL_HANDLE;
+        depthAttachment.resolveImageLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        depthAttachment.clearValue.depthStencil.depth = attachmentInfo.clearDepth;
+        depthAttachment.clearValue.depthStencil.stencil = attachmentInfo.clearStencil;
+
+        // The depth and stencil aspects share the image view and layout and only differ in their
+        // load and store ops.
+        stencilAttachment = depthAttachment;
+
+        if (format.HasDepth()) {
+            depthAttachment.loadOp = VulkanAttachmentLoadOp(attachmentInfo.depthLoadOp);
+            depthAttachment.storeOp = VulkanAttachmentStoreOp(attachmentInfo.depthStoreOp);
+            pDepthAttachment = &depthAttachment;
+        }
+        if (format.HasStencil()) {
+            stencilAttachment.loadOp = VulkanAttachmentLoadOp(attachmentInfo.stencilLoadOp);
+            stencilAttachment.storeOp = VulkanAttachmentStoreOp(attachmentInfo.stencilStoreOp);
+            pStencilAttachment = &stencilAttachment;
+        }
+    }
+
+    VkRenderingInfoKHR renderingInfo;
+    renderingInfo.sType = VK_STRUCTURE_TYPE_RENDERING_INFO_KHR;
+    renderingInfo.pNext = nullptr;
+    renderingInfo.flags = 0;
+    renderingInfo.renderArea.offset.x = 0;
+    renderingInfo.renderArea.offset.y = 0;
+    renderingInfo.renderArea.extent.width = renderPass->width;
+    renderingInfo.renderArea.extent.height = renderPass->height;
+    renderingInfo.layerCount = 1;
+    renderingInfo.viewMask = 0;
+    renderingInfo.colorAttachmentCount = static_cast<uint8_t>(colorAttachmentCount);
+    renderingInfo.pColorAttachments = colorAttachments.data();
+    renderingInfo.pDepthAttachment = pDepthAttachment;
+    renderingInfo.pStencilAttachment = pStencilAttachment;
+
+    device->fn.CmdBeginRendering(recordingContext->commandBuffer, &renderingInfo);
+
+    return {};
+}
+
 }  // anonymous namespace
 
 MaybeError RecordBeginRenderPass(CommandRecordingContext* recordingContext,
                                  Device* device,
                                  BeginRenderPassCmd* renderPass) {
+    if (device->IsToggleEnabled(Toggle::VulkanUseDynamicRendering)) {
+        return RecordBeginRendering(recordingContext, device, renderPass);
+    }
+
     VkCommandBuffer commands = recordingContext->commandBuffer;
 
     // Query a VkRenderPass from the cache
@@ -417,32 +557,8 @@ MaybeError RecordBeginRenderPass(CommandRecordingContext* recordingContext,
                 attachments[attachmentCount] = view->GetHandle();
             }
 
-            switch (view->GetFormat().GetAspectInfo(Aspect::Color).baseType) {
-                case TextureComponentType::Float: {
-                    const std::array<float, 4> appliedClearColor =
-                        ConvertToFloatColor(attachmentInfo.clearColor);
-                    for (uint32_t j = 0; j < 4; ++j) {
-                        clearValues[attachmentCount].color.float32[j] = appliedClearColor[j];
-                    }
-                    break;
-                }
-                case TextureComponentType::Uint: {
-                    const std::array<uint32_t, 4> appliedClearColor =
-                        ConvertToUnsignedIntegerColor(attachmentInfo.clearColor);
-                    for (uint32_t j = 0; j < 4; ++j) {
-                        clearValues[attachmentCount].color.uint32[j] = appliedClearColor[j];
-                    }
-                    break;
-                }
-                case TextureComponentType::Sint: {
-                    const std::array<int32_t, 4> appliedClearColor =
-                        ConvertToSignedIntegerColor(attachmentInfo.clearColor);
-                    for (uint32_t j = 0; j < 4; ++j) {
-                        clearValues[attachmentCount].color.int32[j] = appliedClearColor[j];
-                    }
-                    break;
-                }
-            }
+            clearValues[attachmentCount].color = VulkanClearColorValue(
+                view->GetFormat().GetAspectInfo(Aspect::Color).baseType, attachmentInfo.clearColor);
             attachmentCount++;
         }
 
@@ -506,6 +622,14 @@ MaybeError RecordBeginRenderPass(CommandRecordingContext* recordingContext,
     return {};
 }
 
+void RecordEndRenderPass(CommandRecordingContext* recordingContext, Device* device) {
+    if (device->IsToggleEnabled(Toggle::VulkanUseDynamicRendering)) {
+        device->fn.CmdEndRendering(recordingContext->commandBuffer);
+    } else {
+        device->fn.CmdEndRenderPass(recordingContext->commandBuffer);
+    }
+}
+
 // static
 Ref<CommandBuffer> CommandBuffer::Create(CommandEncoder* encoder,
                                          const CommandBufferDescriptor* descriptor) {
@@ -1199,21 +1323,30 @@ MaybeError CommandBuffer::RecordRenderPass(CommandRecordingContext* recordingCon
 
     auto EncodeRenderBundleCommand = [&](CommandIterator* iter, Command type) {
         switch (type) {
-            case Command::Draw: {
-                DrawCmd* draw = iter->NextCommand<DrawCmd>();
+            case Command::DrawBatch: {
+                DrawBatchCmd* batch = iter->NextCommand<DrawBatchCmd>();
+                DrawCmd* draws = iter->NextData<DrawCmd>(batch->drawCount);
 
                 descriptorSets.Apply(device, recordingContext, VK_PIPELINE_BIND_POINT_GRAPHICS);
-                device->fn.CmdDraw(commands, draw->vertexCount, draw->instanceCount,
-                                   draw->firstVertex, draw->firstInstance);
+                for (uint32_t i = 0; i < batch->drawCount; ++i) {
+                    const DrawCmd& draw = draws[i];
+                    device->fn.CmdDraw(commands, draw.vertexCount, draw.instanceCount,
+                                       draw.firstVertex, draw.firstInstance);
+                }
                 break;
             }
 
-            case Command::DrawIndexed: {
-                DrawIndexedCmd* draw = iter->NextCommand<DrawIndexedCmd>();
+            case Command::DrawIndexedBatch: {
+                DrawIndexedBatchCmd* batch = iter->NextCommand<DrawIndexedBatchCmd>();
+                DrawIndexedCmd* draws = iter->NextData<DrawIndexedCmd>(batch->drawCount);
 
                 descriptorSets.Apply(device, recordingContext, VK_PIPELINE_BIND_POINT_GRAPHICS);
-                device->fn.CmdDrawIndexed(commands, draw->indexCount, draw->instanceCount,
-                                          draw->firstIndex, draw->baseVertex, draw->firstInstance);
+                for (uint32_t i = 0; i < batch->drawCount; ++i) {
+                    const DrawIndexedCmd& draw = draws[i];
+                    device->fn.CmdDrawIndexed(commands, draw.indexCount, draw.instanceCount,
+                                              draw.firstIndex, draw.baseVertex,
+                                              draw.firstInstance);
+                }
                 break;
             }
 
@@ -1348,7 +1481,7 @@ MaybeError CommandBuffer::RecordRenderPass(CommandRecordingContext* recordingCon
             case Command::EndRenderPass: {
                 mCommands.NextCommand<EndRenderPassCmd>();
 
-                device->fn.CmdEndRenderPass(commands);
+                RecordEndRenderPass(recordingContext, device);
 
                 // Write timestamp at the end of render pass if it's set.
                 // We've observed that this must be called after the render pass ends or the
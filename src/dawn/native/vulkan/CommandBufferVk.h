@@ -49,6 +49,7 @@ class Device;
 MaybeError RecordBeginRenderPass(CommandRecordingContext* recordingContext,
                                  Device* device,
                                  BeginRenderPassCmd* renderPass);
+void RecordEndRenderPass(CommandRecordingContext* recordingContext, Device* device);
 
 class CommandBuffer final : public CommandBufferBase {
   public:
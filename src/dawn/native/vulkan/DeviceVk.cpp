@@ -421,6 +421,24 @@ ResultOrError<VulkanDeviceKnobs> Device::CreateDevice(VkPhysicalDevice vkPhysica
         featuresChain.Add(&usedKnobs.shaderIntegerDotProductFeatures);
     }
 
+    if (IsToggleEnabled(Toggle::VulkanUseTimelineSemaphore)) {
+        DAWN_ASSERT(usedKnobs.HasExt(DeviceExt::TimelineSemaphore) &&
+                    mDeviceInfo.timelineSemaphoreFeatures.timelineSemaphore == VK_TRUE);
+
+        usedKnobs.timelineSemaphoreFeatures.timelineSemaphore = VK_TRUE;
+        featuresChain.Add(&usedKnobs.timelineSemaphoreFeatures,
+                          VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES);
+    }
+
+    if (IsToggleEnabled(Toggle::VulkanUseDynamicRendering)) {
+        DAWN_ASSERT(usedKnobs.HasExt(DeviceExt::DynamicRendering) &&
+                    mDeviceInfo.dynamicRenderingFeatures.dynamicRendering == VK_TRUE);
+
+        usedKnobs.dynamicRenderingFeatures.dynamicRendering = VK_TRUE;
+        featuresChain.Add(&usedKnobs.dynamicRenderingFeatures,
+                          VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR);
+    }
+
     if (mDeviceInfo.features.samplerAnisotropy == VK_TRUE) {
         usedKnobs.features.samplerAnisotropy = VK_TRUE;
     }
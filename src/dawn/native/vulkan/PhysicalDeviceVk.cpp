@@ -690,6 +690,24 @@ void PhysicalDevice::SetupBackendDeviceToggles(TogglesState* deviceToggles) cons
     // extension VK_KHR_zero_initialize_workgroup_memory.
     deviceToggles->Default(Toggle::VulkanUseZeroInitializeWorkgroupMemoryExtension, true);
 
+    // The environment can only request to use VK_KHR_timeline_semaphore when the extension is
+    // available and the timelineSemaphore feature is supported.
+    if (!GetDeviceInfo().HasExt(DeviceExt::TimelineSemaphore) ||
+        GetDeviceInfo().timelineSemaphoreFeatures.timelineSemaphore == VK_FALSE) {
+        deviceToggles->ForceSet(Toggle::VulkanUseTimelineSemaphore, false);
+    }
+    // By default track queue serials with a timeline semaphore when possible.
+    deviceToggles->Default(Toggle::VulkanUseTimelineSemaphore, true);
+
+    // The environment can only request to use VK_KHR_dynamic_rendering when the extension is
+    // available and the dynamicRendering feature is supported.
+    if (!GetDeviceInfo().HasExt(DeviceExt::DynamicRendering) ||
+        GetDeviceInfo().dynamicRenderingFeatures.dynamicRendering == VK_FALSE) {
+        deviceToggles->ForceSet(Toggle::VulkanUseDynamicRendering, false);
+    }
+    // By default begin render passes with vkCmdBeginRendering when possible.
+    deviceToggles->Default(Toggle::VulkanUseDynamicRendering, true);
+
     // Inject fragment shaders in all vertex-only pipelines.
     // TODO(crbug.com/dawn/1698): relax this requirement where the Vulkan spec allows.
     // In particular, enable rasterizer discard if the depth-stencil stage is a no-op, and skip
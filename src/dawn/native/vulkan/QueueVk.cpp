@@ -106,6 +106,10 @@ MaybeError Queue::Initialize() {
     Device* device = ToBackend(GetDevice());
     device->fn.GetDeviceQueue(device->GetVkDevice(), mQueueFamily, 0, &mQueue);
 
+    if (device->IsToggleEnabled(Toggle::VulkanUseTimelineSemaphore)) {
+        DAWN_TRY(CreateTimelineSemaphore());
+    }
+
     DAWN_TRY(PrepareRecordingContext());
 
     SetLabelImpl();
@@ -142,6 +146,24 @@ VkQueue Queue::GetVkQueue() const {
 
 ResultOrError<ExecutionSerial> Queue::CheckAndUpdateCompletedSerials() {
     Device* device = ToBackend(GetDevice());
+
+    if (mTimelineSemaphore != VK_NULL_HANDLE) {
+        // The timeline semaphore's value is the serial of the last completed submit, so a single
+        // query replaces polling each fence in flight.
+        uint64_t completedValue = 0;
+        VkResult result = VkResult::WrapUnsafe(
+            INJECT_ERROR_OR_RUN(device->fn.GetSemaphoreCounterValue(
+                                    device->GetVkDevice(), mTimelineSemaphore, &completedValue),
+                                VK_ERROR_DEVICE_LOST));
+        DAWN_TRY(CheckVkSuccess(::VkResult(result), "vkGetSemaphoreCounterValue"));
+
+        ExecutionSerial completedSerial(completedValue);
+        if (completedSerial <= GetCompletedCommandSerial()) {
+            return ExecutionSerial(0);
+        }
+        return completedSerial;
+    }
+
     return mFencesInFlight.Use([&](auto fencesInFlight) -> ResultOrError<ExecutionSerial> {
         ExecutionSerial fenceSerial(0);
         while (!fencesInFlight->empty()) {
@@ -194,6 +216,25 @@ MaybeError Queue::WaitForIdleForDestruction() {
     // (so they are as good as waited on) or success.
     DAWN_UNUSED(waitIdleResult);
 
+    if (mTimelineSemaphore != VK_NULL_HANDLE) {
+        // Make sure all submits are complete by explicitly waiting on the last signaled serial.
+        VkResult result = VkResult::WrapUnsafe(VK_TIMEOUT);
+        do {
+            // See the comment in the loop on fences below.
+            if (GetDevice()->GetState() == Device::State::Disconnected) {
+                result = VkResult::WrapUnsafe(
+                    WaitForTimelineSemaphore(mLastTimelineSignalSerial, UINT64_MAX));
+                continue;
+            }
+
+            result = VkResult::WrapUnsafe(
+                INJECT_ERROR_OR_RUN(WaitForTimelineSemaphore(mLastTimelineSignalSerial, UINT64_MAX),
+                                    VK_ERROR_DEVICE_LOST));
+        } while (result == VK_TIMEOUT);
+        // Ignore errors from vkWaitSemaphores for the same reasons as vkWaitForFences below.
+        return {};
+    }
+
     // Make sure all fences are complete by explicitly waiting on them all
     mFencesInFlight.Use([&](auto fencesInFlight) {
         while (!fencesInFlight->empty()) {
@@ -401,9 +442,26 @@ MaybeError Queue::SubmitPendingCommands() {
         mRecordingContext.signalSemaphores.push_back(externalTextureSemaphore.Get());
     }
 
+    // Signal the timeline semaphore with the serial of this submit. The values of the binary
+    // semaphores are ignored but VkTimelineSemaphoreSubmitInfo needs one per signal semaphore.
+    VkTimelineSemaphoreSubmitInfo timelineSubmitInfo;
+    std::vector<uint64_t> signalValues;
+    if (mTimelineSemaphore != VK_NULL_HANDLE) {
+        mRecordingContext.signalSemaphores.push_back(mTimelineSemaphore);
+        signalValues.resize(mRecordingContext.signalSemaphores.size(), 0);
+        signalValues.back() = uint64_t(GetPendingCommandSerial());
+
+        timelineSubmitInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+        timelineSubmitInfo.pNext = nullptr;
+        timelineSubmitInfo.waitSemaphoreValueCount = 0;
+        timelineSubmitInfo.pWaitSemaphoreValues = nullptr;
+        timelineSubmitInfo.signalSemaphoreValueCount = static_cast<uint32_t>(signalValues.size());
+        timelineSubmitInfo.pSignalSemaphoreValues = signalValues.data();
+    }
+
     VkSubmitInfo submitInfo;
     submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-    submitInfo.pNext = nullptr;
+    submitInfo.pNext = mTimelineSemaphore != VK_NULL_HANDLE ? &timelineSubmitInfo : nullptr;
     submitInfo.waitSemaphoreCount = static_cast<uint32_t>(mRecordingContext.waitSemaphores.size());
     submitInfo.pWaitSemaphores = AsVkArray(mRecordingContext.waitSemaphores.data());
     submitInfo.pWaitDstStageMask = dstStageMasks.data();
@@ -412,14 +470,19 @@ MaybeError Queue::SubmitPendingCommands() {
     submitInfo.signalSemaphoreCount = mRecordingContext.signalSemaphores.size();
     submitInfo.pSignalSemaphores = AsVkArray(mRecordingContext.signalSemaphores.data());
 
+    // Completion is tracked with the timeline semaphore when it is used, otherwise with a fence.
     VkFence fence = VK_NULL_HANDLE;
-    DAWN_TRY_ASSIGN(fence, GetUnusedFence());
+    if (mTimelineSemaphore == VK_NULL_HANDLE) {
+        DAWN_TRY_ASSIGN(fence, GetUnusedFence());
+    }
     DAWN_TRY_WITH_CLEANUP(
         CheckVkSuccess(device->fn.QueueSubmit(mQueue, 1, &submitInfo, fence), "vkQueueSubmit"), {
             // If submitting to the queue fails, move the fence back into the unused fence
             // list, as if it were never acquired. Not doing so would leak the fence since
             // it would be neither in the unused list nor in the in-flight list.
-            mUnusedFences.push_back(fence);
+            if (fence != VK_NULL_HANDLE) {
+                mUnusedFences.push_back(fence);
+            }
         });
 
     // Enqueue the semaphores before incrementing the serial, so that they can be deleted as
@@ -429,7 +492,11 @@ MaybeError Queue::SubmitPendingCommands() {
     }
     IncrementLastSubmittedCommandSerial();
     ExecutionSerial lastSubmittedSerial = GetLastSubmittedCommandSerial();
-    mFencesInFlight->emplace_back(fence, lastSubmittedSerial);
+    if (mTimelineSemaphore != VK_NULL_HANDLE) {
+        mLastTimelineSignalSerial = lastSubmittedSerial;
+    } else {
+        mFencesInFlight->emplace_back(fence, lastSubmittedSerial);
+    }
 
     for (size_t i = 0; i < mRecordingContext.commandBufferList.size(); ++i) {
         CommandPoolAndBuffer submittedCommands = {mRecordingContext.commandPoolList[i],
@@ -481,6 +548,40 @@ ResultOrError<VkFence> Queue::GetUnusedFence() {
     return fence;
 }
 
+MaybeError Queue::CreateTimelineSemaphore() {
+    Device* device = ToBackend(GetDevice());
+
+    VkSemaphoreTypeCreateInfo typeCreateInfo;
+    typeCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+    typeCreateInfo.pNext = nullptr;
+    typeCreateInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+    typeCreateInfo.initialValue = uint64_t(GetCompletedCommandSerial());
+
+    VkSemaphoreCreateInfo createInfo;
+    createInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+    createInfo.pNext = &typeCreateInfo;
+    createInfo.flags = 0;
+
+    return CheckVkSuccess(device->fn.CreateSemaphore(device->GetVkDevice(), &createInfo, nullptr,
+                                                     &*mTimelineSemaphore),
+                          "vkCreateSemaphore");
+}
+
+::VkResult Queue::WaitForTimelineSemaphore(ExecutionSerial serial, uint64_t timeout) {
+    Device* device = ToBackend(GetDevice());
+    uint64_t value = uint64_t(serial);
+
+    VkSemaphoreWaitInfo waitInfo;
+    waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+    waitInfo.pNext = nullptr;
+    waitInfo.flags = 0;
+    waitInfo.semaphoreCount = 1;
+    waitInfo.pSemaphores = AsVkArray(&mTimelineSemaphore);
+    waitInfo.pValues = &value;
+
+    return device->fn.WaitSemaphores(device->GetVkDevice(), &waitInfo, timeout);
+}
+
 void Queue::DestroyImpl() {
     Device* device = ToBackend(GetDevice());
     VkDevice vkDevice = device->GetVkDevice();
@@ -522,12 +623,32 @@ void Queue::DestroyImpl() {
     }
     mUnusedFences.clear();
 
+    if (mTimelineSemaphore != VK_NULL_HANDLE) {
+        device->fn.DestroySemaphore(vkDevice, mTimelineSemaphore, nullptr);
+        mTimelineSemaphore = VK_NULL_HANDLE;
+    }
+
     QueueBase::DestroyImpl();
 }
 
 ResultOrError<bool> Queue::WaitForQueueSerial(ExecutionSerial serial, Nanoseconds timeout) {
     Device* device = ToBackend(GetDevice());
     VkDevice vkDevice = device->GetVkDevice();
+
+    if (mTimelineSemaphore != VK_NULL_HANDLE) {
+        if (serial <= GetCompletedCommandSerial()) {
+            return true;
+        }
+        VkResult waitResult = VkResult::WrapUnsafe(INJECT_ERROR_OR_RUN(
+            WaitForTimelineSemaphore(serial, static_cast<uint64_t>(timeout)),
+            VK_ERROR_DEVICE_LOST));
+        if (waitResult == VK_TIMEOUT) {
+            return false;
+        }
+        DAWN_TRY(CheckVkSuccess(::VkResult(waitResult), "vkWaitSemaphores"));
+        return true;
+    }
+
     VkResult waitResult = mFencesInFlight.Use([&](auto fencesInFlight) {
         // Search from for the first fence >= serial.
         VkFence waitFence = VK_NULL_HANDLE;
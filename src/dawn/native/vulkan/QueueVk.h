@@ -76,6 +76,8 @@ class Queue final : public QueueBase {
     void SetLabelImpl() override;
 
     ResultOrError<VkFence> GetUnusedFence();
+    MaybeError CreateTimelineSemaphore();
+    ::VkResult WaitForTimelineSemaphore(ExecutionSerial serial, uint64_t timeout);
 
     // We track which operations are in flight on the GPU with an increasing serial.
     // This works only because we have a single queue. Each submit to a queue is associated
@@ -85,6 +87,12 @@ class Queue final : public QueueBase {
     // Fences in the unused list aren't reset yet.
     std::vector<VkFence> mUnusedFences;
 
+    // When VK_KHR_timeline_semaphore is used, each submit signals this semaphore with its serial
+    // instead of using a fence, so the completed serial is the semaphore's counter value.
+    VkSemaphore mTimelineSemaphore = VK_NULL_HANDLE;
+    // The serial of the last submit that signaled mTimelineSemaphore.
+    ExecutionSerial mLastTimelineSignalSerial = ExecutionSerial(0);
+
     MaybeError PrepareRecordingContext();
     ResultOrError<CommandPoolAndBuffer> BeginVkCommandBuffer();
 
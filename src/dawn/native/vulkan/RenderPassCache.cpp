@@ -37,7 +37,6 @@
 
 namespace dawn::native::vulkan {
 
-namespace {
 VkAttachmentLoadOp VulkanAttachmentLoadOp(wgpu::LoadOp op) {
     switch (op) {
         case wgpu::LoadOp::Load:
@@ -65,7 +64,6 @@ VkAttachmentStoreOp VulkanAttachmentStoreOp(wgpu::StoreOp op) {
     }
     DAWN_UNREACHABLE();
 }
-}  // anonymous namespace
 
 // RenderPassCacheQuery
 
@@ -46,6 +46,9 @@ namespace dawn::native::vulkan {
 
 class Device;
 
+VkAttachmentLoadOp VulkanAttachmentLoadOp(wgpu::LoadOp op);
+VkAttachmentStoreOp VulkanAttachmentStoreOp(wgpu::StoreOp op);
+
 // This is a key to query the RenderPassCache, it can be sparse meaning that only the
 // information for bits set in colorMask or hasDepthStencil need to be provided and the rest can
 // be uninintialized.
@@ -32,6 +32,7 @@
 #include <utility>
 #include <vector>
 
+#include "dawn/common/Range.h"
 #include "dawn/native/CreatePipelineAsyncTask.h"
 #include "dawn/native/vulkan/DeviceVk.h"
 #include "dawn/native/vulkan/FencedDeleter.h"
@@ -565,7 +566,42 @@ MaybeError RenderPipeline::InitializeImpl() {
         query.SetSampleCount(GetSampleCount());
 
         StreamIn(&mCacheKey, query);
-        DAWN_TRY_ASSIGN(renderPass, device->GetRenderPassCache()->GetRenderPass(query));
+        if (!device->IsToggleEnabled(Toggle::VulkanUseDynamicRendering)) {
+            DAWN_TRY_ASSIGN(renderPass, device->GetRenderPassCache()->GetRenderPass(query));
+        }
+    }
+
+    // With dynamic rendering the attachment formats are given directly to the pipeline instead
+    // of through a compatible VkRenderPass.
+    PerColorAttachment<VkFormat> colorAttachmentFormats;
+    VkPipelineRenderingCreateInfoKHR renderingCreateInfo;
+    if (device->IsToggleEnabled(Toggle::VulkanUseDynamicRendering)) {
+        // Holes in the color attachments are given the VK_FORMAT_UNDEFINED format.
+        auto colorAttachmentCount = GetHighestBitIndexPlusOne(GetColorAttachmentsMask());
+        for (auto i : Range(colorAttachmentCount)) {
+            colorAttachmentFormats[i] = VK_FORMAT_UNDEFINED;
+        }
+        for (auto i : IterateBitSet(GetColorAttachmentsMask())) {
+            colorAttachmentFormats[i] = VulkanImageFormat(device, GetColorAttachmentFormat(i));
+        }
+
+        renderingCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR;
+        renderingCreateInfo.pNext = nullptr;
+        renderingCreateInfo.viewMask = 0;
+        renderingCreateInfo.colorAttachmentCount = static_cast<uint8_t>(colorAttachmentCount);
+        renderingCreateInfo.pColorAttachmentFormats = colorAttachmentFormats.data();
+        renderingCreateInfo.depthAttachmentFormat = VK_FORMAT_UNDEFINED;
+        renderingCreateInfo.stencilAttachmentFormat = VK_FORMAT_UNDEFINED;
+        if (HasDepthStencilAttachment()) {
+            const Format& dsFormat = device->GetValidInternalFormat(GetDepthStencilFormat());
+            VkFormat vkFormat = VulkanImageFormat(device, dsFormat.format);
+            if (dsFormat.HasDepth()) {
+                renderingCreateInfo.depthAttachmentFormat = vkFormat;
+            }
+            if (dsFormat.HasStencil()) {
+                renderingCreateInfo.stencilAttachmentFormat = vkFormat;
+            }
+        }
     }
 
     // The create info chains in a bunch of things created on the stack here or inside state
@@ -592,6 +628,11 @@ MaybeError RenderPipeline::InitializeImpl() {
     createInfo.basePipelineHandle = VkPipeline{};
     createInfo.basePipelineIndex = -1;
 
+    if (device->IsToggleEnabled(Toggle::VulkanUseDynamicRendering)) {
+        PNextChainBuilder createInfoChain(&createInfo);
+        createInfoChain.Add(&renderingCreateInfo);
+    }
+
     // Record cache key information now since createInfo is not stored.
     StreamIn(&mCacheKey, createInfo, layout->GetCacheKey());
 
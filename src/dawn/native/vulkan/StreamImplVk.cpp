@@ -153,6 +153,14 @@ void stream::Stream<VkPipelineRasterizationDepthClipStateCreateInfoEXT>::Write(
     StreamIn(sink, t.depthClipEnable, t.flags);
 }
 
+template <>
+void stream::Stream<VkPipelineRenderingCreateInfoKHR>::Write(
+    stream::Sink* sink,
+    const VkPipelineRenderingCreateInfoKHR& t) {
+    StreamIn(sink, t.viewMask, Iterable(t.pColorAttachmentFormats, t.colorAttachmentCount),
+             t.depthAttachmentFormat, t.stencilAttachmentFormat);
+}
+
 template <>
 void stream::Stream<VkSpecializationMapEntry>::Write(stream::Sink* sink,
                                                      const VkSpecializationMapEntry& t) {
@@ -346,7 +354,7 @@ void stream::Stream<VkGraphicsPipelineCreateInfo>::Write(stream::Sink* sink,
              t.pInputAssemblyState, t.pTessellationState, t.pViewportState, t.pRasterizationState,
              t.pMultisampleState, t.pDepthStencilState, t.pColorBlendState, t.pDynamicState,
              t.subpass);
-    SerializePnext(sink, &t);
+    SerializePnext<VkPipelineRenderingCreateInfoKHR>(sink, &t);
 }
 
 }  // namespace dawn::native
@@ -1567,7 +1567,7 @@ MaybeError Texture::ClearTexture(CommandRecordingContext* recordingContext,
 
                 DAWN_TRY(
                     RecordBeginRenderPass(recordingContext, ToBackend(GetDevice()), &beginCmd));
-                ToBackend(GetDevice())->fn.CmdEndRenderPass(recordingContext->commandBuffer);
+                RecordEndRenderPass(recordingContext, ToBackend(GetDevice()));
             }
         }
     } else if (GetFormat().HasDepthOrStencil()) {
@@ -163,16 +163,22 @@ static constexpr std::array<DeviceExtInfo, kDeviceExtCount> sDeviceExtInfos{{
     {DeviceExt::ExternalSemaphore, "VK_KHR_external_semaphore", VulkanVersion_1_1},
     {DeviceExt::_16BitStorage, "VK_KHR_16bit_storage", VulkanVersion_1_1},
     {DeviceExt::SamplerYCbCrConversion, "VK_KHR_sampler_ycbcr_conversion", VulkanVersion_1_1},
+    {DeviceExt::Multiview, "VK_KHR_multiview", VulkanVersion_1_1},
+    {DeviceExt::DescriptorUpdateTemplate, "VK_KHR_descriptor_update_template", VulkanVersion_1_1},
 
     {DeviceExt::DriverProperties, "VK_KHR_driver_properties", VulkanVersion_1_2},
     {DeviceExt::ImageFormatList, "VK_KHR_image_format_list", VulkanVersion_1_2},
     {DeviceExt::ShaderFloat16Int8, "VK_KHR_shader_float16_int8", VulkanVersion_1_2},
+    {DeviceExt::TimelineSemaphore, "VK_KHR_timeline_semaphore", VulkanVersion_1_2},
+    {DeviceExt::CreateRenderPass2, "VK_KHR_create_renderpass2", VulkanVersion_1_2},
+    {DeviceExt::DepthStencilResolve, "VK_KHR_depth_stencil_resolve", VulkanVersion_1_2},
 
     {DeviceExt::ShaderIntegerDotProduct, "VK_KHR_shader_integer_dot_product", VulkanVersion_1_3},
     {DeviceExt::ZeroInitializeWorkgroupMemory, "VK_KHR_zero_initialize_workgroup_memory",
      VulkanVersion_1_3},
     {DeviceExt::Maintenance4, "VK_KHR_maintenance4", VulkanVersion_1_3},
     {DeviceExt::SubgroupSizeControl, "VK_EXT_subgroup_size_control", VulkanVersion_1_3},
+    {DeviceExt::DynamicRendering, "VK_KHR_dynamic_rendering", VulkanVersion_1_3},
 
     {DeviceExt::DepthClipEnable, "VK_EXT_depth_clip_enable", NeverPromoted},
     {DeviceExt::ImageDrmFormatModifier, "VK_EXT_image_drm_format_modifier", NeverPromoted},
@@ -230,6 +236,7 @@ DeviceExtSet EnsureDependencies(const DeviceExtSet& advertisedExts,
             case DeviceExt::GetMemoryRequirements2:
             case DeviceExt::Maintenance1:
             case DeviceExt::Maintenance2:
+            case DeviceExt::DescriptorUpdateTemplate:
             case DeviceExt::ImageFormatList:
             case DeviceExt::StorageBufferStorageClass:
                 hasDependencies = true;
@@ -276,9 +283,24 @@ DeviceExtSet EnsureDependencies(const DeviceExtSet& advertisedExts,
 
             case DeviceExt::DriverProperties:
             case DeviceExt::ShaderFloat16Int8:
+            case DeviceExt::TimelineSemaphore:
+            case DeviceExt::Multiview:
                 hasDependencies = HasDep(DeviceExt::GetPhysicalDeviceProperties2);
                 break;
 
+            case DeviceExt::CreateRenderPass2:
+                hasDependencies = HasDep(DeviceExt::Multiview) && HasDep(DeviceExt::Maintenance2);
+                break;
+
+            case DeviceExt::DepthStencilResolve:
+                hasDependencies = HasDep(DeviceExt::CreateRenderPass2);
+                break;
+
+            case DeviceExt::DynamicRendering:
+                hasDependencies = HasDep(DeviceExt::DepthStencilResolve) &&
+                                  HasDep(DeviceExt::GetPhysicalDeviceProperties2);
+                break;
+
             case DeviceExt::ExternalMemory:
                 hasDependencies = HasDep(DeviceExt::ExternalMemoryCapabilities);
                 break;
@@ -101,17 +101,23 @@ enum class DeviceExt {
     ExternalSemaphore,
     _16BitStorage,
     SamplerYCbCrConversion,
+    Multiview,
+    DescriptorUpdateTemplate,
 
     // Promoted to 1.2
     DriverProperties,
     ImageFormatList,
     ShaderFloat16Int8,
+    TimelineSemaphore,
+    CreateRenderPass2,
+    DepthStencilResolve,
 
     // Promoted to 1.3
     ShaderIntegerDotProduct,
     ZeroInitializeWorkgroupMemory,
     Maintenance4,
     SubgroupSizeControl,
+    DynamicRendering,
 
     // Others
     DepthClipEnable,
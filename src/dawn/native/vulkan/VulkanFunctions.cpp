@@ -234,14 +234,17 @@ MaybeError VulkanFunctions::LoadInstanceProcs(VkInstance instance,
     return {};
 }
 
-#define GET_DEVICE_PROC(name)                                                        \
-    do {                                                                             \
-        name = AsVkFn<PFN_vk##name>(GetDeviceProcAddr(device, "vk" #name));          \
-        if (name == nullptr) {                                                       \
-            return DAWN_INTERNAL_ERROR(std::string("Couldn't get proc vk") + #name); \
-        }                                                                            \
+#define GET_DEVICE_PROC_BASE(name, procName)                                             \
+    do {                                                                                 \
+        name = AsVkFn<PFN_vk##name>(GetDeviceProcAddr(device, "vk" #procName));          \
+        if (name == nullptr) {                                                           \
+            return DAWN_INTERNAL_ERROR(std::string("Couldn't get proc vk") + #procName); \
+        }                                                                                \
     } while (0)
 
+#define GET_DEVICE_PROC(name) GET_DEVICE_PROC_BASE(name, name)
+#define GET_DEVICE_PROC_VENDOR(name, vendor) GET_DEVICE_PROC_BASE(name, name##vendor)
+
 MaybeError VulkanFunctions::LoadDeviceProcs(VkDevice device, const VulkanDeviceInfo& deviceInfo) {
     GET_DEVICE_PROC(AllocateCommandBuffers);
     GET_DEVICE_PROC(AllocateDescriptorSets);
@@ -391,6 +394,40 @@ MaybeError VulkanFunctions::LoadDeviceProcs(VkDevice device, const VulkanDeviceI
         GET_DEVICE_PROC(GetImageSparseMemoryRequirements2);
     }
 
+    if (deviceInfo.HasExt(DeviceExt::DescriptorUpdateTemplate)) {
+        if (deviceInfo.properties.apiVersion >= VK_API_VERSION_1_1) {
+            GET_DEVICE_PROC(CreateDescriptorUpdateTemplate);
+            GET_DEVICE_PROC(DestroyDescriptorUpdateTemplate);
+            GET_DEVICE_PROC(UpdateDescriptorSetWithTemplate);
+        } else {
+            GET_DEVICE_PROC_VENDOR(CreateDescriptorUpdateTemplate, KHR);
+            GET_DEVICE_PROC_VENDOR(DestroyDescriptorUpdateTemplate, KHR);
+            GET_DEVICE_PROC_VENDOR(UpdateDescriptorSetWithTemplate, KHR);
+        }
+    }
+
+    // Vulkan 1.2 is not required to support the vendor entrypoints of the promoted
+    // VK_KHR_timeline_semaphore in GetDeviceProcAddr.
+    if (deviceInfo.HasExt(DeviceExt::TimelineSemaphore)) {
+        if (deviceInfo.properties.apiVersion >= VK_API_VERSION_1_2) {
+            GET_DEVICE_PROC(GetSemaphoreCounterValue);
+            GET_DEVICE_PROC(WaitSemaphores);
+        } else {
+            GET_DEVICE_PROC_VENDOR(GetSemaphoreCounterValue, KHR);
+            GET_DEVICE_PROC_VENDOR(WaitSemaphores, KHR);
+        }
+    }
+
+    if (deviceInfo.HasExt(DeviceExt::DynamicRendering)) {
+        if (deviceInfo.properties.apiVersion >= VK_API_VERSION_1_3) {
+            GET_DEVICE_PROC(CmdBeginRendering);
+            GET_DEVICE_PROC(CmdEndRendering);
+        } else {
+            GET_DEVICE_PROC_VENDOR(CmdBeginRendering, KHR);
+            GET_DEVICE_PROC_VENDOR(CmdEndRendering, KHR);
+        }
+    }
+
 #if VK_USE_PLATFORM_FUCHSIA
     if (deviceInfo.HasExt(DeviceExt::ExternalMemoryZirconHandle)) {
         GET_DEVICE_PROC(GetMemoryZirconHandleFUCHSIA);
@@ -341,6 +341,19 @@ struct VulkanFunctions {
     VkFn<PFN_vkGetImageMemoryRequirements2KHR> GetImageMemoryRequirements2 = nullptr;
     VkFn<PFN_vkGetImageSparseMemoryRequirements2KHR> GetImageSparseMemoryRequirements2 = nullptr;
 
+    // VK_KHR_descriptor_update_template
+    VkFn<PFN_vkCreateDescriptorUpdateTemplateKHR> CreateDescriptorUpdateTemplate = nullptr;
+    VkFn<PFN_vkDestroyDescriptorUpdateTemplateKHR> DestroyDescriptorUpdateTemplate = nullptr;
+    VkFn<PFN_vkUpdateDescriptorSetWithTemplateKHR> UpdateDescriptorSetWithTemplate = nullptr;
+
+    // VK_KHR_timeline_semaphore
+    VkFn<PFN_vkGetSemaphoreCounterValueKHR> GetSemaphoreCounterValue = nullptr;
+    VkFn<PFN_vkWaitSemaphoresKHR> WaitSemaphores = nullptr;
+
+    // VK_KHR_dynamic_rendering
+    VkFn<PFN_vkCmdBeginRenderingKHR> CmdBeginRendering = nullptr;
+    VkFn<PFN_vkCmdEndRenderingKHR> CmdEndRendering = nullptr;
+
     // VK_KHR_swapchain
     VkFn<PFN_vkCreateSwapchainKHR> CreateSwapchainKHR = nullptr;
     VkFn<PFN_vkDestroySwapchainKHR> DestroySwapchainKHR = nullptr;
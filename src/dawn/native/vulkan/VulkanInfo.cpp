@@ -318,6 +318,16 @@ ResultOrError<VulkanDeviceInfo> GatherDeviceInfo(const PhysicalDevice& device) {
                 VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_UNIFORM_CONTROL_FLOW_FEATURES_KHR);
         }
 
+        if (info.extensions[DeviceExt::TimelineSemaphore]) {
+            featuresChain.Add(&info.timelineSemaphoreFeatures,
+                              VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES);
+        }
+
+        if (info.extensions[DeviceExt::DynamicRendering]) {
+            featuresChain.Add(&info.dynamicRenderingFeatures,
+                              VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR);
+        }
+
         if (info.extensions[DeviceExt::ExternalMemoryHost]) {
             propertiesChain.Add(
                 &info.externalMemoryHostProperties,
@@ -27,9 +27,13 @@
 
 #include "dawn/platform/WorkerThread.h"
 
+#include <algorithm>
 #include <condition_variable>
-#include <functional>
+#include <deque>
+#include <mutex>
 #include <thread>
+#include <utility>
+#include <vector>
 
 #include "dawn/common/Assert.h"
 
@@ -79,25 +83,108 @@ class AsyncWaitableEvent final : public dawn::platform::WaitableEvent {
     std::shared_ptr<AsyncWaitableEventImpl> mWaitableEventImpl;
 };
 
+struct WorkerTask {
+    dawn::platform::PostWorkerTaskCallback callback;
+    void* userdata;
+    std::shared_ptr<AsyncWaitableEventImpl> waitableEventImpl;
+};
+
 }  // anonymous namespace
 
 namespace dawn::platform {
 
+struct AsyncWorkerThreadPool::State {
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::deque<WorkerTask> pendingTasks;
+    std::vector<std::thread> threads;
+    size_t idleThreadCount = 0;
+    uint32_t maxConcurrency = 0;
+    bool isShuttingDown = false;
+};
+
+AsyncWorkerThreadPool::AsyncWorkerThreadPool(uint32_t maxConcurrency)
+    : mState(std::make_shared<State>()) {
+    if (maxConcurrency == 0) {
+        // hardware_concurrency() may return 0 when the value is not computable.
+        maxConcurrency = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    mState->maxConcurrency = maxConcurrency;
+}
+
+AsyncWorkerThreadPool::~AsyncWorkerThreadPool() {
+    std::vector<std::thread> threads;
+    {
+        std::lock_guard<std::mutex> lock(mState->mutex);
+        mState->isShuttingDown = true;
+        threads.swap(mState->threads);
+    }
+    mState->condition.notify_all();
+
+    // Worker threads drain the remaining tasks before exiting. The pool may be destroyed from
+    // one of its own tasks (for example when a task drops the last reference to the device), in
+    // which case that thread cannot be joined and is detached instead. It keeps the state alive
+    // until it exits.
+    for (std::thread& thread : threads) {
+        if (thread.get_id() == std::this_thread::get_id()) {
+            thread.detach();
+        } else {
+            thread.join();
+        }
+    }
+}
+
 std::unique_ptr<dawn::platform::WaitableEvent> AsyncWorkerThreadPool::PostWorkerTask(
     dawn::platform::PostWorkerTaskCallback callback,
     void* userdata) {
     std::unique_ptr<AsyncWaitableEvent> waitableEvent = std::make_unique<AsyncWaitableEvent>();
 
-    std::function<void()> doTask = [callback, userdata,
-                                    waitableEventImpl = waitableEvent->GetWaitableEventImpl()] {
-        callback(userdata);
-        waitableEventImpl->MarkAsComplete();
-    };
-
-    std::thread thread(doTask);
-    thread.detach();
+    bool needsNewThread = false;
+    {
+        std::lock_guard<std::mutex> lock(mState->mutex);
+        DAWN_ASSERT(!mState->isShuttingDown);
+        mState->pendingTasks.push_back({callback, userdata, waitableEvent->GetWaitableEventImpl()});
+
+        // Only spawn a new thread when the idle threads can't pick up all the pending tasks.
+        needsNewThread = mState->pendingTasks.size() > mState->idleThreadCount &&
+                         mState->threads.size() < mState->maxConcurrency;
+        if (needsNewThread) {
+            mState->threads.emplace_back(WorkerLoop, mState);
+        }
+    }
+    if (!needsNewThread) {
+        mState->condition.notify_one();
+    }
 
     return waitableEvent;
 }
 
+uint32_t AsyncWorkerThreadPool::GetMaxConcurrency() const {
+    return mState->maxConcurrency;
+}
+
+// static
+void AsyncWorkerThreadPool::WorkerLoop(std::shared_ptr<State> state) {
+    while (true) {
+        WorkerTask task;
+        {
+            std::unique_lock<std::mutex> lock(state->mutex);
+            state->idleThreadCount++;
+            state->condition.wait(
+                lock, [&state] { return state->isShuttingDown || !state->pendingTasks.empty(); });
+            state->idleThreadCount--;
+
+            if (state->pendingTasks.empty()) {
+                DAWN_ASSERT(state->isShuttingDown);
+                return;
+            }
+            task = std::move(state->pendingTasks.front());
+            state->pendingTasks.pop_front();
+        }
+
+        task.callback(task.userdata);
+        task.waitableEventImpl->MarkAsComplete();
+    }
+}
+
 }  // namespace dawn::platform
@@ -28,6 +28,7 @@
 #ifndef SRC_DAWN_PLATFORM_WORKERTHREAD_H_
 #define SRC_DAWN_PLATFORM_WORKERTHREAD_H_
 
+#include <cstdint>
 #include <memory>
 
 #include "dawn/common/NonCopyable.h"
@@ -35,11 +36,28 @@
 
 namespace dawn::platform {
 
+// A worker task pool backed by a set of persistent threads. Threads are spawned lazily when tasks
+// are posted and no thread is idle, up to |maxConcurrency| threads. They are then reused for all
+// subsequent tasks instead of creating one thread per task.
 class AsyncWorkerThreadPool : public dawn::platform::WorkerTaskPool, public NonCopyable {
   public:
+    // A |maxConcurrency| of 0 means one thread per hardware thread.
+    explicit AsyncWorkerThreadPool(uint32_t maxConcurrency = 0);
+    ~AsyncWorkerThreadPool() override;
+
     std::unique_ptr<dawn::platform::WaitableEvent> PostWorkerTask(
         dawn::platform::PostWorkerTaskCallback callback,
         void* userdata) override;
+
+    uint32_t GetMaxConcurrency() const;
+
+  private:
+    struct State;
+    static void WorkerLoop(std::shared_ptr<State> state);
+
+    // The state is shared with the worker threads so that a worker thread may outlive the pool
+    // when the pool is destroyed from inside one of its tasks.
+    std::shared_ptr<State> mState;
 };
 
 }  // namespace dawn::platform
@@ -0,0 +1,107 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <benchmark/benchmark.h>
+#include <functional>
+#include <vector>
+
+#include "dawn/common/ContentLessObjectCache.h"
+#include "dawn/common/Ref.h"
+#include "dawn/common/RefCounted.h"
+
+namespace dawn {
+namespace {
+
+class CachedValue : public RefCounted, public ContentLessObjectCacheable<CachedValue> {
+  public:
+    explicit CachedValue(size_t value) : mValue(value) {}
+
+    struct HashFunc {
+        size_t operator()(const CachedValue* x) const { return std::hash<size_t>()(x->mValue); }
+    };
+
+    struct EqualityFunc {
+        bool operator()(const CachedValue* l, const CachedValue* r) const {
+            return l->mValue == r->mValue;
+        }
+    };
+
+  private:
+    void DeleteThis() override {
+        Uncache();
+        RefCounted::DeleteThis();
+    }
+
+    size_t mValue;
+};
+
+constexpr size_t kNumCachedValues = 1024;
+
+// A cache shared by all the benchmark threads, populated with |kNumCachedValues| values. The values
+// are declared after the cache so that they are uncached before the cache is destroyed.
+struct SharedCache {
+    SharedCache() {
+        for (size_t i = 0; i < kNumCachedValues; ++i) {
+            values.push_back(AcquireRef(new CachedValue(i)));
+            cache.Insert(values.back().Get());
+        }
+    }
+
+    ContentLessObjectCache<CachedValue> cache;
+    std::vector<Ref<CachedValue>> values;
+};
+
+SharedCache& GetSharedCache() {
+    static SharedCache sharedCache;
+    return sharedCache;
+}
+
+// Benchmarks for lookups in the ContentLessObjectCache used to deduplicate device objects, as done
+// when creating objects from multiple threads. The lookups should scale with the number of threads
+// as long as the threads look up different objects.
+void BM_ContentLessObjectCache_FindSame(benchmark::State& state) {
+    ContentLessObjectCache<CachedValue>& cache = GetSharedCache().cache;
+    CachedValue blueprint(0);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cache.Find(&blueprint));
+    }
+}
+BENCHMARK(BM_ContentLessObjectCache_FindSame)->Threads(1)->Threads(4)->Threads(16);
+
+void BM_ContentLessObjectCache_FindUnique(benchmark::State& state) {
+    ContentLessObjectCache<CachedValue>& cache = GetSharedCache().cache;
+    size_t value = state.thread_index();
+    for (auto _ : state) {
+        CachedValue blueprint(value);
+        benchmark::DoNotOptimize(cache.Find(&blueprint));
+        value = (value + state.threads()) % kNumCachedValues;
+    }
+}
+BENCHMARK(BM_ContentLessObjectCache_FindUnique)->Threads(1)->Threads(4)->Threads(16);
+
+}  // namespace
+}  // namespace dawn
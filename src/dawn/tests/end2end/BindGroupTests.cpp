@@ -1159,6 +1159,94 @@ TEST_P(BindGroupTests, DynamicOffsetOrder) {
     EXPECT_BUFFER_U32_RANGE_EQ(values.data(), outputBuffer, 0, values.size());
 }
 
+// Test a bind group that mixes dynamic buffers with samplers, textures and non-dynamic buffers, in
+// an order that doesn't match the binding numbers. On Vulkan this bind group is written with a
+// descriptor update template, which must put each descriptor at the right binding, with the right
+// descriptor type.
+TEST_P(BindGroupTests, DynamicOffsetsMixedWithSamplerAndTexture) {
+    std::array<uint32_t, 2> offsets = {2 * mMinUniformBufferOffsetAlignment,
+                                       1 * mMinUniformBufferOffsetAlignment};
+    std::array<uint32_t, 2> values = {21, 67};
+
+    wgpu::BufferDescriptor bufferDescriptor;
+    bufferDescriptor.size = 2 * mMinUniformBufferOffsetAlignment + sizeof(uint32_t);
+    bufferDescriptor.usage = wgpu::BufferUsage::Uniform | wgpu::BufferUsage::CopyDst;
+    wgpu::Buffer uniformBuffer = device.CreateBuffer(&bufferDescriptor);
+    bufferDescriptor.usage = wgpu::BufferUsage::Storage | wgpu::BufferUsage::CopyDst;
+    wgpu::Buffer storageBuffer = device.CreateBuffer(&bufferDescriptor);
+
+    queue.WriteBuffer(uniformBuffer, offsets[0], &values[0], sizeof(uint32_t));
+    queue.WriteBuffer(storageBuffer, offsets[1], &values[1], sizeof(uint32_t));
+
+    wgpu::Buffer outputBuffer = utils::CreateBufferFromData(
+        device, wgpu::BufferUsage::CopySrc | wgpu::BufferUsage::Storage, {0, 0, 0});
+
+    // A 1x1 texture holding a single green texel.
+    wgpu::TextureDescriptor textureDescriptor;
+    textureDescriptor.size = {1, 1, 1};
+    textureDescriptor.format = wgpu::TextureFormat::RGBA8Unorm;
+    textureDescriptor.usage = wgpu::TextureUsage::CopyDst | wgpu::TextureUsage::TextureBinding;
+    wgpu::Texture texture = device.CreateTexture(&textureDescriptor);
+
+    utils::RGBA8 texel(0, 255, 0, 255);
+    wgpu::ImageCopyTexture imageCopyTexture = utils::CreateImageCopyTexture(texture);
+    wgpu::TextureDataLayout textureDataLayout =
+        utils::CreateTextureDataLayout(0, sizeof(utils::RGBA8));
+    wgpu::Extent3D copySize = {1, 1, 1};
+    queue.WriteTexture(&imageCopyTexture, &texel, sizeof(texel), &textureDataLayout, &copySize);
+
+    wgpu::Sampler sampler = device.CreateSampler();
+
+    wgpu::BindGroupLayout bgl = utils::MakeBindGroupLayout(
+        device, {
+                    {5, wgpu::ShaderStage::Compute, wgpu::BufferBindingType::ReadOnlyStorage, true},
+                    {1, wgpu::ShaderStage::Compute, wgpu::SamplerBindingType::Filtering},
+                    {3, wgpu::ShaderStage::Compute, wgpu::BufferBindingType::Uniform, true},
+                    {0, wgpu::ShaderStage::Compute, wgpu::TextureSampleType::Float},
+                    {2, wgpu::ShaderStage::Compute, wgpu::BufferBindingType::Storage},
+                });
+    wgpu::BindGroup bindGroup = utils::MakeBindGroup(device, bgl,
+                                                     {
+                                                         {2, outputBuffer, 0, 3 * sizeof(uint32_t)},
+                                                         {5, storageBuffer, 0, sizeof(uint32_t)},
+                                                         {0, texture.CreateView()},
+                                                         {3, uniformBuffer, 0, sizeof(uint32_t)},
+                                                         {1, sampler},
+                                                     });
+
+    wgpu::ComputePipelineDescriptor pipelineDescriptor;
+    pipelineDescriptor.compute.module = utils::CreateShaderModule(device, R"(
+        struct Buffer {
+            value : u32
+        }
+
+        @group(0) @binding(0) var tex : texture_2d<f32>;
+        @group(0) @binding(1) var samp : sampler;
+        @group(0) @binding(2) var<storage, read_write> outputBuffer : vec3u;
+        @group(0) @binding(3) var<uniform> buffer3 : Buffer;
+        @group(0) @binding(5) var<storage, read> buffer5 : Buffer;
+
+        @compute @workgroup_size(1) fn main() {
+            let color = textureSampleLevel(tex, samp, vec2f(0.5), 0.0);
+            outputBuffer = vec3u(buffer3.value, buffer5.value, u32(color.g * 100.0));
+        })");
+    pipelineDescriptor.layout = utils::MakeBasicPipelineLayout(device, &bgl);
+    wgpu::ComputePipeline pipeline = device.CreateComputePipeline(&pipelineDescriptor);
+
+    wgpu::CommandEncoder commandEncoder = device.CreateCommandEncoder();
+    wgpu::ComputePassEncoder computePassEncoder = commandEncoder.BeginComputePass();
+    computePassEncoder.SetPipeline(pipeline);
+    computePassEncoder.SetBindGroup(0, bindGroup, offsets.size(), offsets.data());
+    computePassEncoder.DispatchWorkgroups(1);
+    computePassEncoder.End();
+
+    wgpu::CommandBuffer commands = commandEncoder.Finish();
+    queue.Submit(1, &commands);
+
+    std::array<uint32_t, 3> expected = {values[0], values[1], 100};
+    EXPECT_BUFFER_U32_RANGE_EQ(expected.data(), outputBuffer, 0, expected.size());
+}
+
 // Test that ensures that backends do not remap bindings such that dynamic and non-dynamic bindings
 // conflict. This can happen if the backend treats dynamic bindings separately from non-dynamic
 // bindings.
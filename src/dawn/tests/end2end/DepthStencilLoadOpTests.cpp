@@ -255,7 +255,8 @@ namespace {
 auto GenerateParam() {
     auto params1 = MakeParamGenerator<DepthStencilLoadOpTestParams>(
         {D3D11Backend(), D3D12Backend(), D3D12Backend({}, {"use_d3d12_render_pass"}),
-         MetalBackend(), OpenGLBackend(), OpenGLESBackend(), VulkanBackend()},
+         MetalBackend(), OpenGLBackend(), OpenGLESBackend(), VulkanBackend(),
+         VulkanBackend({}, {"vulkan_use_dynamic_rendering"})},
         {wgpu::TextureFormat::Depth32Float, wgpu::TextureFormat::Depth16Unorm},
         {Check::CopyDepth, Check::DepthTest, Check::SampleDepth});
 
@@ -264,7 +265,8 @@ auto GenerateParam() {
          MetalBackend(), MetalBackend({"metal_use_combined_depth_stencil_format_for_stencil8"}),
          MetalBackend(
              {"metal_use_both_depth_and_stencil_attachments_for_combined_depth_stencil_formats"}),
-         OpenGLBackend(), OpenGLESBackend(), VulkanBackend()},
+         OpenGLBackend(), OpenGLESBackend(), VulkanBackend(),
+         VulkanBackend({}, {"vulkan_use_dynamic_rendering"})},
         {wgpu::TextureFormat::Depth24PlusStencil8, wgpu::TextureFormat::Depth32FloatStencil8,
          wgpu::TextureFormat::Stencil8},
         {Check::CopyStencil, Check::StencilTest, Check::DepthTest, Check::SampleDepth});
@@ -319,7 +321,8 @@ TEST_P(StencilClearValueOverflowTest, StencilClearValueOverFlowUint16) {
 DAWN_INSTANTIATE_TEST_P(StencilClearValueOverflowTest,
                         {D3D11Backend(), D3D12Backend(),
                          D3D12Backend({}, {"use_d3d12_render_pass"}), MetalBackend(),
-                         OpenGLBackend(), OpenGLESBackend(), VulkanBackend()},
+                         OpenGLBackend(), OpenGLESBackend(), VulkanBackend(),
+                         VulkanBackend({}, {"vulkan_use_dynamic_rendering"})},
                         {wgpu::TextureFormat::Depth24PlusStencil8,
                          wgpu::TextureFormat::Depth32FloatStencil8, wgpu::TextureFormat::Stencil8},
                         {Check::CopyStencil, Check::StencilTest});
@@ -437,7 +440,8 @@ TEST_P(DepthTextureClearTwiceTest, ClearDepthAspectTwice) {
 
 DAWN_INSTANTIATE_TEST_P(DepthTextureClearTwiceTest,
                         {D3D11Backend(), D3D12Backend(), MetalBackend(), OpenGLBackend(),
-                         OpenGLESBackend(), VulkanBackend()},
+                         OpenGLESBackend(), VulkanBackend(),
+                         VulkanBackend({}, {"vulkan_use_dynamic_rendering"})},
                         {wgpu::TextureFormat::Depth16Unorm, wgpu::TextureFormat::Depth24Plus,
                          wgpu::TextureFormat::Depth32Float,
                          wgpu::TextureFormat::Depth32FloatStencil8,
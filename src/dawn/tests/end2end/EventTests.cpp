@@ -470,7 +470,8 @@ TEST_P(EventCompletionTests, WorkDoneDropInstanceAfterEvent) {
 
 DAWN_INSTANTIATE_TEST_P(EventCompletionTests,
                         {D3D11Backend(), D3D12Backend(), MetalBackend(), VulkanBackend(),
-                         OpenGLBackend(), OpenGLESBackend()},
+                         VulkanBackend({}, {"vulkan_use_timeline_semaphore"}), OpenGLBackend(),
+                         OpenGLESBackend()},
                         {
                             WaitTypeAndCallbackMode::TimedWaitAny_WaitAnyOnly,
                             WaitTypeAndCallbackMode::TimedWaitAny_AllowSpontaneous,
@@ -627,6 +628,7 @@ DAWN_INSTANTIATE_TEST(WaitAnyTests,
                       D3D12Backend(),
                       MetalBackend(),
                       VulkanBackend(),
+                      VulkanBackend({}, {"vulkan_use_timeline_semaphore"}),
                       OpenGLBackend(),
                       OpenGLESBackend());
 
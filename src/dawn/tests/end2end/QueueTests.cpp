@@ -200,6 +200,20 @@ TEST_P(QueueWriteBufferTests, MaxBufferSizeWriteBuffer) {
     queue.WriteBuffer(buffer, 0, data.data(), maxBufferSize);
 }
 
+// Test WriteBuffer with sizes just below the max buffer size. The staging buffers for these are
+// rounded up to a size class that must not exceed the max buffer size.
+TEST_P(QueueWriteBufferTests, NearMaxBufferSizeWriteBuffer) {
+    uint32_t maxBufferSize = GetSupportedLimits().limits.maxBufferSize;
+    wgpu::BufferDescriptor descriptor;
+    descriptor.size = maxBufferSize;
+    descriptor.usage = wgpu::BufferUsage::CopySrc | wgpu::BufferUsage::CopyDst;
+    wgpu::Buffer buffer = device.CreateBuffer(&descriptor);
+
+    std::vector<uint8_t> data(maxBufferSize - 4);
+    queue.WriteBuffer(buffer, 0, data.data(), maxBufferSize - 4);
+    queue.WriteBuffer(buffer, 4, data.data(), maxBufferSize - 4);
+}
+
 // Test a special code path: writing when dynamic uploader already contatins some unaligned
 // data, it might be necessary to use a ring buffer with properly aligned offset.
 TEST_P(QueueWriteBufferTests, UnalignedDynamicUploader) {
@@ -120,7 +120,8 @@ DAWN_INSTANTIATE_TEST(QueueTimelineTests,
                       MetalBackend(),
                       OpenGLBackend(),
                       OpenGLESBackend(),
-                      VulkanBackend());
+                      VulkanBackend(),
+                      VulkanBackend({}, {"vulkan_use_timeline_semaphore"}));
 
 }  // anonymous namespace
 }  // namespace dawn
@@ -0,0 +1,133 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <vector>
+
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+#include "dawn/utils/WGPUHelpers.h"
+
+namespace dawn {
+namespace {
+
+constexpr unsigned int kNumBindGroups = 1000;
+
+struct BindGroupCreationParams : AdapterTestParam {
+    BindGroupCreationParams(const AdapterTestParam& param, uint32_t bindingCountIn)
+        : AdapterTestParam(param), bindingCount(bindingCountIn) {}
+    uint32_t bindingCount;
+};
+
+std::ostream& operator<<(std::ostream& ostream, const BindGroupCreationParams& param) {
+    ostream << static_cast<const AdapterTestParam&>(param);
+    ostream << "_bindings_" << param.bindingCount;
+    return ostream;
+}
+
+// Test the CPU cost of creating many transient bind groups in a frame. The bindings cycle through
+// uniform buffers, sampled textures and samplers.
+class BindGroupCreationPerf : public DawnPerfTestWithParams<BindGroupCreationParams> {
+  public:
+    BindGroupCreationPerf() : DawnPerfTestWithParams(kNumBindGroups, 1) {}
+    ~BindGroupCreationPerf() override = default;
+
+    void SetUp() override;
+
+  private:
+    void Step() override;
+
+    wgpu::BindGroupLayout mLayout;
+    std::vector<wgpu::BindGroupEntry> mEntries;
+};
+
+void BindGroupCreationPerf::SetUp() {
+    DawnPerfTestWithParams<BindGroupCreationParams>::SetUp();
+
+    wgpu::BufferDescriptor bufferDesc;
+    bufferDesc.size = 256;
+    bufferDesc.usage = wgpu::BufferUsage::Uniform;
+    wgpu::Buffer buffer = device.CreateBuffer(&bufferDesc);
+
+    wgpu::TextureDescriptor textureDesc;
+    textureDesc.size = {1, 1};
+    textureDesc.format = wgpu::TextureFormat::RGBA8Unorm;
+    textureDesc.usage = wgpu::TextureUsage::TextureBinding;
+    wgpu::TextureView view = device.CreateTexture(&textureDesc).CreateView();
+
+    wgpu::Sampler sampler = device.CreateSampler();
+
+    std::vector<wgpu::BindGroupLayoutEntry> layoutEntries(GetParam().bindingCount);
+    mEntries.resize(GetParam().bindingCount);
+    for (uint32_t i = 0; i < GetParam().bindingCount; ++i) {
+        wgpu::BindGroupLayoutEntry& layoutEntry = layoutEntries[i];
+        wgpu::BindGroupEntry& entry = mEntries[i];
+        layoutEntry.binding = i;
+        layoutEntry.visibility = wgpu::ShaderStage::Fragment;
+        entry.binding = i;
+
+        switch (i % 3) {
+            case 0:
+                layoutEntry.buffer.type = wgpu::BufferBindingType::Uniform;
+                entry.buffer = buffer;
+                break;
+            case 1:
+                layoutEntry.texture.sampleType = wgpu::TextureSampleType::Float;
+                entry.textureView = view;
+                break;
+            case 2:
+                layoutEntry.sampler.type = wgpu::SamplerBindingType::Filtering;
+                entry.sampler = sampler;
+                break;
+        }
+    }
+
+    wgpu::BindGroupLayoutDescriptor layoutDesc;
+    layoutDesc.entryCount = layoutEntries.size();
+    layoutDesc.entries = layoutEntries.data();
+    mLayout = device.CreateBindGroupLayout(&layoutDesc);
+}
+
+void BindGroupCreationPerf::Step() {
+    wgpu::BindGroupDescriptor desc;
+    desc.layout = mLayout;
+    desc.entryCount = mEntries.size();
+    desc.entries = mEntries.data();
+
+    for (unsigned int i = 0; i < kNumBindGroups; ++i) {
+        wgpu::BindGroup bindGroup = device.CreateBindGroup(&desc);
+    }
+}
+
+TEST_P(BindGroupCreationPerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_TEST_P(BindGroupCreationPerf,
+                        {D3D12Backend(), MetalBackend(), OpenGLBackend(), VulkanBackend()},
+                        {1, 4, 16});
+
+}  // anonymous namespace
+}  // namespace dawn
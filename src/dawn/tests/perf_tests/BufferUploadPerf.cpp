@@ -25,6 +25,7 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <algorithm>
 #include <vector>
 
 #include "dawn/tests/perf_tests/DawnPerfTest.h"
@@ -34,6 +35,8 @@ namespace dawn {
 namespace {
 
 constexpr unsigned int kNumIterations = 50;
+// Caps the amount of data uploaded per step so that large uploads don't take too long to run.
+constexpr uint64_t kMaxUploadSizePerStep = 1024 * 1024 * 1024;
 
 enum class UploadMethod {
     WriteBuffer,
@@ -41,16 +44,25 @@ enum class UploadMethod {
 };
 
 // Perf delta exists between ranges [0, 1MB] vs [1MB, MAX_SIZE).
-// These are sample buffer sizes within each range.
-enum class UploadSize {
+// These are sample buffer sizes within each range. Uploads larger than 16MB don't fit in the
+// DynamicUploader's ring buffers and use dedicated staging buffers.
+enum class UploadSize : uint64_t {
     BufferSize_1KB = 1 * 1024,
     BufferSize_64KB = 64 * 1024,
     BufferSize_1MB = 1 * 1024 * 1024,
 
     BufferSize_4MB = 4 * 1024 * 1024,
     BufferSize_16MB = 16 * 1024 * 1024,
+    BufferSize_64MB = 64 * 1024 * 1024,
+    BufferSize_256MB = 256 * 1024 * 1024,
 };
 
+unsigned int GetIterationsPerStep(UploadSize uploadSize) {
+    uint64_t maxIterations = kMaxUploadSizePerStep / static_cast<uint64_t>(uploadSize);
+    return static_cast<unsigned int>(
+        std::max(uint64_t(1), std::min(uint64_t(kNumIterations), maxIterations)));
+}
+
 struct BufferUploadParams : AdapterTestParam {
     BufferUploadParams(const AdapterTestParam& param,
                        UploadMethod uploadMethod,
@@ -89,16 +101,24 @@ std::ostream& operator<<(std::ostream& ostream, const BufferUploadParams& param)
         case UploadSize::BufferSize_16MB:
             ostream << "_BufferSize_16MB";
             break;
+        case UploadSize::BufferSize_64MB:
+            ostream << "_BufferSize_64MB";
+            break;
+        case UploadSize::BufferSize_256MB:
+            ostream << "_BufferSize_256MB";
+            break;
     }
 
     return ostream;
 }
 
-// Test uploading |kBufferSize| bytes of data |kNumIterations| times.
+// Test uploading |kBufferSize| bytes of data |kNumIterations| times, or fewer times for the
+// largest sizes.
 class BufferUploadPerf : public DawnPerfTestWithParams<BufferUploadParams> {
   public:
     BufferUploadPerf()
-        : DawnPerfTestWithParams(kNumIterations, 1),
+        : DawnPerfTestWithParams(GetIterationsPerStep(GetParam().uploadSize), 1),
+          iterations(GetIterationsPerStep(GetParam().uploadSize)),
           data(static_cast<size_t>(GetParam().uploadSize)) {}
     ~BufferUploadPerf() override = default;
 
@@ -107,6 +127,7 @@ class BufferUploadPerf : public DawnPerfTestWithParams<BufferUploadParams> {
   private:
     void Step() override;
 
+    const unsigned int iterations;
     wgpu::Buffer dst;
     std::vector<uint8_t> data;
 };
@@ -114,6 +135,8 @@ class BufferUploadPerf : public DawnPerfTestWithParams<BufferUploadParams> {
 void BufferUploadPerf::SetUp() {
     DawnPerfTestWithParams<BufferUploadParams>::SetUp();
 
+    DAWN_TEST_UNSUPPORTED_IF(data.size() > GetSupportedLimits().limits.maxBufferSize);
+
     wgpu::BufferDescriptor desc = {};
     desc.size = data.size();
     desc.usage = wgpu::BufferUsage::CopyDst;
@@ -124,7 +147,7 @@ void BufferUploadPerf::SetUp() {
 void BufferUploadPerf::Step() {
     switch (GetParam().uploadMethod) {
         case UploadMethod::WriteBuffer: {
-            for (unsigned int i = 0; i < kNumIterations; ++i) {
+            for (unsigned int i = 0; i < iterations; ++i) {
                 queue.WriteBuffer(dst, 0, data.data(), data.size());
             }
             // Make sure all WriteBuffer's are flushed.
@@ -140,7 +163,7 @@ void BufferUploadPerf::Step() {
 
             wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
 
-            for (unsigned int i = 0; i < kNumIterations; ++i) {
+            for (unsigned int i = 0; i < iterations; ++i) {
                 wgpu::Buffer buffer = device.CreateBuffer(&desc);
                 memcpy(buffer.GetMappedRange(0, data.size()), data.data(), data.size());
                 buffer.Unmap();
@@ -163,7 +186,8 @@ DAWN_INSTANTIATE_TEST_P(BufferUploadPerf,
                         {UploadMethod::WriteBuffer, UploadMethod::MappedAtCreation},
                         {UploadSize::BufferSize_1KB, UploadSize::BufferSize_64KB,
                          UploadSize::BufferSize_1MB, UploadSize::BufferSize_4MB,
-                         UploadSize::BufferSize_16MB});
+                         UploadSize::BufferSize_16MB, UploadSize::BufferSize_64MB,
+                         UploadSize::BufferSize_256MB});
 
 }  // anonymous namespace
 }  // namespace dawn
@@ -0,0 +1,177 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <array>
+#include <vector>
+
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+#include "dawn/utils/WGPUHelpers.h"
+
+namespace dawn {
+namespace {
+
+constexpr unsigned int kNumDispatches = 1000;
+constexpr uint32_t kNumBindGroups = 4;
+constexpr uint32_t kNumResources = 4;
+
+struct ComputePassEncodingParams : AdapterTestParam {
+    ComputePassEncodingParams(const AdapterTestParam& param,
+                              uint32_t bindingsPerGroupIn,
+                              uint32_t bindGroupSetCountIn)
+        : AdapterTestParam(param),
+          bindingsPerGroup(bindingsPerGroupIn),
+          bindGroupSetCount(bindGroupSetCountIn) {}
+    uint32_t bindingsPerGroup;
+    // The number of different sets of bind groups that dispatches cycle through.
+    uint32_t bindGroupSetCount;
+};
+
+std::ostream& operator<<(std::ostream& ostream, const ComputePassEncodingParams& param) {
+    ostream << static_cast<const AdapterTestParam&>(param);
+    ostream << "_bindingsPerGroup_" << param.bindingsPerGroup;
+    ostream << "_bindGroupSets_" << param.bindGroupSetCount;
+    return ostream;
+}
+
+// Test the CPU cost of encoding a compute pass with many dispatches and bind group changes, which
+// is dominated by the tracking of the resource usage of each dispatch. All bind groups reference
+// the same few buffers and textures so resources are seen multiple times in each dispatch. With a
+// single set of bind groups, the same bind groups are reissued before every dispatch.
+class ComputePassEncodingPerf : public DawnPerfTestWithParams<ComputePassEncodingParams> {
+  public:
+    ComputePassEncodingPerf() : DawnPerfTestWithParams(kNumDispatches, 1) {}
+    ~ComputePassEncodingPerf() override = default;
+
+    void SetUp() override;
+
+  private:
+    void Step() override;
+
+    wgpu::ComputePipeline mPipeline;
+    std::vector<std::array<wgpu::BindGroup, kNumBindGroups>> mBindGroups;
+};
+
+void ComputePassEncodingPerf::SetUp() {
+    DawnPerfTestWithParams<ComputePassEncodingParams>::SetUp();
+    const uint32_t bindingsPerGroup = GetParam().bindingsPerGroup;
+    const uint32_t bindGroupSetCount = GetParam().bindGroupSetCount;
+
+    wgpu::BufferDescriptor bufferDesc;
+    bufferDesc.size = 1024;
+    bufferDesc.usage = wgpu::BufferUsage::Storage;
+
+    wgpu::TextureDescriptor textureDesc;
+    textureDesc.size = {1, 1};
+    textureDesc.format = wgpu::TextureFormat::RGBA8Unorm;
+    textureDesc.usage = wgpu::TextureUsage::TextureBinding;
+
+    std::array<wgpu::Buffer, kNumResources> buffers;
+    std::array<wgpu::TextureView, kNumResources> views;
+    for (uint32_t i = 0; i < kNumResources; ++i) {
+        buffers[i] = device.CreateBuffer(&bufferDesc);
+        views[i] = device.CreateTexture(&textureDesc).CreateView();
+    }
+
+    // Bindings alternate between read-only storage buffers and sampled textures.
+    std::vector<wgpu::BindGroupLayoutEntry> layoutEntries(bindingsPerGroup);
+    for (uint32_t i = 0; i < bindingsPerGroup; ++i) {
+        wgpu::BindGroupLayoutEntry& layoutEntry = layoutEntries[i];
+        layoutEntry.binding = i;
+        layoutEntry.visibility = wgpu::ShaderStage::Compute;
+        if (i % 2 == 0) {
+            layoutEntry.buffer.type = wgpu::BufferBindingType::ReadOnlyStorage;
+        } else {
+            layoutEntry.texture.sampleType = wgpu::TextureSampleType::Float;
+        }
+    }
+
+    wgpu::BindGroupLayoutDescriptor layoutDesc;
+    layoutDesc.entryCount = layoutEntries.size();
+    layoutDesc.entries = layoutEntries.data();
+    wgpu::BindGroupLayout layout = device.CreateBindGroupLayout(&layoutDesc);
+
+    mBindGroups.resize(bindGroupSetCount);
+    for (uint32_t set = 0; set < bindGroupSetCount; ++set) {
+        for (uint32_t group = 0; group < kNumBindGroups; ++group) {
+            std::vector<wgpu::BindGroupEntry> entries(bindingsPerGroup);
+            for (uint32_t i = 0; i < bindingsPerGroup; ++i) {
+                uint32_t resource = (set + group + i / 2) % kNumResources;
+                entries[i].binding = i;
+                if (i % 2 == 0) {
+                    entries[i].buffer = buffers[resource];
+                    entries[i].offset = 256 * (set % 4);
+                    entries[i].size = 256;
+                } else {
+                    entries[i].textureView = views[resource];
+                }
+            }
+
+            wgpu::BindGroupDescriptor desc;
+            desc.layout = layout;
+            desc.entryCount = entries.size();
+            desc.entries = entries.data();
+            mBindGroups[set][group] = device.CreateBindGroup(&desc);
+        }
+    }
+
+    wgpu::ComputePipelineDescriptor pipelineDesc;
+    pipelineDesc.layout = utils::MakePipelineLayout(device, {layout, layout, layout, layout});
+    pipelineDesc.compute.module = utils::CreateShaderModule(device, R"(
+        @compute @workgroup_size(1) fn main() {
+        }
+    )");
+    mPipeline = device.CreateComputePipeline(&pipelineDesc);
+}
+
+void ComputePassEncodingPerf::Step() {
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    wgpu::ComputePassEncoder pass = encoder.BeginComputePass();
+    pass.SetPipeline(mPipeline);
+    for (unsigned int i = 0; i < kNumDispatches; ++i) {
+        const auto& bindGroups = mBindGroups[i % mBindGroups.size()];
+        for (uint32_t group = 0; group < kNumBindGroups; ++group) {
+            pass.SetBindGroup(group, bindGroups[group]);
+        }
+        pass.DispatchWorkgroups(1);
+    }
+    pass.End();
+
+    wgpu::CommandBuffer commands = encoder.Finish();
+    queue.Submit(1, &commands);
+}
+
+TEST_P(ComputePassEncodingPerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_TEST_P(ComputePassEncodingPerf,
+                        {D3D12Backend(), MetalBackend(), OpenGLBackend(), VulkanBackend()},
+                        {1, 4},
+                        {1, 8});
+
+}  // anonymous namespace
+}  // namespace dawn
@@ -0,0 +1,185 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <string>
+#include <vector>
+
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+#include "dawn/utils/ComboRenderPipelineDescriptor.h"
+#include "dawn/utils/WGPUHelpers.h"
+
+namespace dawn {
+namespace {
+
+constexpr unsigned int kNumPipelinesPerStep = 64;
+
+constexpr char kComputeShader[] = R"(
+        override kSeed : u32;
+        @group(0) @binding(0) var<storage, read_write> result : array<u32>;
+        @compute @workgroup_size(64) fn main(@builtin(global_invocation_id) id : vec3u) {
+            var value = id.x;
+            for (var i = 0u; i < 16u; i++) {
+                value = value * 1664525u + kSeed;
+            }
+            result[id.x] = value;
+        })";
+
+constexpr char kVertexShader[] = R"(
+        override kSeed : f32;
+        @vertex fn main(@builtin(vertex_index) index : u32) -> @builtin(position) vec4f {
+            return vec4f(f32(index) * kSeed, 0.0, 0.0, 1.0);
+        })";
+
+constexpr char kFragmentShader[] = R"(
+        @fragment fn main() -> @location(0) vec4f {
+            return vec4f(0.0, 1.0, 0.0, 1.0);
+        })";
+
+enum class PipelineType {
+    Compute,
+    Render,
+};
+
+struct CreatePipelineAsyncParams : AdapterTestParam {
+    CreatePipelineAsyncParams(const AdapterTestParam& param, PipelineType pipelineType)
+        : AdapterTestParam(param), pipelineType(pipelineType) {}
+
+    PipelineType pipelineType;
+};
+
+std::ostream& operator<<(std::ostream& ostream, const CreatePipelineAsyncParams& param) {
+    ostream << static_cast<const AdapterTestParam&>(param);
+
+    switch (param.pipelineType) {
+        case PipelineType::Compute:
+            ostream << "_Compute";
+            break;
+        case PipelineType::Render:
+            ostream << "_Render";
+            break;
+    }
+
+    return ostream;
+}
+
+// Test the throughput of creating |kNumPipelinesPerStep| distinct pipelines with
+// Create*PipelineAsync and waiting for all of them, as an application warming its pipelines at
+// startup would. Each pipeline uses a different override value so that none of them hits the
+// device's pipeline cache.
+class CreatePipelineAsyncPerf : public DawnPerfTestWithParams<CreatePipelineAsyncParams> {
+  public:
+    CreatePipelineAsyncPerf() : DawnPerfTestWithParams(kNumPipelinesPerStep, 1) {}
+    ~CreatePipelineAsyncPerf() override = default;
+
+    void SetUp() override;
+
+  private:
+    bool SupportsCPUAdapters() const override { return true; }
+
+    void Step() override;
+
+    wgpu::ShaderModule mComputeModule;
+    wgpu::ShaderModule mVertexModule;
+    wgpu::ShaderModule mFragmentModule;
+
+    // Used to make override values unique across steps.
+    uint32_t mNextSeed = 0;
+    uint32_t mPendingPipelineCount = 0;
+};
+
+void CreatePipelineAsyncPerf::SetUp() {
+    DawnPerfTestWithParams<CreatePipelineAsyncParams>::SetUp();
+
+    mComputeModule = utils::CreateShaderModule(device, kComputeShader);
+    mVertexModule = utils::CreateShaderModule(device, kVertexShader);
+    mFragmentModule = utils::CreateShaderModule(device, kFragmentShader);
+}
+
+void CreatePipelineAsyncPerf::Step() {
+    mPendingPipelineCount = kNumPipelinesPerStep;
+
+    for (unsigned int i = 0; i < kNumPipelinesPerStep; ++i) {
+        wgpu::ConstantEntry constant;
+        constant.key = "kSeed";
+        constant.value = static_cast<double>(++mNextSeed);
+
+        switch (GetParam().pipelineType) {
+            case PipelineType::Compute: {
+                wgpu::ComputePipelineDescriptor desc;
+                desc.compute.module = mComputeModule;
+                desc.compute.constantCount = 1;
+                desc.compute.constants = &constant;
+
+                device.CreateComputePipelineAsync(
+                    &desc,
+                    [](WGPUCreatePipelineAsyncStatus status, WGPUComputePipeline pipeline,
+                       const char*, void* userdata) {
+                        EXPECT_EQ(WGPUCreatePipelineAsyncStatus_Success, status);
+                        wgpu::ComputePipeline::Acquire(pipeline);
+                        (*static_cast<uint32_t*>(userdata))--;
+                    },
+                    &mPendingPipelineCount);
+                break;
+            }
+
+            case PipelineType::Render: {
+                utils::ComboRenderPipelineDescriptor desc;
+                desc.vertex.module = mVertexModule;
+                desc.vertex.constantCount = 1;
+                desc.vertex.constants = &constant;
+                desc.cFragment.module = mFragmentModule;
+
+                device.CreateRenderPipelineAsync(
+                    &desc,
+                    [](WGPUCreatePipelineAsyncStatus status, WGPURenderPipeline pipeline,
+                       const char*, void* userdata) {
+                        EXPECT_EQ(WGPUCreatePipelineAsyncStatus_Success, status);
+                        wgpu::RenderPipeline::Acquire(pipeline);
+                        (*static_cast<uint32_t*>(userdata))--;
+                    },
+                    &mPendingPipelineCount);
+                break;
+            }
+        }
+    }
+
+    while (mPendingPipelineCount != 0) {
+        WaitABit();
+    }
+}
+
+TEST_P(CreatePipelineAsyncPerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_TEST_P(CreatePipelineAsyncPerf,
+                        {D3D12Backend(), MetalBackend(), NullBackend(), OpenGLBackend(),
+                         VulkanBackend()},
+                        {PipelineType::Compute, PipelineType::Render});
+
+}  // anonymous namespace
+}  // namespace dawn
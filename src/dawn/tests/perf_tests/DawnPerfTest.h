@@ -141,7 +141,8 @@ class DawnPerfTestWithParams : public DawnTestWithParams<Params>, public DawnPer
 
         wgpu::AdapterProperties properties;
         this->GetAdapter().GetProperties(&properties);
-        DAWN_TEST_UNSUPPORTED_IF(properties.adapterType == wgpu::AdapterType::CPU);
+        DAWN_TEST_UNSUPPORTED_IF(properties.adapterType == wgpu::AdapterType::CPU &&
+                                 !SupportsCPUAdapters());
 
         if (mSupportsTimestampQuery) {
             InitializeGPUTimer();
@@ -149,6 +150,10 @@ class DawnPerfTestWithParams : public DawnTestWithParams<Params>, public DawnPer
     }
     ~DawnPerfTestWithParams() override = default;
 
+    // Tests that only measure CPU-side costs of Dawn may override this to also run on CPU adapters
+    // like the Null backend.
+    virtual bool SupportsCPUAdapters() const { return false; }
+
     std::vector<wgpu::FeatureName> GetRequiredFeatures() override {
         std::vector<wgpu::FeatureName> requiredFeatures = {wgpu::FeatureName::TimestampQuery};
         mSupportsTimestampQuery = DawnTestWithParams<Params>::SupportsFeatures(requiredFeatures);
@@ -39,6 +39,9 @@ namespace dawn {
 namespace {
 
 constexpr unsigned int kNumDraws = 2000;
+// The number of command encoders used per frame with Encoders::Many.
+constexpr unsigned int kNumEncoders = 100;
+static_assert(kNumDraws % kNumEncoders == 0);
 
 constexpr uint32_t kTextureSize = 64;
 constexpr size_t kUniformSize = 3 * sizeof(float);
@@ -98,15 +101,22 @@ enum class RenderBundle {
     Yes,  // Record commands in a render bundle
 };
 
+enum class Encoders {
+    Single,  // Record all the draws with a single command encoder.
+    Many,    // Split the draws over many short command encoders, submitted together.
+};
+
 struct DrawCallParam {
     Pipeline pipelineType;
     VertexBuffer vertexBufferType;
     BindGroup bindGroupType;
     UniformData uniformDataType;
     RenderBundle withRenderBundle;
+    Encoders encoders;
 };
 
-using DrawCallParamTuple = std::tuple<Pipeline, VertexBuffer, BindGroup, UniformData, RenderBundle>;
+using DrawCallParamTuple =
+    std::tuple<Pipeline, VertexBuffer, BindGroup, UniformData, RenderBundle, Encoders>;
 
 template <typename T>
 unsigned int AssignParam(T& lhs, T rhs) {
@@ -122,11 +132,13 @@ unsigned int AssignParam(T& lhs, T rhs) {
 //  - BindGroup::NoChange
 //  - UniformData::Static
 //  - RenderBundle::No
+//  - Encoders::Single
 template <typename... Ts>
 DrawCallParam MakeParam(Ts... args) {
     // Baseline param
-    DrawCallParamTuple paramTuple{Pipeline::Static, VertexBuffer::NoChange, BindGroup::NoChange,
-                                  UniformData::Static, RenderBundle::No};
+    DrawCallParamTuple paramTuple{Pipeline::Static,    VertexBuffer::NoChange,
+                                  BindGroup::NoChange, UniformData::Static,
+                                  RenderBundle::No,    Encoders::Single};
 
     unsigned int unused[] = {
         0,  // Avoid making a 0-sized array.
@@ -137,7 +149,7 @@ DrawCallParam MakeParam(Ts... args) {
     return DrawCallParam{
         std::get<Pipeline>(paramTuple),     std::get<VertexBuffer>(paramTuple),
         std::get<BindGroup>(paramTuple),    std::get<UniformData>(paramTuple),
-        std::get<RenderBundle>(paramTuple),
+        std::get<RenderBundle>(paramTuple), std::get<Encoders>(paramTuple),
     };
 }
 
@@ -206,6 +218,14 @@ std::ostream& operator<<(std::ostream& ostream, const DrawCallParamForTest& test
             break;
     }
 
+    switch (param.encoders) {
+        case Encoders::Single:
+            break;
+        case Encoders::Many:
+            ostream << "_ManyEncoders";
+            break;
+    }
+
     return ostream;
 }
 
@@ -223,6 +243,9 @@ std::ostream& operator<<(std::ostream& ostream, const DrawCallParamForTest& test
 //     precomputed in a render bundle.
 //   - Static/Dynamic data: Updating data for each draw is a common use case. It also tests
 //     the efficiency of resource transitions.
+//   - Single/Many encoders: Applications often record many short command encoders per frame,
+//     which stresses the per-encoder costs like the allocation of command memory. The number of
+//     calls made to the system allocator for command blocks is reported per frame.
 class DrawCallPerf : public DawnPerfTestWithParams<DrawCallParamForTest> {
   public:
     DrawCallPerf() : DawnPerfTestWithParams(kNumDraws, 3) {}
@@ -234,11 +257,15 @@ class DrawCallPerf : public DawnPerfTestWithParams<DrawCallParamForTest> {
     DrawCallParam GetParam() const { return DawnPerfTestWithParams::GetParam().param; }
 
     template <typename Encoder>
-    void RecordRenderCommands(Encoder encoder);
+    void RecordRenderCommands(Encoder encoder, uint32_t firstDraw, uint32_t drawCount);
+
+    uint64_t GetFrameCount() const { return mFrameCount; }
 
   private:
     void Step() override;
 
+    uint64_t mFrameCount = 0;
+
     // One large dynamic vertex buffer, or multiple separate vertex buffers.
     wgpu::Buffer mVertexBuffers[kNumDraws];
     size_t mAlignedVertexDataSize;
@@ -269,6 +296,10 @@ class DrawCallPerf : public DawnPerfTestWithParams<DrawCallParamForTest> {
 void DrawCallPerf::SetUp() {
     DawnPerfTestWithParams::SetUp();
 
+    // Render bundles contain all the draws so they can only be executed by a single encoder.
+    DAWN_ASSERT(GetParam().withRenderBundle == RenderBundle::No ||
+                GetParam().encoders == Encoders::Single);
+
     // Compute aligned uniform / vertex data sizes.
     mAlignedUniformSize =
         Align(kUniformSize, GetSupportedLimits().limits.minUniformBufferOffsetAlignment);
@@ -459,13 +490,13 @@ void DrawCallPerf::SetUp() {
         descriptor.depthStencilFormat = wgpu::TextureFormat::Depth24PlusStencil8;
 
         wgpu::RenderBundleEncoder encoder = device.CreateRenderBundleEncoder(&descriptor);
-        RecordRenderCommands(encoder);
+        RecordRenderCommands(encoder, 0, kNumDraws);
         mRenderBundle = encoder.Finish();
     }
 }
 
 template <typename Encoder>
-void DrawCallPerf::RecordRenderCommands(Encoder pass) {
+void DrawCallPerf::RecordRenderCommands(Encoder pass, uint32_t firstDraw, uint32_t drawCount) {
     uint32_t uniformBindGroupIndex = 0;
 
     if (GetParam().pipelineType == Pipeline::Static) {
@@ -486,7 +517,7 @@ void DrawCallPerf::RecordRenderCommands(Encoder pass) {
         pass.SetBindGroup(uniformBindGroupIndex, mUniformBindGroups[0]);
     }
 
-    for (unsigned int i = 0; i < kNumDraws; ++i) {
+    for (uint32_t i = firstDraw; i < firstDraw + drawCount; ++i) {
         switch (GetParam().pipelineType) {
             case Pipeline::Static:
                 break;
@@ -582,29 +613,44 @@ void DrawCallPerf::Step() {
         }
     }
 
-    wgpu::CommandEncoder commands = device.CreateCommandEncoder();
-    utils::ComboRenderPassDescriptor renderPass({mColorAttachment}, mDepthStencilAttachment);
-    wgpu::RenderPassEncoder pass = commands.BeginRenderPass(&renderPass);
+    const uint32_t encoderCount = GetParam().encoders == Encoders::Many ? kNumEncoders : 1;
+    const uint32_t drawsPerEncoder = kNumDraws / encoderCount;
 
-    switch (GetParam().withRenderBundle) {
-        case RenderBundle::No:
-            RecordRenderCommands(pass);
-            break;
-        case RenderBundle::Yes:
-            pass.ExecuteBundles(1, &mRenderBundle);
-            break;
-        default:
-            DAWN_UNREACHABLE();
-            break;
-    }
+    std::vector<wgpu::CommandBuffer> commandBuffers(encoderCount);
+    for (uint32_t e = 0; e < encoderCount; ++e) {
+        wgpu::CommandEncoder commands = device.CreateCommandEncoder();
+        utils::ComboRenderPassDescriptor renderPass({mColorAttachment}, mDepthStencilAttachment);
+        wgpu::RenderPassEncoder pass = commands.BeginRenderPass(&renderPass);
 
-    pass.End();
-    wgpu::CommandBuffer commandBuffer = commands.Finish();
-    queue.Submit(1, &commandBuffer);
+        switch (GetParam().withRenderBundle) {
+            case RenderBundle::No:
+                RecordRenderCommands(pass, e * drawsPerEncoder, drawsPerEncoder);
+                break;
+            case RenderBundle::Yes:
+                pass.ExecuteBundles(1, &mRenderBundle);
+                break;
+            default:
+                DAWN_UNREACHABLE();
+                break;
+        }
+
+        pass.End();
+        commandBuffers[e] = commands.Finish();
+    }
+    queue.Submit(commandBuffers.size(), commandBuffers.data());
+    mFrameCount++;
 }
 
 TEST_P(DrawCallPerf, Run) {
+    uint64_t allocatorCallsBefore =
+        native::GetCommandBlockAllocatorCallCountForTesting(backendDevice);
     RunTest();
+    uint64_t allocatorCalls =
+        native::GetCommandBlockAllocatorCallCountForTesting(backendDevice) - allocatorCallsBefore;
+    if (GetFrameCount() > 0) {
+        PrintResult("command_allocator_calls_per_frame",
+                    static_cast<double>(allocatorCalls) / GetFrameCount(), "calls", false);
+    }
 }
 
 DAWN_INSTANTIATE_TEST_P(
@@ -635,6 +681,8 @@ DAWN_INSTANTIATE_TEST_P(
 
         // ----------- Render Bundles -----------
         // Command validation / state tracking can be futher optimized / precomputed.
+        MakeParam(RenderBundle::Yes),  // Baseline w/ render bundle
+
         // Use render bundles with varying vertex buffer binding
         MakeParam(VertexBuffer::Multiple,
                   RenderBundle::Yes),  // Multiple vertex buffers w/ render bundle
@@ -661,6 +709,14 @@ DAWN_INSTANTIATE_TEST_P(
                   UniformData::Dynamic),  // Update per-draw data: Multiple bind groups
         MakeParam(BindGroup::Dynamic,
                   UniformData::Dynamic),  // Update per-draw data: Dynamic bind groups
+
+        // Split the draws over many short command encoders to measure the per-encoder overhead,
+        // in particular the allocation of command blocks.
+        MakeParam(Encoders::Many),                       // Baseline w/ many encoders
+        MakeParam(BindGroup::Multiple, Encoders::Many),  // Multiple bind groups w/ many encoders
+        MakeParam(Pipeline::Dynamic,
+                  BindGroup::Multiple,
+                  Encoders::Many),  // Multiple bind groups w/ dynamic pipeline w/ many encoders
     });
 
 }  // anonymous namespace
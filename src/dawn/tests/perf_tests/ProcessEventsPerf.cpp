@@ -0,0 +1,103 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <vector>
+
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+
+namespace dawn {
+namespace {
+
+constexpr unsigned int kNumIterations = 100;
+
+struct ProcessEventsParams : AdapterTestParam {
+    ProcessEventsParams(const AdapterTestParam& param, uint32_t outstandingFutureCount)
+        : AdapterTestParam(param), outstandingFutureCount(outstandingFutureCount) {}
+
+    uint32_t outstandingFutureCount;
+};
+
+std::ostream& operator<<(std::ostream& ostream, const ProcessEventsParams& param) {
+    ostream << static_cast<const AdapterTestParam&>(param);
+    ostream << "_outstandingFutures_" << param.outstandingFutureCount;
+    return ostream;
+}
+
+// Test the cost of completing a future with ProcessEvents while many other futures are still
+// outstanding. The outstanding futures are never polled by ProcessEvents so its cost shouldn't
+// depend on how many of them there are.
+class ProcessEventsPerf : public DawnPerfTestWithParams<ProcessEventsParams> {
+  public:
+    ProcessEventsPerf() : DawnPerfTestWithParams(kNumIterations, 1) {}
+    ~ProcessEventsPerf() override = default;
+
+    void SetUp() override;
+
+  private:
+    bool SupportsCPUAdapters() const override { return true; }
+
+    void Step() override;
+
+    std::vector<wgpu::Future> mOutstandingFutures;
+};
+
+void ProcessEventsPerf::SetUp() {
+    DawnPerfTestWithParams<ProcessEventsParams>::SetUp();
+
+    mOutstandingFutures.reserve(GetParam().outstandingFutureCount);
+    for (uint32_t i = 0; i < GetParam().outstandingFutureCount; ++i) {
+        mOutstandingFutures.push_back(queue.OnSubmittedWorkDone(
+            {nullptr, wgpu::CallbackMode::WaitAnyOnly, [](WGPUQueueWorkDoneStatus, void*) {},
+             nullptr}));
+    }
+}
+
+void ProcessEventsPerf::Step() {
+    for (unsigned int i = 0; i < kNumIterations; ++i) {
+        bool done = false;
+        queue.OnSubmittedWorkDone({nullptr, wgpu::CallbackMode::AllowProcessEvents,
+                                   [](WGPUQueueWorkDoneStatus status, void* userdata) {
+                                       *static_cast<bool*>(userdata) = true;
+                                   },
+                                   &done});
+        while (!done) {
+            instance.ProcessEvents();
+        }
+    }
+}
+
+TEST_P(ProcessEventsPerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_TEST_P(ProcessEventsPerf,
+                        {D3D12Backend(), MetalBackend(), NullBackend(), OpenGLBackend(),
+                         VulkanBackend()},
+                        {0, 1000, 10000});
+
+}  // anonymous namespace
+}  // namespace dawn
@@ -0,0 +1,169 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <sstream>
+#include <vector>
+
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+#include "dawn/utils/ComboRenderPipelineDescriptor.h"
+#include "dawn/utils/WGPUHelpers.h"
+
+namespace dawn {
+namespace {
+
+constexpr unsigned int kNumPasses = 100;
+constexpr uint32_t kTextureSize = 16;
+
+struct RenderPassParams : AdapterTestParam {
+    RenderPassParams(const AdapterTestParam& param,
+                     uint32_t colorAttachmentCountIn,
+                     uint32_t sampleCountIn)
+        : AdapterTestParam(param),
+          colorAttachmentCount(colorAttachmentCountIn),
+          sampleCount(sampleCountIn) {}
+    uint32_t colorAttachmentCount;
+    uint32_t sampleCount;
+};
+
+std::ostream& operator<<(std::ostream& ostream, const RenderPassParams& param) {
+    ostream << static_cast<const AdapterTestParam&>(param);
+    ostream << "_colorAttachments_" << param.colorAttachmentCount;
+    ostream << "_sampleCount_" << param.sampleCount;
+    return ostream;
+}
+
+// Test the CPU cost of beginning and ending many short render passes that each target a different
+// set of attachments, like a workload rendering to many transient render targets. On Vulkan this
+// includes looking up or creating the VkRenderPass and VkFramebuffer of each pass.
+class RenderPassPerf : public DawnPerfTestWithParams<RenderPassParams> {
+  public:
+    RenderPassPerf() : DawnPerfTestWithParams(kNumPasses, 1) {}
+    ~RenderPassPerf() override = default;
+
+    void SetUp() override;
+
+  private:
+    void Step() override;
+
+    struct Attachments {
+        std::vector<wgpu::TextureView> colors;
+        std::vector<wgpu::TextureView> resolveTargets;
+        wgpu::TextureView depthStencil;
+    };
+    std::vector<Attachments> mAttachments;
+    wgpu::RenderPipeline mPipeline;
+};
+
+void RenderPassPerf::SetUp() {
+    DawnPerfTestWithParams<RenderPassParams>::SetUp();
+    const RenderPassParams& params = GetParam();
+
+    wgpu::TextureDescriptor colorDesc;
+    colorDesc.size = {kTextureSize, kTextureSize};
+    colorDesc.format = wgpu::TextureFormat::RGBA8Unorm;
+    colorDesc.sampleCount = params.sampleCount;
+    colorDesc.usage = wgpu::TextureUsage::RenderAttachment;
+
+    wgpu::TextureDescriptor resolveDesc = colorDesc;
+    resolveDesc.sampleCount = 1;
+
+    wgpu::TextureDescriptor depthStencilDesc = colorDesc;
+    depthStencilDesc.format = wgpu::TextureFormat::Depth24PlusStencil8;
+
+    mAttachments.resize(kNumPasses);
+    for (Attachments& attachments : mAttachments) {
+        for (uint32_t i = 0; i < params.colorAttachmentCount; ++i) {
+            attachments.colors.push_back(device.CreateTexture(&colorDesc).CreateView());
+            if (params.sampleCount > 1) {
+                attachments.resolveTargets.push_back(
+                    device.CreateTexture(&resolveDesc).CreateView());
+            }
+        }
+        attachments.depthStencil = device.CreateTexture(&depthStencilDesc).CreateView();
+    }
+
+    std::ostringstream fs;
+    fs << "struct Outputs {\n";
+    for (uint32_t i = 0; i < params.colorAttachmentCount; ++i) {
+        fs << "    @location(" << i << ") color" << i << " : vec4f,\n";
+    }
+    fs << "}\n";
+    fs << "@fragment fn main() -> Outputs {\n";
+    fs << "    var outputs : Outputs;\n";
+    for (uint32_t i = 0; i < params.colorAttachmentCount; ++i) {
+        fs << "    outputs.color" << i << " = vec4f(1.0, 0.0, 0.0, 1.0);\n";
+    }
+    fs << "    return outputs;\n";
+    fs << "}\n";
+
+    utils::ComboRenderPipelineDescriptor pipelineDesc;
+    pipelineDesc.vertex.module = utils::CreateShaderModule(device, R"(
+        @vertex fn main() -> @builtin(position) vec4f {
+            return vec4f(0.0, 0.0, 0.0, 1.0);
+        }
+    )");
+    pipelineDesc.cFragment.module = utils::CreateShaderModule(device, fs.str().c_str());
+    pipelineDesc.primitive.topology = wgpu::PrimitiveTopology::PointList;
+    pipelineDesc.multisample.count = params.sampleCount;
+    pipelineDesc.cFragment.targetCount = params.colorAttachmentCount;
+    for (uint32_t i = 0; i < params.colorAttachmentCount; ++i) {
+        pipelineDesc.cTargets[i].format = colorDesc.format;
+    }
+    pipelineDesc.EnableDepthStencil(depthStencilDesc.format);
+    mPipeline = device.CreateRenderPipeline(&pipelineDesc);
+}
+
+void RenderPassPerf::Step() {
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    for (const Attachments& attachments : mAttachments) {
+        utils::ComboRenderPassDescriptor renderPass(attachments.colors, attachments.depthStencil);
+        for (uint32_t i = 0; i < attachments.resolveTargets.size(); ++i) {
+            renderPass.cColorAttachments[i].resolveTarget = attachments.resolveTargets[i];
+        }
+
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass);
+        pass.SetPipeline(mPipeline);
+        pass.Draw(1);
+        pass.End();
+    }
+
+    wgpu::CommandBuffer commands = encoder.Finish();
+    queue.Submit(1, &commands);
+}
+
+TEST_P(RenderPassPerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_TEST_P(RenderPassPerf,
+                        {D3D12Backend(), MetalBackend(), OpenGLBackend(), VulkanBackend(),
+                         VulkanBackend({}, {"vulkan_use_dynamic_rendering"})},
+                        {1, 4},
+                        {1, 4});
+
+}  // anonymous namespace
+}  // namespace dawn
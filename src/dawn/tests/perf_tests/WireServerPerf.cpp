@@ -0,0 +1,291 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <memory>
+#include <vector>
+
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+#include "dawn/utils/TerribleCommandBuffer.h"
+#include "dawn/utils/Timer.h"
+#include "dawn/wire/WireClient.h"
+#include "dawn/wire/WireServer.h"
+
+namespace dawn {
+namespace {
+
+constexpr unsigned int kNumIterations = 10;
+constexpr unsigned int kDispatchesPerIteration = 1000;
+constexpr uint64_t kBufferSize = 256;
+
+enum class DecoderThread {
+    Disabled,
+    Enabled,
+};
+
+enum class Workload {
+    // Compute passes with a SetBindGroup and a DispatchWorkgroups per dispatch.
+    Dispatch,
+    // Small WriteBuffers, which have more data to deserialize per command.
+    WriteBuffer,
+};
+
+struct WireServerParams : AdapterTestParam {
+    WireServerParams(const AdapterTestParam& param, DecoderThread decoderThread, Workload workload)
+        : AdapterTestParam(param), decoderThread(decoderThread), workload(workload) {}
+
+    DecoderThread decoderThread;
+    Workload workload;
+};
+
+std::ostream& operator<<(std::ostream& ostream, const WireServerParams& param) {
+    ostream << static_cast<const AdapterTestParam&>(param);
+
+    switch (param.decoderThread) {
+        case DecoderThread::Disabled:
+            ostream << "_DecoderThreadDisabled";
+            break;
+        case DecoderThread::Enabled:
+            ostream << "_DecoderThreadEnabled";
+            break;
+    }
+
+    switch (param.workload) {
+        case Workload::Dispatch:
+            ostream << "_Dispatch";
+            break;
+        case Workload::WriteBuffer:
+            ostream << "_WriteBuffer";
+            break;
+    }
+
+    return ostream;
+}
+
+// Measures how fast the dawn::wire server handles large batches of commands, with and without
+// decoding them on a separate thread. Only the time spent in the server's HandleCommands is
+// measured so that client-side serialization doesn't skew the results.
+class WireServerPerf : public DawnPerfTestWithParams<WireServerParams> {
+  public:
+    WireServerPerf()
+        : DawnPerfTestWithParams(kNumIterations, 1), mTimer(utils::CreateTimer()) {}
+    ~WireServerPerf() override = default;
+
+    void SetUp() override;
+    void TearDown() override;
+
+  protected:
+    void PrintResults();
+
+  private:
+    bool SupportsCPUAdapters() const override { return true; }
+
+    void Step() override;
+    void EncodeDispatches();
+    void EncodeWriteBuffers();
+
+    const DawnProcTable& mClientProcs = dawn::wire::client::GetProcs();
+    const DawnProcTable& mServerProcs = dawn::native::GetProcs();
+
+    std::unique_ptr<utils::Timer> mTimer;
+    double mElapsedSeconds = 0;
+    uint64_t mCommandCount = 0;
+    std::vector<uint8_t> mData = std::vector<uint8_t>(kBufferSize, 0x5A);
+
+    std::unique_ptr<utils::TerribleCommandBuffer> mC2sBuffer;
+    std::unique_ptr<utils::TerribleCommandBuffer> mS2cBuffer;
+    std::unique_ptr<dawn::wire::WireServer> mWireServer;
+    std::unique_ptr<dawn::wire::WireClient> mWireClient;
+
+    WGPUDevice mServerDevice = nullptr;
+    WGPUInstance mClientInstance = nullptr;
+    WGPUDevice mClientDevice = nullptr;
+    WGPUQueue mClientQueue = nullptr;
+    WGPUBuffer mClientBuffer = nullptr;
+    WGPUComputePipeline mClientPipeline = nullptr;
+    WGPUBindGroup mClientBindGroup = nullptr;
+};
+
+void WireServerPerf::SetUp() {
+    DawnPerfTestWithParams<WireServerParams>::SetUp();
+
+    mServerDevice = GetAdapter().CreateDevice();
+    ASSERT_NE(mServerDevice, nullptr);
+
+    mC2sBuffer = std::make_unique<utils::TerribleCommandBuffer>();
+    mS2cBuffer = std::make_unique<utils::TerribleCommandBuffer>();
+
+    dawn::wire::WireServerDescriptor serverDesc = {};
+    serverDesc.procs = &mServerProcs;
+    serverDesc.serializer = mS2cBuffer.get();
+    serverDesc.useCommandDecoderThread = GetParam().decoderThread == DecoderThread::Enabled;
+    mWireServer = std::make_unique<dawn::wire::WireServer>(serverDesc);
+
+    dawn::wire::WireClientDescriptor clientDesc = {};
+    clientDesc.serializer = mC2sBuffer.get();
+    mWireClient = std::make_unique<dawn::wire::WireClient>(clientDesc);
+
+    mC2sBuffer->SetHandler(mWireServer.get());
+    mS2cBuffer->SetHandler(mWireClient.get());
+
+    dawn::wire::ReservedInstance instanceReservation = mWireClient->ReserveInstance();
+    mWireServer->InjectInstance(mServerProcs.adapterGetInstance(GetAdapter().Get()),
+                                instanceReservation.id, instanceReservation.generation);
+    mClientInstance = instanceReservation.instance;
+
+    dawn::wire::ReservedDevice deviceReservation = mWireClient->ReserveDevice(mClientInstance);
+    mWireServer->InjectDevice(mServerDevice, deviceReservation.id, deviceReservation.generation);
+    mClientDevice = deviceReservation.device;
+    mClientQueue = mClientProcs.deviceGetQueue(mClientDevice);
+
+    WGPUBufferDescriptor bufferDesc = {};
+    bufferDesc.size = kBufferSize;
+    bufferDesc.usage = WGPUBufferUsage_Storage | WGPUBufferUsage_CopyDst;
+    mClientBuffer = mClientProcs.deviceCreateBuffer(mClientDevice, &bufferDesc);
+
+    WGPUShaderModuleWGSLDescriptor wgslDesc = {};
+    wgslDesc.chain.sType = WGPUSType_ShaderModuleWGSLDescriptor;
+    wgslDesc.code = R"(
+        @group(0) @binding(0) var<storage, read_write> data : array<u32>;
+        @compute @workgroup_size(1) fn main() {
+            data[0] = data[0] + 1u;
+        }
+    )";
+    WGPUShaderModuleDescriptor moduleDesc = {};
+    moduleDesc.nextInChain = &wgslDesc.chain;
+    WGPUShaderModule module = mClientProcs.deviceCreateShaderModule(mClientDevice, &moduleDesc);
+
+    WGPUComputePipelineDescriptor pipelineDesc = {};
+    pipelineDesc.compute.module = module;
+    pipelineDesc.compute.entryPoint = "main";
+    mClientPipeline = mClientProcs.deviceCreateComputePipeline(mClientDevice, &pipelineDesc);
+    mClientProcs.shaderModuleRelease(module);
+
+    WGPUBindGroupEntry entry = {};
+    entry.binding = 0;
+    entry.buffer = mClientBuffer;
+    entry.size = kBufferSize;
+    WGPUBindGroupDescriptor bindGroupDesc = {};
+    bindGroupDesc.layout = mClientProcs.computePipelineGetBindGroupLayout(mClientPipeline, 0);
+    bindGroupDesc.entryCount = 1;
+    bindGroupDesc.entries = &entry;
+    mClientBindGroup = mClientProcs.deviceCreateBindGroup(mClientDevice, &bindGroupDesc);
+    mClientProcs.bindGroupLayoutRelease(bindGroupDesc.layout);
+
+    ASSERT_TRUE(mC2sBuffer->Flush());
+    mServerProcs.deviceTick(mServerDevice);
+    ASSERT_TRUE(mS2cBuffer->Flush());
+}
+
+void WireServerPerf::TearDown() {
+    if (mWireClient != nullptr) {
+        mClientProcs.bindGroupRelease(mClientBindGroup);
+        mClientProcs.computePipelineRelease(mClientPipeline);
+        mClientProcs.bufferRelease(mClientBuffer);
+        mClientProcs.queueRelease(mClientQueue);
+        mClientProcs.deviceRelease(mClientDevice);
+        mClientProcs.instanceRelease(mClientInstance);
+        mC2sBuffer->Flush();
+    }
+
+    mWireClient = nullptr;
+    mWireServer = nullptr;
+
+    if (mServerDevice != nullptr) {
+        mServerProcs.deviceRelease(mServerDevice);
+    }
+
+    DawnPerfTestWithParams<WireServerParams>::TearDown();
+}
+
+void WireServerPerf::EncodeDispatches() {
+    WGPUCommandEncoder encoder = mClientProcs.deviceCreateCommandEncoder(mClientDevice, nullptr);
+    WGPUComputePassEncoder pass = mClientProcs.commandEncoderBeginComputePass(encoder, nullptr);
+    mClientProcs.computePassEncoderSetPipeline(pass, mClientPipeline);
+    for (unsigned int i = 0; i < kDispatchesPerIteration; ++i) {
+        mClientProcs.computePassEncoderSetBindGroup(pass, 0, mClientBindGroup, 0, nullptr);
+        mClientProcs.computePassEncoderDispatchWorkgroups(pass, 1, 1, 1);
+    }
+    mClientProcs.computePassEncoderEnd(pass);
+    WGPUCommandBuffer commands = mClientProcs.commandEncoderFinish(encoder, nullptr);
+    mClientProcs.queueSubmit(mClientQueue, 1, &commands);
+    mClientProcs.commandBufferRelease(commands);
+    mClientProcs.computePassEncoderRelease(pass);
+    mClientProcs.commandEncoderRelease(encoder);
+
+    // CreateCommandEncoder, BeginComputePass, SetPipeline, End, Finish, Submit and the three
+    // releases are each sent as a command.
+    mCommandCount += 2 * kDispatchesPerIteration + 9;
+}
+
+void WireServerPerf::EncodeWriteBuffers() {
+    for (unsigned int i = 0; i < kDispatchesPerIteration; ++i) {
+        mClientProcs.queueWriteBuffer(mClientQueue, mClientBuffer, 0, mData.data(), mData.size());
+    }
+    mCommandCount += kDispatchesPerIteration;
+}
+
+void WireServerPerf::Step() {
+    for (unsigned int i = 0; i < kNumIterations; ++i) {
+        switch (GetParam().workload) {
+            case Workload::Dispatch:
+                EncodeDispatches();
+                break;
+            case Workload::WriteBuffer:
+                EncodeWriteBuffers();
+                break;
+        }
+    }
+
+    mTimer->Start();
+    ASSERT_TRUE(mC2sBuffer->Flush());
+    mTimer->Stop();
+    mElapsedSeconds += mTimer->GetElapsedTime();
+
+    mServerProcs.deviceTick(mServerDevice);
+    ASSERT_TRUE(mS2cBuffer->Flush());
+}
+
+void WireServerPerf::PrintResults() {
+    if (mElapsedSeconds == 0) {
+        return;
+    }
+    PrintResult("commands_per_second", mCommandCount / mElapsedSeconds, "commands/s", true);
+}
+
+TEST_P(WireServerPerf, Run) {
+    RunTest();
+    PrintResults();
+}
+
+DAWN_INSTANTIATE_TEST_P(WireServerPerf,
+                        {D3D12Backend(), MetalBackend(), NullBackend(), OpenGLBackend(),
+                         VulkanBackend()},
+                        {DecoderThread::Disabled, DecoderThread::Enabled},
+                        {Workload::Dispatch, Workload::WriteBuffer});
+
+}  // anonymous namespace
+}  // namespace dawn
@@ -0,0 +1,394 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+#include "dawn/utils/SharedMemoryTransferService.h"
+#include "dawn/utils/SharedMemoryTransport.h"
+#include "dawn/utils/TerribleCommandBuffer.h"
+#include "dawn/utils/Timer.h"
+#include "dawn/wire/WireClient.h"
+#include "dawn/wire/WireServer.h"
+
+namespace dawn {
+namespace {
+
+constexpr unsigned int kNumIterations = 100;
+// Caps the amount of data uploaded per step so that large uploads don't take too long to run.
+constexpr uint64_t kMaxUploadSizePerStep = 256 * 1024 * 1024;
+
+constexpr size_t kRingCapacity = 16 * 1024 * 1024;
+constexpr size_t kTransferHeapSize = 64 * 1024 * 1024;
+
+enum class Transport {
+    // Commands are copied into a buffer that is decoded on the same thread when flushed.
+    Inline,
+    // Commands are written in a shared memory ring decoded in place by a server thread.
+    SharedMemory,
+};
+
+enum class UploadMethod {
+    WriteBuffer,
+    MappedAtCreation,
+};
+
+enum class UploadSize : uint64_t {
+    BufferSize_256B = 256,
+    BufferSize_64KB = 64 * 1024,
+    BufferSize_4MB = 4 * 1024 * 1024,
+};
+
+unsigned int GetIterationsPerStep(UploadSize uploadSize) {
+    uint64_t maxIterations = kMaxUploadSizePerStep / static_cast<uint64_t>(uploadSize);
+    return static_cast<unsigned int>(
+        std::max(uint64_t(1), std::min(uint64_t(kNumIterations), maxIterations)));
+}
+
+struct WireTransportParams : AdapterTestParam {
+    WireTransportParams(const AdapterTestParam& param,
+                        Transport transport,
+                        UploadMethod uploadMethod,
+                        UploadSize uploadSize)
+        : AdapterTestParam(param),
+          transport(transport),
+          uploadMethod(uploadMethod),
+          uploadSize(uploadSize) {}
+
+    Transport transport;
+    UploadMethod uploadMethod;
+    UploadSize uploadSize;
+};
+
+std::ostream& operator<<(std::ostream& ostream, const WireTransportParams& param) {
+    ostream << static_cast<const AdapterTestParam&>(param);
+
+    switch (param.transport) {
+        case Transport::Inline:
+            ostream << "_Inline";
+            break;
+        case Transport::SharedMemory:
+            ostream << "_SharedMemory";
+            break;
+    }
+
+    switch (param.uploadMethod) {
+        case UploadMethod::WriteBuffer:
+            ostream << "_WriteBuffer";
+            break;
+        case UploadMethod::MappedAtCreation:
+            ostream << "_MappedAtCreation";
+            break;
+    }
+
+    switch (param.uploadSize) {
+        case UploadSize::BufferSize_256B:
+            ostream << "_BufferSize_256B";
+            break;
+        case UploadSize::BufferSize_64KB:
+            ostream << "_BufferSize_64KB";
+            break;
+        case UploadSize::BufferSize_4MB:
+            ostream << "_BufferSize_4MB";
+            break;
+    }
+
+    return ostream;
+}
+
+// Measures the throughput of uploads through a dawn::wire client and server connected with either
+// an in-process command buffer or the shared memory transport. The wire is built by the test on
+// top of a dedicated device so that the results don't depend on --use-wire.
+class WireTransportPerf : public DawnPerfTestWithParams<WireTransportParams> {
+  public:
+    WireTransportPerf()
+        : DawnPerfTestWithParams(GetIterationsPerStep(GetParam().uploadSize), 1),
+          mTimer(utils::CreateTimer()),
+          mData(static_cast<size_t>(GetParam().uploadSize), 0x5A) {}
+    ~WireTransportPerf() override = default;
+
+    void SetUp() override;
+    void TearDown() override;
+
+  protected:
+    void PrintResults();
+
+  private:
+    bool SupportsCPUAdapters() const override { return true; }
+
+    void Step() override;
+
+    // Sends the pending client commands to the server and waits until they are processed.
+    void FlushAndWait();
+
+    const DawnProcTable& mClientProcs = dawn::wire::client::GetProcs();
+    const DawnProcTable& mServerProcs = dawn::native::GetProcs();
+
+    std::unique_ptr<utils::Timer> mTimer;
+    std::vector<uint8_t> mData;
+    double mElapsedSeconds = 0;
+    uint64_t mUploadedBytes = 0;
+    uint64_t mCommandCount = 0;
+
+    // Transport for Transport::Inline.
+    std::unique_ptr<utils::TerribleCommandBuffer> mC2sBuffer;
+    std::unique_ptr<utils::TerribleCommandBuffer> mS2cBuffer;
+
+    // Transport for Transport::SharedMemory. The client and server ends map the same memfds
+    // separately like they would in different processes.
+    std::unique_ptr<utils::SharedMemoryRing> mClientC2sRing;
+    std::unique_ptr<utils::SharedMemoryRing> mServerC2sRing;
+    std::unique_ptr<utils::SharedMemoryRing> mClientS2cRing;
+    std::unique_ptr<utils::SharedMemoryRing> mServerS2cRing;
+    std::unique_ptr<utils::SharedMemoryRegion> mClientTransferHeap;
+    std::unique_ptr<utils::SharedMemoryRegion> mServerTransferHeap;
+    std::unique_ptr<dawn::wire::client::MemoryTransferService> mClientTransferService;
+    std::unique_ptr<dawn::wire::server::MemoryTransferService> mServerTransferService;
+    std::unique_ptr<utils::SharedMemoryCommandSerializer> mC2sSerializer;
+    std::unique_ptr<utils::SharedMemoryCommandSerializer> mS2cSerializer;
+    std::unique_ptr<utils::SharedMemoryCommandReceiver> mServerReceiver;
+    std::unique_ptr<utils::SharedMemoryCommandReceiver> mClientReceiver;
+    std::thread mServerThread;
+
+    std::unique_ptr<dawn::wire::WireServer> mWireServer;
+    std::unique_ptr<dawn::wire::WireClient> mWireClient;
+
+    WGPUDevice mServerDevice = nullptr;
+    WGPUInstance mClientInstance = nullptr;
+    WGPUDevice mClientDevice = nullptr;
+    WGPUQueue mClientQueue = nullptr;
+    WGPUBuffer mClientBuffer = nullptr;
+};
+
+void WireTransportPerf::SetUp() {
+    DawnPerfTestWithParams<WireTransportParams>::SetUp();
+
+    mServerDevice = GetAdapter().CreateDevice();
+    ASSERT_NE(mServerDevice, nullptr);
+
+    dawn::wire::WireServerDescriptor serverDesc = {};
+    serverDesc.procs = &mServerProcs;
+    dawn::wire::WireClientDescriptor clientDesc = {};
+
+    switch (GetParam().transport) {
+        case Transport::Inline: {
+            mC2sBuffer = std::make_unique<utils::TerribleCommandBuffer>();
+            mS2cBuffer = std::make_unique<utils::TerribleCommandBuffer>();
+            serverDesc.serializer = mS2cBuffer.get();
+            clientDesc.serializer = mC2sBuffer.get();
+            mWireServer = std::make_unique<dawn::wire::WireServer>(serverDesc);
+            mWireClient = std::make_unique<dawn::wire::WireClient>(clientDesc);
+            mC2sBuffer->SetHandler(mWireServer.get());
+            mS2cBuffer->SetHandler(mWireClient.get());
+            break;
+        }
+
+        case Transport::SharedMemory: {
+            mClientC2sRing = utils::SharedMemoryRing::Create(kRingCapacity);
+            mClientS2cRing = utils::SharedMemoryRing::Create(kRingCapacity);
+            mClientTransferHeap =
+                utils::SharedMemoryRegion::Create("dawn_wire_transfer", kTransferHeapSize);
+            ASSERT_NE(mClientC2sRing, nullptr);
+            ASSERT_NE(mClientS2cRing, nullptr);
+            ASSERT_NE(mClientTransferHeap, nullptr);
+
+            mServerC2sRing = utils::SharedMemoryRing::Open(dup(mClientC2sRing->GetFd()));
+            mServerS2cRing = utils::SharedMemoryRing::Open(dup(mClientS2cRing->GetFd()));
+            mServerTransferHeap =
+                utils::SharedMemoryRegion::Open(dup(mClientTransferHeap->GetFd()));
+            ASSERT_NE(mServerC2sRing, nullptr);
+            ASSERT_NE(mServerS2cRing, nullptr);
+            ASSERT_NE(mServerTransferHeap, nullptr);
+
+            mClientTransferService =
+                utils::CreateSharedMemoryClientTransferService(mClientTransferHeap.get());
+            mServerTransferService =
+                utils::CreateSharedMemoryServerTransferService(mServerTransferHeap.get());
+            mC2sSerializer =
+                std::make_unique<utils::SharedMemoryCommandSerializer>(mClientC2sRing.get());
+            mS2cSerializer =
+                std::make_unique<utils::SharedMemoryCommandSerializer>(mServerS2cRing.get());
+
+            serverDesc.serializer = mS2cSerializer.get();
+            serverDesc.memoryTransferService = mServerTransferService.get();
+            clientDesc.serializer = mC2sSerializer.get();
+            clientDesc.memoryTransferService = mClientTransferService.get();
+            mWireServer = std::make_unique<dawn::wire::WireServer>(serverDesc);
+            mWireClient = std::make_unique<dawn::wire::WireClient>(clientDesc);
+
+            mServerReceiver = std::make_unique<utils::SharedMemoryCommandReceiver>(
+                mServerC2sRing.get(), mWireServer.get());
+            mClientReceiver = std::make_unique<utils::SharedMemoryCommandReceiver>(
+                mClientS2cRing.get(), mWireClient.get());
+
+            // The server thread is the only one using the server device and the server to client
+            // serializer, like the GPU process would.
+            mServerThread = std::thread([this] {
+                while (mServerReceiver->WaitForCommands()) {
+                    if (!mServerReceiver->ProcessCommands()) {
+                        break;
+                    }
+                    mServerProcs.deviceTick(mServerDevice);
+                    mS2cSerializer->Flush();
+                }
+                // Unblock the client if the server stopped because of an error.
+                mServerC2sRing->Close();
+            });
+            break;
+        }
+    }
+
+    dawn::wire::ReservedInstance instanceReservation = mWireClient->ReserveInstance();
+    mWireServer->InjectInstance(mServerProcs.adapterGetInstance(GetAdapter().Get()),
+                                instanceReservation.id, instanceReservation.generation);
+    mClientInstance = instanceReservation.instance;
+
+    dawn::wire::ReservedDevice deviceReservation = mWireClient->ReserveDevice(mClientInstance);
+    mWireServer->InjectDevice(mServerDevice, deviceReservation.id, deviceReservation.generation);
+    mClientDevice = deviceReservation.device;
+    mClientQueue = mClientProcs.deviceGetQueue(mClientDevice);
+
+    if (GetParam().uploadMethod == UploadMethod::WriteBuffer) {
+        WGPUBufferDescriptor desc = {};
+        desc.size = mData.size();
+        desc.usage = WGPUBufferUsage_CopyDst;
+        mClientBuffer = mClientProcs.deviceCreateBuffer(mClientDevice, &desc);
+    }
+    FlushAndWait();
+}
+
+void WireTransportPerf::TearDown() {
+    if (mWireClient != nullptr) {
+        if (mClientBuffer != nullptr) {
+            mClientProcs.bufferRelease(mClientBuffer);
+        }
+        mClientProcs.queueRelease(mClientQueue);
+        mClientProcs.deviceRelease(mClientDevice);
+        mClientProcs.instanceRelease(mClientInstance);
+        FlushAndWait();
+    }
+
+    if (mServerThread.joinable()) {
+        mServerC2sRing->Close();
+        mServerThread.join();
+    }
+    mWireClient = nullptr;
+    mWireServer = nullptr;
+
+    if (mServerDevice != nullptr) {
+        mServerProcs.deviceRelease(mServerDevice);
+    }
+
+    DawnPerfTestWithParams<WireTransportParams>::TearDown();
+}
+
+void WireTransportPerf::FlushAndWait() {
+    switch (GetParam().transport) {
+        case Transport::Inline:
+            ASSERT_TRUE(mC2sBuffer->Flush());
+            mServerProcs.deviceTick(mServerDevice);
+            ASSERT_TRUE(mS2cBuffer->Flush());
+            break;
+
+        case Transport::SharedMemory:
+            ASSERT_TRUE(mC2sSerializer->Flush());
+            ASSERT_TRUE(mC2sSerializer->WaitUntilConsumed());
+            ASSERT_TRUE(mClientReceiver->ProcessCommands());
+            break;
+    }
+}
+
+void WireTransportPerf::Step() {
+    const unsigned int iterations = GetIterationsPerStep(GetParam().uploadSize);
+
+    mTimer->Start();
+    switch (GetParam().uploadMethod) {
+        case UploadMethod::WriteBuffer:
+            for (unsigned int i = 0; i < iterations; ++i) {
+                mClientProcs.queueWriteBuffer(mClientQueue, mClientBuffer, 0, mData.data(),
+                                              mData.size());
+            }
+            mCommandCount += iterations;
+            break;
+
+        case UploadMethod::MappedAtCreation: {
+            WGPUBufferDescriptor desc = {};
+            desc.size = mData.size();
+            desc.usage = WGPUBufferUsage_CopySrc;
+            desc.mappedAtCreation = true;
+            for (unsigned int i = 0; i < iterations; ++i) {
+                WGPUBuffer buffer = mClientProcs.deviceCreateBuffer(mClientDevice, &desc);
+                memcpy(mClientProcs.bufferGetMappedRange(buffer, 0, mData.size()), mData.data(),
+                       mData.size());
+                mClientProcs.bufferUnmap(buffer);
+                mClientProcs.bufferRelease(buffer);
+            }
+            // CreateBuffer, Unmap and Release are each sent as a command.
+            mCommandCount += 3 * iterations;
+            break;
+        }
+    }
+
+    // Submit so that the staging memory used for the uploads gets recycled.
+    mClientProcs.queueSubmit(mClientQueue, 0, nullptr);
+    mCommandCount += 1;
+    FlushAndWait();
+    mTimer->Stop();
+
+    mElapsedSeconds += mTimer->GetElapsedTime();
+    mUploadedBytes += iterations * mData.size();
+}
+
+void WireTransportPerf::PrintResults() {
+    if (mElapsedSeconds == 0) {
+        return;
+    }
+    PrintResult("throughput", mUploadedBytes / mElapsedSeconds / (1024 * 1024), "MB/s", true);
+    PrintResult("commands_per_second", mCommandCount / mElapsedSeconds, "commands/s", true);
+}
+
+TEST_P(WireTransportPerf, Run) {
+    RunTest();
+    PrintResults();
+}
+
+DAWN_INSTANTIATE_TEST_P(WireTransportPerf,
+                        {D3D12Backend(), MetalBackend(), NullBackend(), OpenGLBackend(),
+                         VulkanBackend()},
+                        {Transport::Inline, Transport::SharedMemory},
+                        {UploadMethod::WriteBuffer, UploadMethod::MappedAtCreation},
+                        {UploadSize::BufferSize_256B, UploadSize::BufferSize_64KB,
+                         UploadSize::BufferSize_4MB});
+
+}  // anonymous namespace
+}  // namespace dawn
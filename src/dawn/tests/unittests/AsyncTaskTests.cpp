@@ -29,15 +29,19 @@
 // AsyncTaskTests:
 //     Simple tests for native::AsyncTask and native::AsnycTaskManager.
 
+#include <atomic>
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <set>
+#include <thread>
 #include <utility>
 #include <vector>
 
 #include "dawn/common/NonCopyable.h"
 #include "dawn/native/AsyncTask.h"
 #include "dawn/platform/DawnPlatform.h"
+#include "dawn/platform/WorkerThread.h"
 #include "gtest/gtest.h"
 
 namespace dawn {
@@ -103,5 +107,63 @@ TEST_F(AsyncTaskTest, Basic) {
     ASSERT_TRUE(idset.empty());
 }
 
+// Test that the worker thread pool never runs more tasks at once than its concurrency cap, and that
+// it still completes all the tasks posted to it.
+TEST_F(AsyncTaskTest, WorkerThreadPoolMaxConcurrency) {
+    constexpr uint32_t kMaxConcurrency = 2u;
+    constexpr size_t kTaskCount = 32u;
+
+    struct ConcurrencyTracker {
+        std::atomic<uint32_t> runningTasks{0};
+        std::atomic<uint32_t> maxRunningTasks{0};
+        std::atomic<uint32_t> completedTasks{0};
+    } tracker;
+
+    platform::AsyncWorkerThreadPool pool(kMaxConcurrency);
+    ASSERT_EQ(kMaxConcurrency, pool.GetMaxConcurrency());
+
+    std::vector<std::unique_ptr<platform::WaitableEvent>> events;
+    for (size_t i = 0; i < kTaskCount; ++i) {
+        events.push_back(pool.PostWorkerTask(
+            [](void* userdata) {
+                ConcurrencyTracker* tracker = static_cast<ConcurrencyTracker*>(userdata);
+                uint32_t running = ++tracker->runningTasks;
+                uint32_t maxRunning = tracker->maxRunningTasks.load();
+                while (running > maxRunning &&
+                       !tracker->maxRunningTasks.compare_exchange_weak(maxRunning, running)) {
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                tracker->runningTasks--;
+                tracker->completedTasks++;
+            },
+            &tracker));
+    }
+
+    for (std::unique_ptr<platform::WaitableEvent>& event : events) {
+        event->Wait();
+        EXPECT_TRUE(event->IsComplete());
+    }
+
+    EXPECT_EQ(kTaskCount, tracker.completedTasks.load());
+    EXPECT_LE(tracker.maxRunningTasks.load(), kMaxConcurrency);
+}
+
+// Test that destroying the worker thread pool runs the tasks that are still pending.
+TEST_F(AsyncTaskTest, WorkerThreadPoolDrainsTasksOnDestruction) {
+    constexpr size_t kTaskCount = 16u;
+    std::atomic<uint32_t> completedTasks{0};
+
+    {
+        platform::AsyncWorkerThreadPool pool(1u);
+        for (size_t i = 0; i < kTaskCount; ++i) {
+            pool.PostWorkerTask(
+                [](void* userdata) { (*static_cast<std::atomic<uint32_t>*>(userdata))++; },
+                &completedTasks);
+        }
+    }
+
+    EXPECT_EQ(kTaskCount, completedTasks.load());
+}
+
 }  // anonymous namespace
 }  // namespace dawn
@@ -459,6 +459,89 @@ TEST(CommandAllocator, AllocateDataDefaultInitializes) {
     iterator.MakeEmptyAsDataWasDestroyed();
 }
 
+// Test that data can be extended in place while nothing else is allocated
+TEST(CommandAllocator, TryExtendData) {
+    CommandAllocator allocator;
+
+    CommandPushConstants* pushConstants =
+        allocator.Allocate<CommandPushConstants>(CommandType::PushConstants);
+    pushConstants->size = 5;
+
+    uint32_t* values = allocator.AllocateData<uint32_t>(2);
+    values[0] = 0;
+    values[1] = 1;
+
+    uint32_t* moreValues = allocator.TryExtendData(values, 2, 3);
+    ASSERT_EQ(moreValues, values + 2);
+    for (uint32_t i = 0; i < 3; i++) {
+        moreValues[i] = 2 + i;
+    }
+
+    // Extending isn't possible after another command is allocated.
+    allocator.Allocate<CommandSmall>(CommandType::Small);
+    ASSERT_EQ(allocator.TryExtendData(values, 5, 1), nullptr);
+
+    CommandIterator iterator(std::move(allocator));
+    CommandType type;
+
+    ASSERT_TRUE(iterator.NextCommandId(&type));
+    ASSERT_EQ(type, CommandType::PushConstants);
+    pushConstants = iterator.NextCommand<CommandPushConstants>();
+    values = iterator.NextData<uint32_t>(pushConstants->size);
+    for (uint32_t i = 0; i < 5; i++) {
+        ASSERT_EQ(values[i], i);
+    }
+
+    ASSERT_TRUE(iterator.NextCommandId(&type));
+    ASSERT_EQ(type, CommandType::Small);
+    iterator.NextCommand<CommandSmall>();
+
+    ASSERT_FALSE(iterator.NextCommandId(&type));
+    iterator.MakeEmptyAsDataWasDestroyed();
+}
+
+// Test extending data one element at a time until the block is full, starting new commands when
+// extending fails
+TEST(CommandAllocator, TryExtendDataUntilBlockIsFull) {
+    CommandAllocator allocator;
+
+    constexpr uint32_t kValueCount = 100000;
+    std::vector<uint32_t> counts;
+
+    uint32_t* values = nullptr;
+    for (uint32_t i = 0; i < kValueCount; i++) {
+        uint32_t* value = nullptr;
+        if (values != nullptr) {
+            value = allocator.TryExtendData(values, counts.back(), 1);
+        }
+        if (value == nullptr) {
+            allocator.Allocate<CommandPushConstants>(CommandType::PushConstants);
+            values = allocator.AllocateData<uint32_t>(1);
+            value = values;
+            counts.push_back(0);
+        }
+        *value = i;
+        counts.back()++;
+    }
+    ASSERT_GT(counts.size(), 1u);
+
+    CommandIterator iterator(std::move(allocator));
+    CommandType type;
+    uint32_t expected = 0;
+    for (uint32_t count : counts) {
+        ASSERT_TRUE(iterator.NextCommandId(&type));
+        ASSERT_EQ(type, CommandType::PushConstants);
+        iterator.NextCommand<CommandPushConstants>();
+        values = iterator.NextData<uint32_t>(count);
+        for (uint32_t i = 0; i < count; i++) {
+            ASSERT_EQ(values[i], expected++);
+        }
+    }
+    ASSERT_EQ(expected, kValueCount);
+    ASSERT_FALSE(iterator.NextCommandId(&type));
+    iterator.MakeEmptyAsDataWasDestroyed();
+}
+
 // Tests flattening of multiple CommandAllocators into a single CommandIterator using
 // AcquireCommandBlocks.
 TEST(CommandAllocator, AcquireCommandBlocks) {
@@ -513,4 +596,96 @@ TEST(CommandAllocator, AcquireCommandBlocks) {
     iterator.MakeEmptyAsDataWasDestroyed();
 }
 
+// Test that blocks freed by a CommandIterator are reused by the next allocator using the same
+// CommandBlockPool instead of being returned to the system allocator.
+TEST(CommandAllocator, BlockPoolReusesBlocks) {
+    CommandBlockPool pool;
+
+    auto RecordAndFree = [&pool] {
+        CommandAllocator allocator(&pool);
+        for (int i = 0; i < 2000; i++) {
+            CommandDraw* draw = allocator.Allocate<CommandDraw>(CommandType::Draw);
+            draw->first = i;
+            draw->count = 3;
+        }
+        CommandIterator iterator(std::move(allocator));
+        iterator.MakeEmptyAsDataWasDestroyed();
+    };
+
+    RecordAndFree();
+    uint64_t callsAfterFirstRecording = pool.GetSystemAllocatorCallCount();
+    EXPECT_GT(callsAfterFirstRecording, 0u);
+    size_t cachedBlockCount = pool.GetCachedBlockCountForTesting();
+    EXPECT_GT(cachedBlockCount, 0u);
+
+    // The same recording is entirely served by the cached blocks.
+    for (int i = 0; i < 10; i++) {
+        RecordAndFree();
+    }
+    EXPECT_EQ(pool.GetSystemAllocatorCallCount(), callsAfterFirstRecording);
+    EXPECT_EQ(pool.GetCachedBlockCountForTesting(), cachedBlockCount);
+}
+
+// Test that Reset and destruction of a CommandAllocator return its blocks to the pool, and that
+// moved-from allocators keep using the pool.
+TEST(CommandAllocator, BlockPoolAllocatorReset) {
+    CommandBlockPool pool;
+
+    CommandAllocator allocator(&pool);
+    allocator.Allocate<CommandDraw>(CommandType::Draw);
+    allocator.Reset();
+    EXPECT_EQ(pool.GetCachedBlockCountForTesting(), 1u);
+
+    {
+        CommandAllocator other = std::move(allocator);
+        other.Allocate<CommandDraw>(CommandType::Draw);
+        allocator.Allocate<CommandDraw>(CommandType::Draw);
+        EXPECT_EQ(pool.GetCachedBlockCountForTesting(), 0u);
+    }
+    EXPECT_EQ(pool.GetCachedBlockCountForTesting(), 1u);
+
+    allocator.Reset();
+    EXPECT_EQ(pool.GetCachedBlockCountForTesting(), 2u);
+    EXPECT_EQ(pool.GetSystemAllocatorCallCount(), 2u);
+}
+
+// Test that blocks of non-standard sizes are not cached.
+TEST(CommandAllocator, BlockPoolDoesNotCacheLargeBlocks) {
+    CommandBlockPool pool;
+
+    CommandAllocator allocator(&pool);
+    allocator.Allocate<CommandBig>(CommandType::Big);
+    allocator.Reset();
+    EXPECT_EQ(pool.GetCachedBlockCountForTesting(), 0u);
+    EXPECT_EQ(pool.GetSystemAllocatorCallCount(), 2u);
+}
+
+// Test that Trim only keeps enough blocks to cover the peak usage since the previous Trim.
+TEST(CommandAllocator, BlockPoolTrim) {
+    CommandBlockPool pool;
+
+    std::vector<uint8_t*> blocks;
+    for (int i = 0; i < 4; i++) {
+        blocks.push_back(pool.Allocate(4096));
+    }
+    for (uint8_t* block : blocks) {
+        pool.Deallocate(block, 4096);
+    }
+    EXPECT_EQ(pool.GetCachedBlockCountForTesting(), 4u);
+
+    // The peak usage was four blocks, they are all kept.
+    pool.Trim();
+    EXPECT_EQ(pool.GetCachedBlockCountForTesting(), 4u);
+
+    // Only one block is used during the next period, the rest is freed.
+    pool.Deallocate(pool.Allocate(4096), 4096);
+    pool.Trim();
+    EXPECT_EQ(pool.GetCachedBlockCountForTesting(), 1u);
+
+    // Nothing is used during the next period, everything is freed.
+    pool.Trim();
+    EXPECT_EQ(pool.GetCachedBlockCountForTesting(), 0u);
+    EXPECT_EQ(pool.GetSystemAllocatorCallCount(), 8u);
+}
+
 }  // namespace dawn::native
@@ -162,6 +162,29 @@ TEST(ContentLessObjectCacheTest, EraseDuplicate) {
     EXPECT_FALSE(cache.Empty());
 }
 
+// Objects with many different hashes are all findable, and erasing them all leaves the cache
+// empty.
+TEST(ContentLessObjectCacheTest, InsertFindEraseManyHashes) {
+    constexpr size_t kNumObjects = 1000;
+    ContentLessObjectCache<CacheableT> cache;
+    std::vector<Ref<CacheableT>> objects;
+    for (size_t i = 0; i < kNumObjects; i++) {
+        Ref<CacheableT> object = AcquireRef(new CacheableT(i));
+        object->SetDeleteFn([&](CacheableT* x) { cache.Erase(x); });
+        EXPECT_TRUE(cache.Insert(object.Get()).second);
+        objects.push_back(std::move(object));
+    }
+
+    for (size_t i = 0; i < kNumObjects; i++) {
+        CacheableT blueprint(i);
+        Ref<CacheableT> cached = cache.Find(&blueprint);
+        EXPECT_EQ(objects[i].Get(), cached.Get());
+    }
+
+    objects.clear();
+    EXPECT_TRUE(cache.Empty());
+}
+
 // Inserting and finding elements should respect the results from the insert call.
 TEST(ContentLessObjectCacheTest, InsertingAndFinding) {
     constexpr size_t kNumObjects = 100;
@@ -0,0 +1,316 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "dawn/native/BlobCompression.h"
+#include "dawn/native/DiskBlobCache.h"
+#include "dawn/native/MemoryBlobCache.h"
+#include "gtest/gtest.h"
+
+namespace dawn::native {
+namespace {
+
+std::vector<uint8_t> MakeData(size_t size, uint32_t seed) {
+    std::vector<uint8_t> data(size);
+    // Mix repeated runs with pseudo-random bytes so that both paths of the compressor are used.
+    uint32_t state = seed;
+    for (size_t i = 0; i < size; i++) {
+        state = state * 1664525u + 1013904223u;
+        data[i] = (i / 64) % 2 == 0 ? static_cast<uint8_t>(i % 7)
+                                    : static_cast<uint8_t>(state >> 24);
+    }
+    return data;
+}
+
+bool BlobEquals(const Blob& blob, const std::vector<uint8_t>& data) {
+    return blob.Size() == data.size() && memcmp(blob.Data(), data.data(), data.size()) == 0;
+}
+
+// Test that compression round-trips for various sizes and contents.
+TEST(BlobCompressionTests, RoundTrip) {
+    for (size_t size : {1u, 3u, 4u, 15u, 16u, 100u, 4096u, 100000u}) {
+        for (uint32_t seed : {0u, 1u}) {
+            std::vector<uint8_t> data = MakeData(size, seed);
+            std::vector<uint8_t> compressed = CompressBlobData(data.data(), data.size());
+
+            std::vector<uint8_t> decompressed(size);
+            ASSERT_TRUE(DecompressBlobData(compressed.data(), compressed.size(),
+                                           decompressed.data(), decompressed.size()));
+            EXPECT_EQ(decompressed, data);
+        }
+    }
+}
+
+// Test that repetitive data is compressed.
+TEST(BlobCompressionTests, CompressesRepetitiveData) {
+    std::vector<uint8_t> data(10000, 42);
+    std::vector<uint8_t> compressed = CompressBlobData(data.data(), data.size());
+    EXPECT_LT(compressed.size(), data.size() / 10);
+}
+
+// Test that malformed or truncated data fails to decompress.
+TEST(BlobCompressionTests, MalformedData) {
+    std::vector<uint8_t> data = MakeData(1000, 3);
+    std::vector<uint8_t> compressed = CompressBlobData(data.data(), data.size());
+    std::vector<uint8_t> decompressed(data.size());
+
+    EXPECT_FALSE(DecompressBlobData(compressed.data(), compressed.size() / 2, decompressed.data(),
+                                    decompressed.size()));
+    EXPECT_FALSE(DecompressBlobData(compressed.data(), compressed.size(), decompressed.data(),
+                                    decompressed.size() - 1));
+
+    // A match pointing before the start of the output.
+    const uint8_t badOffset[] = {0x10, 'a', 0x05, 0x00};
+    EXPECT_FALSE(DecompressBlobData(badOffset, sizeof(badOffset), decompressed.data(), 5));
+}
+
+// Test loading and storing in the memory cache.
+TEST(MemoryBlobCacheTests, LoadStore) {
+    MemoryBlobCache cache(1024 * 1024);
+    std::vector<uint8_t> value = MakeData(100, 0);
+
+    EXPECT_TRUE(cache.Load("key").Empty());
+    cache.Store("key", value.size(), value.data());
+    EXPECT_TRUE(BlobEquals(cache.Load("key"), value));
+    EXPECT_TRUE(cache.Load("other key").Empty());
+
+    EXPECT_EQ(cache.GetHitCount(), 1u);
+    EXPECT_EQ(cache.GetMissCount(), 2u);
+    EXPECT_EQ(cache.GetSize(), value.size() + 3);
+}
+
+// Test that the least recently used blobs are evicted first when the budget is exceeded.
+TEST(MemoryBlobCacheTests, EvictsLeastRecentlyUsed) {
+    // Use a single key length so that all entries have the same size, and enough entries to fill
+    // every shard.
+    constexpr size_t kValueSize = 1000;
+    constexpr size_t kEntryCount = 256;
+    MemoryBlobCache cache(kEntryCount * kValueSize / 4);
+    std::vector<uint8_t> value = MakeData(kValueSize, 0);
+
+    auto Key = [](size_t i) {
+        char key[16];
+        snprintf(key, sizeof(key), "key%05zu", i);
+        return std::string(key);
+    };
+
+    for (size_t i = 0; i < kEntryCount; i++) {
+        cache.Store(Key(i), value.size(), value.data());
+        // Keep using the first key so that it stays in the cache.
+        EXPECT_FALSE(cache.Load(Key(0)).Empty());
+    }
+    EXPECT_LE(cache.GetSize(), cache.GetBudget());
+
+    // The first key was always recently used, the second one was evicted.
+    EXPECT_FALSE(cache.Load(Key(0)).Empty());
+    EXPECT_TRUE(cache.Load(Key(1)).Empty());
+}
+
+// Test that values larger than a shard's budget are not cached.
+TEST(MemoryBlobCacheTests, TooLargeValue) {
+    MemoryBlobCache cache(1024);
+    std::vector<uint8_t> value = MakeData(1024, 0);
+    cache.Store("key", value.size(), value.data());
+    EXPECT_TRUE(cache.Load("key").Empty());
+    EXPECT_EQ(cache.GetSize(), 0u);
+}
+
+class DiskBlobCacheTests : public testing::Test {
+  protected:
+    void SetUp() override {
+        mDirectory = testing::TempDir();
+        if (!mDirectory.empty() && mDirectory.back() == '/') {
+            mDirectory.pop_back();
+        }
+        RemoveFiles();
+    }
+    void TearDown() override { RemoveFiles(); }
+
+    void RemoveFiles() {
+        std::remove((mDirectory + "/dawn_blob_cache.data").c_str());
+        std::remove((mDirectory + "/dawn_blob_cache.index").c_str());
+    }
+
+    std::unique_ptr<DiskBlobCache> Open() {
+        auto result = DiskBlobCache::Create(mDirectory);
+        EXPECT_TRUE(result.IsSuccess());
+        return result.IsSuccess() ? result.AcquireSuccess() : nullptr;
+    }
+
+    // Mirrors the layout of the records of the index file.
+    struct IndexRecord {
+        uint64_t keyHash;
+        uint64_t offset;
+        uint32_t keySize;
+        uint32_t storedSize;
+        uint32_t valueSize;
+        uint32_t flags;
+    };
+
+    void StoreAndReopen(std::string_view key, const std::vector<uint8_t>& value) {
+        std::unique_ptr<DiskBlobCache> cache = Open();
+        ASSERT_NE(cache, nullptr);
+        cache->Store(key, value.size(), value.data());
+    }
+
+    // Appends a copy of the last record of the index after applying |modify| to it. The copy
+    // replaces the original record when the cache is opened, if it is accepted.
+    template <typename F>
+    void AppendModifiedLastIndexRecord(F modify) {
+        const std::string indexPath = mDirectory + "/dawn_blob_cache.index";
+        IndexRecord record;
+        {
+            std::ifstream index(indexPath, std::ios::binary);
+            index.seekg(-static_cast<std::streamoff>(sizeof(record)), std::ios::end);
+            ASSERT_TRUE(index.read(reinterpret_cast<char*>(&record), sizeof(record)));
+        }
+        modify(&record);
+        std::ofstream index(indexPath, std::ios::binary | std::ios::app);
+        index.write(reinterpret_cast<const char*>(&record), sizeof(record));
+    }
+
+    std::string mDirectory;
+};
+
+// Test that stored blobs can be loaded before and after being written to disk.
+TEST_F(DiskBlobCacheTests, LoadStore) {
+    std::unique_ptr<DiskBlobCache> cache = Open();
+    ASSERT_NE(cache, nullptr);
+    std::vector<uint8_t> value = MakeData(5000, 0);
+
+    EXPECT_TRUE(cache->Load("key").Empty());
+    cache->Store("key", value.size(), value.data());
+    EXPECT_TRUE(BlobEquals(cache->Load("key"), value));
+
+    cache->Flush();
+    EXPECT_TRUE(BlobEquals(cache->Load("key"), value));
+    EXPECT_TRUE(cache->Load("other key").Empty());
+
+    EXPECT_EQ(cache->GetHitCount(), 2u);
+    EXPECT_EQ(cache->GetMissCount(), 2u);
+    EXPECT_EQ(cache->GetStoredBytes(), value.size());
+    EXPECT_GT(cache->GetWrittenBytes(), 0u);
+    EXPECT_LT(cache->GetWrittenBytes(), value.size());
+}
+
+// Test that blobs persist when the cache is reopened.
+TEST_F(DiskBlobCacheTests, Persistence) {
+    std::vector<std::vector<uint8_t>> values;
+    for (uint32_t i = 0; i < 10; i++) {
+        values.push_back(MakeData(1000 + i * 100, i));
+    }
+
+    {
+        std::unique_ptr<DiskBlobCache> cache = Open();
+        ASSERT_NE(cache, nullptr);
+        for (size_t i = 0; i < values.size(); i++) {
+            std::string key = "key" + std::to_string(i);
+            cache->Store(key, values[i].size(), values[i].data());
+        }
+        // The pending blobs are written when the cache is destroyed.
+    }
+
+    std::unique_ptr<DiskBlobCache> cache = Open();
+    ASSERT_NE(cache, nullptr);
+    for (size_t i = 0; i < values.size(); i++) {
+        std::string key = "key" + std::to_string(i);
+        EXPECT_TRUE(BlobEquals(cache->Load(key), values[i]));
+    }
+    EXPECT_TRUE(cache->Load("key10").Empty());
+}
+
+// Test that a partial record left at the end of the index by a crash is dropped, and that the
+// records appended after reopening the cache are still read correctly.
+TEST_F(DiskBlobCacheTests, PartialIndexRecord) {
+    std::vector<uint8_t> value0 = MakeData(1000, 0);
+    std::vector<uint8_t> value1 = MakeData(2000, 1);
+    {
+        std::unique_ptr<DiskBlobCache> cache = Open();
+        ASSERT_NE(cache, nullptr);
+        cache->Store("key0", value0.size(), value0.data());
+    }
+    {
+        std::ofstream index(mDirectory + "/dawn_blob_cache.index",
+                            std::ios::binary | std::ios::app);
+        index.write("partial", 7);
+    }
+    {
+        std::unique_ptr<DiskBlobCache> cache = Open();
+        ASSERT_NE(cache, nullptr);
+        EXPECT_TRUE(BlobEquals(cache->Load("key0"), value0));
+        cache->Store("key1", value1.size(), value1.data());
+    }
+
+    std::unique_ptr<DiskBlobCache> cache = Open();
+    ASSERT_NE(cache, nullptr);
+    EXPECT_TRUE(BlobEquals(cache->Load("key0"), value0));
+    EXPECT_TRUE(BlobEquals(cache->Load("key1"), value1));
+}
+
+// Test that records pointing past the end of the data file are ignored, including ones whose
+// bounds overflow.
+TEST_F(DiskBlobCacheTests, CorruptIndexRecordBounds) {
+    std::vector<uint8_t> value = MakeData(1000, 0);
+    StoreAndReopen("key", value);
+    AppendModifiedLastIndexRecord([](IndexRecord* record) { record->offset = UINT64_MAX - 1; });
+
+    std::unique_ptr<DiskBlobCache> cache = Open();
+    ASSERT_NE(cache, nullptr);
+    EXPECT_TRUE(BlobEquals(cache->Load("key"), value));
+}
+
+// Test that a record of an uncompressed value whose stored size doesn't match the value size is
+// treated as a cache miss.
+TEST_F(DiskBlobCacheTests, CorruptIndexRecordSizes) {
+    std::vector<uint8_t> value = MakeData(1000, 0);
+    StoreAndReopen("key", value);
+    AppendModifiedLastIndexRecord([](IndexRecord* record) {
+        record->flags = 0;
+        record->valueSize = record->storedSize + 1000;
+    });
+
+    std::unique_ptr<DiskBlobCache> cache = Open();
+    ASSERT_NE(cache, nullptr);
+    EXPECT_TRUE(cache->Load("key").Empty());
+}
+
+// Test that opening the cache in a directory that doesn't exist fails.
+TEST_F(DiskBlobCacheTests, InvalidDirectory) {
+    auto result = DiskBlobCache::Create(mDirectory + "/this/directory/does/not/exist");
+    ASSERT_TRUE(result.IsError());
+    EXPECT_NE(result.AcquireError(), nullptr);
+}
+
+}  // anonymous namespace
+}  // namespace dawn::native
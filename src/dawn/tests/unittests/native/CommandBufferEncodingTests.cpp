@@ -32,6 +32,7 @@
 #include "dawn/native/Commands.h"
 #include "dawn/native/ComputePassEncoder.h"
 #include "dawn/tests/DawnNativeTest.h"
+#include "dawn/utils/ComboRenderPipelineDescriptor.h"
 #include "dawn/utils/WGPUHelpers.h"
 
 namespace dawn::native {
@@ -285,6 +286,65 @@ TEST_F(CommandBufferEncodingTests, ComputePassEncoderIndirectDispatchStateRestor
         });
 }
 
+// Test that consecutive draws are recorded in a single batch and that any other command starts a
+// new one.
+TEST_F(CommandBufferEncodingTests, ConsecutiveDrawsAreBatched) {
+    utils::BasicRenderPass renderPass = utils::CreateBasicRenderPass(device, 1, 1);
+
+    utils::ComboRenderPipelineDescriptor pipelineDesc;
+    pipelineDesc.vertex.module = utils::CreateShaderModule(device, R"(
+        @vertex fn main() -> @builtin(position) vec4f {
+            return vec4f(0.0, 0.0, 0.0, 1.0);
+        })");
+    pipelineDesc.cFragment.module = utils::CreateShaderModule(device, R"(
+        @fragment fn main() -> @location(0) vec4f {
+            return vec4f(0.0, 1.0, 0.0, 1.0);
+        })");
+    wgpu::RenderPipeline pipeline = device.CreateRenderPipeline(&pipelineDesc);
+
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass.renderPassInfo);
+    pass.SetPipeline(pipeline);
+    pass.Draw(3);
+    pass.Draw(4, 2);
+    pass.Draw(5, 1, 6);
+    pass.SetStencilReference(1);
+    pass.Draw(7);
+    pass.End();
+    wgpu::CommandBuffer commandBuffer = encoder.Finish();
+
+    auto ExpectDrawBatch = [](std::vector<DrawCmd> expectedDraws) {
+        return [expectedDraws](CommandIterator* commands) {
+            auto* cmd = commands->NextCommand<DrawBatchCmd>();
+            ASSERT_EQ(cmd->drawCount, expectedDraws.size());
+            DrawCmd* draws = commands->NextData<DrawCmd>(cmd->drawCount);
+            for (uint32_t i = 0; i < cmd->drawCount; ++i) {
+                EXPECT_EQ(draws[i].vertexCount, expectedDraws[i].vertexCount);
+                EXPECT_EQ(draws[i].instanceCount, expectedDraws[i].instanceCount);
+                EXPECT_EQ(draws[i].firstVertex, expectedDraws[i].firstVertex);
+                EXPECT_EQ(draws[i].firstInstance, expectedDraws[i].firstInstance);
+            }
+        };
+    };
+
+    ExpectCommands(
+        FromAPI(commandBuffer.Get())->GetCommandIteratorForTesting(),
+        {
+            {Command::BeginRenderPass,
+             [&](CommandIterator* commands) { SkipCommand(commands, Command::BeginRenderPass); }},
+            {Command::SetRenderPipeline,
+             [&](CommandIterator* commands) { SkipCommand(commands, Command::SetRenderPipeline); }},
+            {Command::DrawBatch, ExpectDrawBatch({{3, 1, 0, 0}, {4, 2, 0, 0}, {5, 1, 6, 0}})},
+            {Command::SetStencilReference,
+             [&](CommandIterator* commands) {
+                 SkipCommand(commands, Command::SetStencilReference);
+             }},
+            {Command::DrawBatch, ExpectDrawBatch({{7, 1, 0, 0}})},
+            {Command::EndRenderPass,
+             [&](CommandIterator* commands) { SkipCommand(commands, Command::EndRenderPass); }},
+        });
+}
+
 // Test that after restoring state, it is fully applied to the state tracker
 // and does not leak state changes that occurred between a snapshot and the
 // state restoration.
@@ -0,0 +1,196 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "dawn/native/PassResourceUsageTracker.h"
+#include "mocks/BufferMock.h"
+#include "mocks/DawnMockTest.h"
+#include "mocks/TextureMock.h"
+
+namespace dawn::native {
+namespace {
+
+using ::testing::NiceMock;
+
+class SyncScopeUsageTrackerTests : public DawnMockTest {
+  protected:
+    Ref<BufferBase> CreateBuffer() {
+        BufferDescriptor desc = {};
+        desc.size = 4;
+        desc.usage = wgpu::BufferUsage::Vertex | wgpu::BufferUsage::Uniform |
+                     wgpu::BufferUsage::Storage;
+        return AcquireRef(new NiceMock<BufferMock>(mDeviceMock, &desc));
+    }
+
+    Ref<TextureBase> CreateTexture() {
+        TextureDescriptor desc = {};
+        desc.size = {1, 1, 1};
+        desc.format = wgpu::TextureFormat::RGBA8Unorm;
+        desc.usage = wgpu::TextureUsage::TextureBinding | wgpu::TextureUsage::StorageBinding;
+        return AcquireRef(new NiceMock<TextureMock>(mDeviceMock, &desc));
+    }
+
+    // Returns the usage recorded for |buffer| in |usage|, checking that it is recorded once.
+    wgpu::BufferUsage GetBufferUsage(const SyncScopeResourceUsage& usage, BufferBase* buffer) {
+        wgpu::BufferUsage result = wgpu::BufferUsage::None;
+        uint32_t count = 0;
+        for (size_t i = 0; i < usage.buffers.size(); ++i) {
+            if (usage.buffers[i] == buffer) {
+                result = usage.bufferSyncInfos[i].usage;
+                ++count;
+            }
+        }
+        EXPECT_EQ(count, 1u);
+        return result;
+    }
+};
+
+// Test two trackers that record the same buffers alternately, so that each one overwrites the
+// stamps set by the other.
+TEST_F(SyncScopeUsageTrackerTests, AlternatingScopesOnSameBuffers) {
+    Ref<BufferBase> buffer0 = CreateBuffer();
+    Ref<BufferBase> buffer1 = CreateBuffer();
+
+    SyncScopeUsageTracker trackerA;
+    SyncScopeUsageTracker trackerB;
+
+    // buffer1 is at index 1 in A and at index 0 in B.
+    trackerA.BufferUsedAs(buffer0.Get(), wgpu::BufferUsage::Vertex);
+    trackerA.BufferUsedAs(buffer1.Get(), wgpu::BufferUsage::Vertex);
+    trackerB.BufferUsedAs(buffer1.Get(), wgpu::BufferUsage::Uniform);
+    trackerA.BufferUsedAs(buffer1.Get(), wgpu::BufferUsage::Uniform);
+    trackerB.BufferUsedAs(buffer0.Get(), wgpu::BufferUsage::Storage);
+    trackerA.BufferUsedAs(buffer0.Get(), wgpu::BufferUsage::Storage);
+    trackerB.BufferUsedAs(buffer1.Get(), wgpu::BufferUsage::Storage);
+
+    SyncScopeResourceUsage usageA = trackerA.AcquireSyncScopeUsage();
+    ASSERT_EQ(usageA.buffers.size(), 2u);
+    ASSERT_EQ(usageA.bufferSyncInfos.size(), 2u);
+    EXPECT_EQ(GetBufferUsage(usageA, buffer0.Get()),
+              wgpu::BufferUsage::Vertex | wgpu::BufferUsage::Storage);
+    EXPECT_EQ(GetBufferUsage(usageA, buffer1.Get()),
+              wgpu::BufferUsage::Vertex | wgpu::BufferUsage::Uniform);
+
+    SyncScopeResourceUsage usageB = trackerB.AcquireSyncScopeUsage();
+    ASSERT_EQ(usageB.buffers.size(), 2u);
+    ASSERT_EQ(usageB.bufferSyncInfos.size(), 2u);
+    EXPECT_EQ(GetBufferUsage(usageB, buffer0.Get()), wgpu::BufferUsage::Storage);
+    EXPECT_EQ(GetBufferUsage(usageB, buffer1.Get()),
+              wgpu::BufferUsage::Uniform | wgpu::BufferUsage::Storage);
+}
+
+// Test alternating trackers on more buffers than are searched linearly, so that resources whose
+// stamp was overwritten are found with the hash map fallback.
+TEST_F(SyncScopeUsageTrackerTests, AlternatingScopesOnManyBuffers) {
+    constexpr size_t kBufferCount = 40;
+    std::vector<Ref<BufferBase>> buffers;
+    for (size_t i = 0; i < kBufferCount; ++i) {
+        buffers.push_back(CreateBuffer());
+    }
+
+    SyncScopeUsageTracker trackerA;
+    SyncScopeUsageTracker trackerB;
+
+    // A records the buffers in order and B in reverse order, so that their indices differ. Each
+    // buffer is then used again by both trackers, after the other tracker overwrote its stamp.
+    for (size_t i = 0; i < kBufferCount; ++i) {
+        trackerA.BufferUsedAs(buffers[i].Get(), wgpu::BufferUsage::Vertex);
+        trackerB.BufferUsedAs(buffers[kBufferCount - 1 - i].Get(), wgpu::BufferUsage::Uniform);
+    }
+    for (size_t i = 0; i < kBufferCount; ++i) {
+        trackerA.BufferUsedAs(buffers[i].Get(), wgpu::BufferUsage::Uniform);
+        trackerB.BufferUsedAs(buffers[i].Get(), wgpu::BufferUsage::Storage);
+    }
+
+    SyncScopeResourceUsage usageA = trackerA.AcquireSyncScopeUsage();
+    SyncScopeResourceUsage usageB = trackerB.AcquireSyncScopeUsage();
+    ASSERT_EQ(usageA.buffers.size(), kBufferCount);
+    ASSERT_EQ(usageB.buffers.size(), kBufferCount);
+    for (const Ref<BufferBase>& buffer : buffers) {
+        EXPECT_EQ(GetBufferUsage(usageA, buffer.Get()),
+                  wgpu::BufferUsage::Vertex | wgpu::BufferUsage::Uniform);
+        EXPECT_EQ(GetBufferUsage(usageB, buffer.Get()),
+                  wgpu::BufferUsage::Uniform | wgpu::BufferUsage::Storage);
+    }
+}
+
+// Test two trackers that record the same texture alternately.
+TEST_F(SyncScopeUsageTrackerTests, AlternatingScopesOnSameTexture) {
+    Ref<TextureBase> texture = CreateTexture();
+    SubresourceRange range = texture->GetAllSubresources();
+
+    SyncScopeUsageTracker trackerA;
+    SyncScopeUsageTracker trackerB;
+
+    trackerA.TextureRangeUsedAs(texture.Get(), range, wgpu::TextureUsage::TextureBinding,
+                                wgpu::ShaderStage::Fragment);
+    trackerB.TextureRangeUsedAs(texture.Get(), range, wgpu::TextureUsage::StorageBinding,
+                                wgpu::ShaderStage::Compute);
+    trackerA.TextureRangeUsedAs(texture.Get(), range, wgpu::TextureUsage::TextureBinding,
+                                wgpu::ShaderStage::Vertex);
+
+    SyncScopeResourceUsage usageA = trackerA.AcquireSyncScopeUsage();
+    ASSERT_EQ(usageA.textures.size(), 1u);
+    ASSERT_EQ(usageA.textureSyncInfos.size(), 1u);
+    const TextureSyncInfo& syncInfoA = usageA.textureSyncInfos[0].Get(Aspect::Color, 0, 0);
+    EXPECT_EQ(syncInfoA.usage, wgpu::TextureUsage::TextureBinding);
+    EXPECT_EQ(syncInfoA.shaderStages, wgpu::ShaderStage::Vertex | wgpu::ShaderStage::Fragment);
+
+    SyncScopeResourceUsage usageB = trackerB.AcquireSyncScopeUsage();
+    ASSERT_EQ(usageB.textures.size(), 1u);
+    ASSERT_EQ(usageB.textureSyncInfos.size(), 1u);
+    const TextureSyncInfo& syncInfoB = usageB.textureSyncInfos[0].Get(Aspect::Color, 0, 0);
+    EXPECT_EQ(syncInfoB.usage, wgpu::TextureUsage::StorageBinding);
+    EXPECT_EQ(syncInfoB.shaderStages, wgpu::ShaderStage::Compute);
+}
+
+// Test that the stamps set before AcquireSyncScopeUsage are ignored by the next scope of the same
+// tracker.
+TEST_F(SyncScopeUsageTrackerTests, NewScopeAfterAcquire) {
+    Ref<BufferBase> buffer0 = CreateBuffer();
+    Ref<BufferBase> buffer1 = CreateBuffer();
+
+    SyncScopeUsageTracker tracker;
+    tracker.BufferUsedAs(buffer0.Get(), wgpu::BufferUsage::Vertex);
+    tracker.BufferUsedAs(buffer1.Get(), wgpu::BufferUsage::Vertex);
+    SyncScopeResourceUsage usage = tracker.AcquireSyncScopeUsage();
+    ASSERT_EQ(usage.buffers.size(), 2u);
+
+    // buffer1 still has a stamp for index 1 of the previous scope.
+    tracker.BufferUsedAs(buffer1.Get(), wgpu::BufferUsage::Uniform);
+    usage = tracker.AcquireSyncScopeUsage();
+    ASSERT_EQ(usage.buffers.size(), 1u);
+    ASSERT_EQ(usage.bufferSyncInfos.size(), 1u);
+    EXPECT_EQ(GetBufferUsage(usage, buffer1.Get()), wgpu::BufferUsage::Uniform);
+}
+
+}  // anonymous namespace
+}  // namespace dawn::native
@@ -0,0 +1,151 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <string>
+#include <vector>
+
+#include "dawn/tests/unittests/wire/WireTest.h"
+#include "dawn/wire/WireClient.h"
+#include "dawn/wire/WireServer.h"
+
+namespace dawn::wire {
+namespace {
+
+using testing::_;
+using testing::InSequence;
+using testing::Return;
+using testing::StrEq;
+
+// Runs the wire with the server decoding commands on its own thread. Commands must still be
+// executed in order and object references must resolve against objects created earlier in the
+// same flush.
+class WireCommandDecoderThreadTests : public WireTest {
+  public:
+    WireCommandDecoderThreadTests() {}
+    ~WireCommandDecoderThreadTests() override = default;
+
+  private:
+    bool UseCommandDecoderThread() override { return true; }
+};
+
+// Test that an object created in a flush can be used by the next command of the same flush.
+TEST_F(WireCommandDecoderThreadTests, CreateThenCall) {
+    WGPUCommandEncoder encoder = wgpuDeviceCreateCommandEncoder(device, nullptr);
+    wgpuCommandEncoderInsertDebugMarker(encoder, "marker");
+    wgpuCommandEncoderFinish(encoder, nullptr);
+
+    WGPUCommandEncoder apiEncoder = api.GetNewCommandEncoder();
+    WGPUCommandBuffer apiCommandBuffer = api.GetNewCommandBuffer();
+    {
+        InSequence s;
+        EXPECT_CALL(api, DeviceCreateCommandEncoder(apiDevice, nullptr))
+            .WillOnce(Return(apiEncoder));
+        EXPECT_CALL(api, CommandEncoderInsertDebugMarker(apiEncoder, StrEq("marker")));
+        EXPECT_CALL(api, CommandEncoderFinish(apiEncoder, nullptr))
+            .WillOnce(Return(apiCommandBuffer));
+    }
+
+    FlushClient();
+}
+
+// Test that objects referenced from descriptors are resolved at execution time.
+TEST_F(WireCommandDecoderThreadTests, ObjectInDescriptor) {
+    WGPUBindGroupLayoutDescriptor bglDescriptor = {};
+    WGPUBindGroupLayout bgl = wgpuDeviceCreateBindGroupLayout(device, &bglDescriptor);
+
+    WGPUPipelineLayoutDescriptor descriptor = {};
+    descriptor.bindGroupLayoutCount = 1;
+    descriptor.bindGroupLayouts = &bgl;
+    wgpuDeviceCreatePipelineLayout(device, &descriptor);
+
+    WGPUBindGroupLayout apiBgl = api.GetNewBindGroupLayout();
+    EXPECT_CALL(api, DeviceCreateBindGroupLayout(apiDevice, _)).WillOnce(Return(apiBgl));
+
+    WGPUPipelineLayout apiLayout = api.GetNewPipelineLayout();
+    EXPECT_CALL(api, DeviceCreatePipelineLayout(
+                         apiDevice, MatchesLambda([apiBgl](const WGPUPipelineLayoutDescriptor* desc) {
+                             return desc->bindGroupLayoutCount == 1 &&
+                                    desc->bindGroupLayouts[0] == apiBgl;
+                         })))
+        .WillOnce(Return(apiLayout));
+
+    FlushClient();
+}
+
+// Test that a flush with more commands than the decoded command queue can hold executes all of
+// them in order.
+TEST_F(WireCommandDecoderThreadTests, ManyCommands) {
+    constexpr size_t kMarkerCount = 1000;
+
+    WGPUCommandEncoder encoder = wgpuDeviceCreateCommandEncoder(device, nullptr);
+    WGPUCommandEncoder apiEncoder = api.GetNewCommandEncoder();
+    EXPECT_CALL(api, DeviceCreateCommandEncoder(apiDevice, nullptr)).WillOnce(Return(apiEncoder));
+
+    std::vector<std::string> markers;
+    for (size_t i = 0; i < kMarkerCount; ++i) {
+        markers.push_back("marker" + std::to_string(i));
+    }
+
+    InSequence s;
+    for (const std::string& marker : markers) {
+        wgpuCommandEncoderInsertDebugMarker(encoder, marker.c_str());
+        EXPECT_CALL(api, CommandEncoderInsertDebugMarker(apiEncoder, StrEq(marker)));
+    }
+
+    FlushClient();
+}
+
+// Test that commands following a command that fails to execute are not executed.
+TEST_F(WireCommandDecoderThreadTests, ErrorStopsBatch) {
+    WGPUTextureDescriptor placeholderDesc = {};
+    ReservedTexture reservation = GetWireClient()->ReserveTexture(device, &placeholderDesc);
+
+    // The texture is never injected so the server fails to resolve it.
+    wgpuTextureCreateView(reservation.texture, nullptr);
+    wgpuDeviceCreateCommandEncoder(device, nullptr);
+
+    EXPECT_CALL(api, DeviceCreateCommandEncoder(_, _)).Times(0);
+    FlushClient(false);
+}
+
+// Test that the server keeps working across several flushes.
+TEST_F(WireCommandDecoderThreadTests, SeveralFlushes) {
+    for (int i = 0; i < 3; ++i) {
+        WGPUCommandEncoder encoder = wgpuDeviceCreateCommandEncoder(device, nullptr);
+        wgpuCommandEncoderInsertDebugMarker(encoder, "marker");
+
+        WGPUCommandEncoder apiEncoder = api.GetNewCommandEncoder();
+        EXPECT_CALL(api, DeviceCreateCommandEncoder(apiDevice, nullptr))
+            .WillOnce(Return(apiEncoder));
+        EXPECT_CALL(api, CommandEncoderInsertDebugMarker(apiEncoder, StrEq("marker")));
+
+        FlushClient();
+    }
+}
+
+}  // anonymous namespace
+}  // namespace dawn::wire
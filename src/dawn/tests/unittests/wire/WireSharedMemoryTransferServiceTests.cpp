@@ -0,0 +1,188 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <cstring>
+#include <limits>
+#include <memory>
+
+#include "dawn/utils/SharedMemoryTransferService.h"
+#include "dawn/utils/SharedMemoryTransport.h"
+#include "gtest/gtest.h"
+
+namespace dawn::utils {
+namespace {
+
+using ClientReadHandle = dawn::wire::client::MemoryTransferService::ReadHandle;
+using ServerReadHandle = dawn::wire::server::MemoryTransferService::ReadHandle;
+using ServerWriteHandle = dawn::wire::server::MemoryTransferService::WriteHandle;
+
+constexpr size_t kRegionSize = 4096;
+
+// Mirrors the data serialized by the handles on creation.
+struct SerializedAllocation {
+    uint64_t offset;
+    uint64_t size;
+};
+
+class WireSharedMemoryTransferServiceTests : public testing::Test {
+  protected:
+    void SetUp() override {
+        mRegion = SharedMemoryRegion::Create("dawn_wire_test", kRegionSize);
+        ASSERT_NE(mRegion, nullptr);
+        mClientService = CreateSharedMemoryClientTransferService(mRegion.get());
+        mServerService = CreateSharedMemoryServerTransferService(mRegion.get());
+    }
+
+    std::unique_ptr<ClientReadHandle> CreateClientReadHandle(size_t size) {
+        return std::unique_ptr<ClientReadHandle>(mClientService->CreateReadHandle(size));
+    }
+
+    static SerializedAllocation GetAllocation(ClientReadHandle* handle) {
+        SerializedAllocation allocation;
+        EXPECT_EQ(handle->SerializeCreateSize(), sizeof(allocation));
+        handle->SerializeCreate(&allocation);
+        return allocation;
+    }
+
+    // Returns whether the server accepts the allocation as both a read and a write handle.
+    bool ServerAcceptsSerializedAllocation(const void* data, size_t size) {
+        ServerReadHandle* readHandle = nullptr;
+        bool readSuccess = mServerService->DeserializeReadHandle(data, size, &readHandle);
+        EXPECT_EQ(readSuccess, readHandle != nullptr);
+        delete readHandle;
+
+        ServerWriteHandle* writeHandle = nullptr;
+        bool writeSuccess = mServerService->DeserializeWriteHandle(data, size, &writeHandle);
+        EXPECT_EQ(writeSuccess, writeHandle != nullptr);
+        delete writeHandle;
+
+        EXPECT_EQ(readSuccess, writeSuccess);
+        return readSuccess && writeSuccess;
+    }
+
+    bool ServerAcceptsAllocation(uint64_t offset, uint64_t size) {
+        SerializedAllocation allocation = {offset, size};
+        return ServerAcceptsSerializedAllocation(&allocation, sizeof(allocation));
+    }
+
+    std::unique_ptr<SharedMemoryRegion> mRegion;
+    std::unique_ptr<dawn::wire::client::MemoryTransferService> mClientService;
+    std::unique_ptr<dawn::wire::server::MemoryTransferService> mServerService;
+};
+
+// Test that the server only accepts allocations that are inside the region.
+TEST_F(WireSharedMemoryTransferServiceTests, DeserializeAllocationBounds) {
+    EXPECT_TRUE(ServerAcceptsAllocation(0, kRegionSize));
+    EXPECT_TRUE(ServerAcceptsAllocation(kRegionSize - 256, 256));
+    EXPECT_TRUE(ServerAcceptsAllocation(kRegionSize, 0));
+
+    EXPECT_FALSE(ServerAcceptsAllocation(0, kRegionSize + 1));
+    EXPECT_FALSE(ServerAcceptsAllocation(kRegionSize + 1, 0));
+    EXPECT_FALSE(ServerAcceptsAllocation(kRegionSize - 256, 257));
+    // offset + size wraps around to a value inside the region.
+    EXPECT_FALSE(ServerAcceptsAllocation(256, std::numeric_limits<uint64_t>::max()));
+    EXPECT_FALSE(ServerAcceptsAllocation(std::numeric_limits<uint64_t>::max(), 2));
+}
+
+// Test that the server rejects serialized allocations of the wrong size.
+TEST_F(WireSharedMemoryTransferServiceTests, DeserializeAllocationWrongSize) {
+    SerializedAllocation allocation = {0, 256};
+    EXPECT_FALSE(ServerAcceptsSerializedAllocation(&allocation, sizeof(allocation) - 1));
+    EXPECT_FALSE(ServerAcceptsSerializedAllocation(&allocation, 0));
+    EXPECT_FALSE(ServerAcceptsSerializedAllocation(nullptr, sizeof(allocation)));
+}
+
+// Test that data update ranges that overflow are rejected on the client read handle.
+TEST_F(WireSharedMemoryTransferServiceTests, ClientReadHandleRangeOverflow) {
+    std::unique_ptr<ClientReadHandle> handle = CreateClientReadHandle(64);
+    ASSERT_NE(handle, nullptr);
+
+    EXPECT_TRUE(handle->DeserializeDataUpdate(nullptr, 0, 0, 64));
+    EXPECT_TRUE(handle->DeserializeDataUpdate(nullptr, 0, 64, 0));
+    EXPECT_FALSE(handle->DeserializeDataUpdate(nullptr, 0, 32, 64));
+    EXPECT_FALSE(handle->DeserializeDataUpdate(nullptr, 0, 16, std::numeric_limits<size_t>::max()));
+    EXPECT_FALSE(handle->DeserializeDataUpdate(nullptr, 0, std::numeric_limits<size_t>::max(), 2));
+}
+
+// Test that data update ranges that overflow are rejected on the server write handle, even when
+// the buffer mapping is large enough.
+TEST_F(WireSharedMemoryTransferServiceTests, ServerWriteHandleRangeOverflow) {
+    SerializedAllocation allocation = {256, 64};
+    ServerWriteHandle* rawHandle = nullptr;
+    ASSERT_TRUE(
+        mServerService->DeserializeWriteHandle(&allocation, sizeof(allocation), &rawHandle));
+    std::unique_ptr<ServerWriteHandle> handle(rawHandle);
+
+    uint8_t target[64] = {};
+    memset(mRegion->GetData() + allocation.offset, 0x42, allocation.size);
+    handle->SetTarget(target);
+    handle->SetDataLength(std::numeric_limits<size_t>::max());
+
+    EXPECT_FALSE(handle->DeserializeDataUpdate(nullptr, 0, 16, std::numeric_limits<size_t>::max()));
+    EXPECT_FALSE(handle->DeserializeDataUpdate(nullptr, 0, std::numeric_limits<size_t>::max(), 2));
+    EXPECT_FALSE(handle->DeserializeDataUpdate(nullptr, 0, 32, 64));
+    EXPECT_EQ(target[0], 0);
+
+    EXPECT_TRUE(handle->DeserializeDataUpdate(nullptr, 0, 0, 64));
+    EXPECT_EQ(target[0], 0x42);
+    EXPECT_EQ(target[63], 0x42);
+}
+
+// Test that freed ranges are merged with their free neighbors so that a large allocation fits in
+// them again.
+TEST_F(WireSharedMemoryTransferServiceTests, FreeMergesNeighbors) {
+    constexpr size_t kQuarter = kRegionSize / 4;
+    std::unique_ptr<ClientReadHandle> handles[4];
+    for (size_t i = 0; i < 4; ++i) {
+        handles[i] = CreateClientReadHandle(kQuarter);
+        ASSERT_NE(handles[i], nullptr);
+        EXPECT_EQ(GetAllocation(handles[i].get()).offset, i * kQuarter);
+    }
+    EXPECT_EQ(CreateClientReadHandle(1), nullptr);
+
+    // Merge with the next free range.
+    handles[1] = nullptr;
+    handles[0] = nullptr;
+    {
+        std::unique_ptr<ClientReadHandle> handle = CreateClientReadHandle(2 * kQuarter);
+        ASSERT_NE(handle, nullptr);
+        EXPECT_EQ(GetAllocation(handle.get()).offset, 0u);
+    }
+
+    // The free ranges are [0, 2 * kQuarter) and [3 * kQuarter, kRegionSize).
+    handles[3] = nullptr;
+    EXPECT_EQ(CreateClientReadHandle(3 * kQuarter), nullptr);
+
+    // Merge with both the previous and the next free ranges.
+    handles[2] = nullptr;
+    std::unique_ptr<ClientReadHandle> handle = CreateClientReadHandle(kRegionSize);
+    ASSERT_NE(handle, nullptr);
+    EXPECT_EQ(GetAllocation(handle.get()).offset, 0u);
+}
+
+}  // anonymous namespace
+}  // namespace dawn::utils
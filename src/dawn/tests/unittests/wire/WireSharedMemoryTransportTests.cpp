@@ -0,0 +1,224 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "dawn/utils/SharedMemoryTransport.h"
+#include "gtest/gtest.h"
+
+namespace dawn::utils {
+namespace {
+
+constexpr size_t kRingCapacity = 256;
+constexpr size_t kMessageHeaderSize = sizeof(uint64_t);
+constexpr uint64_t kWrapMarker = ~uint64_t(0);
+
+// A CommandHandler that records every message it is given.
+class RecordingCommandHandler : public dawn::wire::CommandHandler {
+  public:
+    const volatile char* HandleCommands(const volatile char* commands, size_t size) override {
+        std::vector<char> message(size);
+        for (size_t i = 0; i < size; ++i) {
+            message[i] = commands[i];
+        }
+        messages.push_back(std::move(message));
+        return commands + size;
+    }
+
+    std::vector<std::vector<char>> messages;
+};
+
+class WireSharedMemoryTransportTests : public testing::Test {
+  protected:
+    void SetUp() override {
+        mRing = SharedMemoryRing::Create(kRingCapacity);
+        ASSERT_NE(mRing, nullptr);
+        mSerializer = std::make_unique<SharedMemoryCommandSerializer>(mRing.get());
+        mReceiver = std::make_unique<SharedMemoryCommandReceiver>(mRing.get(), &mHandler);
+    }
+
+    // Writes a command of |size| bytes filled with |value| in the open message.
+    void WriteCommand(size_t size, char value) {
+        void* space = mSerializer->GetCmdSpace(size);
+        ASSERT_NE(space, nullptr);
+        memset(space, value, size);
+    }
+
+    // Writes raw bytes in the ring as a compromised producer would.
+    void WriteRaw(size_t offset, uint64_t value) {
+        ASSERT_LE(offset + sizeof(value), kRingCapacity);
+        *reinterpret_cast<volatile uint64_t*>(mRing->GetData() + offset) = value;
+    }
+
+    void ExpectMessage(size_t index, size_t size, char value) {
+        ASSERT_LT(index, mHandler.messages.size());
+        EXPECT_EQ(mHandler.messages[index], std::vector<char>(size, value));
+    }
+
+    std::unique_ptr<SharedMemoryRing> mRing;
+    RecordingCommandHandler mHandler;
+    std::unique_ptr<SharedMemoryCommandSerializer> mSerializer;
+    std::unique_ptr<SharedMemoryCommandReceiver> mReceiver;
+};
+
+// Test that messages keep their contents when the ring wraps around many times.
+TEST_F(WireSharedMemoryTransportTests, WrapAround) {
+    constexpr size_t kCommandSize = 40;
+    constexpr size_t kMessageCount = 32;
+
+    for (size_t i = 0; i < kMessageCount; ++i) {
+        WriteCommand(kCommandSize, static_cast<char>(i));
+        ASSERT_TRUE(mSerializer->Flush());
+        ASSERT_TRUE(mReceiver->ProcessCommands());
+    }
+
+    ASSERT_EQ(mHandler.messages.size(), kMessageCount);
+    for (size_t i = 0; i < kMessageCount; ++i) {
+        ExpectMessage(i, kCommandSize, static_cast<char>(i));
+    }
+    EXPECT_GT(mRing->LoadWritePosition(), 4 * kRingCapacity);
+    EXPECT_EQ(mRing->LoadReadPosition(), mRing->LoadWritePosition());
+}
+
+// Test that a message that would grow past the end of the ring is split: the commands written so
+// far are published and the rest starts a new message at the beginning of the ring.
+TEST_F(WireSharedMemoryTransportTests, MessageSpanningEndOfRing) {
+    // Move the write position to 64 bytes before the end of the ring.
+    for (size_t i = 0; i < 4; ++i) {
+        WriteCommand(40, 'a');
+        ASSERT_TRUE(mSerializer->Flush());
+    }
+    ASSERT_TRUE(mReceiver->ProcessCommands());
+    ASSERT_EQ(mRing->LoadWritePosition(), kRingCapacity - 64);
+    mHandler.messages.clear();
+
+    WriteCommand(24, 'b');
+    WriteCommand(40, 'c');
+    ASSERT_TRUE(mSerializer->Flush());
+    ASSERT_TRUE(mReceiver->ProcessCommands());
+
+    ASSERT_EQ(mHandler.messages.size(), 2u);
+    ExpectMessage(0, 24, 'b');
+    ExpectMessage(1, 40, 'c');
+    EXPECT_EQ(mRing->LoadWritePosition(), kRingCapacity + kMessageHeaderSize + 40);
+}
+
+// Test that commands larger than half of the ring are rejected since they wouldn't always fit
+// after a wrap.
+TEST_F(WireSharedMemoryTransportTests, OversizedCommand) {
+    size_t maxSize = mSerializer->GetMaximumAllocationSize();
+    EXPECT_EQ(maxSize, kRingCapacity / 2 - kMessageHeaderSize);
+    EXPECT_EQ(mSerializer->GetCmdSpace(maxSize + 1), nullptr);
+    EXPECT_EQ(mSerializer->GetCmdSpace(kRingCapacity), nullptr);
+    EXPECT_NE(mSerializer->GetCmdSpace(maxSize), nullptr);
+}
+
+// Test that a message size larger than the published bytes is rejected.
+TEST_F(WireSharedMemoryTransportTests, MessageSizeLargerThanPublished) {
+    WriteRaw(0, 64);
+    mRing->PublishWrite(kMessageHeaderSize + 16);
+    EXPECT_FALSE(mReceiver->ProcessCommands());
+    EXPECT_TRUE(mHandler.messages.empty());
+}
+
+// Test that a message size that would overflow the position computations is rejected.
+TEST_F(WireSharedMemoryTransportTests, MessageSizeOverflow) {
+    WriteRaw(0, kWrapMarker - 1);
+    mRing->PublishWrite(kRingCapacity);
+    EXPECT_FALSE(mReceiver->ProcessCommands());
+    EXPECT_TRUE(mHandler.messages.empty());
+}
+
+// Test that a message running past the end of the ring is rejected even if enough bytes were
+// published.
+TEST_F(WireSharedMemoryTransportTests, MessageSizePastEndOfRing) {
+    WriteCommand(40, 'a');
+    ASSERT_TRUE(mSerializer->Flush());
+    ASSERT_TRUE(mReceiver->ProcessCommands());
+    uint64_t position = mRing->LoadWritePosition();
+
+    WriteRaw(position, kRingCapacity - position);
+    mRing->PublishWrite(position + kRingCapacity);
+    EXPECT_FALSE(mReceiver->ProcessCommands());
+    EXPECT_EQ(mHandler.messages.size(), 1u);
+}
+
+// Test that a wrap marker is rejected if the rest of the ring wasn't published.
+TEST_F(WireSharedMemoryTransportTests, WrapMarkerPastPublished) {
+    WriteRaw(0, kWrapMarker);
+    mRing->PublishWrite(kMessageHeaderSize);
+    EXPECT_FALSE(mReceiver->ProcessCommands());
+}
+
+// Test that write positions too close to or too far from the read position are rejected.
+TEST_F(WireSharedMemoryTransportTests, MalformedWritePosition) {
+    WriteRaw(0, 0);
+    mRing->PublishWrite(kMessageHeaderSize / 2);
+    EXPECT_FALSE(mReceiver->ProcessCommands());
+
+    mRing->PublishWrite(kRingCapacity + kMessageHeaderSize);
+    EXPECT_FALSE(mReceiver->ProcessCommands());
+    EXPECT_TRUE(mHandler.messages.empty());
+}
+
+// Test that Close() wakes up a consumer waiting for commands.
+TEST_F(WireSharedMemoryTransportTests, CloseWakesWaitingConsumer) {
+    bool result = true;
+    std::thread consumer([&] { result = mReceiver->WaitForCommands(); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    mRing->Close();
+    consumer.join();
+
+    EXPECT_FALSE(result);
+    EXPECT_TRUE(mRing->IsClosed());
+    EXPECT_FALSE(mReceiver->WaitForCommands());
+}
+
+// Test that Close() wakes up a producer waiting for space in a full ring.
+TEST_F(WireSharedMemoryTransportTests, CloseWakesWaitingProducer) {
+    size_t maxSize = mSerializer->GetMaximumAllocationSize();
+    WriteCommand(maxSize, 'a');
+    ASSERT_TRUE(mSerializer->Flush());
+    WriteCommand(maxSize, 'b');
+    ASSERT_TRUE(mSerializer->Flush());
+
+    void* space = reinterpret_cast<void*>(1);
+    std::thread producer([&] { space = mSerializer->GetCmdSpace(maxSize); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    mRing->Close();
+    producer.join();
+
+    EXPECT_EQ(space, nullptr);
+    EXPECT_FALSE(mSerializer->Flush());
+}
+
+}  // anonymous namespace
+}  // namespace dawn::utils
@@ -50,6 +50,10 @@ dawn::wire::server::MemoryTransferService* WireTest::GetServerMemoryTransferServ
     return nullptr;
 }
 
+bool WireTest::UseCommandDecoderThread() {
+    return false;
+}
+
 void WireTest::SetUp() {
     DawnProcTable mockProcs;
     api.GetProcTable(&mockProcs);
@@ -67,6 +71,7 @@ void WireTest::SetUp() {
     serverDesc.procs = &mockProcs;
     serverDesc.serializer = mS2cBuf.get();
     serverDesc.memoryTransferService = GetServerMemoryTransferService();
+    serverDesc.useCommandDecoderThread = UseCommandDecoderThread();
 
     mWireServer.reset(new dawn::wire::WireServer(serverDesc));
     mC2sBuf->SetHandler(mWireServer.get());
@@ -0,0 +1,299 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dawn/utils/SharedMemoryTransferService.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <optional>
+
+#include "dawn/common/Assert.h"
+#include "dawn/common/Math.h"
+#include "dawn/utils/SharedMemoryTransport.h"
+#include "partition_alloc/pointers/raw_ptr.h"
+
+namespace dawn::utils {
+
+namespace {
+
+constexpr size_t kAllocationAlignment = 256;
+
+// The data serialized for a handle on creation.
+struct SerializedAllocation {
+    uint64_t offset;
+    uint64_t size;
+};
+
+// Returns true if [offset, offset + size) is inside the allocation. Checks for overflows.
+bool IsRangeInAllocation(const SerializedAllocation& allocation, size_t offset, size_t size) {
+    return offset <= allocation.size && size <= allocation.size - offset;
+}
+
+class ClientTransferService : public dawn::wire::client::MemoryTransferService {
+  public:
+    explicit ClientTransferService(SharedMemoryRegion* region) : mRegion(region) {
+        mFreeRanges[0] = region->GetSize();
+    }
+    ~ClientTransferService() override = default;
+
+    class ReadHandleImpl : public ReadHandle {
+      public:
+        ReadHandleImpl(ClientTransferService* service, SerializedAllocation allocation)
+            : mService(service), mAllocation(allocation) {}
+        ~ReadHandleImpl() override { mService->Free(mAllocation); }
+
+        size_t SerializeCreateSize() override { return sizeof(SerializedAllocation); }
+
+        void SerializeCreate(void* serializePointer) override {
+            memcpy(serializePointer, &mAllocation, sizeof(SerializedAllocation));
+        }
+
+        const void* GetData() override { return mService->GetPointer(mAllocation); }
+
+        bool DeserializeDataUpdate(const void* deserializePointer,
+                                   size_t deserializeSize,
+                                   size_t offset,
+                                   size_t size) override {
+            // The server already wrote the data in the shared pages.
+            return deserializeSize == 0 && IsRangeInAllocation(mAllocation, offset, size);
+        }
+
+      private:
+        raw_ptr<ClientTransferService> mService;
+        SerializedAllocation mAllocation;
+    };
+
+    class WriteHandleImpl : public WriteHandle {
+      public:
+        WriteHandleImpl(ClientTransferService* service, SerializedAllocation allocation)
+            : mService(service), mAllocation(allocation) {}
+        ~WriteHandleImpl() override { mService->Free(mAllocation); }
+
+        size_t SerializeCreateSize() override { return sizeof(SerializedAllocation); }
+
+        void SerializeCreate(void* serializePointer) override {
+            memcpy(serializePointer, &mAllocation, sizeof(SerializedAllocation));
+        }
+
+        void* GetData() override { return mService->GetPointer(mAllocation); }
+
+        // The server reads the data from the shared pages so there is nothing to serialize.
+        size_t SizeOfSerializeDataUpdate(size_t offset, size_t size) override { return 0; }
+        void SerializeDataUpdate(void* serializePointer, size_t offset, size_t size) override {}
+
+      private:
+        raw_ptr<ClientTransferService> mService;
+        SerializedAllocation mAllocation;
+    };
+
+    ReadHandle* CreateReadHandle(size_t size) override {
+        std::optional<SerializedAllocation> allocation = Allocate(size);
+        if (!allocation) {
+            return nullptr;
+        }
+        return new ReadHandleImpl(this, *allocation);
+    }
+
+    WriteHandle* CreateWriteHandle(size_t size) override {
+        std::optional<SerializedAllocation> allocation = Allocate(size);
+        if (!allocation) {
+            return nullptr;
+        }
+        // WriteHandle::GetData must return zero-initialized memory.
+        memset(GetPointer(*allocation), 0, allocation->size);
+        return new WriteHandleImpl(this, *allocation);
+    }
+
+  private:
+    uint8_t* GetPointer(const SerializedAllocation& allocation) const {
+        return mRegion->GetData() + allocation.offset;
+    }
+
+    // First-fit allocation in the free ranges of the region.
+    std::optional<SerializedAllocation> Allocate(size_t size) {
+        if (size > mRegion->GetSize()) {
+            return std::nullopt;
+        }
+        uint64_t alignedSize = Align(std::max(size, size_t(1)), kAllocationAlignment);
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        for (auto it = mFreeRanges.begin(); it != mFreeRanges.end(); ++it) {
+            auto [offset, rangeSize] = *it;
+            if (rangeSize < alignedSize) {
+                continue;
+            }
+            mFreeRanges.erase(it);
+            if (rangeSize > alignedSize) {
+                mFreeRanges[offset + alignedSize] = rangeSize - alignedSize;
+            }
+            return SerializedAllocation{offset, size};
+        }
+        return std::nullopt;
+    }
+
+    // Returns the range to the free list, merging it with its neighbors.
+    void Free(const SerializedAllocation& allocation) {
+        uint64_t offset = allocation.offset;
+        uint64_t size = std::min(Align(std::max(allocation.size, uint64_t(1)),
+                                       kAllocationAlignment),
+                                 mRegion->GetSize() - offset);
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto next = mFreeRanges.lower_bound(offset);
+        if (next != mFreeRanges.end() && next->first == offset + size) {
+            size += next->second;
+            next = mFreeRanges.erase(next);
+        }
+        if (next != mFreeRanges.begin()) {
+            auto previous = std::prev(next);
+            if (previous->first + previous->second == offset) {
+                previous->second += size;
+                return;
+            }
+        }
+        mFreeRanges[offset] = size;
+    }
+
+    raw_ptr<SharedMemoryRegion> mRegion;
+    std::mutex mMutex;
+    // Maps the offset of each free range to its size.
+    std::map<uint64_t, uint64_t> mFreeRanges;
+};
+
+class ServerTransferService : public dawn::wire::server::MemoryTransferService {
+  public:
+    explicit ServerTransferService(SharedMemoryRegion* region) : mRegion(region) {}
+    ~ServerTransferService() override = default;
+
+    class ReadHandleImpl : public ReadHandle {
+      public:
+        ReadHandleImpl(uint8_t* data, SerializedAllocation allocation)
+            : mData(data), mAllocation(allocation) {}
+        ~ReadHandleImpl() override = default;
+
+        size_t SizeOfSerializeDataUpdate(size_t offset, size_t size) override { return 0; }
+
+        void SerializeDataUpdate(const void* data,
+                                 size_t offset,
+                                 size_t size,
+                                 void* serializePointer) override {
+            // The wire validated the range against the buffer size, but the allocation may be
+            // smaller if the client is compromised.
+            if (size > 0 && IsRangeInAllocation(mAllocation, offset, size)) {
+                DAWN_ASSERT(data != nullptr);
+                memcpy(mData + offset, data, size);
+            }
+        }
+
+      private:
+        raw_ptr<uint8_t, AllowPtrArithmetic> mData;
+        SerializedAllocation mAllocation;
+    };
+
+    class WriteHandleImpl : public WriteHandle {
+      public:
+        WriteHandleImpl(uint8_t* data, SerializedAllocation allocation)
+            : mData(data), mAllocation(allocation) {}
+        ~WriteHandleImpl() override = default;
+
+        bool DeserializeDataUpdate(const void* deserializePointer,
+                                   size_t deserializeSize,
+                                   size_t offset,
+                                   size_t size) override {
+            if (deserializeSize != 0 || mTargetData == nullptr) {
+                return false;
+            }
+            if (offset > mDataLength || size > mDataLength - offset ||
+                !IsRangeInAllocation(mAllocation, offset, size)) {
+                return false;
+            }
+            memcpy(static_cast<uint8_t*>(mTargetData) + offset, mData + offset, size);
+            return true;
+        }
+
+      private:
+        raw_ptr<uint8_t, AllowPtrArithmetic> mData;
+        SerializedAllocation mAllocation;
+    };
+
+    bool DeserializeReadHandle(const void* deserializePointer,
+                               size_t deserializeSize,
+                               ReadHandle** readHandle) override {
+        DAWN_ASSERT(readHandle != nullptr);
+        SerializedAllocation allocation;
+        if (!DeserializeAllocation(deserializePointer, deserializeSize, &allocation)) {
+            return false;
+        }
+        *readHandle = new ReadHandleImpl(mRegion->GetData() + allocation.offset, allocation);
+        return true;
+    }
+
+    bool DeserializeWriteHandle(const void* deserializePointer,
+                                size_t deserializeSize,
+                                WriteHandle** writeHandle) override {
+        DAWN_ASSERT(writeHandle != nullptr);
+        SerializedAllocation allocation;
+        if (!DeserializeAllocation(deserializePointer, deserializeSize, &allocation)) {
+            return false;
+        }
+        *writeHandle = new WriteHandleImpl(mRegion->GetData() + allocation.offset, allocation);
+        return true;
+    }
+
+  private:
+    bool DeserializeAllocation(const void* deserializePointer,
+                               size_t deserializeSize,
+                               SerializedAllocation* allocation) const {
+        if (deserializeSize != sizeof(SerializedAllocation) || deserializePointer == nullptr) {
+            return false;
+        }
+        memcpy(allocation, deserializePointer, sizeof(SerializedAllocation));
+
+        uint64_t regionSize = mRegion->GetSize();
+        return allocation->offset <= regionSize &&
+               allocation->size <= regionSize - allocation->offset;
+    }
+
+    raw_ptr<SharedMemoryRegion> mRegion;
+};
+
+}  // anonymous namespace
+
+std::unique_ptr<dawn::wire::client::MemoryTransferService>
+CreateSharedMemoryClientTransferService(SharedMemoryRegion* region) {
+    return std::make_unique<ClientTransferService>(region);
+}
+
+std::unique_ptr<dawn::wire::server::MemoryTransferService>
+CreateSharedMemoryServerTransferService(SharedMemoryRegion* region) {
+    return std::make_unique<ServerTransferService>(region);
+}
+
+}  // namespace dawn::utils
@@ -0,0 +1,399 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dawn/utils/SharedMemoryTransport.h"
+
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <climits>
+#include <cstring>
+#include <utility>
+
+#include "dawn/common/Assert.h"
+#include "dawn/common/Math.h"
+
+namespace dawn::utils {
+
+namespace {
+
+constexpr uint32_t kRingMagic = 0x4457524E;  // "DWRN"
+constexpr size_t kRingHeaderSize = 4096;
+
+// Each message starts with its size in bytes, or kWrapMarker if the rest of the ring is unused
+// and the next message starts at offset 0. Messages are padded to kMessageAlignment.
+constexpr size_t kMessageHeaderSize = sizeof(uint64_t);
+constexpr size_t kMessageAlignment = 8;
+constexpr uint64_t kWrapMarker = ~uint64_t(0);
+
+// Number of times a side re-checks the ring before going to sleep on the futex. The other side
+// usually makes progress within a few hundred cycles so this avoids most syscalls.
+constexpr uint32_t kSpinCount = 128;
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free);
+static_assert(std::atomic<uint64_t>::is_always_lock_free);
+
+void FutexWait(std::atomic<uint32_t>* word, uint32_t expected) {
+    // The word is shared between processes so FUTEX_PRIVATE_FLAG must not be used.
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAIT, expected, nullptr, nullptr,
+            0);
+}
+
+void FutexWake(std::atomic<uint32_t>* word) {
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAKE, INT_MAX, nullptr, nullptr,
+            0);
+}
+
+// Waits until |isReady| returns true using |sequence| as the doorbell. |waiting| tells the other
+// side that it needs to ring the doorbell after bumping the sequence.
+template <typename F>
+bool WaitOnDoorbell(std::atomic<uint32_t>* sequence,
+                    std::atomic<uint32_t>* waiting,
+                    const std::atomic<uint32_t>* closed,
+                    F isReady) {
+    for (uint32_t i = 0; i < kSpinCount; ++i) {
+        if (isReady()) {
+            return true;
+        }
+        if (closed->load(std::memory_order_acquire)) {
+            return false;
+        }
+    }
+
+    while (true) {
+        waiting->store(1);
+        uint32_t observed = sequence->load();
+        if (isReady()) {
+            waiting->store(0);
+            return true;
+        }
+        if (closed->load()) {
+            waiting->store(0);
+            return false;
+        }
+        FutexWait(sequence, observed);
+    }
+}
+
+}  // anonymous namespace
+
+// SharedMemoryRegion
+
+// static
+std::unique_ptr<SharedMemoryRegion> SharedMemoryRegion::Create(const char* name, size_t size) {
+    int fd = memfd_create(name, MFD_CLOEXEC);
+    if (fd < 0) {
+        return nullptr;
+    }
+    if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        close(fd);
+        return nullptr;
+    }
+    return Open(fd);
+}
+
+// static
+std::unique_ptr<SharedMemoryRegion> SharedMemoryRegion::Open(int fd) {
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0) {
+        close(fd);
+        return nullptr;
+    }
+    size_t size = static_cast<size_t>(fileStat.st_size);
+
+    void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (data == MAP_FAILED) {
+        close(fd);
+        return nullptr;
+    }
+    return std::unique_ptr<SharedMemoryRegion>(
+        new SharedMemoryRegion(fd, static_cast<uint8_t*>(data), size));
+}
+
+SharedMemoryRegion::SharedMemoryRegion(int fd, uint8_t* data, size_t size)
+    : mFd(fd), mData(data), mSize(size) {}
+
+SharedMemoryRegion::~SharedMemoryRegion() {
+    uint8_t* data = mData.get();
+    mData = nullptr;
+    munmap(data, mSize);
+    close(mFd);
+}
+
+int SharedMemoryRegion::GetFd() const {
+    return mFd;
+}
+
+size_t SharedMemoryRegion::GetSize() const {
+    return mSize;
+}
+
+uint8_t* SharedMemoryRegion::GetData() const {
+    return mData.get();
+}
+
+// SharedMemoryRing
+
+// The producer and consumer fields are on separate cache lines so that publishing on one side
+// doesn't invalidate the line the other side is spinning on.
+struct SharedMemoryRing::Header {
+    uint32_t magic;
+
+    alignas(64) std::atomic<uint64_t> writePosition;
+    std::atomic<uint32_t> writeSequence;
+    std::atomic<uint32_t> consumerWaiting;
+
+    alignas(64) std::atomic<uint64_t> readPosition;
+    std::atomic<uint32_t> readSequence;
+    std::atomic<uint32_t> producerWaiting;
+
+    alignas(64) std::atomic<uint32_t> closed;
+};
+// static
+std::unique_ptr<SharedMemoryRing> SharedMemoryRing::Create(size_t capacity) {
+    static_assert(sizeof(Header) <= kRingHeaderSize);
+    DAWN_ASSERT(IsPowerOfTwo(capacity));
+    auto region = SharedMemoryRegion::Create("dawn_wire_ring", kRingHeaderSize + capacity);
+    if (region == nullptr) {
+        return nullptr;
+    }
+
+    // The memfd is zero-initialized so only the magic needs to be written.
+    Header* header = new (region->GetData()) Header();
+    header->magic = kRingMagic;
+    return std::unique_ptr<SharedMemoryRing>(new SharedMemoryRing(std::move(region)));
+}
+
+// static
+std::unique_ptr<SharedMemoryRing> SharedMemoryRing::Open(int fd) {
+    auto region = SharedMemoryRegion::Open(fd);
+    if (region == nullptr || region->GetSize() <= kRingHeaderSize ||
+        !IsPowerOfTwo(region->GetSize() - kRingHeaderSize)) {
+        return nullptr;
+    }
+    if (reinterpret_cast<Header*>(region->GetData())->magic != kRingMagic) {
+        return nullptr;
+    }
+    return std::unique_ptr<SharedMemoryRing>(new SharedMemoryRing(std::move(region)));
+}
+
+SharedMemoryRing::SharedMemoryRing(std::unique_ptr<SharedMemoryRegion> region)
+    : mRegion(std::move(region)), mCapacity(mRegion->GetSize() - kRingHeaderSize) {}
+
+SharedMemoryRing::~SharedMemoryRing() = default;
+
+SharedMemoryRing::Header* SharedMemoryRing::GetHeader() const {
+    return reinterpret_cast<Header*>(mRegion->GetData());
+}
+
+int SharedMemoryRing::GetFd() const {
+    return mRegion->GetFd();
+}
+
+size_t SharedMemoryRing::GetCapacity() const {
+    return mCapacity;
+}
+
+volatile uint8_t* SharedMemoryRing::GetData() const {
+    return mRegion->GetData() + kRingHeaderSize;
+}
+
+uint64_t SharedMemoryRing::LoadReadPosition() const {
+    return GetHeader()->readPosition.load(std::memory_order_acquire);
+}
+
+void SharedMemoryRing::PublishWrite(uint64_t writePosition) {
+    Header* header = GetHeader();
+    header->writePosition.store(writePosition, std::memory_order_release);
+    header->writeSequence.fetch_add(1);
+    if (header->consumerWaiting.load()) {
+        FutexWake(&header->writeSequence);
+    }
+}
+
+bool SharedMemoryRing::WaitForSpace(uint64_t writePosition, size_t size) {
+    DAWN_ASSERT(size <= mCapacity);
+    Header* header = GetHeader();
+    return WaitOnDoorbell(&header->readSequence, &header->producerWaiting, &header->closed, [&] {
+        return mCapacity - (writePosition - LoadReadPosition()) >= size;
+    });
+}
+
+uint64_t SharedMemoryRing::LoadWritePosition() const {
+    return GetHeader()->writePosition.load(std::memory_order_acquire);
+}
+
+void SharedMemoryRing::PublishRead(uint64_t readPosition) {
+    Header* header = GetHeader();
+    header->readPosition.store(readPosition, std::memory_order_release);
+    header->readSequence.fetch_add(1);
+    if (header->producerWaiting.load()) {
+        FutexWake(&header->readSequence);
+    }
+}
+
+bool SharedMemoryRing::WaitForData(uint64_t readPosition) {
+    Header* header = GetHeader();
+    return WaitOnDoorbell(&header->writeSequence, &header->consumerWaiting, &header->closed,
+                          [&] { return LoadWritePosition() != readPosition; });
+}
+
+void SharedMemoryRing::Close() {
+    Header* header = GetHeader();
+    header->closed.store(1);
+    header->writeSequence.fetch_add(1);
+    header->readSequence.fetch_add(1);
+    FutexWake(&header->writeSequence);
+    FutexWake(&header->readSequence);
+}
+
+bool SharedMemoryRing::IsClosed() const {
+    return GetHeader()->closed.load(std::memory_order_acquire) != 0;
+}
+
+// SharedMemoryCommandSerializer
+
+SharedMemoryCommandSerializer::SharedMemoryCommandSerializer(SharedMemoryRing* ring)
+    : mRing(ring), mWritePosition(ring->LoadWritePosition()) {}
+
+SharedMemoryCommandSerializer::~SharedMemoryCommandSerializer() = default;
+
+size_t SharedMemoryCommandSerializer::GetMaximumAllocationSize() const {
+    // Keep the largest command small enough that it always fits after a wrap.
+    return mRing->GetCapacity() / 2 - kMessageHeaderSize;
+}
+
+void* SharedMemoryCommandSerializer::GetCmdSpace(size_t size) {
+    // Note: This returns non-null even if size is zero.
+    if (size > GetMaximumAllocationSize()) {
+        return nullptr;
+    }
+
+    const size_t capacity = mRing->GetCapacity();
+    size_t offset = mWritePosition & (capacity - 1);
+    if (offset + kMessageHeaderSize + mMessageSize + size > capacity) {
+        // The open message can't grow past the end of the ring. Publish it and start a new one,
+        // at the beginning of the ring if there isn't enough room left at the end.
+        if (!Flush()) {
+            return nullptr;
+        }
+        offset = mWritePosition & (capacity - 1);
+        if (offset + kMessageHeaderSize + size > capacity) {
+            size_t tailSize = capacity - offset;
+            if (!mRing->WaitForSpace(mWritePosition, tailSize)) {
+                return nullptr;
+            }
+            *reinterpret_cast<volatile uint64_t*>(mRing->GetData() + offset) = kWrapMarker;
+            mWritePosition += tailSize;
+            mRing->PublishWrite(mWritePosition);
+            offset = 0;
+        }
+    }
+
+    size_t messageSize = Align(kMessageHeaderSize + mMessageSize + size, kMessageAlignment);
+    if (!mRing->WaitForSpace(mWritePosition, messageSize)) {
+        return nullptr;
+    }
+
+    volatile uint8_t* result = mRing->GetData() + offset + kMessageHeaderSize + mMessageSize;
+    mMessageSize += size;
+    return const_cast<uint8_t*>(result);
+}
+
+bool SharedMemoryCommandSerializer::Flush() {
+    if (mMessageSize == 0) {
+        return !mRing->IsClosed();
+    }
+
+    size_t offset = mWritePosition & (mRing->GetCapacity() - 1);
+    *reinterpret_cast<volatile uint64_t*>(mRing->GetData() + offset) = mMessageSize;
+    mWritePosition += Align(kMessageHeaderSize + mMessageSize, kMessageAlignment);
+    mMessageSize = 0;
+    mRing->PublishWrite(mWritePosition);
+    return !mRing->IsClosed();
+}
+
+bool SharedMemoryCommandSerializer::WaitUntilConsumed() {
+    return mRing->WaitForSpace(mWritePosition, mRing->GetCapacity());
+}
+
+// SharedMemoryCommandReceiver
+
+SharedMemoryCommandReceiver::SharedMemoryCommandReceiver(SharedMemoryRing* ring,
+                                                         dawn::wire::CommandHandler* handler)
+    : mRing(ring), mHandler(handler), mReadPosition(ring->LoadReadPosition()) {}
+
+SharedMemoryCommandReceiver::~SharedMemoryCommandReceiver() = default;
+
+bool SharedMemoryCommandReceiver::ProcessCommands() {
+    const size_t capacity = mRing->GetCapacity();
+    const uint64_t writePosition = mRing->LoadWritePosition();
+
+    while (mReadPosition != writePosition) {
+        // The producer may live in another process so nothing read from the ring is trusted.
+        uint64_t available = writePosition - mReadPosition;
+        if (available > capacity || available < kMessageHeaderSize) {
+            return false;
+        }
+
+        size_t offset = mReadPosition & (capacity - 1);
+        uint64_t messageSize = *reinterpret_cast<volatile uint64_t*>(mRing->GetData() + offset);
+        if (messageSize == kWrapMarker) {
+            if (capacity - offset > available) {
+                return false;
+            }
+            mReadPosition += capacity - offset;
+        } else {
+            if (messageSize > available - kMessageHeaderSize ||
+                messageSize > capacity - offset - kMessageHeaderSize) {
+                return false;
+            }
+
+            const volatile char* commands = reinterpret_cast<const volatile char*>(
+                mRing->GetData() + offset + kMessageHeaderSize);
+            if (mHandler->HandleCommands(commands, static_cast<size_t>(messageSize)) == nullptr) {
+                return false;
+            }
+            mReadPosition += Align(kMessageHeaderSize + messageSize, kMessageAlignment);
+        }
+
+        // Release the space right away so that a blocked producer can continue while the next
+        // messages are decoded.
+        mRing->PublishRead(mReadPosition);
+    }
+    return true;
+}
+
+bool SharedMemoryCommandReceiver::WaitForCommands() {
+    return mRing->WaitForData(mReadPosition);
+}
+
+}  // namespace dawn::utils
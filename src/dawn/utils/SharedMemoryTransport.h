@@ -0,0 +1,157 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_DAWN_UTILS_SHAREDMEMORYTRANSPORT_H_
+#define SRC_DAWN_UTILS_SHAREDMEMORYTRANSPORT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "dawn/wire/Wire.h"
+#include "partition_alloc/pointers/raw_ptr.h"
+
+// A dawn::wire transport for running the client and the server in different processes without
+// copying commands through a pipe. Both ends map the same memfd pages: the client serializes
+// commands directly into a single-producer / single-consumer ring and the server decodes them in
+// place. Futexes on words inside the shared header act as doorbells so an idle side sleeps in the
+// kernel instead of polling. Sharing the file descriptors (with fork or SCM_RIGHTS) is left to the
+// embedder. This is only implemented on Linux.
+
+namespace dawn::utils {
+
+// An anonymous memfd mapping that can be shared with another process through its fd.
+class SharedMemoryRegion {
+  public:
+    // Returns nullptr if the memfd could not be created or mapped.
+    static std::unique_ptr<SharedMemoryRegion> Create(const char* name, size_t size);
+    // Maps a region created by another process. Takes ownership of |fd|.
+    static std::unique_ptr<SharedMemoryRegion> Open(int fd);
+    ~SharedMemoryRegion();
+
+    int GetFd() const;
+    size_t GetSize() const;
+    uint8_t* GetData() const;
+
+  private:
+    SharedMemoryRegion(int fd, uint8_t* data, size_t size);
+
+    int mFd;
+    raw_ptr<uint8_t, AllowPtrArithmetic> mData;
+    size_t mSize;
+};
+
+// A byte ring in shared memory. Positions are monotonically increasing byte counts, the offset in
+// the ring is the position modulo the capacity. The producer only ever advances the write position
+// and the consumer only ever advances the read position.
+class SharedMemoryRing {
+  public:
+    // |capacity| must be a power of two. Returns nullptr on failure.
+    static std::unique_ptr<SharedMemoryRing> Create(size_t capacity);
+    // Maps a ring created by another process. Takes ownership of |fd|. Returns nullptr if the
+    // region isn't a valid ring.
+    static std::unique_ptr<SharedMemoryRing> Open(int fd);
+    ~SharedMemoryRing();
+
+    int GetFd() const;
+    size_t GetCapacity() const;
+    volatile uint8_t* GetData() const;
+
+    // Producer side.
+    uint64_t LoadReadPosition() const;
+    void PublishWrite(uint64_t writePosition);
+    // Blocks until |size| bytes after |writePosition| are free. Returns false if the ring is
+    // closed.
+    bool WaitForSpace(uint64_t writePosition, size_t size);
+
+    // Consumer side.
+    uint64_t LoadWritePosition() const;
+    void PublishRead(uint64_t readPosition);
+    // Blocks until data was published past |readPosition|. Returns false if the ring is closed.
+    bool WaitForData(uint64_t readPosition);
+
+    // Wakes up both sides and makes all the waits fail from now on.
+    void Close();
+    bool IsClosed() const;
+
+  private:
+    struct Header;
+
+    explicit SharedMemoryRing(std::unique_ptr<SharedMemoryRegion> region);
+    Header* GetHeader() const;
+
+    std::unique_ptr<SharedMemoryRegion> mRegion;
+    size_t mCapacity;
+};
+
+// The producer end of a SharedMemoryRing. Commands are appended to an open message that is
+// published to the consumer on Flush, so a message is always contiguous in the ring and the
+// consumer can hand it to a CommandHandler without reassembling it.
+class SharedMemoryCommandSerializer : public dawn::wire::CommandSerializer {
+  public:
+    explicit SharedMemoryCommandSerializer(SharedMemoryRing* ring);
+    ~SharedMemoryCommandSerializer() override;
+
+    size_t GetMaximumAllocationSize() const override;
+
+    void* GetCmdSpace(size_t size) override;
+    bool Flush() override;
+
+    // Blocks until the consumer processed every published message. Returns false if the ring
+    // was closed.
+    bool WaitUntilConsumed();
+
+  private:
+    raw_ptr<SharedMemoryRing> mRing;
+    uint64_t mWritePosition;
+    // Size of the commands in the open message, which starts at mWritePosition.
+    size_t mMessageSize = 0;
+};
+
+// The consumer end of a SharedMemoryRing. Messages are decoded directly from the shared pages.
+class SharedMemoryCommandReceiver {
+  public:
+    SharedMemoryCommandReceiver(SharedMemoryRing* ring, dawn::wire::CommandHandler* handler);
+    ~SharedMemoryCommandReceiver();
+
+    // Hands every message published so far to the handler. Returns false if the handler failed
+    // or the ring contents are malformed.
+    bool ProcessCommands();
+
+    // Blocks until the producer publishes more commands. Returns false if the ring is closed.
+    bool WaitForCommands();
+
+  private:
+    raw_ptr<SharedMemoryRing> mRing;
+    // TODO(https://crbug/dawn/2343): Remove DanglingUntriaged.
+    raw_ptr<dawn::wire::CommandHandler, DanglingUntriaged> mHandler;
+    uint64_t mReadPosition;
+};
+
+}  // namespace dawn::utils
+
+#endif  // SRC_DAWN_UTILS_SHAREDMEMORYTRANSPORT_H_
@@ -27,15 +27,24 @@
 
 #include "dawn/wire/server/Server.h"
 #include "dawn/wire/WireServer.h"
+#include "dawn/wire/server/ServerCommandDecoder.h"
 
 namespace dawn::wire::server {
 
+namespace {
+
+// The number of commands the decoder thread can get ahead of execution.
+constexpr size_t kDecodedCommandQueueSize = 256;
+
+}  // anonymous namespace
+
 CallbackUserdata::CallbackUserdata(Server* server, const std::shared_ptr<bool>& serverIsAlive)
     : server(server), serverIsAlive(serverIsAlive) {}
 
 Server::Server(const DawnProcTable& procs,
                CommandSerializer* serializer,
-               MemoryTransferService* memoryTransferService)
+               MemoryTransferService* memoryTransferService,
+               bool useCommandDecoderThread)
     : mSerializer(serializer),
       mProcs(procs),
       mMemoryTransferService(memoryTransferService),
@@ -45,9 +54,15 @@ Server::Server(const DawnProcTable& procs,
         mOwnedMemoryTransferService = CreateInlineMemoryTransferService();
         mMemoryTransferService = mOwnedMemoryTransferService.get();
     }
+    if (useCommandDecoderThread) {
+        mCommandDecoder = std::make_unique<ServerCommandDecoder>(this, kDecodedCommandQueueSize);
+    }
 }
 
 Server::~Server() {
+    // The decoder thread is idle outside of HandleCommands. Stop it before anything else.
+    mCommandDecoder = nullptr;
+
     // Un-set the error and lost callbacks since we cannot forward them
     // after the server has been destroyed.
     for (WGPUDevice device : DeviceObjects().GetAllHandles()) {
@@ -157,6 +172,13 @@ bool Server::IsDeviceKnown(WGPUDevice device) const {
     return DeviceObjects().IsKnown(device);
 }
 
+WireResult Server::ProcessInstanceEvents() {
+    for (auto instance : InstanceObjects().GetAllHandles()) {
+        WIRE_TRY(DoInstanceProcessEvents(instance));
+    }
+    return WireResult::Success;
+}
+
 void Server::SetForwardingDeviceCallbacks(Known<WGPUDevice> device) {
     // Note: these callbacks are manually inlined here since they do not acquire and
     // free their userdata. Also unlike other callbacks, these are cleared and unset when
@@ -40,6 +40,7 @@ namespace dawn::wire::server {
 
 class Server;
 class MemoryTransferService;
+class ServerCommandDecoder;
 
 // CallbackUserdata and its derived classes are intended to be created by
 // Server::MakeUserdata<T> and then passed as the userdata argument for Dawn
@@ -166,7 +167,8 @@ class Server : public ServerBase {
   public:
     Server(const DawnProcTable& procs,
            CommandSerializer* serializer,
-           MemoryTransferService* memoryTransferService);
+           MemoryTransferService* memoryTransferService,
+           bool useCommandDecoderThread = false);
     ~Server() override;
 
     // ChunkedCommandHandler implementation
@@ -198,6 +200,19 @@ class Server : public ServerBase {
     }
 
   private:
+    friend class ServerCommandDecoder;
+
+    // Implementation of HandleCommandsImpl when commands are decoded on a separate thread.
+    const volatile char* HandleCommandsPipelined(const volatile char* commands, size_t size);
+    // Called on the decoder thread to decode a batch of commands into the decoder's queue.
+    void DecodeCommands(const volatile char* commands, size_t size);
+    WireResult DecodeCommand(WireCmd cmdId,
+                             DeserializeBuffer* deserializeBuffer,
+                             DecodedCommand* decoded);
+    WireResult ExecuteCommand(DecodedCommand* decoded);
+
+    WireResult ProcessInstanceEvents();
+
     template <typename Cmd>
     void SerializeCommand(const Cmd& cmd) {
         mSerializer->SerializeCommand(cmd);
@@ -249,6 +264,9 @@ class Server : public ServerBase {
     raw_ptr<MemoryTransferService> mMemoryTransferService = nullptr;
 
     std::shared_ptr<bool> mIsAlive;
+
+    // Only set if commands are decoded on a separate thread.
+    std::unique_ptr<ServerCommandDecoder> mCommandDecoder;
 };
 
 std::unique_ptr<MemoryTransferService> CreateInlineMemoryTransferService();
@@ -0,0 +1,187 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dawn/wire/server/ServerCommandDecoder.h"
+
+#include "dawn/wire/server/Server.h"
+
+namespace dawn::wire::server {
+
+ServerCommandDecoder::ServerCommandDecoder(Server* server, size_t queueSize)
+    : mServer(server), mQueue(queueSize), mThread([this] { ThreadLoop(); }) {}
+
+ServerCommandDecoder::~ServerCommandDecoder() {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mIsStopping = true;
+    }
+    mCondition.notify_one();
+    mThread.join();
+}
+
+void ServerCommandDecoder::BeginBatch(const volatile char* commands, size_t size) {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        DAWN_ASSERT(!mHasBatch);
+        mBatchCommands = commands;
+        mBatchSize = size;
+        mHasBatch = true;
+        mBatchAborted = false;
+    }
+    mCondition.notify_one();
+}
+
+void ServerCommandDecoder::AbortBatch() {
+    mBatchAborted = true;
+}
+
+bool ServerCommandDecoder::IsBatchAborted() const {
+    return mBatchAborted.load(std::memory_order_relaxed);
+}
+
+SPSCQueue<DecodedCommandEntry>* ServerCommandDecoder::GetQueue() {
+    return &mQueue;
+}
+
+void ServerCommandDecoder::ThreadLoop() {
+    while (true) {
+        const volatile char* commands;
+        size_t size;
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mCondition.wait(lock, [this] { return mHasBatch || mIsStopping; });
+            if (mIsStopping) {
+                return;
+            }
+            commands = mBatchCommands;
+            size = mBatchSize;
+            mBatchCommands = nullptr;
+            mHasBatch = false;
+        }
+        mServer->DecodeCommands(commands, size);
+    }
+}
+
+// Server methods used when commands are decoded on a separate thread. They mirror the loop of
+// the generated Server::HandleCommandsImpl.
+
+void Server::DecodeCommands(const volatile char* commands, size_t size) {
+    SPSCQueue<DecodedCommandEntry>* queue = mCommandDecoder->GetQueue();
+    DeserializeBuffer deserializeBuffer(commands, size);
+
+    DecodeBatchResult result = DecodeBatchResult::Success;
+    while (deserializeBuffer.AvailableSize() >= sizeof(CmdHeader) + sizeof(WireCmd)) {
+        if (mCommandDecoder->IsBatchAborted()) {
+            result = DecodeBatchResult::Error;
+            break;
+        }
+
+        // The chunked command state is only used by the decoder thread while a batch is in
+        // flight, and by the executing thread outside of HandleCommandsPipelined.
+        ChunkedCommandsResult chunkedResult =
+            HandleChunkedCommands(deserializeBuffer.Buffer(), deserializeBuffer.AvailableSize());
+        if (chunkedResult == ChunkedCommandsResult::Consumed) {
+            result = DecodeBatchResult::ChunkedCommandConsumed;
+            break;
+        }
+        if (chunkedResult == ChunkedCommandsResult::Error) {
+            result = DecodeBatchResult::Error;
+            break;
+        }
+
+        WireCmd cmdId = *static_cast<const volatile WireCmd*>(static_cast<const volatile void*>(
+            deserializeBuffer.Buffer() + sizeof(CmdHeader)));
+
+        DecodedCommandEntry* entry = queue->BeginPush();
+        entry->isEndOfBatch = false;
+        if (DecodeCommand(cmdId, &deserializeBuffer, &entry->command) != WireResult::Success) {
+            // The entry isn't pushed and gets reused for the end of batch below.
+            entry->command.allocator.Reset();
+            entry->command.objects.clear();
+            result = DecodeBatchResult::Error;
+            break;
+        }
+        queue->EndPush();
+    }
+
+    if (result == DecodeBatchResult::Success && deserializeBuffer.AvailableSize() != 0) {
+        result = DecodeBatchResult::Error;
+    }
+
+    DecodedCommandEntry* endOfBatch = queue->BeginPush();
+    endOfBatch->isEndOfBatch = true;
+    endOfBatch->result = result;
+    queue->EndPush();
+}
+
+const volatile char* Server::HandleCommandsPipelined(const volatile char* commands, size_t size) {
+    SPSCQueue<DecodedCommandEntry>* queue = mCommandDecoder->GetQueue();
+    mCommandDecoder->BeginBatch(commands, size);
+
+    // Execute the commands as the decoder thread produces them. After an error the rest of the
+    // batch is still drained so that the decoder thread is done with |commands| when returning.
+    bool executionSucceeded = true;
+    DecodeBatchResult result = DecodeBatchResult::Success;
+    while (true) {
+        DecodedCommandEntry* entry = queue->Front();
+        if (entry->isEndOfBatch) {
+            result = entry->result;
+            queue->Pop();
+            break;
+        }
+
+        if (executionSucceeded && ExecuteCommand(&entry->command) != WireResult::Success) {
+            executionSucceeded = false;
+            mCommandDecoder->AbortBatch();
+        }
+        entry->command.allocator.Reset();
+        entry->command.objects.clear();
+        queue->Pop();
+    }
+
+    if (!executionSucceeded) {
+        return nullptr;
+    }
+    switch (result) {
+        case DecodeBatchResult::ChunkedCommandConsumed:
+            return commands + size;
+        case DecodeBatchResult::Error:
+            return nullptr;
+        case DecodeBatchResult::Success:
+            break;
+    }
+
+    // After the server handles all the commands from the stream, we additionally run
+    // ProcessEvents on all known Instances so that any work done on the server side can be
+    // forwarded through to the client.
+    if (ProcessInstanceEvents() != WireResult::Success) {
+        return nullptr;
+    }
+    return commands;
+}
+
+}  // namespace dawn::wire::server
@@ -0,0 +1,102 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_DAWN_WIRE_SERVER_SERVERCOMMANDDECODER_H_
+#define SRC_DAWN_WIRE_SERVER_SERVERCOMMANDDECODER_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "dawn/common/SPSCQueue.h"
+#include "dawn/wire/server/ServerBase_autogen.h"
+#include "partition_alloc/pointers/raw_ptr.h"
+
+namespace dawn::wire::server {
+
+class Server;
+
+// How the decoder thread finished decoding a batch of commands.
+enum class DecodeBatchResult {
+    Success,
+    // The batch ended with the start of a chunked command that later batches will complete.
+    ChunkedCommandConsumed,
+    Error,
+};
+
+// An element of the queue between the decoder thread and the thread executing the commands.
+struct DecodedCommandEntry {
+    DecodedCommand command;
+    // The last entry of each batch doesn't hold a command, only the result of decoding the batch.
+    bool isEndOfBatch = false;
+    DecodeBatchResult result = DecodeBatchResult::Success;
+};
+
+// ServerCommandDecoder deserializes the commands passed to WireServer::HandleCommands on a
+// dedicated thread, so that decoding a command overlaps with the execution of the previous ones
+// on the thread calling HandleCommands. Objects referenced by the commands are only looked up
+// right before execution (see DeferredObjectIdResolver) so the decoder never has to wait for
+// commands to be executed, and objects are still created and used in command order.
+class ServerCommandDecoder {
+  public:
+    ServerCommandDecoder(Server* server, size_t queueSize);
+    ~ServerCommandDecoder();
+
+    // Called on the executing thread to start decoding a batch. |commands| must stay valid until
+    // the end of batch entry has been popped from the queue.
+    void BeginBatch(const volatile char* commands, size_t size);
+
+    // Called on the executing thread when a command failed to execute so that the decoder thread
+    // can skip the rest of the batch.
+    void AbortBatch();
+
+    // Called on the decoder thread.
+    bool IsBatchAborted() const;
+
+    SPSCQueue<DecodedCommandEntry>* GetQueue();
+
+  private:
+    void ThreadLoop();
+
+    raw_ptr<Server> mServer;
+    SPSCQueue<DecodedCommandEntry> mQueue;
+    std::atomic<bool> mBatchAborted = false;
+
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    raw_ptr<const volatile char, AllowPtrArithmetic> mBatchCommands = nullptr;
+    size_t mBatchSize = 0;
+    bool mHasBatch = false;
+    bool mIsStopping = false;
+
+    std::thread mThread;
+};
+
+}  // namespace dawn::wire::server
+
+#endif  // SRC_DAWN_WIRE_SERVER_SERVERCOMMANDDECODER_H_
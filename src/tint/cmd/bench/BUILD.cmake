@@ -46,14 +46,17 @@ tint_target_add_dependencies(tint_cmd_bench_bench_cmd bench_cmd
   tint_cmd_bench_bench
   tint_lang_core
   tint_lang_core_constant
+  tint_lang_core_constant_bench
   tint_lang_core_type
   tint_lang_core_bench
   tint_lang_wgsl
   tint_lang_wgsl_ast
+  tint_lang_wgsl_ast_transform_bench
   tint_lang_wgsl_program
   tint_lang_wgsl_sem
   tint_lang_wgsl_bench
   tint_utils_containers
+  tint_utils_containers_bench
   tint_utils_diagnostic
   tint_utils_ice
   tint_utils_id
@@ -65,6 +68,7 @@ tint_target_add_dependencies(tint_cmd_bench_bench_cmd bench_cmd
   tint_utils_rtti
   tint_utils_rtti_bench
   tint_utils_symbol
+  tint_utils_symbol_bench
   tint_utils_text
   tint_utils_traits
 )
@@ -85,6 +89,12 @@ if(TINT_BUILD_HLSL_WRITER)
   )
 endif(TINT_BUILD_HLSL_WRITER)
 
+if(TINT_BUILD_IR_BINARY)
+  tint_target_add_dependencies(tint_cmd_bench_bench_cmd bench_cmd
+    tint_lang_core_ir_binary_bench
+  )
+endif(TINT_BUILD_IR_BINARY)
+
 if(TINT_BUILD_MSL_WRITER)
   tint_target_add_dependencies(tint_cmd_bench_bench_cmd bench_cmd
     tint_lang_msl_writer_bench
@@ -100,6 +110,7 @@ endif(TINT_BUILD_SPV_WRITER)
 if(TINT_BUILD_WGSL_READER)
   tint_target_add_dependencies(tint_cmd_bench_bench_cmd bench_cmd
     tint_lang_wgsl_reader_bench
+    tint_lang_wgsl_resolver_bench
   )
 endif(TINT_BUILD_WGSL_READER)
 
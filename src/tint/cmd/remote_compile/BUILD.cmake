@@ -34,6 +34,8 @@
 #                       Do not modify this file directly
 ################################################################################
 
+include(cmd/remote_compile/service/BUILD.cmake)
+
 ################################################################################
 # Target:    tint_cmd_remote_compile_cmd
 # Kind:      cmd
@@ -43,6 +45,7 @@ tint_add_target(tint_cmd_remote_compile_cmd cmd
 )
 
 tint_target_add_dependencies(tint_cmd_remote_compile_cmd cmd
+  tint_cmd_remote_compile_service
   tint_lang_wgsl_ast
   tint_utils_macros
   tint_utils_socket
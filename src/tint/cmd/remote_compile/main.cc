@@ -29,17 +29,21 @@
 #include <stdlib.h>
 #include <fstream>
 #include <iostream>
+#include <memory>
+#include <optional>
 #include <regex>
 #include <sstream>
 #include <string>
 #include <thread>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #if TINT_BUILD_MSL_WRITER
 #include "src/tint/lang/msl/validate/validate.h"
 #endif
 
+#include "src/tint/cmd/remote_compile/service/compile_service.h"
 #include "src/tint/utils/macros/compiler.h"
 #include "src/tint/utils/socket/socket.h"
 
@@ -59,22 +63,32 @@ struct CompileResult {
     printf(R"(%s is a tool for compiling a shader on a remote machine
 
 usage as server:
-  %s -s [-p port-number]
+  %s -s [-p port-number | --socket path] [-j jobs] [--cache-dir dir]
+
+  -j, --jobs        number of shaders compiled concurrently. Defaults to the
+                    number of hardware threads.
+  --cache-dir       directory used to cache the compiled WGSL shaders on disk.
 
 usage as client:
   %s [-p port-number] [server-address] shader-file-path
+  %s [-p port-number] [server-address] --target spirv|msl|hlsl|glsl
+     [--entry-point name] [-o output-file] shader.wgsl
+  %s [-p port-number] [server-address] --stats
 
   [server-address] can be omitted if the TINT_REMOTE_COMPILE_ADDRESS environment
-  variable is set.
+  variable is set, or if --socket is used.
+  --socket path     connect to the server through the Unix domain socket at path.
+  --target          compile the WGSL shader with the given backend.
+  --stats           print the counters and latency histograms of the server.
   Alternatively, you can pass xcrun arguments so %s can be used as a
   drop-in replacement.
 )",
-           name, name, name, name);
+           name, name, name, name, name, name);
     exit(1);
 }
 
 /// The protocol version code. Bump each time the protocol changes
-constexpr uint32_t kProtocolVersion = 1;
+constexpr uint32_t kProtocolVersion = 2;
 
 /// Supported shader source languages
 enum SourceLanguage : uint8_t {
@@ -186,6 +200,10 @@ struct Message {
         ConnectionResponse,
         CompileRequest,
         CompileResponse,
+        WgslCompileRequest,
+        WgslCompileResponse,
+        StatsRequest,
+        StatsResponse,
     };
 
     explicit Message(Type ty) : type(ty) {}
@@ -254,6 +272,63 @@ struct CompileRequest : Message {  // Client -> Server
     std::string source;
 };
 
+struct WgslCompileResponse : Message {  //  Server -> Client
+    WgslCompileResponse() : Message(Type::WgslCompileResponse) {}
+
+    template <typename T>
+    void Serialize(T&& f) {
+        f(success);
+        f(output);
+    }
+
+    /// 1 if the shader compiled
+    uint32_t success = 0;
+    /// The generated code, or the compilation errors
+    std::string output;
+};
+
+struct WgslCompileRequest : Message {  // Client -> Server
+    using Response = WgslCompileResponse;
+
+    WgslCompileRequest() : Message(Type::WgslCompileRequest) {}
+    WgslCompileRequest(tint::remote_compile::Backend tgt, std::string ep, std::string src)
+        : Message(Type::WgslCompileRequest),
+          target(tgt),
+          entry_point(std::move(ep)),
+          source(std::move(src)) {}
+
+    template <typename T>
+    void Serialize(T&& f) {
+        f(target);
+        f(entry_point);
+        f(source);
+    }
+
+    tint::remote_compile::Backend target = tint::remote_compile::Backend::kSpirv;
+    std::string entry_point;
+    std::string source;
+};
+
+struct StatsResponse : Message {  //  Server -> Client
+    StatsResponse() : Message(Type::StatsResponse) {}
+
+    template <typename T>
+    void Serialize(T&& f) {
+        f(report);
+    }
+
+    std::string report;
+};
+
+struct StatsRequest : Message {  // Client -> Server
+    using Response = StatsResponse;
+
+    StatsRequest() : Message(Type::StatsRequest) {}
+
+    template <typename T>
+    void Serialize(T&&) {}
+};
+
 /// Writes the message `m` to the stream `s`
 template <typename MESSAGE>
 std::enable_if_t<std::is_base_of<Message, MESSAGE>::value, Stream>& operator<<(Stream& s,
@@ -282,6 +357,13 @@ std::enable_if_t<std::is_base_of<Message, MESSAGE>::value, Stream>& operator>>(S
     return s;
 }
 
+/// Reads the body of the message `m` from the stream `s`, once its type has been read
+template <typename MESSAGE>
+Stream& ReadBody(Stream& s, MESSAGE& m) {
+    m.Serialize([&s](auto& value) { s >> value; });
+    return s;
+}
+
 /// Writes the request message `req` to the stream `s`, then reads and returns
 /// the response message from the same stream.
 template <typename REQUEST, typename RESPONSE = typename REQUEST::Response>
@@ -299,20 +381,52 @@ RESPONSE Send(Stream& s, const REQUEST& req) {
 
 }  // namespace
 
-bool RunServer(std::string port, bool verbose);
-bool RunClient(std::string address,
-               std::string port,
-               std::string file,
-               int version_major,
-               int version_minor,
+/// The options of the client
+struct ClientOptions {
+    /// The address of the server
+    std::string address;
+    /// The TCP port of the server
+    std::string port;
+    /// The path of the Unix domain socket of the server. Takes precedence over the address.
+    std::string socket_path;
+    /// The shader file to compile
+    std::string file;
+    /// The Metal version of an MSL shader
+    int version_major = 0;
+    int version_minor = 0;
+    /// The backend to compile a WGSL shader with, if set
+    std::optional<tint::remote_compile::Backend> target;
+    /// The entry point to compile a WGSL shader for
+    std::string entry_point;
+    /// The file to write the generated code to. Stdout if empty.
+    std::string output_file;
+    /// True to print the statistics of the server instead of compiling a shader
+    bool stats = false;
+    /// True to log progress
+    bool verbose = false;
+};
+
+bool RunServer(std::string port,
+               std::string socket_path,
+               tint::remote_compile::CompileService::Options service_options,
                bool verbose);
+bool RunClient(const ClientOptions& options);
 
 int main(int argc, char* argv[]) {
     bool run_server = false;
-    bool verbose = false;
-    int version_major = 0;
-    int version_minor = 0;
-    std::string port = "19000";
+    ClientOptions client;
+    client.port = "19000";
+    tint::remote_compile::CompileService::Options service_options;
+
+    // Returns the value of the flag at argv[i], advancing i, or exits if there is none.
+    auto flag_value = [&](int& i) -> std::string {
+        if (i < argc - 1) {
+            i++;
+            return argv[i];
+        }
+        printf("expected value for %s\n", argv[i]);
+        exit(1);
+    };
 
     std::regex metal_version_re{"^-?-std=macos-metal([0-9]+)\\.([0-9]+)"};
 
@@ -326,7 +440,7 @@ int main(int argc, char* argv[]) {
         if (arg == "-p" || arg == "--port") {
             if (i < argc - 1) {
                 i++;
-                port = argv[i];
+                client.port = argv[i];
             } else {
                 printf("expected port number");
                 exit(1);
@@ -334,7 +448,47 @@ int main(int argc, char* argv[]) {
             continue;
         }
         if (arg == "-v" || arg == "--verbose") {
-            verbose = true;
+            client.verbose = true;
+            continue;
+        }
+        if (arg == "--socket") {
+            client.socket_path = flag_value(i);
+            continue;
+        }
+        if (arg == "-j" || arg == "--jobs") {
+            service_options.num_workers = static_cast<uint32_t>(std::atoi(flag_value(i).c_str()));
+            continue;
+        }
+        if (arg == "--cache-dir") {
+            service_options.cache_dir = flag_value(i);
+            continue;
+        }
+        if (arg == "--target") {
+            auto target = flag_value(i);
+            if (target == "spirv") {
+                client.target = tint::remote_compile::Backend::kSpirv;
+            } else if (target == "msl") {
+                client.target = tint::remote_compile::Backend::kMsl;
+            } else if (target == "hlsl") {
+                client.target = tint::remote_compile::Backend::kHlsl;
+            } else if (target == "glsl") {
+                client.target = tint::remote_compile::Backend::kGlsl;
+            } else {
+                printf("unknown target '%s'\n", target.c_str());
+                exit(1);
+            }
+            continue;
+        }
+        if (arg == "--entry-point") {
+            client.entry_point = flag_value(i);
+            continue;
+        }
+        if (arg == "-o" || arg == "--output") {
+            client.output_file = flag_value(i);
+            continue;
+        }
+        if (arg == "--stats") {
+            client.stats = true;
             continue;
         }
 
@@ -349,8 +503,8 @@ int main(int argc, char* argv[]) {
                 // metal_version_re
                 std::smatch metal_version_match;
                 if (std::regex_match(arg, metal_version_match, metal_version_re)) {
-                    version_major = std::atoi(metal_version_match[1].str().c_str());
-                    version_minor = std::atoi(metal_version_match[2].str().c_str());
+                    client.version_major = std::atoi(metal_version_match[1].str().c_str());
+                    client.version_minor = std::atoi(metal_version_match[2].str().c_str());
                     continue;
                 }
                 if (arg == "-c") {
@@ -366,31 +520,41 @@ int main(int argc, char* argv[]) {
     bool success = false;
 
     if (run_server) {
-        success = RunServer(port, verbose);
+        success = RunServer(client.port, client.socket_path, service_options, client.verbose);
     } else {
-        std::string address;
-        std::string file;
-        switch (args.size()) {
+        // The address is implied by --socket, and there is no file to compile with --stats.
+        const size_t num_implied_args =
+            (client.socket_path.empty() ? 0 : 1) + (client.stats ? 1 : 0);
+        switch (args.size() + num_implied_args) {
             case 1:
-                TINT_BEGIN_DISABLE_WARNING(DEPRECATED);
-                if (auto* addr = getenv("TINT_REMOTE_COMPILE_ADDRESS")) {
-                    address = addr;
+                if (client.socket_path.empty()) {
+                    TINT_BEGIN_DISABLE_WARNING(DEPRECATED);
+                    if (auto* addr = getenv("TINT_REMOTE_COMPILE_ADDRESS")) {
+                        client.address = addr;
+                    }
+                    TINT_END_DISABLE_WARNING(DEPRECATED);
+                }
+                if (!client.stats && !args.empty()) {
+                    client.file = args[0];
                 }
-                TINT_END_DISABLE_WARNING(DEPRECATED);
-                file = args[0];
                 break;
             case 2:
-                address = args[0];
-                file = args[1];
+                if (client.socket_path.empty()) {
+                    client.address = args[0];
+                }
+                if (!client.stats) {
+                    client.file = args.back();
+                }
                 break;
             default:
                 std::cerr << "Expected 1 or 2 arguments, got " << args.size() << "\n\n";
                 ShowUsage();
         }
-        if (address.empty() || file.empty()) {
+        if ((client.address.empty() && client.socket_path.empty()) ||
+            (client.file.empty() && !client.stats)) {
             ShowUsage();
         }
-        success = RunClient(address, port, file, version_major, version_minor, verbose);
+        success = RunClient(client);
     }
 
     if (!success) {
@@ -400,105 +564,185 @@ int main(int argc, char* argv[]) {
     return 0;
 }
 
-bool RunServer(std::string port, bool verbose) {
-    auto server_socket = tint::socket::Socket::Listen("", port.c_str());
-    if (!server_socket) {
-        std::cout << "Failed to listen on port " << port << "\n";
-        return false;
+namespace {
+
+/// Handles a CompileRequest for an MSL shader
+/// @returns the response to send to the client
+CompileResponse HandleCompile([[maybe_unused]] const CompileRequest& req) {
+    CompileResponse resp;
+#if TINT_BUILD_MSL_WRITER && defined(__APPLE__)
+    if (req.language == SourceLanguage::MSL) {
+        auto version = tint::msl::validate::MslVersion::kMsl_1_2;
+        if (req.version_major == 2 && req.version_minor == 1) {
+            version = tint::msl::validate::MslVersion::kMsl_2_1;
+        }
+        if (req.version_major == 2 && req.version_minor == 3) {
+            version = tint::msl::validate::MslVersion::kMsl_2_3;
+        }
+        auto result = tint::msl::validate::ValidateUsingMetal(req.source, version);
+        if (result.failed) {
+            resp.error = result.output;
+        }
+        return resp;
     }
-    std::cout << "Listening on port " << port.c_str() << "...\n";
-    while (auto conn = server_socket->Accept()) {
-        std::thread([=] {
-            auto tid = std::this_thread::get_id();
+#endif
+    resp.error = "server cannot compile this type of shader";
+    return resp;
+}
+
+/// Serves the requests of a single client until it disconnects
+void ServeConnection(tint::socket::Socket* conn,
+                     tint::remote_compile::CompileService& service,
+                     bool verbose) {
+    auto tid = std::this_thread::get_id();
+    if (verbose) {
+        std::cout << tid << " Client connected...\n";
+    }
+    Stream stream{conn, ""};
+
+    {
+        ConnectionRequest req;
+        stream >> req;
+        if (!stream.error.empty()) {
             if (verbose) {
-                std::cout << tid << " Client connected...\n";
+                std::cout << tid << " Error: " << stream.error << "\n";
             }
-            Stream stream{conn.get(), ""};
-
-            {
-                ConnectionRequest req;
-                stream >> req;
-                if (!stream.error.empty()) {
-                    if (verbose) {
-                        std::cout << tid << " Error: " << stream.error << "\n";
-                    }
-                    return;
+            return;
+        }
+        ConnectionResponse resp;
+        if (req.protocol_version != kProtocolVersion) {
+            if (verbose) {
+                std::cout << tid << " Protocol version mismatch. requested: "
+                          << req.protocol_version << "\n";
+            }
+            resp.error = "Protocol version mismatch";
+            stream << resp;
+            return;
+        }
+        stream << resp;
+    }
+    if (verbose) {
+        std::cout << tid << " Connection established\n";
+    }
+
+    // Clients may send any number of requests over the connection, and are served in order.
+    while (stream.error.empty()) {
+        Message::Type type;
+        stream >> type;
+        if (!stream.error.empty()) {
+            break;  // Client disconnected
+        }
+        switch (type) {
+            case Message::Type::CompileRequest: {
+                CompileRequest req;
+                if (!ReadBody(stream, req).error.empty()) {
+                    break;
                 }
-                ConnectionResponse resp;
-                if (req.protocol_version != kProtocolVersion) {
-                    if (verbose) {
-                        std::cout << tid << " Protocol version mismatch. requested: "
-                                  << req.protocol_version << "\n";
-                    }
-                    resp.error = "Protocol version mismatch";
-                    stream << resp;
-                    return;
+                auto resp = HandleCompile(req);
+                if (verbose) {
+                    std::cout << tid << " Shader compilation "
+                              << (resp.error.empty() ? "passed" : "failed") << "\n";
                 }
                 stream << resp;
+                break;
             }
-            if (verbose) {
-                std::cout << tid << " Connection established\n";
-            }
-            {
-                CompileRequest req;
-                stream >> req;
-                if (!stream.error.empty()) {
-                    if (verbose) {
-                        std::cout << tid << " Error: " << stream.error << "\n";
-                    }
-                    return;
+            case Message::Type::WgslCompileRequest: {
+                WgslCompileRequest req;
+                if (!ReadBody(stream, req).error.empty()) {
+                    break;
                 }
-#if TINT_BUILD_MSL_WRITER && defined(__APPLE__)
-                if (req.language == SourceLanguage::MSL) {
-                    auto version = tint::msl::validate::MslVersion::kMsl_1_2;
-                    if (req.version_major == 2 && req.version_minor == 1) {
-                        version = tint::msl::validate::MslVersion::kMsl_2_1;
-                    }
-                    if (req.version_major == 2 && req.version_minor == 3) {
-                        version = tint::msl::validate::MslVersion::kMsl_2_3;
-                    }
-                    auto result = tint::msl::validate::ValidateUsingMetal(req.source, version);
-                    CompileResponse resp;
-                    if (result.failed) {
-                        resp.error = result.output;
-                    }
-                    stream << resp;
-
-                    if (verbose) {
-                        std::cout << tid << " Shader compilation "
-                                  << (result.failed ? "failed" : "passed") << "\n";
-                    }
-                    return;
+                auto result = service.Compile({req.target, req.entry_point, req.source});
+                if (verbose) {
+                    std::cout << tid << " " << ToString(req.target) << " compilation "
+                              << (result.success ? "passed" : "failed") << "\n";
                 }
-#endif
-                CompileResponse resp;
-                resp.error = "server cannot compile this type of shader";
+                WgslCompileResponse resp;
+                resp.success = result.success ? 1 : 0;
+                resp.output = std::move(result.output);
                 stream << resp;
+                break;
+            }
+            case Message::Type::StatsRequest: {
+                StatsRequest req;
+                if (!ReadBody(stream, req).error.empty()) {
+                    break;
+                }
+                StatsResponse resp;
+                resp.report = service.Report();
+                stream << resp;
+                break;
             }
-        }).detach();
+            default:
+                stream.error = "unexpected message type " + std::to_string(uint32_t(type));
+                break;
+        }
+    }
+    if (verbose) {
+        std::cout << tid << " Connection closed: " << stream.error << "\n";
     }
-    return true;
 }
 
-bool RunClient(std::string address,
-               std::string port,
-               std::string file,
-               int version_major,
-               int version_minor,
+}  // namespace
+
+bool RunServer(std::string port,
+               std::string socket_path,
+               tint::remote_compile::CompileService::Options service_options,
                bool verbose) {
+    std::shared_ptr<tint::socket::Socket> server_socket;
+    if (!socket_path.empty()) {
+        server_socket = tint::socket::Socket::ListenUnix(socket_path.c_str());
+        if (!server_socket) {
+            std::cout << "Failed to listen on socket " << socket_path << "\n";
+            return false;
+        }
+        std::cout << "Listening on socket " << socket_path << "...\n";
+    } else {
+        server_socket = tint::socket::Socket::Listen("", port.c_str());
+        if (!server_socket) {
+            std::cout << "Failed to listen on port " << port << "\n";
+            return false;
+        }
+        std::cout << "Listening on port " << port.c_str() << "...\n";
+    }
+
+    // Shared by all the connections, so that identical shaders requested by different clients
+    // are compiled once.
+    auto service = std::make_shared<tint::remote_compile::CompileService>(service_options);
+    while (auto conn = server_socket->Accept()) {
+        std::thread([=] { ServeConnection(conn.get(), *service, verbose); }).detach();
+    }
+    return true;
+}
+
+bool RunClient(const ClientOptions& options) {
+    const bool verbose = options.verbose;
+
     // Read the file
-    std::ifstream input(file, std::ios::binary);
-    if (!input) {
-        std::cerr << "Couldn't open '" << file << "'\n";
-        return false;
+    std::string source;
+    if (!options.stats) {
+        std::ifstream input(options.file, std::ios::binary);
+        if (!input) {
+            std::cerr << "Couldn't open '" << options.file << "'\n";
+            return false;
+        }
+        source = std::string((std::istreambuf_iterator<char>(input)),
+                             std::istreambuf_iterator<char>());
     }
-    std::string source((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
 
-    constexpr const int timeout_ms = 100'000;
-    if (verbose) {
-        std::cout << "Connecting to " << address << ":" << port << "\n";
+    std::shared_ptr<tint::socket::Socket> conn;
+    if (!options.socket_path.empty()) {
+        if (verbose) {
+            std::cout << "Connecting to " << options.socket_path << "\n";
+        }
+        conn = tint::socket::Socket::ConnectUnix(options.socket_path.c_str());
+    } else {
+        constexpr const int timeout_ms = 100'000;
+        if (verbose) {
+            std::cout << "Connecting to " << options.address << ":" << options.port << "\n";
+        }
+        conn = tint::socket::Socket::Connect(options.address.c_str(), options.port.c_str(),
+                                             timeout_ms);
     }
-    auto conn = tint::socket::Socket::Connect(address.c_str(), port.c_str(), timeout_ms);
     if (!conn) {
         std::cerr << "Connection failed\n";
         return false;
@@ -518,11 +762,50 @@ bool RunClient(std::string address,
         std::cerr << conn_resp.error << "\n";
         return false;
     }
+
+    if (options.stats) {
+        auto stats_resp = Send(stream, StatsRequest{});
+        if (!stream.error.empty()) {
+            std::cerr << stream.error << "\n";
+            return false;
+        }
+        std::cout << stats_resp.report;
+        return true;
+    }
+
+    if (options.target) {
+        if (verbose) {
+            std::cout << "Connection established. Requesting " << ToString(*options.target)
+                      << " compile...\n";
+        }
+        auto comp_resp =
+            Send(stream, WgslCompileRequest{*options.target, options.entry_point, source});
+        if (!stream.error.empty()) {
+            std::cerr << stream.error << "\n";
+            return false;
+        }
+        if (!comp_resp.success) {
+            std::cerr << comp_resp.output << "\n";
+            return false;
+        }
+        if (options.output_file.empty()) {
+            std::cout << comp_resp.output;
+        } else {
+            std::ofstream output(options.output_file, std::ios::binary);
+            if (!output.write(comp_resp.output.data(),
+                              static_cast<std::streamsize>(comp_resp.output.size()))) {
+                std::cerr << "Couldn't write '" << options.output_file << "'\n";
+                return false;
+            }
+        }
+        return true;
+    }
+
     if (verbose) {
         std::cout << "Connection established. Requesting compile...\n";
     }
-    auto comp_resp =
-        Send(stream, CompileRequest{SourceLanguage::MSL, version_major, version_minor, source});
+    auto comp_resp = Send(stream, CompileRequest{SourceLanguage::MSL, options.version_major,
+                                                 options.version_minor, source});
     if (!stream.error.empty()) {
         std::cerr << stream.error << "\n";
         return false;
@@ -0,0 +1,509 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/cmd/remote_compile/service/compile_service.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <utility>
+
+#if TINT_BUILD_WGSL_READER
+#include "src/tint/lang/wgsl/reader/reader.h"
+#include "src/tint/utils/diagnostic/source.h"
+#endif
+
+#if TINT_BUILD_SPV_WRITER
+#include "src/tint/lang/spirv/writer/helpers/ast_generate_bindings.h"
+#include "src/tint/lang/spirv/writer/writer.h"
+#endif
+
+#if TINT_BUILD_MSL_WRITER
+#include "src/tint/lang/msl/writer/helpers/generate_bindings.h"
+#include "src/tint/lang/msl/writer/writer.h"
+#include "src/tint/lang/wgsl/helpers/flatten_bindings.h"
+#endif
+
+#if TINT_BUILD_HLSL_WRITER
+#include "src/tint/lang/hlsl/writer/helpers/generate_bindings.h"
+#include "src/tint/lang/hlsl/writer/writer.h"
+#endif
+
+#if TINT_BUILD_GLSL_WRITER
+#include "src/tint/lang/glsl/writer/writer.h"
+#endif
+
+namespace tint::remote_compile {
+namespace {
+
+/// The magic string at the start of each disk cache file. Bump the version when the format of
+/// the file or the generated code changes in an incompatible way.
+constexpr char kDiskCacheMagic[] = "tint-remote-compile-cache-v1";
+
+/// @returns the key used to look up the result of @p compilation in the caches
+std::string CacheKey(const Compilation& compilation) {
+    std::string key;
+    key.reserve(compilation.entry_point.size() + compilation.wgsl.size() + 8);
+    key += ToString(compilation.backend);
+    key += '\0';
+    key += compilation.entry_point;
+    key += '\0';
+    key += compilation.wgsl;
+    return key;
+}
+
+/// @returns the 64-bit FNV-1a hash of @p data
+uint64_t Fnv1a64(const std::string& data) {
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (char c : data) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+/// @returns the index of the histogram bucket holding @p value
+size_t BucketIndex(uint64_t value) {
+    size_t index = 0;
+    while (value != 0 && index < Histogram::kNumBuckets - 1) {
+        value >>= 1;
+        index++;
+    }
+    return index;
+}
+
+/// @returns the exclusive upper bound of the values held by the bucket @p index
+uint64_t BucketUpperBound(size_t index) {
+    return uint64_t{1} << index;
+}
+
+/// Writes a 64-bit size to @p out
+void WriteSize(std::ostream& out, uint64_t size) {
+    for (int i = 0; i < 8; i++) {
+        out.put(static_cast<char>(size >> (i * 8)));
+    }
+}
+
+/// Reads a 64-bit size from @p in
+bool ReadSize(std::istream& in, uint64_t* size) {
+    *size = 0;
+    for (int i = 0; i < 8; i++) {
+        int c = in.get();
+        if (c == std::char_traits<char>::eof()) {
+            return false;
+        }
+        *size |= static_cast<uint64_t>(static_cast<uint8_t>(c)) << (i * 8);
+    }
+    return true;
+}
+
+/// Reads a string of @p size bytes from @p in
+bool ReadString(std::istream& in, uint64_t size, std::string* out) {
+    out->resize(size);
+    return size == 0 || static_cast<bool>(in.read(out->data(), static_cast<std::streamsize>(size)));
+}
+
+/// @returns the elapsed time in microseconds since @p start
+uint64_t MicrosecondsSince(std::chrono::steady_clock::time_point start) {
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+}
+
+}  // namespace
+
+const char* ToString(Backend backend) {
+    switch (backend) {
+        case Backend::kSpirv:
+            return "spirv";
+        case Backend::kMsl:
+            return "msl";
+        case Backend::kHlsl:
+            return "hlsl";
+        case Backend::kGlsl:
+            return "glsl";
+    }
+    return "<unknown>";
+}
+
+void Histogram::Add(uint64_t value) {
+    buckets_[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64_t Histogram::Count() const {
+    return count_.load(std::memory_order_relaxed);
+}
+
+uint64_t Histogram::Percentile(double percentile) const {
+    uint64_t count = Count();
+    if (count == 0) {
+        return 0;
+    }
+    double clamped = std::clamp(percentile, 0.0, 100.0);
+    uint64_t rank = std::max<uint64_t>(
+        1, static_cast<uint64_t>(static_cast<double>(count) * clamped / 100.0 + 0.5));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < kNumBuckets; i++) {
+        seen += buckets_[i].load(std::memory_order_relaxed);
+        if (seen >= rank) {
+            return BucketUpperBound(i);
+        }
+    }
+    return BucketUpperBound(kNumBuckets - 1);
+}
+
+std::string Histogram::ToString(const char* unit) const {
+    std::stringstream out;
+    out << "count: " << Count() << ", p50 < " << Percentile(50) << unit << ", p90 < "
+        << Percentile(90) << unit << ", p99 < " << Percentile(99) << unit << "\n";
+    for (size_t i = 0; i < kNumBuckets; i++) {
+        uint64_t n = buckets_[i].load(std::memory_order_relaxed);
+        if (n != 0) {
+            out << "  < " << BucketUpperBound(i) << unit << ": " << n << "\n";
+        }
+    }
+    return out.str();
+}
+
+CompileService::CompileService(Options options)
+    : options_(std::move(options)), start_time_(std::chrono::steady_clock::now()) {
+    uint32_t num_workers = options_.num_workers;
+    if (num_workers == 0) {
+        num_workers = std::max(1u, std::thread::hardware_concurrency());
+    }
+    workers_.reserve(num_workers);
+    for (uint32_t i = 0; i < num_workers; i++) {
+        workers_.emplace_back([this] { WorkerLoop(); });
+    }
+}
+
+CompileService::~CompileService() {
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        stopping_ = true;
+    }
+    queue_cv_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+CompilationResult CompileService::Compile(const Compilation& compilation) {
+    auto start = std::chrono::steady_clock::now();
+    std::string key = CacheKey(compilation);
+
+    std::shared_future<CompilationResult> result;
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex_);
+        stats_.requests++;
+        stats_.input_bytes += compilation.wgsl.size();
+
+        auto it = cache_.find(key);
+        if (it != cache_.end()) {
+            Entry& entry = it->second;
+            if (entry.ready) {
+                stats_.memory_cache_hits++;
+                lru_.splice(lru_.begin(), lru_, entry.lru);
+            } else {
+                stats_.deduplicated++;
+            }
+            result = entry.result;
+        } else {
+            auto promise = std::make_shared<std::promise<CompilationResult>>();
+            Entry& entry = cache_[key];
+            entry.result = promise->get_future().share();
+            result = entry.result;
+
+            {
+                std::lock_guard<std::mutex> queue_lock(queue_mutex_);
+                queue_.emplace_back([this, key, compilation, promise] {
+                    promise->set_value(Run(key, compilation));
+                });
+            }
+            queue_cv_.notify_one();
+        }
+    }
+
+    CompilationResult out = result.get();
+    request_latency_.Add(MicrosecondsSince(start));
+    return out;
+}
+
+void CompileService::WorkerLoop() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex_);
+            queue_cv_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+            if (queue_.empty()) {
+                return;
+            }
+            task = std::move(queue_.front());
+            queue_.pop_front();
+        }
+        task();
+    }
+}
+
+CompilationResult CompileService::Run(const std::string& key, const Compilation& compilation) {
+    CompilationResult result;
+    bool from_disk = LoadFromDisk(key, &result);
+    if (!from_disk) {
+        auto start = std::chrono::steady_clock::now();
+        result = options_.compile ? options_.compile(compilation) : CompileWithTint(compilation);
+        compile_latency_.Add(MicrosecondsSince(start));
+        StoreToDisk(key, result);
+    }
+
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    if (from_disk) {
+        stats_.disk_cache_hits++;
+    } else {
+        stats_.compilations++;
+        if (!result.success) {
+            stats_.failures++;
+        }
+    }
+
+    Entry& entry = cache_[key];
+    entry.ready = true;
+    entry.size = key.size() + result.output.size();
+    entry.lru = lru_.insert(lru_.begin(), key);
+    cached_bytes_ += entry.size;
+
+    // Evict the least recently used entries, keeping at least the one just added so that the
+    // requests waiting on it can still be served.
+    while (cached_bytes_ > options_.memory_cache_bytes && lru_.size() > 1) {
+        auto evicted = cache_.find(lru_.back());
+        cached_bytes_ -= evicted->second.size;
+        cache_.erase(evicted);
+        lru_.pop_back();
+    }
+    return result;
+}
+
+std::string CompileService::DiskCachePath(const std::string& key) const {
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.bin", static_cast<unsigned long long>(Fnv1a64(key)));
+    std::string path = options_.cache_dir;
+    if (path.back() != '/' && path.back() != '\\') {
+        path += '/';
+    }
+    return path + name;
+}
+
+bool CompileService::LoadFromDisk(const std::string& key, CompilationResult* result) const {
+    if (options_.cache_dir.empty()) {
+        return false;
+    }
+    std::ifstream in(DiskCachePath(key), std::ios::binary);
+    if (!in) {
+        return false;
+    }
+
+    std::string magic;
+    uint64_t key_size = 0;
+    std::string stored_key;
+    int success = 0;
+    uint64_t output_size = 0;
+    if (!ReadString(in, sizeof(kDiskCacheMagic), &magic) ||
+        magic != std::string(kDiskCacheMagic, sizeof(kDiskCacheMagic)) ||
+        !ReadSize(in, &key_size) || key_size != key.size() ||
+        !ReadString(in, key_size, &stored_key) || stored_key != key) {
+        // A different module with the same hash, or a file from another version.
+        return false;
+    }
+    success = in.get();
+    if ((success != 0 && success != 1) || !ReadSize(in, &output_size) ||
+        !ReadString(in, output_size, &result->output)) {
+        return false;
+    }
+    result->success = success == 1;
+    return true;
+}
+
+void CompileService::StoreToDisk(const std::string& key, const CompilationResult& result) const {
+    if (options_.cache_dir.empty()) {
+        return;
+    }
+    // Write to a temporary file then rename it, so that concurrent readers, possibly from other
+    // processes sharing the cache directory, never observe a partially written file.
+    std::string path = DiskCachePath(key);
+    std::stringstream tmp_name;
+    tmp_name << path << ".tmp." << std::this_thread::get_id();
+    std::string tmp_path = tmp_name.str();
+    {
+        std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            return;
+        }
+        out.write(kDiskCacheMagic, sizeof(kDiskCacheMagic));
+        WriteSize(out, key.size());
+        out.write(key.data(), static_cast<std::streamsize>(key.size()));
+        out.put(result.success ? 1 : 0);
+        WriteSize(out, result.output.size());
+        out.write(result.output.data(), static_cast<std::streamsize>(result.output.size()));
+        if (!out) {
+            out.close();
+            std::remove(tmp_path.c_str());
+            return;
+        }
+    }
+    std::remove(path.c_str());
+    if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+        std::remove(tmp_path.c_str());
+    }
+}
+
+CompileService::Stats CompileService::GetStats() const {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    Stats stats = stats_;
+    stats.uptime_seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time_).count();
+    return stats;
+}
+
+std::string CompileService::Report() const {
+    Stats stats = GetStats();
+    std::stringstream out;
+    out << "requests:          " << stats.requests << "\n";
+    out << "memory cache hits: " << stats.memory_cache_hits << "\n";
+    out << "deduplicated:      " << stats.deduplicated << "\n";
+    out << "disk cache hits:   " << stats.disk_cache_hits << "\n";
+    out << "compilations:      " << stats.compilations << "\n";
+    out << "failures:          " << stats.failures << "\n";
+    out << "workers:           " << workers_.size() << "\n";
+    if (stats.uptime_seconds > 0) {
+        out << "throughput:        "
+            << static_cast<double>(stats.requests) / stats.uptime_seconds << " requests/s, "
+            << static_cast<double>(stats.input_bytes) / stats.uptime_seconds
+            << " WGSL bytes/s\n";
+    }
+    out << "request latency:   " << request_latency_.ToString("us");
+    out << "compile latency:   " << compile_latency_.ToString("us");
+    return out.str();
+}
+
+CompilationResult CompileService::CompileWithTint([[maybe_unused]] const Compilation& compilation) {
+    CompilationResult result;
+#if TINT_BUILD_WGSL_READER
+    Source::File file("<remote>", compilation.wgsl);
+    auto program = wgsl::reader::Parse(&file);
+    if (!program.IsValid()) {
+        result.output = program.Diagnostics().Str();
+        return result;
+    }
+
+    switch (compilation.backend) {
+        case Backend::kSpirv: {
+#if TINT_BUILD_SPV_WRITER
+            spirv::writer::Options options;
+            options.bindings = spirv::writer::GenerateBindings(program);
+            auto spirv = spirv::writer::Generate(program, options);
+            if (spirv != Success) {
+                result.output = spirv.Failure().reason.Str();
+                return result;
+            }
+            const auto& words = spirv->spirv;
+            result.output.resize(words.size() * sizeof(uint32_t));
+            std::copy(words.begin(), words.end(),
+                      reinterpret_cast<uint32_t*>(result.output.data()));
+            result.success = true;
+            return result;
+#else
+            break;
+#endif
+        }
+        case Backend::kMsl: {
+#if TINT_BUILD_MSL_WRITER
+            const Program* input_program = &program;
+            auto flattened = wgsl::FlattenBindings(program);
+            if (flattened) {
+                input_program = &*flattened;
+            }
+            msl::writer::Options options;
+            options.bindings = msl::writer::GenerateBindings(*input_program);
+            options.array_length_from_uniform.ubo_binding = BindingPoint{0, 30};
+            auto msl = msl::writer::Generate(*input_program, options);
+            if (msl != Success) {
+                result.output = msl.Failure().reason.Str();
+                return result;
+            }
+            result.output = std::move(msl->msl);
+            result.success = true;
+            return result;
+#else
+            break;
+#endif
+        }
+        case Backend::kHlsl: {
+#if TINT_BUILD_HLSL_WRITER
+            hlsl::writer::Options options;
+            options.bindings = hlsl::writer::GenerateBindings(program);
+            auto hlsl = hlsl::writer::Generate(program, options);
+            if (hlsl != Success) {
+                result.output = hlsl.Failure().reason.Str();
+                return result;
+            }
+            result.output = std::move(hlsl->hlsl);
+            result.success = true;
+            return result;
+#else
+            break;
+#endif
+        }
+        case Backend::kGlsl: {
+#if TINT_BUILD_GLSL_WRITER
+            if (compilation.entry_point.empty()) {
+                result.output = "the GLSL backend requires an entry point";
+                return result;
+            }
+            glsl::writer::Options options;
+            auto glsl = glsl::writer::Generate(program, options, compilation.entry_point);
+            if (glsl != Success) {
+                result.output = glsl.Failure().reason.Str();
+                return result;
+            }
+            result.output = std::move(glsl->glsl);
+            result.success = true;
+            return result;
+#else
+            break;
+#endif
+        }
+    }
+    result.output = ToString(compilation.backend);
+    result.output += " writer not enabled in tint build";
+#else
+    result.output = "WGSL reader not enabled in tint build";
+#endif  // TINT_BUILD_WGSL_READER
+    return result;
+}
+
+}  // namespace tint::remote_compile
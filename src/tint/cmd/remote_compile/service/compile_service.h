@@ -0,0 +1,215 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_TINT_CMD_REMOTE_COMPILE_SERVICE_COMPILE_SERVICE_H_
+#define SRC_TINT_CMD_REMOTE_COMPILE_SERVICE_COMPILE_SERVICE_H_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace tint::remote_compile {
+
+/// The shader languages that WGSL can be compiled to
+enum class Backend : uint8_t {
+    kSpirv,
+    kMsl,
+    kHlsl,
+    kGlsl,
+};
+
+/// @param backend the backend
+/// @returns the name of the backend
+const char* ToString(Backend backend);
+
+/// A request to compile a WGSL module
+struct Compilation {
+    /// The backend to generate code for
+    Backend backend = Backend::kSpirv;
+    /// The entry point to generate. Only used by the GLSL backend, which emits a single entry
+    /// point per shader.
+    std::string entry_point;
+    /// The WGSL source
+    std::string wgsl;
+};
+
+/// The result of a compilation
+struct CompilationResult {
+    /// True if the module compiled
+    bool success = false;
+    /// The generated code if the compilation succeeded, otherwise the diagnostics. SPIR-V is
+    /// returned as the bytes of the binary module.
+    std::string output;
+};
+
+/// A thread-safe histogram with power-of-two buckets, used to track latencies in microseconds.
+class Histogram {
+  public:
+    /// The number of buckets. Bucket `i` holds the values in [2^(i-1), 2^i), bucket 0 holds 0.
+    static constexpr size_t kNumBuckets = 40;
+
+    /// Records a value
+    /// @param value the value
+    void Add(uint64_t value);
+
+    /// @returns the number of values recorded
+    uint64_t Count() const;
+
+    /// @param percentile the percentile, in [0, 100]
+    /// @returns an upper bound of the given percentile of the recorded values
+    uint64_t Percentile(double percentile) const;
+
+    /// @param unit the unit of the values, appended to each bucket bound
+    /// @returns a textual representation of the non-empty buckets
+    std::string ToString(const char* unit) const;
+
+  private:
+    std::array<std::atomic<uint64_t>, kNumBuckets> buckets_{};
+    std::atomic<uint64_t> count_{0};
+};
+
+/// CompileService compiles WGSL modules concurrently on a pool of worker threads. Identical
+/// requests made while a compilation is in flight share its result, and results are cached in
+/// memory and optionally on disk, keyed by the backend, entry point and WGSL source.
+class CompileService {
+  public:
+    /// The function used to compile a module
+    using CompileFunction = std::function<CompilationResult(const Compilation&)>;
+
+    /// The service configuration
+    struct Options {
+        /// The number of worker threads. 0 uses the number of hardware threads.
+        uint32_t num_workers = 0;
+        /// The directory of the disk cache, or empty to disable it. The directory must exist.
+        std::string cache_dir;
+        /// The maximum total size in bytes of the outputs kept in the memory cache.
+        size_t memory_cache_bytes = 256 * 1024 * 1024;
+        /// The function used to compile modules. Defaults to the Tint writers.
+        CompileFunction compile;
+    };
+
+    /// The counters of the service
+    struct Stats {
+        /// The number of requests
+        uint64_t requests = 0;
+        /// The number of requests served from the memory cache
+        uint64_t memory_cache_hits = 0;
+        /// The number of requests that shared the result of an identical in-flight request
+        uint64_t deduplicated = 0;
+        /// The number of requests served from the disk cache
+        uint64_t disk_cache_hits = 0;
+        /// The number of modules compiled
+        uint64_t compilations = 0;
+        /// The number of compilations that failed
+        uint64_t failures = 0;
+        /// The total size of the WGSL of all the requests
+        uint64_t input_bytes = 0;
+        /// The time since the service was created, in seconds
+        double uptime_seconds = 0;
+    };
+
+    /// Constructor
+    /// @param options the service configuration
+    explicit CompileService(Options options);
+
+    /// Destructor. Waits for the pending compilations to finish.
+    ~CompileService();
+
+    /// Compiles a module, blocking until the result is available. Thread-safe.
+    /// @param compilation the module to compile
+    /// @returns the result of the compilation
+    CompilationResult Compile(const Compilation& compilation);
+
+    /// @returns the counters of the service
+    Stats GetStats() const;
+
+    /// @returns the latency of the requests, from Compile() being called to it returning
+    const Histogram& RequestLatency() const { return request_latency_; }
+
+    /// @returns the time spent compiling each module, excluding queuing
+    const Histogram& CompileLatency() const { return compile_latency_; }
+
+    /// @returns a human readable report of the counters, throughput and latency histograms
+    std::string Report() const;
+
+    /// Compiles a module with the Tint writers enabled in this build
+    /// @param compilation the module to compile
+    /// @returns the result of the compilation
+    static CompilationResult CompileWithTint(const Compilation& compilation);
+
+  private:
+    /// An entry of the memory cache. Its result is pending while the module is compiled.
+    struct Entry {
+        std::shared_future<CompilationResult> result;
+        size_t size = 0;
+        bool ready = false;
+        std::list<std::string>::iterator lru;
+    };
+
+    void WorkerLoop();
+    CompilationResult Run(const std::string& key, const Compilation& compilation);
+
+    std::string DiskCachePath(const std::string& key) const;
+    bool LoadFromDisk(const std::string& key, CompilationResult* result) const;
+    void StoreToDisk(const std::string& key, const CompilationResult& result) const;
+
+    const Options options_;
+    const std::chrono::steady_clock::time_point start_time_;
+
+    // Protects the cache and the counters below.
+    mutable std::mutex cache_mutex_;
+    std::unordered_map<std::string, Entry> cache_;
+    // The keys of the ready entries, most recently used first.
+    std::list<std::string> lru_;
+    size_t cached_bytes_ = 0;
+    Stats stats_;
+
+    std::mutex queue_mutex_;
+    std::condition_variable queue_cv_;
+    std::deque<std::function<void()>> queue_;
+    bool stopping_ = false;
+    std::vector<std::thread> workers_;
+
+    Histogram request_latency_;
+    Histogram compile_latency_;
+};
+
+}  // namespace tint::remote_compile
+
+#endif  // SRC_TINT_CMD_REMOTE_COMPILE_SERVICE_COMPILE_SERVICE_H_
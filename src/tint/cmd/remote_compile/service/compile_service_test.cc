@@ -0,0 +1,257 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/cmd/remote_compile/service/compile_service.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace tint::remote_compile {
+namespace {
+
+/// A compile function that echoes the WGSL, counting the number of calls. Sources starting with
+/// "error" fail to compile.
+class FakeCompiler {
+  public:
+    CompileService::CompileFunction Function() {
+        return [this](const Compilation& compilation) {
+            calls++;
+            if (delay.count() > 0) {
+                std::this_thread::sleep_for(delay);
+            }
+            CompilationResult result;
+            result.success = compilation.wgsl.rfind("error", 0) != 0;
+            result.output = std::string(ToString(compilation.backend)) + ":" + compilation.wgsl;
+            return result;
+        };
+    }
+
+    std::atomic<int> calls{0};
+    std::chrono::milliseconds delay{0};
+};
+
+CompileService::Options MakeOptions(FakeCompiler& compiler, uint32_t num_workers = 2) {
+    CompileService::Options options;
+    options.num_workers = num_workers;
+    options.compile = compiler.Function();
+    return options;
+}
+
+TEST(CompileServiceTest, Compile) {
+    FakeCompiler compiler;
+    CompileService service(MakeOptions(compiler));
+
+    auto result = service.Compile({Backend::kMsl, "", "fn f() {}"});
+    EXPECT_TRUE(result.success);
+    EXPECT_EQ(result.output, "msl:fn f() {}");
+
+    auto stats = service.GetStats();
+    EXPECT_EQ(stats.requests, 1u);
+    EXPECT_EQ(stats.compilations, 1u);
+    EXPECT_EQ(stats.failures, 0u);
+    EXPECT_EQ(service.RequestLatency().Count(), 1u);
+    EXPECT_EQ(service.CompileLatency().Count(), 1u);
+}
+
+TEST(CompileServiceTest, Failure) {
+    FakeCompiler compiler;
+    CompileService service(MakeOptions(compiler));
+
+    auto result = service.Compile({Backend::kSpirv, "", "error"});
+    EXPECT_FALSE(result.success);
+    EXPECT_EQ(result.output, "spirv:error");
+    EXPECT_EQ(service.GetStats().failures, 1u);
+}
+
+TEST(CompileServiceTest, MemoryCacheHit) {
+    FakeCompiler compiler;
+    CompileService service(MakeOptions(compiler));
+
+    service.Compile({Backend::kHlsl, "", "fn f() {}"});
+    auto result = service.Compile({Backend::kHlsl, "", "fn f() {}"});
+    EXPECT_EQ(result.output, "hlsl:fn f() {}");
+    EXPECT_EQ(compiler.calls, 1);
+    EXPECT_EQ(service.GetStats().memory_cache_hits, 1u);
+}
+
+TEST(CompileServiceTest, KeyIncludesBackendAndEntryPoint) {
+    FakeCompiler compiler;
+    CompileService service(MakeOptions(compiler));
+
+    service.Compile({Backend::kGlsl, "a", "fn f() {}"});
+    service.Compile({Backend::kGlsl, "b", "fn f() {}"});
+    auto result = service.Compile({Backend::kMsl, "a", "fn f() {}"});
+    EXPECT_EQ(result.output, "msl:fn f() {}");
+    EXPECT_EQ(compiler.calls, 3);
+}
+
+TEST(CompileServiceTest, MemoryCacheEviction) {
+    FakeCompiler compiler;
+    auto options = MakeOptions(compiler);
+    options.memory_cache_bytes = 64;
+    CompileService service(options);
+
+    service.Compile({Backend::kMsl, "", std::string(40, 'a')});
+    service.Compile({Backend::kMsl, "", std::string(40, 'b')});
+    service.Compile({Backend::kMsl, "", std::string(40, 'a')});
+    EXPECT_EQ(compiler.calls, 3);
+    EXPECT_EQ(service.GetStats().memory_cache_hits, 0u);
+}
+
+TEST(CompileServiceTest, ConcurrentIdenticalRequestsAreDeduplicated) {
+    FakeCompiler compiler;
+    compiler.delay = std::chrono::milliseconds(50);
+    CompileService service(MakeOptions(compiler, 4));
+
+    constexpr size_t kNumClients = 8;
+    std::vector<std::thread> clients;
+    std::vector<CompilationResult> results(kNumClients);
+    for (size_t i = 0; i < kNumClients; i++) {
+        clients.emplace_back(
+            [&, i] { results[i] = service.Compile({Backend::kSpirv, "", "fn f() {}"}); });
+    }
+    for (auto& client : clients) {
+        client.join();
+    }
+
+    EXPECT_EQ(compiler.calls, 1);
+    for (auto& result : results) {
+        EXPECT_EQ(result.output, "spirv:fn f() {}");
+    }
+    auto stats = service.GetStats();
+    EXPECT_EQ(stats.requests, kNumClients);
+    EXPECT_EQ(stats.compilations, 1u);
+    EXPECT_EQ(stats.deduplicated + stats.memory_cache_hits, kNumClients - 1);
+}
+
+TEST(CompileServiceTest, ConcurrentDistinctRequests) {
+    FakeCompiler compiler;
+    CompileService service(MakeOptions(compiler, 4));
+
+    constexpr size_t kNumClients = 16;
+    std::vector<std::thread> clients;
+    std::vector<CompilationResult> results(kNumClients);
+    for (size_t i = 0; i < kNumClients; i++) {
+        clients.emplace_back([&, i] {
+            results[i] = service.Compile({Backend::kMsl, "", std::to_string(i)});
+        });
+    }
+    for (auto& client : clients) {
+        client.join();
+    }
+
+    EXPECT_EQ(compiler.calls, static_cast<int>(kNumClients));
+    for (size_t i = 0; i < kNumClients; i++) {
+        EXPECT_EQ(results[i].output, "msl:" + std::to_string(i));
+    }
+}
+
+/// Runs the test with an empty disk cache directory, removed with the cache files at the end.
+class CompileServiceDiskCacheTest : public testing::Test {
+  protected:
+    void SetUp() override {
+        // Use a directory unique to this run so that files left by previous runs are not hit.
+        auto unique = std::chrono::steady_clock::now().time_since_epoch().count();
+        dir_ = std::filesystem::path(::testing::TempDir()) /
+               ("tint_compile_service_test." + std::to_string(unique));
+        ASSERT_TRUE(std::filesystem::create_directories(dir_));
+    }
+
+    void TearDown() override {
+        std::error_code error;
+        std::filesystem::remove_all(dir_, error);
+        EXPECT_FALSE(error) << error.message();
+    }
+
+    std::filesystem::path dir_;
+};
+
+TEST_F(CompileServiceDiskCacheTest, Hit) {
+    FakeCompiler compiler;
+    {
+        auto options = MakeOptions(compiler);
+        options.cache_dir = dir_.string();
+        CompileService service(options);
+        auto result = service.Compile({Backend::kHlsl, "", "fn f() {}"});
+        EXPECT_EQ(result.output, "hlsl:fn f() {}");
+        EXPECT_EQ(service.GetStats().disk_cache_hits, 0u);
+    }
+    EXPECT_FALSE(std::filesystem::is_empty(dir_));
+    {
+        auto options = MakeOptions(compiler);
+        options.cache_dir = dir_.string();
+        CompileService service(options);
+        auto result = service.Compile({Backend::kHlsl, "", "fn f() {}"});
+        EXPECT_TRUE(result.success);
+        EXPECT_EQ(result.output, "hlsl:fn f() {}");
+        EXPECT_EQ(service.GetStats().disk_cache_hits, 1u);
+        EXPECT_EQ(service.GetStats().compilations, 0u);
+    }
+    EXPECT_EQ(compiler.calls, 1);
+}
+
+TEST(CompileServiceTest, Report) {
+    FakeCompiler compiler;
+    CompileService service(MakeOptions(compiler));
+    service.Compile({Backend::kMsl, "", "fn f() {}"});
+
+    auto report = service.Report();
+    EXPECT_NE(report.find("requests:          1"), std::string::npos);
+    EXPECT_NE(report.find("request latency:"), std::string::npos);
+}
+
+TEST(HistogramTest, Empty) {
+    Histogram histogram;
+    EXPECT_EQ(histogram.Count(), 0u);
+    EXPECT_EQ(histogram.Percentile(50), 0u);
+}
+
+TEST(HistogramTest, Percentiles) {
+    Histogram histogram;
+    for (uint64_t i = 0; i < 90; i++) {
+        histogram.Add(5);  // Bucket [4, 8)
+    }
+    for (uint64_t i = 0; i < 10; i++) {
+        histogram.Add(1000);  // Bucket [512, 1024)
+    }
+    EXPECT_EQ(histogram.Count(), 100u);
+    EXPECT_EQ(histogram.Percentile(50), 8u);
+    EXPECT_EQ(histogram.Percentile(90), 8u);
+    EXPECT_EQ(histogram.Percentile(99), 1024u);
+    EXPECT_EQ(histogram.Percentile(100), 1024u);
+}
+
+}  // namespace
+}  // namespace tint::remote_compile
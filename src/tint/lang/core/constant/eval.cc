@@ -48,6 +48,7 @@
 #include "src/tint/lang/core/type/f32.h"
 #include "src/tint/lang/core/type/i32.h"
 #include "src/tint/lang/core/type/matrix.h"
+#include "src/tint/lang/core/type/scalar.h"
 #include "src/tint/lang/core/type/struct.h"
 #include "src/tint/lang/core/type/u32.h"
 #include "src/tint/lang/core/type/vector.h"
@@ -507,6 +508,15 @@ TransformElements(Manager& mgr,
     return mgr.Composite(composite_ty, std::move(els));
 }
 
+/// @returns the element that is repeated for every element of the composite @p c if @p c is a
+/// Splat, otherwise nullptr.
+const Value* SplatElement(const Value* c) {
+    if (auto* splat = c->As<Splat>()) {
+        return splat->el;
+    }
+    return nullptr;
+}
+
 /// Signature of a unary transformation callback
 using UnaryTransform = std::function<Eval::Result(const Value*)>;
 
@@ -523,8 +533,28 @@ Eval::Result TransformUnaryElements(Manager& mgr,
 
     auto* composite_el_ty = composite_ty->Elements(composite_ty).type;
 
+    if (auto* el0 = SplatElement(c0)) {
+        // Every element is the same, so only a single element needs to be transformed.
+        auto el = TransformUnaryElements(mgr, composite_el_ty, f, el0);
+        if (el != Success || !el.Get()) {
+            return el;
+        }
+        return mgr.Splat(composite_ty, el.Get(), n);
+    }
+
     Vector<const Value*, 8> els;
     els.Reserve(n);
+    if (el_ty->Is<core::type::Scalar>()) {
+        // Fast path for vectors: transform each of the lanes without recursion.
+        for (uint32_t i = 0; i < n; i++) {
+            if (auto el = f(c0->Index(i)); el == Success) {
+                els.Push(el.Get());
+            } else {
+                return el.Failure();
+            }
+        }
+        return mgr.Composite(composite_ty, std::move(els));
+    }
     for (uint32_t i = 0; i < n; i++) {
         if (auto el = TransformUnaryElements(mgr, composite_el_ty, f, c0->Index(i));
             el == Success) {
@@ -555,8 +585,28 @@ Eval::Result TransformBinaryElements(Manager& mgr,
 
     auto* composite_el_ty = composite_ty->Elements(composite_ty).type;
 
+    if (auto *el0 = SplatElement(c0), *el1 = SplatElement(c1); el0 && el1) {
+        // Every element is the same, so only a single element needs to be transformed.
+        auto el = TransformBinaryElements(mgr, composite_el_ty, f, el0, el1);
+        if (el != Success || !el.Get()) {
+            return el;
+        }
+        return mgr.Splat(composite_ty, el.Get(), n);
+    }
+
     Vector<const Value*, 8> els;
     els.Reserve(n);
+    if (el_ty->Is<core::type::Scalar>()) {
+        // Fast path for vectors: transform each of the lanes without recursion.
+        for (uint32_t i = 0; i < n; i++) {
+            if (auto el = f(c0->Index(i), c1->Index(i)); el == Success) {
+                els.Push(el.Get());
+            } else {
+                return el.Failure();
+            }
+        }
+        return mgr.Composite(composite_ty, std::move(els));
+    }
     for (uint32_t i = 0; i < n; i++) {
         if (auto el = TransformBinaryElements(mgr, composite_el_ty, f, c0->Index(i), c1->Index(i));
             el == Success) {
@@ -587,14 +637,39 @@ Eval::Result TransformBinaryDifferingArityElements(Manager& mgr,
 
     const auto* element_ty = composite_ty->Elements(composite_ty).type;
 
+    auto nested_or_self = [&](auto* c, uint32_t num_elems, uint32_t i) {
+        return (num_elems == 1) ? c : c->Index(i);
+    };
+    auto splat_or_self = [&](auto* c, uint32_t num_elems) {
+        return (num_elems == 1) ? c : SplatElement(c);
+    };
+
+    if (auto *el0 = splat_or_self(c0, n0), *el1 = splat_or_self(c1, n1); el0 && el1) {
+        // Every element is the same, so only a single element needs to be transformed.
+        auto el = TransformBinaryDifferingArityElements(mgr, element_ty, f, el0, el1);
+        if (el != Success || !el.Get()) {
+            return el;
+        }
+        return mgr.Splat(composite_ty, el.Get(), max_n);
+    }
+
     Vector<const Value*, 8> els;
     els.Reserve(max_n);
+    if (element_ty->Is<core::type::Scalar>()) {
+        // Fast path for vectors: transform each of the lanes without recursion.
+        for (uint32_t i = 0; i < max_n; i++) {
+            if (auto el = f(nested_or_self(c0, n0, i), nested_or_self(c1, n1, i));
+                el == Success) {
+                els.Push(el.Get());
+            } else {
+                return el.Failure();
+            }
+        }
+        return mgr.Composite(composite_ty, std::move(els));
+    }
     for (uint32_t i = 0; i < max_n; i++) {
-        auto nested_or_self = [&](auto* c, uint32_t num_elems) {
-            return (num_elems == 1) ? c : c->Index(i);
-        };
         if (auto el = TransformBinaryDifferingArityElements(
-                mgr, element_ty, f, nested_or_self(c0, n0), nested_or_self(c1, n1));
+                mgr, element_ty, f, nested_or_self(c0, n0, i), nested_or_self(c1, n1, i));
             el == Success) {
             els.Push(el.Get());
         } else {
@@ -623,8 +698,29 @@ Eval::Result TransformTernaryElements(Manager& mgr,
 
     auto* composite_el_ty = composite_ty->Elements(composite_ty).type;
 
+    if (auto *el0 = SplatElement(c0), *el1 = SplatElement(c1), *el2 = SplatElement(c2);
+        el0 && el1 && el2) {
+        // Every element is the same, so only a single element needs to be transformed.
+        auto el = TransformTernaryElements(mgr, composite_el_ty, f, el0, el1, el2);
+        if (el != Success || !el.Get()) {
+            return el;
+        }
+        return mgr.Splat(composite_ty, el.Get(), n);
+    }
+
     Vector<const Value*, 8> els;
     els.Reserve(n);
+    if (el_ty->Is<core::type::Scalar>()) {
+        // Fast path for vectors: transform each of the lanes without recursion.
+        for (uint32_t i = 0; i < n; i++) {
+            if (auto el = f(c0->Index(i), c1->Index(i), c2->Index(i)); el == Success) {
+                els.Push(el.Get());
+            } else {
+                return el.Failure();
+            }
+        }
+        return mgr.Composite(composite_ty, std::move(els));
+    }
     for (uint32_t i = 0; i < n; i++) {
         if (auto el = TransformTernaryElements(mgr, composite_el_ty, f, c0->Index(i), c1->Index(i),
                                                c2->Index(i));
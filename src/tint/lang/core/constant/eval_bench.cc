@@ -0,0 +1,148 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "benchmark/benchmark.h"
+
+#include "src/tint/lang/core/constant/eval.h"
+#include "src/tint/lang/core/constant/manager.h"
+#include "src/tint/lang/core/constant/scalar.h"
+#include "src/tint/lang/core/constant/splat.h"
+#include "src/tint/lang/core/type/array.h"
+#include "src/tint/lang/core/type/f32.h"
+#include "src/tint/lang/core/type/matrix.h"
+#include "src/tint/lang/core/type/vector.h"
+#include "src/tint/utils/diagnostic/diagnostic.h"
+#include "src/tint/utils/diagnostic/source.h"
+
+namespace tint::core::constant {
+namespace {
+
+/// The number of distinct input values used by each benchmark
+constexpr uint32_t kNumInputs = 64;
+
+/// @returns kNumInputs distinct vec4<f32> constants
+Vector<const Value*, kNumInputs> Vec4s(Manager& mgr) {
+    Vector<const Value*, kNumInputs> out;
+    for (uint32_t i = 0; i < kNumInputs; i++) {
+        float f = static_cast<float>(i);
+        out.Push(mgr.Composite(mgr.types.vec4<f32>(), Vector{mgr.Get(f32(f)),
+                                                           mgr.Get(f32(f + 0.5f)),
+                                                           mgr.Get(f32(f * 2.0f)),
+                                                           mgr.Get(f32(-f))}));
+    }
+    return out;
+}
+
+/// @returns kNumInputs distinct vec4<f32> splat constants
+Vector<const Value*, kNumInputs> Vec4Splats(Manager& mgr) {
+    Vector<const Value*, kNumInputs> out;
+    for (uint32_t i = 0; i < kNumInputs; i++) {
+        out.Push(mgr.Splat(mgr.types.vec4<f32>(), mgr.Get(f32(static_cast<float>(i) + 0.25f)), 4));
+    }
+    return out;
+}
+
+/// Evaluates a binary builtin / operator over all pairs of @p inputs.
+void EvalBinary(benchmark::State& state,
+                Eval::Function fn,
+                const core::type::Type* ty,
+                VectorRef<const Value*> inputs,
+                Eval& eval) {
+    Source source;
+    for (auto _ : state) {
+        for (auto* lhs : inputs) {
+            for (auto* rhs : inputs) {
+                auto res = (eval.*fn)(ty, Vector{lhs, rhs}, source);
+                benchmark::DoNotOptimize(res);
+            }
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * inputs.Length() *
+                                                 inputs.Length()));
+}
+
+void EvalVec4Add(benchmark::State& state) {
+    Manager mgr;
+    diag::List diags;
+    Eval eval(mgr, diags);
+    EvalBinary(state, &Eval::Plus, mgr.types.vec4<f32>(), Vec4s(mgr), eval);
+}
+
+BENCHMARK(EvalVec4Add);
+
+void EvalVec4Atan2(benchmark::State& state) {
+    Manager mgr;
+    diag::List diags;
+    Eval eval(mgr, diags);
+    EvalBinary(state, &Eval::atan2, mgr.types.vec4<f32>(), Vec4s(mgr), eval);
+}
+
+BENCHMARK(EvalVec4Atan2);
+
+void EvalVec4SplatAtan2(benchmark::State& state) {
+    Manager mgr;
+    diag::List diags;
+    Eval eval(mgr, diags);
+    EvalBinary(state, &Eval::atan2, mgr.types.vec4<f32>(), Vec4Splats(mgr), eval);
+}
+
+BENCHMARK(EvalVec4SplatAtan2);
+
+void EvalMat4x4Multiply(benchmark::State& state) {
+    Manager mgr;
+    diag::List diags;
+    Eval eval(mgr, diags);
+    auto* mat_ty = mgr.types.mat4x4<f32>();
+    auto cols = Vec4s(mgr);
+    Vector<const Value*, kNumInputs> mats;
+    for (uint32_t i = 0; i + 3 < kNumInputs; i += 4) {
+        mats.Push(mgr.Composite(mat_ty, Vector{cols[i], cols[i + 1], cols[i + 2], cols[i + 3]}));
+    }
+    EvalBinary(state, &Eval::MultiplyMatMat, mat_ty, mats, eval);
+}
+
+BENCHMARK(EvalMat4x4Multiply);
+
+void EvalArrayConstruct(benchmark::State& state) {
+    Manager mgr;
+    diag::List diags;
+    Eval eval(mgr, diags);
+    auto* arr_ty = mgr.types.array(mgr.types.f32(), kNumInputs);
+    Vector<const Value*, kNumInputs> els;
+    for (uint32_t i = 0; i < kNumInputs; i++) {
+        els.Push(mgr.Get(f32(static_cast<float>(i))));
+    }
+    for (auto _ : state) {
+        auto res = eval.ArrayOrStructCtor(arr_ty, els);
+        benchmark::DoNotOptimize(res);
+    }
+}
+
+BENCHMARK(EvalArrayConstruct);
+
+}  // namespace
+}  // namespace tint::core::constant
@@ -119,6 +119,30 @@ const Scalar<AInt>* Manager::Get(AInt value) {
     return Get<Scalar<AInt>>(types.AInt(), value);
 }
 
+bool Manager::Equal::operator()(const constant::Value& a, const constant::Value& b) const {
+    if (&a == &b) {
+        return true;
+    }
+    if (a.Type() != b.Type()) {
+        return false;
+    }
+    auto* a_first = a.Index(0);
+    if (!a_first) {
+        // Scalar
+        return a.Equal(&b);
+    }
+    size_t n = a.NumElements();
+    if (n != b.NumElements() || a_first != b.Index(0)) {
+        return false;
+    }
+    for (size_t i = 1; i < n; i++) {
+        if (a.Index(i) != b.Index(i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 const Value* Manager::Zero(const core::type::Type* type) {
     return Switch(
         type,  //
@@ -158,14 +158,15 @@ class Manager final {
         HashCode operator()(const constant::Value& value) const { return value.Hash(); }
     };
 
-    /// An equality helper for constant::Value
+    /// An equality helper for constant::Value.
+    /// The elements of composite values held by the manager are themselves unique, so two
+    /// composites are equal if their elements are pointer-equal. This avoids the recursive
+    /// comparison of Value::Equal().
     struct Equal {
         /// @param a the LHS value
         /// @param b the RHS value
         /// @returns true if the two constants are equal
-        bool operator()(const constant::Value& a, const constant::Value& b) const {
-            return a.Equal(&b);
-        }
+        bool operator()(const constant::Value& a, const constant::Value& b) const;
     };
 
     /// Unique types owned by the manager
@@ -28,6 +28,7 @@
 #ifndef SRC_TINT_LANG_CORE_INTRINSIC_TABLE_H_
 #define SRC_TINT_LANG_CORE_INTRINSIC_TABLE_H_
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
@@ -38,7 +39,9 @@
 #include "src/tint/lang/core/intrinsic/table_data.h"
 #include "src/tint/lang/core/parameter_usage.h"
 #include "src/tint/lang/core/unary_op.h"
+#include "src/tint/utils/containers/hashmap.h"
 #include "src/tint/utils/containers/vector.h"
+#include "src/tint/utils/math/hash.h"
 #include "src/tint/utils/text/string.h"
 
 // Forward declarations
@@ -183,7 +186,64 @@ Result<Overload, std::string> LookupCtorConv(Context& context,
                                              VectorRef<const core::type::Type*> args,
                                              EvaluationStage earliest_eval_stage);
 
+/// OverloadCacheKey is the key used by Table to memoize the result of an overload lookup.
+/// Types are uniqued by the type manager, so the key can compare types by pointer.
+struct OverloadCacheKey {
+    /// The kind of intrinsic being looked up
+    enum class Kind : uint8_t {
+        kBuiltinFn,
+        kUnaryOp,
+        kBinaryOp,
+        kCtorConv,
+    };
+
+    /// The kind of intrinsic being looked up
+    Kind kind = Kind::kBuiltinFn;
+    /// True if the binary operator is being used as a compound assignment
+    bool is_compound = false;
+    /// The earliest evaluation stage of the call
+    EvaluationStage earliest_eval_stage = EvaluationStage::kRuntime;
+    /// The builtin function, operator or type constructor / conversion identifier
+    size_t id = 0;
+    /// The optional template argument of a type constructor / conversion
+    const core::type::Type* template_arg = nullptr;
+    /// The argument types
+    Vector<const core::type::Type*, 4> args;
+
+    /// Equality operator
+    /// @param other the key to compare against
+    /// @returns true if this key and @p other are the same
+    bool operator==(const OverloadCacheKey& other) const {
+        return kind == other.kind && is_compound == other.is_compound &&
+               earliest_eval_stage == other.earliest_eval_stage && id == other.id &&
+               template_arg == other.template_arg && args == other.args;
+    }
+
+    /// @returns a hash code for this key
+    tint::HashCode HashCode() const {
+        return Hash(kind, is_compound, earliest_eval_stage, id, template_arg, args);
+    }
+};
+
+/// OverloadCacheStats holds the hit and miss counters of a Table's overload cache.
+struct OverloadCacheStats {
+    /// The number of lookups that were served from the cache
+    size_t hits = 0;
+    /// The number of lookups that required overload resolution
+    size_t misses = 0;
+
+    /// @returns the total number of lookups
+    size_t Lookups() const { return hits + misses; }
+
+    /// @returns the ratio of lookups served from the cache, in the range [0, 1]
+    double HitRate() const {
+        return Lookups() > 0 ? static_cast<double>(hits) / static_cast<double>(Lookups()) : 0.0;
+    }
+};
+
 /// Table is a wrapper around a dialect to provide type-safe interface to the intrinsic table.
+/// The result of each lookup is memoized, so repeated lookups with the same signature skip
+/// overload resolution.
 template <typename DIALECT>
 struct Table {
     /// Alias to DIALECT::BuiltinFn
@@ -215,9 +275,13 @@ struct Table {
     Result<Overload, std::string> Lookup(BuiltinFn builtin_fn,
                                          VectorRef<const core::type::Type*> args,
                                          EvaluationStage earliest_eval_stage) {
-        std::string_view name = DIALECT::ToString(builtin_fn);
         size_t id = static_cast<size_t>(builtin_fn);
-        return LookupFn(context, name, id, std::move(args), earliest_eval_stage);
+        OverloadCacheKey key{OverloadCacheKey::Kind::kBuiltinFn, false, earliest_eval_stage, id,
+                             nullptr, args};
+        return Cached(std::move(key), [&] {
+            std::string_view name = DIALECT::ToString(builtin_fn);
+            return LookupFn(context, name, id, std::move(args), earliest_eval_stage);
+        });
     }
 
     /// Lookup looks for the unary op overload with the given signature, raising an error
@@ -235,7 +299,10 @@ struct Table {
     Result<Overload, std::string> Lookup(core::UnaryOp op,
                                          const core::type::Type* arg,
                                          EvaluationStage earliest_eval_stage) {
-        return LookupUnary(context, op, arg, earliest_eval_stage);
+        OverloadCacheKey key{OverloadCacheKey::Kind::kUnaryOp, false, earliest_eval_stage,
+                             static_cast<size_t>(op), nullptr, {arg}};
+        return Cached(std::move(key),
+                      [&] { return LookupUnary(context, op, arg, earliest_eval_stage); });
     }
 
     /// Lookup looks for the binary op overload with the given signature, raising an error
@@ -257,7 +324,11 @@ struct Table {
                                          const core::type::Type* rhs,
                                          EvaluationStage earliest_eval_stage,
                                          bool is_compound) {
-        return LookupBinary(context, op, lhs, rhs, earliest_eval_stage, is_compound);
+        OverloadCacheKey key{OverloadCacheKey::Kind::kBinaryOp, is_compound, earliest_eval_stage,
+                             static_cast<size_t>(op), nullptr, {lhs, rhs}};
+        return Cached(std::move(key), [&] {
+            return LookupBinary(context, op, lhs, rhs, earliest_eval_stage, is_compound);
+        });
     }
 
     /// Lookup looks for the value constructor or conversion overload for the given CtorConv.
@@ -276,14 +347,41 @@ struct Table {
                                          const core::type::Type* template_arg,
                                          VectorRef<const core::type::Type*> args,
                                          EvaluationStage earliest_eval_stage) {
-        std::string_view name = DIALECT::ToString(type);
         size_t id = static_cast<size_t>(type);
-        return LookupCtorConv(context, name, id, template_arg, std::move(args),
-                              earliest_eval_stage);
+        OverloadCacheKey key{OverloadCacheKey::Kind::kCtorConv, false, earliest_eval_stage, id,
+                             template_arg, args};
+        return Cached(std::move(key), [&] {
+            std::string_view name = DIALECT::ToString(type);
+            return LookupCtorConv(context, name, id, template_arg, std::move(args),
+                                  earliest_eval_stage);
+        });
     }
 
+    /// @returns the hit and miss counters of the overload cache
+    const OverloadCacheStats& CacheStats() const { return cache_stats_; }
+
     /// The intrinsic context
     Context context;
+
+  private:
+    /// @returns the cached lookup result for @p key, calling @p lookup to resolve the overload
+    /// if the result is not already cached.
+    /// @param key the lookup signature
+    /// @param lookup the function used to resolve the overload on a cache miss
+    template <typename LOOKUP>
+    Result<Overload, std::string> Cached(OverloadCacheKey&& key, LOOKUP&& lookup) {
+        if (auto cached = cache_.Get(key)) {
+            cache_stats_.hits++;
+            return *cached;
+        }
+        cache_stats_.misses++;
+        return cache_.Add(std::move(key), lookup()).value;
+    }
+
+    /// The memoized lookup results
+    Hashmap<OverloadCacheKey, Result<Overload, std::string>, 32> cache_;
+    /// The cache hit and miss counters
+    OverloadCacheStats cache_stats_;
 };
 
 }  // namespace tint::core::intrinsic
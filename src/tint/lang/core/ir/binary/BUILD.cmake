@@ -45,6 +45,7 @@ tint_add_target(tint_lang_core_ir_binary lib
   lang/core/ir/binary/decode.h
   lang/core/ir/binary/encode.cc
   lang/core/ir/binary/encode.h
+  lang/core/ir/binary/header.h
 )
 
 tint_target_add_dependencies(tint_lang_core_ir_binary lib
@@ -130,6 +131,61 @@ if(TINT_BUILD_IR_BINARY)
   )
 endif(TINT_BUILD_IR_BINARY)
 
+endif(TINT_BUILD_IR_BINARY)
+if(TINT_BUILD_IR_BINARY)
+################################################################################
+# Target:    tint_lang_core_ir_binary_bench
+# Kind:      bench
+# Condition: TINT_BUILD_IR_BINARY
+################################################################################
+tint_add_target(tint_lang_core_ir_binary_bench bench
+  lang/core/ir/binary/decode_bench.cc
+)
+
+tint_target_add_dependencies(tint_lang_core_ir_binary_bench bench
+  tint_api_common
+  tint_cmd_bench_bench
+  tint_lang_core
+  tint_lang_core_constant
+  tint_lang_core_ir
+  tint_lang_core_type
+  tint_lang_wgsl
+  tint_lang_wgsl_ast
+  tint_lang_wgsl_common
+  tint_lang_wgsl_features
+  tint_lang_wgsl_program
+  tint_lang_wgsl_sem
+  tint_utils_containers
+  tint_utils_diagnostic
+  tint_utils_ice
+  tint_utils_id
+  tint_utils_macros
+  tint_utils_math
+  tint_utils_memory
+  tint_utils_reflection
+  tint_utils_result
+  tint_utils_rtti
+  tint_utils_symbol
+  tint_utils_text
+  tint_utils_traits
+)
+
+tint_target_add_external_dependencies(tint_lang_core_ir_binary_bench bench
+  "google-benchmark"
+)
+
+if(TINT_BUILD_IR_BINARY)
+  tint_target_add_dependencies(tint_lang_core_ir_binary_bench bench
+    tint_lang_core_ir_binary
+  )
+endif(TINT_BUILD_IR_BINARY)
+
+if(TINT_BUILD_WGSL_READER)
+  tint_target_add_dependencies(tint_lang_core_ir_binary_bench bench
+    tint_lang_wgsl_reader
+  )
+endif(TINT_BUILD_WGSL_READER)
+
 endif(TINT_BUILD_IR_BINARY)
 if(TINT_BUILD_IR_BINARY)
 ################################################################################
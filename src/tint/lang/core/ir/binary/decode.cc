@@ -27,8 +27,10 @@
 
 #include "src/tint/lang/core/ir/binary/decode.h"
 
+#include <string>
 #include <utility>
 
+#include "src/tint/lang/core/ir/binary/header.h"
 #include "src/tint/lang/core/ir/builder.h"
 #include "src/tint/lang/core/ir/module.h"
 #include "src/tint/lang/core/type/depth_multisampled_texture.h"
@@ -1348,8 +1350,27 @@ struct Decoder {
 Result<Module> Decode(Slice<const std::byte> encoded) {
     GOOGLE_PROTOBUF_VERIFY_VERSION;
 
+    if (encoded.len < kHeaderSize) {
+        return Failure{"encoded module is too small"};
+    }
+    auto read_u32 = [&](size_t offset) {
+        uint32_t value = 0;
+        for (uint32_t i = 0; i < 4; i++) {
+            value |= static_cast<uint32_t>(encoded[offset + i]) << (i * 8);
+        }
+        return value;
+    };
+    if (read_u32(0) != kMagic) {
+        return Failure{"encoded module has an invalid header"};
+    }
+    if (auto version = read_u32(4); version != kVersion) {
+        return Failure{"encoded module has version " + std::to_string(version) + ", expected " +
+                       std::to_string(kVersion)};
+    }
+
     pb::Module mod_in;
-    if (!mod_in.ParseFromArray(encoded.data, static_cast<int>(encoded.len))) {
+    if (!mod_in.ParseFromArray(encoded.data + kHeaderSize,
+                               static_cast<int>(encoded.len - kHeaderSize))) {
         return Failure{"failed to deserialize protobuf"};
     }
 
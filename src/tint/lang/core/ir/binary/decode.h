@@ -37,6 +37,10 @@ class Module;
 
 namespace tint::core::ir::binary {
 
+/// Decodes a module encoded with Encode().
+/// @param encoded the encoded module
+/// @returns the decoded module, or a failure if @p encoded was not produced by Encode() with the
+/// same encoding version.
 Result<Module> Decode(Slice<const std::byte> encoded);
 
 }  // namespace tint::core::ir::binary
@@ -0,0 +1,96 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <string>
+
+#include "src/tint/cmd/bench/bench.h"
+#include "src/tint/lang/core/ir/binary/decode.h"
+#include "src/tint/lang/core/ir/binary/encode.h"
+#include "src/tint/lang/core/ir/module.h"
+
+#if TINT_BUILD_WGSL_READER
+#include "src/tint/lang/wgsl/reader/reader.h"
+#endif  // TINT_BUILD_WGSL_READER
+
+namespace tint::core::ir::binary {
+namespace {
+
+/// Parses, resolves and lowers the WGSL program to IR. This is the work that is skipped when the
+/// IR is loaded with Decode().
+void WgslToIR(benchmark::State& state, std::string input_name) {
+#if TINT_BUILD_WGSL_READER
+    auto res = bench::LoadInputFile(input_name);
+    if (res != Success) {
+        state.SkipWithError(res.Failure().reason.Str());
+        return;
+    }
+    for (auto _ : state) {
+        auto ir = wgsl::reader::WgslToIR(&res.Get());
+        if (ir != Success) {
+            state.SkipWithError(ir.Failure().reason.Str());
+        }
+    }
+#else
+#error "WGSL Reader is required to build IR for the decoder benchmark"
+#endif  // TINT_BUILD_WGSL_READER
+}
+
+/// Decodes IR that was encoded from the WGSL program.
+void DecodeIR(benchmark::State& state, std::string input_name) {
+#if TINT_BUILD_WGSL_READER
+    auto res = bench::LoadInputFile(input_name);
+    if (res != Success) {
+        state.SkipWithError(res.Failure().reason.Str());
+        return;
+    }
+    auto ir = wgsl::reader::WgslToIR(&res.Get());
+    if (ir != Success) {
+        state.SkipWithError(ir.Failure().reason.Str());
+        return;
+    }
+    auto encoded = Encode(ir.Get());
+    if (encoded != Success) {
+        state.SkipWithError(encoded.Failure().reason.Str());
+        return;
+    }
+    for (auto _ : state) {
+        auto decoded = Decode(encoded->Slice());
+        if (decoded != Success) {
+            state.SkipWithError(decoded.Failure().reason.Str());
+        }
+    }
+    state.counters["encoded_bytes"] = static_cast<double>(encoded->Length());
+#else
+#error "WGSL Reader is required to build IR for the decoder benchmark"
+#endif  // TINT_BUILD_WGSL_READER
+}
+
+TINT_BENCHMARK_PROGRAMS(WgslToIR);
+TINT_BENCHMARK_PROGRAMS(DecodeIR);
+
+}  // namespace
+}  // namespace tint::core::ir::binary
@@ -35,6 +35,7 @@
 #include "src/tint/lang/core/constant/scalar.h"
 #include "src/tint/lang/core/constant/splat.h"
 #include "src/tint/lang/core/ir/access.h"
+#include "src/tint/lang/core/ir/binary/header.h"
 #include "src/tint/lang/core/ir/bitcast.h"
 #include "src/tint/lang/core/ir/break_if.h"
 #include "src/tint/lang/core/ir/construct.h"
@@ -1133,9 +1134,13 @@ Result<Vector<std::byte, 0>> Encode(const Module& mod_in) {
 
     Vector<std::byte, 0> buffer;
     size_t len = mod_out.ByteSizeLong();
-    buffer.Resize(len);
+    buffer.Resize(kHeaderSize + len);
+    for (uint32_t i = 0; i < 4; i++) {
+        buffer[i] = static_cast<std::byte>(kMagic >> (i * 8));
+        buffer[4 + i] = static_cast<std::byte>(kVersion >> (i * 8));
+    }
     if (len > 0) {
-        if (!mod_out.SerializeToArray(&buffer[0], static_cast<int>(len))) {
+        if (!mod_out.SerializeToArray(&buffer[kHeaderSize], static_cast<int>(len))) {
             return Failure{"failed to serialize protobuf"};
         }
     }
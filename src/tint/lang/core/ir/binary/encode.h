@@ -38,6 +38,9 @@ class Module;
 
 namespace tint::core::ir::binary {
 
+/// Encodes a module to a versioned binary form, which can be decoded with Decode().
+/// @param module the module to encode
+/// @returns the encoded module
 Result<Vector<std::byte, 0>> Encode(const Module& module);
 
 }  // namespace tint::core::ir::binary
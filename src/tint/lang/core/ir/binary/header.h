@@ -0,0 +1,57 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_TINT_LANG_CORE_IR_BINARY_HEADER_H_
+#define SRC_TINT_LANG_CORE_IR_BINARY_HEADER_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace tint::core::ir::binary {
+
+/// The encoded form of a module is a fixed size header followed by the protobuf serialization of
+/// the module. The header lets a loader reject data from an incompatible version of Tint, such as a
+/// stale on-disk cache entry, without parsing the protobuf.
+///
+/// Header layout, with each field stored as a little-endian uint32:
+///   [0..3] kMagic
+///   [4..7] kVersion
+
+/// The magic number at the start of an encoded module: the bytes 'T', 'I', 'R', 'B'.
+static constexpr uint32_t kMagic = 0x42524954;
+
+/// The version of the encoding.
+/// This must be incremented whenever a change to ir.proto, the encoder or the decoder would cause
+/// a previously encoded module to decode differently.
+static constexpr uint32_t kVersion = 1;
+
+/// The size in bytes of the header.
+static constexpr size_t kHeaderSize = 8;
+
+}  // namespace tint::core::ir::binary
+
+#endif  // SRC_TINT_LANG_CORE_IR_BINARY_HEADER_H_
@@ -29,6 +29,7 @@
 
 #include "src/tint/lang/core/ir/binary/decode.h"
 #include "src/tint/lang/core/ir/binary/encode.h"
+#include "src/tint/lang/core/ir/binary/header.h"
 #include "src/tint/lang/core/ir/disassembler.h"
 #include "src/tint/lang/core/type/depth_multisampled_texture.h"
 #include "src/tint/lang/core/type/depth_texture.h"
@@ -73,6 +74,35 @@ TEST_F(IRBinaryRoundtripTest, EmptyModule) {
     RUN_TEST();
 }
 
+TEST_F(IRBinaryRoundtripTest, Decode_TooSmall) {
+    auto encoded = Encode(mod);
+    ASSERT_TRUE(encoded == Success);
+    auto decoded = Decode(encoded->Slice().Truncate(kHeaderSize - 1));
+    ASSERT_TRUE(decoded != Success);
+    EXPECT_EQ(decoded.Failure().reason.Str(), "error: encoded module is too small");
+}
+
+TEST_F(IRBinaryRoundtripTest, Decode_InvalidHeader) {
+    auto encoded = Encode(mod);
+    ASSERT_TRUE(encoded == Success);
+    encoded.Get()[0] = std::byte{'X'};
+    auto decoded = Decode(encoded->Slice());
+    ASSERT_TRUE(decoded != Success);
+    EXPECT_EQ(decoded.Failure().reason.Str(), "error: encoded module has an invalid header");
+}
+
+TEST_F(IRBinaryRoundtripTest, Decode_VersionMismatch) {
+    b.Append(b.ir.root_block, [&] { b.Var<private_, i32>(); });
+    auto encoded = Encode(mod);
+    ASSERT_TRUE(encoded == Success);
+    encoded.Get()[4] = static_cast<std::byte>(kVersion + 1);
+    auto decoded = Decode(encoded->Slice());
+    ASSERT_TRUE(decoded != Success);
+    EXPECT_EQ(decoded.Failure().reason.Str(), "error: encoded module has version " +
+                                                  std::to_string(kVersion + 1) + ", expected " +
+                                                  std::to_string(kVersion));
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Root block
 ////////////////////////////////////////////////////////////////////////////////
@@ -329,6 +329,8 @@ SanitizedResult Sanitize(const Program& in, const Options& options) {
     // assumes that num_workgroups builtins only appear as struct members and are
     // only accessed directly via member accessors.
     manager.Add<NumWorkgroupsFromUniform>();
+    // VectorizeScalarMatrixInitializers and RemovePhonies are LocalTransforms, but are separated by
+    // SimplifyPointers, so each is applied with its own clone and resolve of the program.
     manager.Add<ast::transform::VectorizeScalarMatrixInitializers>();
     manager.Add<ast::transform::SimplifyPointers>();
     manager.Add<ast::transform::RemovePhonies>();
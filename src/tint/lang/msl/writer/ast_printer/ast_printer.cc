@@ -234,6 +234,8 @@ SanitizedResult Sanitize(const Program& in, const Options& options) {
     // TODO(crbug.com/tint/1752): This is only necessary for Metal versions older than 2.3.
     manager.Add<ast::transform::DemoteToHelper>();
 
+    // VectorizeScalarMatrixInitializers and RemovePhonies are LocalTransforms. Keep them adjacent,
+    // so that the Manager applies both with a single clone and resolve of the program.
     manager.Add<ast::transform::VectorizeScalarMatrixInitializers>();
     manager.Add<ast::transform::RemovePhonies>();
     manager.Add<ast::transform::SimplifyPointers>();
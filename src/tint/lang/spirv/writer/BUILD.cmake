@@ -188,6 +188,7 @@ tint_target_add_dependencies(tint_lang_spirv_writer_bench bench
   tint_lang_core_type
   tint_lang_wgsl
   tint_lang_wgsl_ast
+  tint_lang_wgsl_ast_transform
   tint_lang_wgsl_common
   tint_lang_wgsl_features
   tint_lang_wgsl_program
@@ -214,6 +215,7 @@ tint_target_add_external_dependencies(tint_lang_spirv_writer_bench bench
 if(TINT_BUILD_SPV_WRITER)
   tint_target_add_dependencies(tint_lang_spirv_writer_bench bench
     tint_lang_spirv_writer
+    tint_lang_spirv_writer_ast_printer
     tint_lang_spirv_writer_common
   )
 endif(TINT_BUILD_SPV_WRITER)
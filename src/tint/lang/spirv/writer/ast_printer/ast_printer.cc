@@ -28,6 +28,7 @@
 #include "src/tint/lang/spirv/writer/ast_printer/ast_printer.h"
 
 #include <unordered_map>
+#include <utility>
 
 #include "src/tint/lang/spirv/writer/ast_raise/for_loop_to_loop.h"
 #include "src/tint/lang/spirv/writer/ast_raise/merge_return.h"
@@ -85,6 +86,8 @@ SanitizedResult Sanitize(const Program& in, const Options& options) {
     // Required for arrayLength()
     manager.Add<ast::transform::SimplifyPointers>();
 
+    // RemovePhonies and VectorizeScalarMatrixInitializers are LocalTransforms. Keep them adjacent,
+    // so that the Manager applies both with a single clone and resolve of the program.
     manager.Add<ast::transform::RemovePhonies>();
     manager.Add<ast::transform::VectorizeScalarMatrixInitializers>();
     manager.Add<VectorizeMatrixConversions>();
@@ -193,6 +196,9 @@ SanitizedResult Sanitize(const Program& in, const Options& options) {
     SanitizedResult result;
     ast::transform::DataMap outputs;
     result.program = manager.Run(in, data, outputs);
+    if (auto* timings = outputs.Get<ast::transform::Manager::Timings>()) {
+        result.timings.transforms = std::move(timings->transforms);
+    }
     return result;
 }
 
@@ -34,6 +34,7 @@
 #include "src/tint/lang/spirv/writer/ast_printer/builder.h"
 #include "src/tint/lang/spirv/writer/common/binary_writer.h"
 #include "src/tint/lang/spirv/writer/common/options.h"
+#include "src/tint/lang/wgsl/ast/transform/manager.h"
 #include "src/tint/lang/wgsl/program/program.h"
 
 namespace tint::spirv::writer {
@@ -42,6 +43,8 @@ namespace tint::spirv::writer {
 struct SanitizedResult {
     /// The sanitized program.
     Program program;
+    /// The time taken by each of the sanitizer's transforms.
+    ast::transform::Manager::Timings timings;
 };
 
 /// Sanitize a program in preparation for generating SPIR-V.
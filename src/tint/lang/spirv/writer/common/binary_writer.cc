@@ -27,9 +27,6 @@
 
 #include "src/tint/lang/spirv/writer/common/binary_writer.h"
 
-#include <cstring>
-#include <string>
-
 namespace tint::spirv::writer {
 namespace {
 
@@ -42,8 +39,7 @@ BinaryWriter::BinaryWriter() = default;
 BinaryWriter::~BinaryWriter() = default;
 
 void BinaryWriter::WriteModule(const Module& module) {
-    out_.reserve(module.TotalSize());
-    module.Iterate([this](const Instruction& inst) { this->process_instruction(inst); });
+    module.Encode(out_);
 }
 
 void BinaryWriter::WriteInstruction(const Instruction& inst) {
@@ -59,30 +55,7 @@ void BinaryWriter::WriteHeader(uint32_t bound, uint32_t version) {
 }
 
 void BinaryWriter::process_instruction(const Instruction& inst) {
-    out_.push_back(inst.word_length() << 16 | static_cast<uint32_t>(inst.opcode()));
-    for (const auto& op : inst.operands()) {
-        process_op(op);
-    }
-}
-
-void BinaryWriter::process_op(const Operand& op) {
-    if (auto* i = std::get_if<uint32_t>(&op)) {
-        out_.push_back(*i);
-        return;
-    }
-    if (auto* f = std::get_if<float>(&op)) {
-        // Allocate space for the float
-        out_.push_back(0);
-        uint8_t* ptr = reinterpret_cast<uint8_t*>(out_.data() + (out_.size() - 1));
-        memcpy(ptr, f, 4);
-        return;
-    }
-    if (auto* str = std::get_if<std::string>(&op)) {
-        auto idx = out_.size();
-        out_.resize(out_.size() + OperandLength(op), 0);
-        memcpy(out_.data() + idx, str->c_str(), str->size() + 1);
-        return;
-    }
+    EncodeInstruction(out_, inst.opcode(), inst.operands());
 }
 
 }  // namespace tint::spirv::writer
@@ -63,7 +63,6 @@ class BinaryWriter {
 
   private:
     void process_instruction(const Instruction& inst);
-    void process_op(const Operand& op);
 
     std::vector<uint32_t> out_;
 };
@@ -33,8 +33,9 @@ Function::Function() : declaration_(Instruction{spv::Op::OpNop, {}}), label_op_(
 
 Function::Function(const Instruction& declaration,
                    const Operand& label_op,
-                   const InstructionList& params)
-    : declaration_(declaration), label_op_(label_op), params_(params) {}
+                   const InstructionList& params,
+                   InstructionStorage storage)
+    : declaration_(declaration), label_op_(label_op), params_(params), storage_(storage) {}
 
 Function::Function(const Function& other) = default;
 
@@ -54,11 +55,34 @@ void Function::iterate(std::function<void(const Instruction&)> cb) const {
     for (const auto& var : vars_) {
         cb(var);
     }
+    for (const auto& var : DecodeInstructions(var_words_)) {
+        cb(var);
+    }
     for (const auto& inst : instructions_) {
         cb(inst);
     }
+    for (const auto& inst : DecodeInstructions(instruction_words_)) {
+        cb(inst);
+    }
 
     cb(Instruction{spv::Op::OpFunctionEnd, {}});
 }
 
+void Function::encode(std::vector<uint32_t>& out) const {
+    EncodeInstruction(out, declaration_.opcode(), declaration_.operands());
+    for (const auto& param : params_) {
+        EncodeInstruction(out, param.opcode(), param.operands());
+    }
+    EncodeInstruction(out, spv::Op::OpLabel, {label_op_});
+    for (const auto& var : vars_) {
+        EncodeInstruction(out, var.opcode(), var.operands());
+    }
+    out.insert(out.end(), var_words_.begin(), var_words_.end());
+    for (const auto& inst : instructions_) {
+        EncodeInstruction(out, inst.opcode(), inst.operands());
+    }
+    out.insert(out.end(), instruction_words_.begin(), instruction_words_.end());
+    EncodeInstruction(out, spv::Op::OpFunctionEnd, {});
+}
+
 }  // namespace tint::spirv::writer
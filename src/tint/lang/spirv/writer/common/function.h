@@ -28,7 +28,9 @@
 #ifndef SRC_TINT_LANG_SPIRV_WRITER_COMMON_FUNCTION_H_
 #define SRC_TINT_LANG_SPIRV_WRITER_COMMON_FUNCTION_H_
 
+#include <cstdint>
 #include <functional>
+#include <vector>
 
 #include "src/tint/lang/spirv/writer/common/instruction.h"
 
@@ -45,9 +47,11 @@ class Function {
     /// @param declaration the function declaration
     /// @param label_op the operand for function's entry block label
     /// @param params the function parameters
+    /// @param storage how the instructions of the function body are held
     Function(const Instruction& declaration,
              const Operand& label_op,
-             const InstructionList& params);
+             const InstructionList& params,
+             InstructionStorage storage = InstructionStorage::kInstructions);
     /// Copy constructor
     /// @param other the function to copy
     Function(const Function& other);
@@ -58,10 +62,16 @@ class Function {
     /// Destructor
     ~Function();
 
-    /// Iterates over the function call the cb on each instruction
+    /// Iterates over the function call the cb on each instruction.
+    /// If the function uses InstructionStorage::kWords, the instructions of the body are decoded
+    /// from their words.
     /// @param cb the callback to call
     void iterate(std::function<void(const Instruction&)> cb) const;
 
+    /// Appends the SPIR-V binary encoding of the whole function to @p out.
+    /// @param out the words to append to
+    void encode(std::vector<uint32_t>& out) const;
+
     /// @returns the declaration
     const Instruction& declaration() const { return declaration_; }
 
@@ -71,24 +81,38 @@ class Function {
     /// Adds an instruction to the instruction list
     /// @param op the op to set
     /// @param operands the operands for the instruction
-    void push_inst(spv::Op op, const OperandList& operands) {
-        instructions_.push_back(Instruction{op, operands});
+    void push_inst(spv::Op op, OperandSpan operands) {
+        if (storage_ == InstructionStorage::kWords) {
+            EncodeInstruction(instruction_words_, op, operands);
+        } else {
+            instructions_.push_back(Instruction{op, OperandList(operands.begin(), operands.end())});
+        }
     }
-    /// @returns the instruction list
+    /// @returns the instruction list. Empty if the function uses InstructionStorage::kWords.
     const InstructionList& instructions() const { return instructions_; }
 
+    /// @returns true if an instruction has been added to the instruction list
+    bool has_instructions() const {
+        return !instructions_.empty() || !instruction_words_.empty();
+    }
+
     /// Adds a variable to the variable list
     /// @param operands the operands for the variable
-    void push_var(const OperandList& operands) {
-        vars_.push_back(Instruction{spv::Op::OpVariable, operands});
+    void push_var(OperandSpan operands) {
+        if (storage_ == InstructionStorage::kWords) {
+            EncodeInstruction(var_words_, spv::Op::OpVariable, operands);
+        } else {
+            vars_.push_back(
+                Instruction{spv::Op::OpVariable, OperandList(operands.begin(), operands.end())});
+        }
     }
-    /// @returns the variable list
+    /// @returns the variable list. Empty if the function uses InstructionStorage::kWords.
     const InstructionList& variables() const { return vars_; }
 
     /// @returns the word length of the function
     uint32_t word_length() const {
-        // 1 for the Label and 1 for the FunctionEnd
-        uint32_t size = 2 + declaration_.word_length();
+        // 2 for the Label and 1 for the FunctionEnd
+        uint32_t size = 3 + declaration_.word_length();
 
         for (const auto& param : params_) {
             size += param.word_length();
@@ -99,6 +123,7 @@ class Function {
         for (const auto& inst : instructions_) {
             size += inst.word_length();
         }
+        size += static_cast<uint32_t>(var_words_.size() + instruction_words_.size());
         return size;
     }
 
@@ -111,6 +136,9 @@ class Function {
     InstructionList params_;
     InstructionList vars_;
     InstructionList instructions_;
+    InstructionStorage storage_ = InstructionStorage::kInstructions;
+    std::vector<uint32_t> var_words_;
+    std::vector<uint32_t> instruction_words_;
 };
 
 }  // namespace tint::spirv::writer
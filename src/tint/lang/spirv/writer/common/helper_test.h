@@ -175,7 +175,7 @@ class SpirvWriterTestHelperBase : public BASE {
     }
 
     /// @returns the disassembled types from the generated module.
-    std::string DumpTypes() { return DumpInstructions(spirv_.Types()); }
+    std::string DumpTypes() { return DumpInstructions(DecodeInstructions(spirv_.TypeWords())); }
 
     /// Helper to make a scalar type corresponding to the element type `type`.
     /// @param type the element type
@@ -27,6 +27,8 @@
 
 #include "src/tint/lang/spirv/writer/common/instruction.h"
 
+#include <cstring>
+#include <string>
 #include <utility>
 
 namespace tint::spirv::writer {
@@ -48,4 +50,47 @@ uint32_t Instruction::word_length() const {
     return size;
 }
 
+void EncodeInstruction(std::vector<uint32_t>& out, spv::Op op, OperandSpan operands) {
+    // Reserve the word holding the opcode and word count, which is known once the operands have
+    // been written.
+    auto start = out.size();
+    out.push_back(0);
+    for (const auto& operand : operands) {
+        if (auto* i = std::get_if<uint32_t>(&operand)) {
+            out.push_back(*i);
+        } else if (auto* f = std::get_if<float>(&operand)) {
+            uint32_t bits = 0;
+            memcpy(&bits, f, sizeof(bits));
+            out.push_back(bits);
+        } else if (auto* str = std::get_if<std::string>(&operand)) {
+            // Pack the string in place, nul-terminated and padded with zeros to a whole word.
+            auto idx = out.size();
+            out.resize(idx + OperandLength(operand), 0);
+            memcpy(out.data() + idx, str->c_str(), str->size());
+        }
+    }
+    auto word_count = static_cast<uint32_t>(out.size() - start);
+    out[start] = word_count << 16 | static_cast<uint32_t>(op);
+}
+
+InstructionList DecodeInstructions(const std::vector<uint32_t>& words) {
+    InstructionList instructions;
+    size_t i = 0;
+    while (i < words.size()) {
+        uint32_t word_count = words[i] >> 16;
+        auto op = static_cast<spv::Op>(words[i] & 0xffff);
+        if (word_count == 0 || i + word_count > words.size()) {
+            break;  // Malformed
+        }
+        OperandList operands;
+        operands.reserve(word_count - 1);
+        for (uint32_t w = 1; w < word_count; w++) {
+            operands.push_back(Operand(words[i + w]));
+        }
+        instructions.push_back(Instruction{op, std::move(operands)});
+        i += word_count;
+    }
+    return instructions;
+}
+
 }  // namespace tint::spirv::writer
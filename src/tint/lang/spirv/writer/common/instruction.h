@@ -28,6 +28,7 @@
 #ifndef SRC_TINT_LANG_SPIRV_WRITER_COMMON_INSTRUCTION_H_
 #define SRC_TINT_LANG_SPIRV_WRITER_COMMON_INSTRUCTION_H_
 
+#include <cstdint>
 #include <vector>
 
 #include "spirv/unified1/spirv.hpp11"
@@ -68,6 +69,27 @@ class Instruction {
 /// A list of instructions
 using InstructionList = std::vector<Instruction>;
 
+/// How a Module or Function holds the instructions pushed to it
+enum class InstructionStorage : uint8_t {
+    /// Instructions are held as Instruction objects, which can be inspected individually.
+    kInstructions,
+    /// Instructions are encoded into SPIR-V words as they are pushed, without allocating an
+    /// Instruction or OperandList for each of them.
+    kWords,
+};
+
+/// Appends the SPIR-V binary encoding of an instruction to @p out.
+/// @param out the words to append to
+/// @param op the instruction opcode
+/// @param operands the instruction operands
+void EncodeInstruction(std::vector<uint32_t>& out, spv::Op op, OperandSpan operands);
+
+/// Decodes a sequence of SPIR-V binary encoded instructions. As the types of the operands are not
+/// known, every operand word is decoded as a separate uint32_t operand.
+/// @param words the encoded instructions
+/// @returns the decoded instructions
+InstructionList DecodeInstructions(const std::vector<uint32_t>& words);
+
 }  // namespace tint::spirv::writer
 
 #endif  // SRC_TINT_LANG_SPIRV_WRITER_COMMON_INSTRUCTION_H_
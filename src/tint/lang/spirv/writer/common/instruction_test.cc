@@ -27,7 +27,9 @@
 
 #include "src/tint/lang/spirv/writer/common/instruction.h"
 
+#include <cstring>
 #include <string>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -57,5 +59,32 @@ TEST_F(SpirvWriterInstructionTest, Length) {
     EXPECT_EQ(i.word_length(), 5u);
 }
 
+TEST_F(SpirvWriterInstructionTest, Encode) {
+    std::vector<uint32_t> words;
+    EncodeInstruction(words, spv::Op::OpEntryPoint, {Operand(1.5f), Operand(1u), Operand("abcd")});
+
+    ASSERT_EQ(words.size(), 5u);
+    EXPECT_EQ(words[0], 5u << 16 | static_cast<uint32_t>(spv::Op::OpEntryPoint));
+    EXPECT_EQ(words[1], 0x3fc00000u);
+    EXPECT_EQ(words[2], 1u);
+    EXPECT_EQ(memcmp(&words[3], "abcd", 4), 0);
+    EXPECT_EQ(words[4], 0u);
+}
+
+TEST_F(SpirvWriterInstructionTest, Decode) {
+    std::vector<uint32_t> words;
+    EncodeInstruction(words, spv::Op::OpTypeFloat, {Operand(1u), Operand(32u)});
+    EncodeInstruction(words, spv::Op::OpReturn, {});
+
+    auto insts = DecodeInstructions(words);
+    ASSERT_EQ(insts.size(), 2u);
+    EXPECT_EQ(insts[0].opcode(), spv::Op::OpTypeFloat);
+    ASSERT_EQ(insts[0].operands().size(), 2u);
+    EXPECT_EQ(std::get<uint32_t>(insts[0].operands()[0]), 1u);
+    EXPECT_EQ(std::get<uint32_t>(insts[0].operands()[1]), 32u);
+    EXPECT_EQ(insts[1].opcode(), spv::Op::OpReturn);
+    EXPECT_TRUE(insts[1].operands().empty());
+}
+
 }  // namespace
 }  // namespace tint::spirv::writer
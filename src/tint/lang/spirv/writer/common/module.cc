@@ -43,7 +43,7 @@ uint32_t SizeOf(const InstructionList& instructions) {
 
 }  // namespace
 
-Module::Module() = default;
+Module::Module(InstructionStorage storage) : storage_(storage) {}
 
 Module::Module(const Module&) = default;
 
@@ -59,64 +59,78 @@ uint32_t Module::TotalSize() const {
     // The 5 covers the magic, version, generator, id bound and reserved.
     uint32_t size = 5;
 
-    size += SizeOf(capabilities_);
-    size += SizeOf(extensions_);
-    size += SizeOf(ext_imports_);
-    size += SizeOf(memory_model_);
-    size += SizeOf(entry_points_);
-    size += SizeOf(execution_modes_);
-    size += SizeOf(debug_);
-    size += SizeOf(annotations_);
-    size += SizeOf(types_);
+    for (auto* section : {&capabilities_, &extensions_, &ext_imports_, &memory_model_,
+                          &entry_points_, &execution_modes_, &debug_, &annotations_, &types_}) {
+        size += SizeOf(section->instructions);
+        size += static_cast<uint32_t>(section->words.size());
+    }
     for (const auto& func : functions_) {
         size += func.word_length();
     }
+    size += static_cast<uint32_t>(function_words_.size());
 
     return size;
 }
 
 void Module::Iterate(std::function<void(const Instruction&)> cb) const {
-    for (const auto& inst : capabilities_) {
-        cb(inst);
-    }
-    for (const auto& inst : extensions_) {
-        cb(inst);
-    }
-    for (const auto& inst : ext_imports_) {
-        cb(inst);
+    for (auto* section : {&capabilities_, &extensions_, &ext_imports_, &memory_model_,
+                          &entry_points_, &execution_modes_, &debug_, &annotations_, &types_}) {
+        for (const auto& inst : section->instructions) {
+            cb(inst);
+        }
+        for (const auto& inst : DecodeInstructions(section->words)) {
+            cb(inst);
+        }
     }
-    for (const auto& inst : memory_model_) {
-        cb(inst);
-    }
-    for (const auto& inst : entry_points_) {
-        cb(inst);
+    for (const auto& func : functions_) {
+        func.iterate(cb);
     }
-    for (const auto& inst : execution_modes_) {
+    for (const auto& inst : DecodeInstructions(function_words_)) {
         cb(inst);
     }
-    for (const auto& inst : debug_) {
-        cb(inst);
+}
+
+void Module::Encode(std::vector<uint32_t>& out) const {
+    out.reserve(out.size() + TotalSize());
+    for (auto* section : {&capabilities_, &extensions_, &ext_imports_, &memory_model_,
+                          &entry_points_, &execution_modes_, &debug_, &annotations_, &types_}) {
+        for (const auto& inst : section->instructions) {
+            EncodeInstruction(out, inst.opcode(), inst.operands());
+        }
+        out.insert(out.end(), section->words.begin(), section->words.end());
     }
-    for (const auto& inst : annotations_) {
-        cb(inst);
+    for (const auto& func : functions_) {
+        func.encode(out);
     }
-    for (const auto& inst : types_) {
-        cb(inst);
+    out.insert(out.end(), function_words_.begin(), function_words_.end());
+}
+
+void Module::Push(Section& section, spv::Op op, OperandSpan operands) {
+    if (storage_ == InstructionStorage::kWords) {
+        EncodeInstruction(section.words, op, operands);
+    } else {
+        section.instructions.push_back(
+            Instruction{op, OperandList(operands.begin(), operands.end())});
     }
-    for (const auto& func : functions_) {
-        func.iterate(cb);
+}
+
+void Module::PushFunction(const Function& func) {
+    if (storage_ == InstructionStorage::kWords) {
+        func.encode(function_words_);
+    } else {
+        functions_.push_back(func);
     }
 }
 
 void Module::PushCapability(uint32_t cap) {
     if (capability_set_.Add(cap)) {
-        capabilities_.push_back(Instruction{spv::Op::OpCapability, {Operand(cap)}});
+        Push(capabilities_, spv::Op::OpCapability, {Operand(cap)});
     }
 }
 
 void Module::PushExtension(const char* extension) {
     if (extension_set_.Add(extension)) {
-        extensions_.push_back(Instruction{spv::Op::OpExtension, {Operand(extension)}});
+        Push(extensions_, spv::Op::OpExtension, {Operand(extension)});
     }
 }
 
@@ -43,7 +43,11 @@ namespace tint::spirv::writer {
 class Module {
   public:
     /// Constructor
-    Module();
+    /// @param storage how the instructions of the module are held. With
+    /// InstructionStorage::kWords, the instructions are encoded into a buffer of words for each
+    /// section of the module as they are pushed, and the instruction list accessors such as
+    /// Types() return empty lists.
+    explicit Module(InstructionStorage storage = InstructionStorage::kInstructions);
 
     /// Copy constructor
     /// @param other the other Module to copy
@@ -80,114 +84,129 @@ class Module {
     }
 
     /// Iterates over all the instructions in the correct order and calls the given callback.
+    /// If the module uses InstructionStorage::kWords, the instructions are decoded from their
+    /// words.
     /// @param cb the callback to execute
     void Iterate(std::function<void(const Instruction&)> cb) const;
 
+    /// Appends the SPIR-V binary encoding of all the instructions, in the correct order, to
+    /// @p out. This does not include the SPIR-V header.
+    /// @param out the words to append to
+    void Encode(std::vector<uint32_t>& out) const;
+
+    /// @returns how the instructions of the module are held
+    InstructionStorage Storage() const { return storage_; }
+
     /// Add an instruction to the list of capabilities, if the capability hasn't already been added.
     /// @param cap the capability to set
     void PushCapability(uint32_t cap);
 
     /// @returns the capabilities
-    const InstructionList& Capabilities() const { return capabilities_; }
+    const InstructionList& Capabilities() const { return capabilities_.instructions; }
 
     /// Add an instruction to the list of extensions.
     /// @param extension the name of the extension
     void PushExtension(const char* extension);
 
     /// @returns the extensions
-    const InstructionList& Extensions() const { return extensions_; }
+    const InstructionList& Extensions() const { return extensions_.instructions; }
 
     /// Add an instruction to the list of imported extension instructions.
     /// @param op the op to set
     /// @param operands the operands for the instruction
-    void PushExtImport(spv::Op op, const OperandList& operands) {
-        ext_imports_.push_back(Instruction{op, operands});
-    }
+    void PushExtImport(spv::Op op, OperandSpan operands) { Push(ext_imports_, op, operands); }
 
     /// @returns the ext imports
-    const InstructionList& ExtImports() const { return ext_imports_; }
+    const InstructionList& ExtImports() const { return ext_imports_.instructions; }
 
     /// Add an instruction to the memory model.
     /// @param op the op to set
     /// @param operands the operands for the instruction
-    void PushMemoryModel(spv::Op op, const OperandList& operands) {
-        memory_model_.push_back(Instruction{op, operands});
-    }
+    void PushMemoryModel(spv::Op op, OperandSpan operands) { Push(memory_model_, op, operands); }
 
     /// @returns the memory model
-    const InstructionList& MemoryModel() const { return memory_model_; }
+    const InstructionList& MemoryModel() const { return memory_model_.instructions; }
 
     /// Add an instruction to the list pf entry points.
     /// @param op the op to set
     /// @param operands the operands for the instruction
-    void PushEntryPoint(spv::Op op, const OperandList& operands) {
-        entry_points_.push_back(Instruction{op, operands});
-    }
+    void PushEntryPoint(spv::Op op, OperandSpan operands) { Push(entry_points_, op, operands); }
     /// @returns the entry points
-    const InstructionList& EntryPoints() const { return entry_points_; }
+    const InstructionList& EntryPoints() const { return entry_points_.instructions; }
 
     /// Add an instruction to the execution mode declarations.
     /// @param op the op to set
     /// @param operands the operands for the instruction
-    void PushExecutionMode(spv::Op op, const OperandList& operands) {
-        execution_modes_.push_back(Instruction{op, operands});
+    void PushExecutionMode(spv::Op op, OperandSpan operands) {
+        Push(execution_modes_, op, operands);
     }
 
     /// @returns the execution modes
-    const InstructionList& ExecutionModes() const { return execution_modes_; }
+    const InstructionList& ExecutionModes() const { return execution_modes_.instructions; }
 
     /// Add an instruction to the debug declarations.
     /// @param op the op to set
     /// @param operands the operands for the instruction
-    void PushDebug(spv::Op op, const OperandList& operands) {
-        debug_.push_back(Instruction{op, operands});
-    }
+    void PushDebug(spv::Op op, OperandSpan operands) { Push(debug_, op, operands); }
 
     /// @returns the debug instructions
-    const InstructionList& Debug() const { return debug_; }
+    const InstructionList& Debug() const { return debug_.instructions; }
 
     /// Add an instruction to the type declarations.
     /// @param op the op to set
     /// @param operands the operands for the instruction
-    void PushType(spv::Op op, const OperandList& operands) {
-        types_.push_back(Instruction{op, operands});
-    }
+    void PushType(spv::Op op, OperandSpan operands) { Push(types_, op, operands); }
 
-    /// @returns the type instructions
-    const InstructionList& Types() const { return types_; }
+    /// @returns the type instructions. Empty if the module uses InstructionStorage::kWords.
+    const InstructionList& Types() const { return types_.instructions; }
+
+    /// @returns the encoded type instructions, if the module uses InstructionStorage::kWords
+    const std::vector<uint32_t>& TypeWords() const { return types_.words; }
 
     /// Add an instruction to the annotations.
     /// @param op the op to set
     /// @param operands the operands for the instruction
-    void PushAnnot(spv::Op op, const OperandList& operands) {
-        annotations_.push_back(Instruction{op, operands});
-    }
+    void PushAnnot(spv::Op op, OperandSpan operands) { Push(annotations_, op, operands); }
 
     /// @returns the annotations
-    const InstructionList& Annots() const { return annotations_; }
+    const InstructionList& Annots() const { return annotations_.instructions; }
 
     /// Add a function to the module.
     /// @param func the function to add
-    void PushFunction(const Function& func) { functions_.push_back(func); }
+    void PushFunction(const Function& func);
 
-    /// @returns the functions
+    /// @returns the functions. Empty if the module uses InstructionStorage::kWords.
     const std::vector<Function>& Functions() const { return functions_; }
 
     /// @returns the SPIR-V code as a vector of uint32_t
     std::vector<uint32_t>& Code() { return code_; }
 
   private:
+    /// A logical section of the module. Only one of the members is used, depending on the storage
+    /// of the module.
+    struct Section {
+        /// The instructions, with InstructionStorage::kInstructions
+        InstructionList instructions;
+        /// The encoded instructions, with InstructionStorage::kWords
+        std::vector<uint32_t> words;
+    };
+
+    /// Adds an instruction to a section of the module
+    void Push(Section& section, spv::Op op, OperandSpan operands);
+
+    InstructionStorage storage_ = InstructionStorage::kInstructions;
     uint32_t next_id_ = 1;
-    InstructionList capabilities_;
-    InstructionList extensions_;
-    InstructionList ext_imports_;
-    InstructionList memory_model_;
-    InstructionList entry_points_;
-    InstructionList execution_modes_;
-    InstructionList debug_;
-    InstructionList types_;
-    InstructionList annotations_;
+    Section capabilities_;
+    Section extensions_;
+    Section ext_imports_;
+    Section memory_model_;
+    Section entry_points_;
+    Section execution_modes_;
+    Section debug_;
+    Section types_;
+    Section annotations_;
     std::vector<Function> functions_;
+    std::vector<uint32_t> function_words_;
     Hashset<uint32_t, 8> capability_set_;
     Hashset<std::string, 8> extension_set_;
     std::vector<uint32_t> code_;
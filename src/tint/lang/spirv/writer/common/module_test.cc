@@ -62,5 +62,57 @@ TEST_F(SpirvWriterModuleTest, DeclareExtension) {
     EXPECT_EQ(DumpInstructions(m.Extensions()), "OpExtension \"SPV_KHR_integer_dot_product\"\n");
 }
 
+/// Pushes the same instructions to @p m, regardless of its storage
+void BuildModule(Module& m) {
+    m.PushCapability(SpvCapabilityShader);
+    m.PushCapability(SpvCapabilityShader);
+    m.PushMemoryModel(spv::Op::OpMemoryModel,
+                      {U32Operand(SpvAddressingModelLogical), U32Operand(SpvMemoryModelGLSL450)});
+    m.PushDebug(spv::Op::OpName, {1u, Operand("main")});
+    m.PushType(spv::Op::OpTypeVoid, {2u});
+    m.PushType(spv::Op::OpTypeFunction, OperandList{3u, 2u});
+    m.PushType(spv::Op::OpTypeFloat, {4u, 32u});
+    m.PushType(spv::Op::OpConstant, {4u, 5u, Operand(1.5f)});
+
+    Function f(
+        Instruction{spv::Op::OpFunction, {2u, 1u, U32Operand(SpvFunctionControlMaskNone), 3u}}, 6u,
+        {}, m.Storage());
+    EXPECT_FALSE(f.has_instructions());
+    f.push_inst(spv::Op::OpReturn, {});
+    EXPECT_TRUE(f.has_instructions());
+    m.PushFunction(f);
+}
+
+TEST_F(SpirvWriterModuleTest, WordStorage_MatchesInstructionStorage) {
+    Module instructions;
+    BuildModule(instructions);
+    Module words(InstructionStorage::kWords);
+    BuildModule(words);
+
+    EXPECT_TRUE(words.Types().empty());
+    EXPECT_TRUE(words.Functions().empty());
+    EXPECT_EQ(words.TotalSize(), instructions.TotalSize());
+    EXPECT_EQ(DumpModule(words), DumpModule(instructions));
+    EXPECT_EQ(DumpModule(words), R"(OpCapability Shader
+OpMemoryModel Logical GLSL450
+OpName %1 "main"
+%2 = OpTypeVoid
+%3 = OpTypeFunction %2
+%4 = OpTypeFloat 32
+%5 = OpConstant %4 1.5
+%1 = OpFunction %2 None %3
+%6 = OpLabel
+OpReturn
+OpFunctionEnd
+)");
+}
+
+TEST_F(SpirvWriterModuleTest, WordStorage_TypeWords) {
+    Module m(InstructionStorage::kWords);
+    m.PushType(spv::Op::OpTypeFloat, {1u, 32u});
+
+    EXPECT_EQ(DumpInstructions(DecodeInstructions(m.TypeWords())), "%1 = OpTypeFloat 32\n");
+}
+
 }  // namespace
 }  // namespace tint::spirv::writer
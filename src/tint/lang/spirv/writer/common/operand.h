@@ -29,6 +29,8 @@
 #define SRC_TINT_LANG_SPIRV_WRITER_COMMON_OPERAND_H_
 
 #include <cstring>
+#include <initializer_list>
+#include <iterator>
 #include <string>
 #include <variant>
 #include <vector>
@@ -54,6 +56,34 @@ using OperandList = std::vector<Operand>;
 
 using OperandListKey = tint::UnorderedKeyWrapper<OperandList>;
 
+/// A non-owning view of the operands of an instruction, which can be built from a braced list of
+/// operands without allocating an OperandList. An OperandSpan must not outlive its operands.
+class OperandSpan {
+  public:
+    /// Constructor
+    /// @param operands the operands
+    OperandSpan(std::initializer_list<Operand> operands)  // NOLINT(runtime/explicit)
+        : begin_(std::data(operands)), end_(std::data(operands) + operands.size()) {}
+
+    /// Constructor
+    /// @param operands the operands
+    OperandSpan(const OperandList& operands)  // NOLINT(runtime/explicit)
+        : begin_(operands.data()), end_(operands.data() + operands.size()) {}
+
+    /// @returns a pointer to the first operand
+    const Operand* begin() const { return begin_; }
+
+    /// @returns a pointer one past the last operand
+    const Operand* end() const { return end_; }
+
+    /// @returns the number of operands
+    size_t size() const { return static_cast<size_t>(end_ - begin_); }
+
+  private:
+    const Operand* begin_;
+    const Operand* end_;
+};
+
 }  // namespace tint::spirv::writer
 
 #endif  // SRC_TINT_LANG_SPIRV_WRITER_COMMON_OPERAND_H_
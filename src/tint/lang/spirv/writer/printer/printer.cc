@@ -217,7 +217,7 @@ class Printer {
   private:
     core::ir::Module& ir_;
     core::ir::Builder b_;
-    writer::Module module_;
+    writer::Module module_{InstructionStorage::kWords};
     BinaryWriter writer_;
 
     /// A function type used for an OpTypeFunction declaration.
@@ -728,7 +728,8 @@ class Printer {
 
         // Create a function that we will add instructions to.
         auto entry_block = module_.NextId();
-        current_function_ = Function(decl, entry_block, std::move(params));
+        current_function_ =
+            Function(decl, entry_block, std::move(params), InstructionStorage::kWords);
         TINT_DEFER(current_function_ = Function());
 
         // Emit the body of the function.
@@ -825,7 +826,7 @@ class Printer {
     void EmitBlock(core::ir::Block* block) {
         // Emit the label.
         // Skip if this is the function's entry block, as it will be emitted by the function object.
-        if (!current_function_.instructions().empty()) {
+        if (current_function_.has_instructions()) {
             current_function_.push_inst(spv::Op::OpLabel, {Label(block)});
         }
 
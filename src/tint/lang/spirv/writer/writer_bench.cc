@@ -25,9 +25,15 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <chrono>
+#include <map>
 #include <string>
 
+#include "spirv/unified1/spirv.h"
 #include "src/tint/cmd/bench/bench.h"
+#include "src/tint/lang/spirv/writer/ast_printer/ast_printer.h"
+#include "src/tint/lang/spirv/writer/common/binary_writer.h"
+#include "src/tint/lang/spirv/writer/common/module.h"
 #include "src/tint/lang/spirv/writer/writer.h"
 
 #if TINT_BUILD_WGSL_READER
@@ -76,8 +82,96 @@ void GenerateSPIRV_UseIR(benchmark::State& state, std::string input_name) {
 #endif  // TINT_BUILD_WGSL_READER
 }
 
+/// Runs the AST sanitizer of the SPIR-V generator, and reports the average time taken by each of its
+/// transforms as a counter. The clone and resolve shared by each run of local transforms is
+/// reported as Manager::Timings::kSharedClone.
+void SanitizeSPIRV(benchmark::State& state, std::string input_name) {
+    auto res = bench::LoadProgram(input_name);
+    if (res != Success) {
+        state.SkipWithError(res.Failure().reason.Str());
+        return;
+    }
+    std::map<std::string, std::chrono::duration<double>> durations;
+    for (auto _ : state) {
+        auto sanitized = Sanitize(res->program, {});
+        if (!sanitized.program.IsValid()) {
+            state.SkipWithError(sanitized.program.Diagnostics().Str());
+            return;
+        }
+        for (auto& timing : sanitized.timings.transforms) {
+            durations[timing.name] += timing.duration;
+        }
+    }
+    for (auto& it : durations) {
+        state.counters[it.first] =
+            benchmark::Counter(it.second.count(), benchmark::Counter::kAvgIterations);
+    }
+}
+
+/// Builds and serializes a module with a large number of types, constants and instructions, as
+/// emitted for a large compute shader, to compare the costs of the instruction storages.
+void BuildModule(benchmark::State& state, InstructionStorage storage) {
+    constexpr uint32_t kNumConstants = 2000;
+    constexpr uint32_t kNumInstructions = 20000;
+    for (auto _ : state) {
+        Module module(storage);
+        module.PushCapability(SpvCapabilityShader);
+        module.PushMemoryModel(spv::Op::OpMemoryModel, {U32Operand(SpvAddressingModelLogical),
+                                                        U32Operand(SpvMemoryModelGLSL450)});
+        auto void_ty = module.NextId();
+        auto fn_ty = module.NextId();
+        auto u32_ty = module.NextId();
+        auto ptr_ty = module.NextId();
+        module.PushType(spv::Op::OpTypeVoid, {void_ty});
+        module.PushType(spv::Op::OpTypeFunction, {fn_ty, void_ty});
+        module.PushType(spv::Op::OpTypeInt, {u32_ty, 32u, 0u});
+        module.PushType(spv::Op::OpTypePointer,
+                        {ptr_ty, U32Operand(SpvStorageClassFunction), u32_ty});
+        uint32_t first_constant = module.NextId();
+        for (uint32_t i = 1; i < kNumConstants; i++) {
+            module.NextId();
+        }
+        for (uint32_t i = 0; i < kNumConstants; i++) {
+            module.PushType(spv::Op::OpConstant, {u32_ty, first_constant + i, i});
+        }
+
+        auto fn = module.NextId();
+        module.PushDebug(spv::Op::OpName, {fn, Operand("main")});
+        Function func(
+            Instruction{spv::Op::OpFunction,
+                        {void_ty, fn, U32Operand(SpvFunctionControlMaskNone), fn_ty}},
+            module.NextId(), {}, storage);
+        auto var = module.NextId();
+        func.push_var({ptr_ty, var, U32Operand(SpvStorageClassFunction)});
+        for (uint32_t i = 0; i < kNumInstructions; i++) {
+            auto value = module.NextId();
+            func.push_inst(spv::Op::OpIAdd, {u32_ty, value, first_constant + i % kNumConstants,
+                                             first_constant + (i + 1) % kNumConstants});
+            func.push_inst(spv::Op::OpStore, {var, value});
+        }
+        func.push_inst(spv::Op::OpReturn, {});
+        module.PushFunction(func);
+
+        BinaryWriter writer;
+        writer.WriteHeader(module.IdBound());
+        writer.WriteModule(module);
+        benchmark::DoNotOptimize(writer.Result().data());
+    }
+}
+
+void BuildModule_Instructions(benchmark::State& state) {
+    BuildModule(state, InstructionStorage::kInstructions);
+}
+
+void BuildModule_Words(benchmark::State& state) {
+    BuildModule(state, InstructionStorage::kWords);
+}
+
 TINT_BENCHMARK_PROGRAMS(GenerateSPIRV);
 TINT_BENCHMARK_PROGRAMS(GenerateSPIRV_UseIR);
+TINT_BENCHMARK_PROGRAMS(SanitizeSPIRV);
+BENCHMARK(BuildModule_Instructions);
+BENCHMARK(BuildModule_Words);
 
 }  // namespace
 }  // namespace tint::spirv::writer
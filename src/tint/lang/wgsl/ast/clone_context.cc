@@ -39,11 +39,14 @@ CloneContext::CloneContext(ast::Builder* to, GenerationID from) : dst(to), src_i
 CloneContext::~CloneContext() = default;
 
 Symbol CloneContext::Clone(Symbol s) {
+    if (shared_symbols_) {
+        return Symbol{s.value(), dst->ID(), s.NameView()};
+    }
     return cloned_symbols_.GetOrAdd(s, [&]() -> Symbol {
         if (symbol_transform_) {
             return symbol_transform_(s);
         }
-        return dst->Symbols().New(s.Name());
+        return dst->Symbols().New(s.NameView());
     });
 }
 
@@ -142,6 +142,11 @@ class CloneContext {
     /// @return the cloned source
     Symbol Clone(Symbol s);
 
+    /// Declares that the symbol table of #dst shares the symbol table of the source program, using
+    /// SymbolTable::WrapShared(). Clone() then returns each symbol of the source program as the
+    /// symbol of #dst with the same value and name, instead of adding a new symbol to #dst.
+    void UseSharedSymbols() { shared_symbols_ = true; }
+
     /// Clones each of the elements of the vector `v` into the Builder
     /// #dst.
     ///
@@ -598,6 +603,9 @@ class CloneContext {
 
     /// Symbol transform registered with ReplaceAll()
     SymbolTransform symbol_transform_;
+
+    /// True if the symbol table of #dst shares the symbol table of the source program
+    bool shared_symbols_ = false;
 };
 
 }  // namespace tint::ast
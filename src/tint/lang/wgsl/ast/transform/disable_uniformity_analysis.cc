@@ -31,7 +31,6 @@
 
 #include "src/tint/lang/wgsl/program/clone_context.h"
 #include "src/tint/lang/wgsl/program/program_builder.h"
-#include "src/tint/lang/wgsl/resolver/resolve.h"
 #include "src/tint/lang/wgsl/sem/module.h"
 
 TINT_INSTANTIATE_TYPEINFO(tint::ast::transform::DisableUniformityAnalysis);
@@ -42,20 +41,16 @@ DisableUniformityAnalysis::DisableUniformityAnalysis() = default;
 
 DisableUniformityAnalysis::~DisableUniformityAnalysis() = default;
 
-Transform::ApplyResult DisableUniformityAnalysis::Apply(const Program& src,
-                                                        const DataMap&,
-                                                        DataMap&) const {
-    if (src.Sem().Module()->Extensions().Contains(
+LocalTransform::RewriteResult DisableUniformityAnalysis::Rewrite(program::CloneContext& ctx,
+                                                                 const DataMap&,
+                                                                 DataMap&) const {
+    if (ctx.src->Sem().Module()->Extensions().Contains(
             wgsl::Extension::kChromiumDisableUniformityAnalysis)) {
         return SkipTransform;
     }
 
-    ProgramBuilder b;
-    program::CloneContext ctx{&b, &src, /* auto_clone_symbols */ true};
-    b.Enable(wgsl::Extension::kChromiumDisableUniformityAnalysis);
-
-    ctx.Clone();
-    return resolver::Resolve(b);
+    ctx.dst->Enable(wgsl::Extension::kChromiumDisableUniformityAnalysis);
+    return Rewritten();
 }
 
 }  // namespace tint::ast::transform
@@ -27,6 +27,7 @@
 
 #include "src/tint/lang/wgsl/ast/transform/expand_compound_assignment.h"
 
+#include <memory>
 #include <utility>
 
 #include "src/tint/lang/wgsl/ast/compound_assignment_statement.h"
@@ -34,7 +35,6 @@
 #include "src/tint/lang/wgsl/ast/transform/hoist_to_decl_before.h"
 #include "src/tint/lang/wgsl/program/clone_context.h"
 #include "src/tint/lang/wgsl/program/program_builder.h"
-#include "src/tint/lang/wgsl/resolver/resolve.h"
 #include "src/tint/lang/wgsl/sem/block_statement.h"
 #include "src/tint/lang/wgsl/sem/for_loop_statement.h"
 #include "src/tint/lang/wgsl/sem/statement.h"
@@ -60,7 +60,7 @@ bool ShouldRun(const Program& program) {
 }  // namespace
 
 /// PIMPL state for the transform
-struct ExpandCompoundAssignment::State {
+struct ExpandCompoundAssignment::State : public LocalTransform::RewriteState {
     /// Constructor
     /// @param context the clone context
     explicit State(program::CloneContext& context)
@@ -183,28 +183,27 @@ ExpandCompoundAssignment::ExpandCompoundAssignment() = default;
 
 ExpandCompoundAssignment::~ExpandCompoundAssignment() = default;
 
-Transform::ApplyResult ExpandCompoundAssignment::Apply(const Program& src,
-                                                       const DataMap&,
-                                                       DataMap&) const {
-    if (!ShouldRun(src)) {
+LocalTransform::RewriteResult ExpandCompoundAssignment::Rewrite(program::CloneContext& ctx,
+                                                                const DataMap&,
+                                                                DataMap&) const {
+    if (!ShouldRun(*ctx.src)) {
         return SkipTransform;
     }
 
-    ProgramBuilder b;
-    program::CloneContext ctx{&b, &src, /* auto_clone_symbols */ true};
-    State state(ctx);
-    for (auto* node : src.ASTNodes().Objects()) {
+    // The state is kept alive until the program is cloned, as it holds the HoistToDeclBefore
+    // helper used by the CloneContext callbacks.
+    auto state = std::make_unique<State>(ctx);
+    for (auto* node : ctx.src->ASTNodes().Objects()) {
         if (auto* assign = node->As<CompoundAssignmentStatement>()) {
-            state.Expand(assign, assign->lhs, ctx.Clone(assign->rhs), assign->op);
+            state->Expand(assign, assign->lhs, ctx.Clone(assign->rhs), assign->op);
         } else if (auto* inc_dec = node->As<IncrementDecrementStatement>()) {
             // For increment/decrement statements, `i++` becomes `i = i + 1`.
             auto op = inc_dec->increment ? core::BinaryOp::kAdd : core::BinaryOp::kSubtract;
-            state.Expand(inc_dec, inc_dec->lhs, ctx.dst->Expr(1_a), op);
+            state->Expand(inc_dec, inc_dec->lhs, ctx.dst->Expr(1_a), op);
         }
     }
 
-    ctx.Clone();
-    return resolver::Resolve(b);
+    return RewriteResult{std::move(state)};
 }
 
 }  // namespace tint::ast::transform
@@ -51,17 +51,17 @@ namespace tint::ast::transform {
 ///
 /// This transform also handles increment and decrement statements in the same
 /// manner, by replacing `i++` with `i = i + 1`.
-class ExpandCompoundAssignment final : public Castable<ExpandCompoundAssignment, Transform> {
+class ExpandCompoundAssignment final : public Castable<ExpandCompoundAssignment, LocalTransform> {
   public:
     /// Constructor
     ExpandCompoundAssignment();
     /// Destructor
     ~ExpandCompoundAssignment() override;
 
-    /// @copydoc Transform::Apply
-    ApplyResult Apply(const Program& program,
-                      const DataMap& inputs,
-                      DataMap& outputs) const override;
+    /// @copydoc LocalTransform::Rewrite
+    RewriteResult Rewrite(program::CloneContext& ctx,
+                          const DataMap& inputs,
+                          DataMap& outputs) const override;
 
   private:
     struct State;
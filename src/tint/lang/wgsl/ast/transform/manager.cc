@@ -26,10 +26,14 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "src/tint/lang/wgsl/ast/transform/manager.h"
+
+#include <chrono>
+
 #include "src/tint/lang/wgsl/ast/transform/transform.h"
 #include "src/tint/lang/wgsl/program/clone_context.h"
 #include "src/tint/lang/wgsl/program/program_builder.h"
 #include "src/tint/lang/wgsl/resolver/resolve.h"
+#include "src/tint/utils/containers/vector.h"
 
 /// If set to 1 then the transform::Manager will dump the WGSL of the program
 /// before and after each transform. Helpful for debugging bad output.
@@ -42,7 +46,17 @@
 #define TINT_IF_PRINT_PROGRAM(x)
 #endif  // TINT_PRINT_PROGRAM_FOR_EACH_TRANSFORM
 
+TINT_INSTANTIATE_TYPEINFO(tint::ast::transform::Manager::Timings);
+
 namespace tint::ast::transform {
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+}  // namespace
+
+Manager::Timings::Timings() = default;
+Manager::Timings::~Timings() = default;
 
 Manager::Manager() = default;
 Manager::~Manager() = default;
@@ -69,28 +83,76 @@ Program Manager::Run(const Program& program_in, const DataMap& inputs, DataMap&
 #endif
 
     std::optional<Program> output;
+    auto timings = std::make_unique<Timings>();
+
+    auto record = [&](const char* name, Clock::time_point start, bool skipped) {
+        timings->transforms.push_back(Timings::Timing{name, Clock::now() - start, skipped});
+    };
 
     TINT_IF_PRINT_PROGRAM(print_program("Input of", nullptr));
 
-    for (const auto& transform : transforms_) {
-        if (auto result = transform->Apply(*program, inputs, outputs)) {
+    for (size_t i = 0; i < transforms_.size();) {
+        const Transform* transform = transforms_[i].get();
+        if (!transform->Is<LocalTransform>()) {
+            i++;
+            auto start = Clock::now();
+            auto result = transform->Apply(*program, inputs, outputs);
+            record(transform->TypeInfo().name, start, !result);
+            if (!result) {
+                TINT_IF_PRINT_PROGRAM(std::cout << "Skipped " << transform->TypeInfo().name
+                                                << std::endl);
+                continue;
+            }
             output.emplace(std::move(result.value()));
-            program = &output.value();
-
-            if (!program->IsValid()) {
-                TINT_IF_PRINT_PROGRAM(print_program("Invalid output of", transform.get()));
-                break;
+        } else {
+            // Register the rewrites of the run of consecutive local transforms with a single
+            // CloneContext, then clone and resolve the program once.
+            ProgramBuilder b;
+            program::CloneContext ctx{&b, program, /* auto_clone_symbols */ true};
+            Vector<std::unique_ptr<LocalTransform::RewriteState>, 4> states;
+            bool rewritten = false;
+            for (; i < transforms_.size(); i++) {
+                auto* local = transforms_[i]->As<LocalTransform>();
+                if (!local) {
+                    break;
+                }
+                transform = local;
+                auto start = Clock::now();
+                auto result = local->Rewrite(ctx, inputs, outputs);
+                record(local->TypeInfo().name, start, !result);
+                if (!result) {
+                    TINT_IF_PRINT_PROGRAM(std::cout << "Skipped " << local->TypeInfo().name
+                                                    << std::endl);
+                    continue;
+                }
+                rewritten = true;
+                if (result.value()) {
+                    states.Push(std::move(result.value()));
+                }
+            }
+            if (!rewritten) {
+                continue;
             }
+            auto start = Clock::now();
+            ctx.Clone();
+            output.emplace(resolver::Resolve(b));
+            record(Timings::kSharedClone, start, /* skipped */ false);
+        }
 
-            TINT_IF_PRINT_PROGRAM(print_program("Output of", transform.get()));
-        } else {
-            TINT_IF_PRINT_PROGRAM(std::cout << "Skipped " << transform->TypeInfo().name
-                                            << std::endl);
+        program = &output.value();
+
+        if (!program->IsValid()) {
+            TINT_IF_PRINT_PROGRAM(print_program("Invalid output of", transform));
+            break;
         }
+
+        TINT_IF_PRINT_PROGRAM(print_program("Output of", transform));
     }
 
     TINT_IF_PRINT_PROGRAM(print_program("Final output of", nullptr));
 
+    outputs.Put(std::move(timings));
+
     if (!output) {
         ProgramBuilder b;
         program::CloneContext ctx{&b, program, /* auto_clone_symbols */ true};
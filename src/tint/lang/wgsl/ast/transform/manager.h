@@ -28,7 +28,9 @@
 #ifndef SRC_TINT_LANG_WGSL_AST_TRANSFORM_MANAGER_H_
 #define SRC_TINT_LANG_WGSL_AST_TRANSFORM_MANAGER_H_
 
+#include <chrono>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -42,8 +44,37 @@ namespace tint::ast::transform {
 /// The inner transforms will execute in the appended order.
 /// If any inner transform fails the manager will return immediately and
 /// the error can be retrieved with the Output's diagnostics.
+/// Consecutive LocalTransforms are applied to a single clone of the program, which is resolved once
+/// all the transforms of the run have registered their rewrites.
 class Manager {
   public:
+    /// Timings is the output data that holds the time taken by each of the transforms.
+    /// The timings of the SPIR-V sanitizer are reported by the SanitizeSPIRV benchmark.
+    struct Timings final : public Castable<Timings, Data> {
+        /// The name used for the clone and resolve of a run of local transforms.
+        static constexpr const char* kSharedClone = "<shared clone and resolve>";
+
+        /// Timing is the time taken by a single transform.
+        struct Timing {
+            /// The name of the transform, or kSharedClone.
+            std::string name;
+            /// The time taken by the transform. For a LocalTransform applied with other local
+            /// transforms, this is the time taken to register the rewrites, and the time taken to
+            /// clone and resolve the program is held by the kSharedClone entry that follows.
+            std::chrono::nanoseconds duration{};
+            /// True if the transform did not need to run.
+            bool skipped = false;
+        };
+
+        /// Constructor
+        Timings();
+        /// Destructor
+        ~Timings() override;
+
+        /// The time taken by each of the transforms, in the order they were run.
+        std::vector<Timing> transforms;
+    };
+
     /// Constructor
     Manager();
     ~Manager();
@@ -63,6 +94,7 @@ class Manager {
     }
 
     /// Runs the transforms on @p program, returning the transformed clone of @p program.
+    /// The time taken by each transform is added to @p outputs as Timings.
     /// @param program the source program to transform
     /// @param inputs optional extra transform-specific input data
     /// @param outputs optional extra transform-specific output data
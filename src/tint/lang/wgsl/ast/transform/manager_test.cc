@@ -27,7 +27,9 @@
 
 #include "src/tint/lang/wgsl/ast/transform/manager.h"
 
+#include <memory>
 #include <string>
+#include <utility>
 
 #include "gtest/gtest.h"
 #include "src/tint/lang/wgsl/ast/transform/transform.h"
@@ -56,6 +58,27 @@ class AST_AddFunction final : public ast::transform::Transform {
     }
 };
 
+class AST_LocalNoOp final : public ast::transform::LocalTransform {
+    RewriteResult Rewrite(program::CloneContext&, const DataMap&, DataMap&) const override {
+        return SkipTransform;
+    }
+};
+
+class AST_LocalAddFunction final : public ast::transform::LocalTransform {
+  public:
+    explicit AST_LocalAddFunction(std::string name) : name_(std::move(name)) {}
+
+    RewriteResult Rewrite(program::CloneContext& ctx, const DataMap&, DataMap&) const override {
+        // Record the number of functions seen in the source program
+        num_src_functions_ = ctx.src->AST().Functions().Length();
+        ctx.dst->Func(ctx.dst->Sym(name_), {}, ctx.dst->ty.void_(), {});
+        return Rewritten();
+    }
+
+    std::string name_;
+    mutable size_t num_src_functions_ = 0;
+};
+
 Program MakeAST() {
     ProgramBuilder b;
     b.Func(b.Sym("main"), {}, b.ty.void_(), {});
@@ -77,5 +100,99 @@ TEST_F(TransformManagerTest, AST_AlwaysClone) {
     EXPECT_EQ(result.AST().Functions()[0]->name->symbol.Name(), "main");
 }
 
+// Test that consecutive local transforms are applied to a single clone of the program.
+TEST_F(TransformManagerTest, AST_LocalTransformsShareClone) {
+    Program ast = MakeAST();
+
+    Manager manager;
+    DataMap outputs;
+    manager.Add<AST_LocalAddFunction>("a");
+    manager.Add<AST_LocalNoOp>();
+    manager.Add<AST_LocalAddFunction>("b");
+
+    auto result = manager.Run(ast, {}, outputs);
+    EXPECT_TRUE(result.IsValid()) << result.Diagnostics();
+    ASSERT_EQ(result.AST().Functions().Length(), 3u);
+    EXPECT_EQ(result.AST().Functions()[0]->name->symbol.Name(), "a");
+    EXPECT_EQ(result.AST().Functions()[1]->name->symbol.Name(), "b");
+    EXPECT_EQ(result.AST().Functions()[2]->name->symbol.Name(), "main");
+
+    auto* timings = outputs.Get<Manager::Timings>();
+    ASSERT_NE(timings, nullptr);
+    ASSERT_EQ(timings->transforms.size(), 4u);
+    EXPECT_FALSE(timings->transforms[0].skipped);
+    EXPECT_TRUE(timings->transforms[1].skipped);
+    EXPECT_FALSE(timings->transforms[2].skipped);
+    EXPECT_EQ(timings->transforms[3].name, Manager::Timings::kSharedClone);
+    EXPECT_FALSE(timings->transforms[3].skipped);
+}
+
+// Test that a local transform does not see the changes made by the preceding local transforms of
+// the same run, but does see the changes of preceding non-local transforms.
+TEST_F(TransformManagerTest, AST_LocalTransformsUseSourceProgram) {
+    Program ast = MakeAST();
+
+    auto first = std::make_unique<AST_LocalAddFunction>("a");
+    auto second = std::make_unique<AST_LocalAddFunction>("b");
+    auto third = std::make_unique<AST_LocalAddFunction>("c");
+    auto* first_ptr = first.get();
+    auto* second_ptr = second.get();
+    auto* third_ptr = third.get();
+
+    Manager manager;
+    DataMap outputs;
+    manager.append(std::move(first));
+    manager.append(std::move(second));
+    manager.Add<AST_AddFunction>();
+    manager.append(std::move(third));
+
+    auto result = manager.Run(ast, {}, outputs);
+    EXPECT_TRUE(result.IsValid()) << result.Diagnostics();
+    EXPECT_EQ(result.AST().Functions().Length(), 5u);
+    EXPECT_EQ(first_ptr->num_src_functions_, 1u);
+    EXPECT_EQ(second_ptr->num_src_functions_, 1u);
+    EXPECT_EQ(third_ptr->num_src_functions_, 4u);
+
+    auto* timings = outputs.Get<Manager::Timings>();
+    ASSERT_NE(timings, nullptr);
+    ASSERT_EQ(timings->transforms.size(), 6u);
+    EXPECT_EQ(timings->transforms[2].name, Manager::Timings::kSharedClone);
+    EXPECT_EQ(timings->transforms[5].name, Manager::Timings::kSharedClone);
+}
+
+// Test that a run of skipped local transforms does not clone the program.
+TEST_F(TransformManagerTest, AST_LocalTransformsSkipped) {
+    Program ast = MakeAST();
+
+    Manager manager;
+    DataMap outputs;
+    manager.Add<AST_LocalNoOp>();
+    manager.Add<AST_LocalNoOp>();
+
+    auto result = manager.Run(ast, {}, outputs);
+    EXPECT_TRUE(result.IsValid()) << result.Diagnostics();
+    EXPECT_NE(result.ID(), ast.ID());
+    ASSERT_EQ(result.AST().Functions().Length(), 1u);
+
+    auto* timings = outputs.Get<Manager::Timings>();
+    ASSERT_NE(timings, nullptr);
+    ASSERT_EQ(timings->transforms.size(), 2u);
+    EXPECT_TRUE(timings->transforms[0].skipped);
+    EXPECT_TRUE(timings->transforms[1].skipped);
+}
+
+// Test that a local transform can be run on its own.
+TEST_F(TransformManagerTest, AST_LocalTransformApply) {
+    Program ast = MakeAST();
+
+    DataMap outputs;
+    auto result = AST_LocalAddFunction("a").Apply(ast, {}, outputs);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_TRUE(result->IsValid()) << result->Diagnostics();
+    EXPECT_EQ(result->AST().Functions().Length(), 2u);
+
+    EXPECT_FALSE(AST_LocalNoOp().Apply(ast, {}, outputs).has_value());
+}
+
 }  // namespace
 }  // namespace tint::ast::transform
@@ -35,7 +35,6 @@
 #include "src/tint/lang/wgsl/ast/traverse_expressions.h"
 #include "src/tint/lang/wgsl/program/clone_context.h"
 #include "src/tint/lang/wgsl/program/program_builder.h"
-#include "src/tint/lang/wgsl/resolver/resolve.h"
 #include "src/tint/lang/wgsl/sem/block_statement.h"
 #include "src/tint/lang/wgsl/sem/function.h"
 #include "src/tint/lang/wgsl/sem/statement.h"
@@ -50,19 +49,27 @@ namespace {
 
 using SinkSignature = std::vector<const core::type::Type*>;
 
+/// The state of the transform, which is used by the CloneContext callbacks.
+struct State : public LocalTransform::RewriteState {
+    /// The placeholder functions that take the phony assignment side effects as arguments.
+    Hashmap<SinkSignature, Symbol, 8> sinks;
+};
+
 }  // namespace
 
 RemovePhonies::RemovePhonies() = default;
 
 RemovePhonies::~RemovePhonies() = default;
 
-Transform::ApplyResult RemovePhonies::Apply(const Program& src, const DataMap&, DataMap&) const {
-    ProgramBuilder b;
-    program::CloneContext ctx{&b, &src, /* auto_clone_symbols */ true};
-
+LocalTransform::RewriteResult RemovePhonies::Rewrite(program::CloneContext& ctx,
+                                                     const DataMap&,
+                                                     DataMap&) const {
+    auto& src = *ctx.src;
+    auto& b = *ctx.dst;
     auto& sem = src.Sem();
 
-    Hashmap<SinkSignature, Symbol, 8> sinks;
+    auto state = std::make_unique<State>();
+    auto& sinks = state->sinks;
 
     bool made_changes = false;
     for (auto* node : src.ASTNodes().Objects()) {
@@ -163,8 +170,7 @@ Transform::ApplyResult RemovePhonies::Apply(const Program& src, const DataMap&,
         return SkipTransform;
     }
 
-    ctx.Clone();
-    return resolver::Resolve(b);
+    return RewriteResult{std::move(state)};
 }
 
 }  // namespace tint::ast::transform
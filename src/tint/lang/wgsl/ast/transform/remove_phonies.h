@@ -38,7 +38,7 @@ namespace tint::ast::transform {
 /// RemovePhonies is a Transform that removes all phony-assignment statements,
 /// while preserving function call expressions in the RHS of the assignment that
 /// may have side-effects. It also removes calls to builtins that return a constant value.
-class RemovePhonies final : public Castable<RemovePhonies, Transform> {
+class RemovePhonies final : public Castable<RemovePhonies, LocalTransform> {
   public:
     /// Constructor
     RemovePhonies();
@@ -46,10 +46,10 @@ class RemovePhonies final : public Castable<RemovePhonies, Transform> {
     /// Destructor
     ~RemovePhonies() override;
 
-    /// @copydoc Transform::Apply
-    ApplyResult Apply(const Program& program,
-                      const DataMap& inputs,
-                      DataMap& outputs) const override;
+    /// @copydoc LocalTransform::Rewrite
+    RewriteResult Rewrite(program::CloneContext& ctx,
+                          const DataMap& inputs,
+                          DataMap& outputs) const override;
 };
 
 }  // namespace tint::ast::transform
@@ -28,6 +28,7 @@
 #include "src/tint/lang/wgsl/ast/transform/renamer.h"
 
 #include <memory>
+#include <string_view>
 #include <utility>
 
 #include "src/tint/lang/wgsl/program/clone_context.h"
@@ -1357,7 +1358,7 @@ Transform::ApplyResult Renamer::Apply(const Program& src,
         if (target == Target::kAll) {
             return true;
         }
-        auto name = symbol.Name();
+        auto name = symbol.NameView();
         if (!tint::utf8::IsASCII(name)) {
             // name is non-ascii. All of the backend keywords are ascii, so rename if we're not
             // preserving unicode symbols.
@@ -1369,7 +1370,7 @@ Transform::ApplyResult Renamer::Apply(const Program& src,
                                           kReservedKeywordsGLSL +
                                               sizeof(kReservedKeywordsGLSL) / sizeof(const char*),
                                           name) ||
-                       name.compare(0, 3, "gl_") == 0 || name.find("__") != std::string::npos;
+                       name.compare(0, 3, "gl_") == 0 || name.find("__") != std::string_view::npos;
             case Target::kHlslKeywords:
                 return std::binary_search(
                     kReservedKeywordsHLSL,
@@ -46,6 +46,7 @@
 using namespace tint::core::fluent_types;  // NOLINT
 
 TINT_INSTANTIATE_TYPEINFO(tint::ast::transform::Transform);
+TINT_INSTANTIATE_TYPEINFO(tint::ast::transform::LocalTransform);
 
 namespace tint::ast::transform {
 
@@ -67,6 +68,23 @@ Output Transform::Run(const Program& src, const DataMap& data /* = {} */) const
     return output;
 }
 
+LocalTransform::LocalTransform() = default;
+LocalTransform::~LocalTransform() = default;
+LocalTransform::RewriteState::~RewriteState() = default;
+
+Transform::ApplyResult LocalTransform::Apply(const Program& src,
+                                             const DataMap& inputs,
+                                             DataMap& outputs) const {
+    ProgramBuilder b;
+    program::CloneContext ctx{&b, &src, /* auto_clone_symbols */ true};
+    auto state = Rewrite(ctx, inputs, outputs);
+    if (!state) {
+        return SkipTransform;
+    }
+    ctx.Clone();
+    return resolver::Resolve(b);
+}
+
 void Transform::RemoveStatement(program::CloneContext& ctx, const Statement* stmt) {
     auto* sem = ctx.src->Sem().Get(stmt);
     if (auto* block = tint::As<sem::BlockStatement>(sem->Parent())) {
@@ -28,6 +28,8 @@
 #ifndef SRC_TINT_LANG_WGSL_AST_TRANSFORM_TRANSFORM_H_
 #define SRC_TINT_LANG_WGSL_AST_TRANSFORM_TRANSFORM_H_
 
+#include <memory>
+#include <optional>
 #include <utility>
 
 #include "src/tint/lang/wgsl/ast/transform/data.h"
@@ -112,6 +114,61 @@ class Transform : public Castable<Transform> {
     static void RemoveStatement(program::CloneContext& ctx, const Statement* stmt);
 };
 
+/// Interface for transforms that only make local rewrites to a program.
+/// Instead of cloning and resolving the program itself, a LocalTransform registers its rewrites
+/// with a CloneContext that may be shared with other local transforms. This allows the Manager to
+/// apply a run of consecutive local transforms with a single clone and resolve of the program.
+/// A LocalTransform must:
+/// * Only depend on the source program of the CloneContext. The program is not re-resolved between
+///   the transforms of a run, so the changes made by the preceding local transforms of the run are
+///   not visible.
+/// * Not register rewrites that conflict with those of other local transforms, such as a second
+///   ReplaceAll() handler for the same node type.
+/// * Not modify the CloneContext or its destination ProgramBuilder if it returns SkipTransform.
+class LocalTransform : public Castable<LocalTransform, Transform> {
+  public:
+    /// Constructor
+    LocalTransform();
+    /// Destructor
+    ~LocalTransform() override;
+
+    /// RewriteState is the base class for the state of a local transform that needs to be kept
+    /// alive until the program has been cloned, such as the state used by a ReplaceAll() callback.
+    class RewriteState {
+      public:
+        /// Destructor
+        virtual ~RewriteState();
+    };
+
+    /// The return value of Rewrite().
+    /// If SkipTransform (std::nullopt), then the transform did not need to run. Otherwise holds
+    /// the (possibly null) state that is destructed once the program has been cloned.
+    using RewriteResult = std::optional<std::unique_ptr<RewriteState>>;
+
+    /// @returns a RewriteResult indicating that the transform registered rewrites, and has no state
+    /// that needs to be kept alive.
+    static RewriteResult Rewritten() { return std::unique_ptr<RewriteState>{}; }
+
+    /// Registers the rewrites of the transform with @p ctx.
+    /// @param ctx the clone context
+    /// @param inputs optional extra transform-specific input data
+    /// @param outputs optional extra transform-specific output data
+    /// @returns SkipTransform if the transform didn't need to run, otherwise the transform state
+    /// that needs to be kept alive until the program is cloned.
+    virtual RewriteResult Rewrite(program::CloneContext& ctx,
+                                  const DataMap& inputs,
+                                  DataMap& outputs) const = 0;
+
+    /// Runs the transform on its own, by calling Rewrite() on a new clone of @p program.
+    /// @param program the input program
+    /// @param inputs optional extra transform-specific input data
+    /// @param outputs optional extra transform-specific output data
+    /// @returns a transformed program, or std::nullopt if the transform didn't need to run.
+    ApplyResult Apply(const Program& program,
+                      const DataMap& inputs,
+                      DataMap& outputs) const final;
+};
+
 }  // namespace tint::ast::transform
 
 #endif  // SRC_TINT_LANG_WGSL_AST_TRANSFORM_TRANSFORM_H_
@@ -27,13 +27,13 @@
 
 #include "src/tint/lang/wgsl/ast/transform/vectorize_scalar_matrix_initializers.h"
 
+#include <memory>
 #include <unordered_map>
 #include <utility>
 
 #include "src/tint/lang/core/type/abstract_numeric.h"
 #include "src/tint/lang/wgsl/program/clone_context.h"
 #include "src/tint/lang/wgsl/program/program_builder.h"
-#include "src/tint/lang/wgsl/resolver/resolve.h"
 #include "src/tint/lang/wgsl/sem/call.h"
 #include "src/tint/lang/wgsl/sem/value_constructor.h"
 #include "src/tint/lang/wgsl/sem/value_expression.h"
@@ -59,23 +59,30 @@ bool ShouldRun(const Program& program) {
     return false;
 }
 
+/// The state of the transform, which is used by the CloneContext callbacks.
+struct State : public LocalTransform::RewriteState {
+    /// The helper functions that construct a matrix from a single scalar, keyed by matrix type.
+    std::unordered_map<const core::type::Matrix*, Symbol> scalar_inits;
+};
+
 }  // namespace
 
 VectorizeScalarMatrixInitializers::VectorizeScalarMatrixInitializers() = default;
 
 VectorizeScalarMatrixInitializers::~VectorizeScalarMatrixInitializers() = default;
 
-Transform::ApplyResult VectorizeScalarMatrixInitializers::Apply(const Program& src,
-                                                                const DataMap&,
-                                                                DataMap&) const {
+LocalTransform::RewriteResult VectorizeScalarMatrixInitializers::Rewrite(
+    program::CloneContext& ctx,
+    const DataMap&,
+    DataMap&) const {
+    auto& src = *ctx.src;
     if (!ShouldRun(src)) {
         return SkipTransform;
     }
 
-    ProgramBuilder b;
-    program::CloneContext ctx{&b, &src, /* auto_clone_symbols */ true};
-
-    std::unordered_map<const core::type::Matrix*, Symbol> scalar_inits;
+    auto& b = *ctx.dst;
+    auto state = std::make_unique<State>();
+    auto& scalar_inits = state->scalar_inits;
 
     ctx.ReplaceAll([&](const CallExpression* expr) -> const CallExpression* {
         auto* call = src.Sem().Get(expr)->UnwrapMaterialize()->As<sem::Call>();
@@ -154,8 +161,7 @@ Transform::ApplyResult VectorizeScalarMatrixInitializers::Apply(const Program& s
         return nullptr;
     });
 
-    ctx.Clone();
-    return resolver::Resolve(b);
+    return RewriteResult{std::move(state)};
 }
 
 }  // namespace tint::ast::transform
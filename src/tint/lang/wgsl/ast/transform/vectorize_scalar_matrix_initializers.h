@@ -34,7 +34,7 @@ namespace tint::ast::transform {
 
 /// A transform that converts scalar matrix initializers to the vector form.
 class VectorizeScalarMatrixInitializers final
-    : public Castable<VectorizeScalarMatrixInitializers, Transform> {
+    : public Castable<VectorizeScalarMatrixInitializers, LocalTransform> {
   public:
     /// Constructor
     VectorizeScalarMatrixInitializers();
@@ -42,10 +42,10 @@ class VectorizeScalarMatrixInitializers final
     /// Destructor
     ~VectorizeScalarMatrixInitializers() override;
 
-    /// @copydoc Transform::Apply
-    ApplyResult Apply(const Program& program,
-                      const DataMap& inputs,
-                      DataMap& outputs) const override;
+    /// @copydoc LocalTransform::Rewrite
+    RewriteResult Rewrite(program::CloneContext& ctx,
+                          const DataMap& inputs,
+                          DataMap& outputs) const override;
 };
 
 }  // namespace tint::ast::transform
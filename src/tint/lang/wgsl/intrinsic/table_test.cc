@@ -965,6 +965,88 @@ TEST_F(WgslIntrinsicTableTest, OverloadResolution) {
     EXPECT_EQ(result->parameters[0].type, ai);
 }
 
+TEST_F(WgslIntrinsicTableTest, CacheHit_BuiltinFn) {
+    auto* f32 = create<core::type::F32>();
+    auto a = table.Lookup(wgsl::BuiltinFn::kCos, Vector{f32}, core::EvaluationStage::kConstant);
+    auto b = table.Lookup(wgsl::BuiltinFn::kCos, Vector{f32}, core::EvaluationStage::kConstant);
+    ASSERT_EQ(a, Success);
+    ASSERT_EQ(b, Success);
+    EXPECT_EQ(a.Get(), b.Get());
+    EXPECT_EQ(table.CacheStats().hits, 1u);
+    EXPECT_EQ(table.CacheStats().misses, 1u);
+    EXPECT_EQ(table.CacheStats().HitRate(), 0.5);
+}
+
+TEST_F(WgslIntrinsicTableTest, CacheMiss_DifferentSignature) {
+    auto* f32 = create<core::type::F32>();
+    auto* vec3f = create<core::type::Vector>(f32, 3u);
+    auto a = table.Lookup(wgsl::BuiltinFn::kCos, Vector{f32}, core::EvaluationStage::kConstant);
+    auto b = table.Lookup(wgsl::BuiltinFn::kCos, Vector{vec3f}, core::EvaluationStage::kConstant);
+    auto c = table.Lookup(wgsl::BuiltinFn::kCos, Vector{f32}, core::EvaluationStage::kRuntime);
+    auto d = table.Lookup(wgsl::BuiltinFn::kSin, Vector{f32}, core::EvaluationStage::kConstant);
+    ASSERT_EQ(a, Success);
+    ASSERT_EQ(b, Success);
+    ASSERT_EQ(c, Success);
+    ASSERT_EQ(d, Success);
+    EXPECT_EQ(a->return_type, f32);
+    EXPECT_EQ(b->return_type, vec3f);
+    EXPECT_NE(a->const_eval_fn, nullptr);
+    EXPECT_NE(a->info, d->info);
+    EXPECT_EQ(table.CacheStats().hits, 0u);
+    EXPECT_EQ(table.CacheStats().misses, 4u);
+}
+
+TEST_F(WgslIntrinsicTableTest, CacheHit_Operators) {
+    auto* i32 = create<core::type::I32>();
+    auto* vec3i = create<core::type::Vector>(i32, 3u);
+    auto unary = [&] {
+        return table.Lookup(core::UnaryOp::kNegation, vec3i, core::EvaluationStage::kConstant);
+    };
+    auto binary = [&](bool is_compound) {
+        return table.Lookup(core::BinaryOp::kMultiply, i32, vec3i,
+                            core::EvaluationStage::kConstant, is_compound);
+    };
+    ASSERT_EQ(unary(), Success);
+    ASSERT_EQ(unary(), Success);
+    ASSERT_EQ(binary(false), Success);
+    ASSERT_EQ(binary(false), Success);
+    // Compound assignment is keyed separately from the plain binary operator.
+    ASSERT_EQ(binary(true), Success);
+    ASSERT_EQ(binary(true), Success);
+    EXPECT_EQ(table.CacheStats().hits, 3u);
+    EXPECT_EQ(table.CacheStats().misses, 3u);
+}
+
+TEST_F(WgslIntrinsicTableTest, CacheHit_Error) {
+    auto* i32 = create<core::type::I32>();
+    auto a = table.Lookup(wgsl::BuiltinFn::kCos, Vector{i32}, core::EvaluationStage::kConstant);
+    auto b = table.Lookup(wgsl::BuiltinFn::kCos, Vector{i32}, core::EvaluationStage::kConstant);
+    ASSERT_NE(a, Success);
+    ASSERT_NE(b, Success);
+    EXPECT_EQ(a.Failure(), b.Failure());
+    EXPECT_EQ(table.CacheStats().hits, 1u);
+    EXPECT_EQ(table.CacheStats().misses, 1u);
+}
+
+TEST_F(WgslIntrinsicTableTest, CacheHit_CtorConv) {
+    auto* i32 = create<core::type::I32>();
+    auto* f32 = create<core::type::F32>();
+    auto* vec3i = create<core::type::Vector>(i32, 3u);
+    auto* vec3f = create<core::type::Vector>(f32, 3u);
+    auto a =
+        table.Lookup(CtorConv::kVec3, nullptr, Vector{vec3i}, core::EvaluationStage::kConstant);
+    auto b = table.Lookup(CtorConv::kVec3, f32, Vector{vec3i}, core::EvaluationStage::kConstant);
+    auto c = table.Lookup(CtorConv::kVec3, f32, Vector{vec3i}, core::EvaluationStage::kConstant);
+    ASSERT_EQ(a, Success);
+    ASSERT_EQ(b, Success);
+    ASSERT_EQ(c, Success);
+    EXPECT_EQ(a->return_type, vec3i);
+    EXPECT_EQ(b->return_type, vec3f);
+    EXPECT_EQ(b.Get(), c.Get());
+    EXPECT_EQ(table.CacheStats().hits, 1u);
+    EXPECT_EQ(table.CacheStats().misses, 2u);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // AbstractBinaryTests
 ////////////////////////////////////////////////////////////////////////////////
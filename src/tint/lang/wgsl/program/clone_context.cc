@@ -40,7 +40,13 @@ CloneContext::CloneContext(ProgramBuilder* to, Program const* from, bool auto_cl
         // Almost all transforms will want to clone all symbols before doing any
         // work, to avoid any newly created symbols clashing with existing symbols
         // in the source program and causing them to be renamed.
-        from->Symbols().Foreach([&](Symbol s) { Clone(s); });
+        if (to->Symbols().IsEmpty() && from->Symbols().IsShareable()) {
+            // Share the source program's symbol table instead of copying each of its symbols.
+            to->Symbols() = SymbolTable::WrapShared(from->SharedSymbols(), to->ID());
+            ctx_.UseSharedSymbols();
+        } else {
+            from->Symbols().Foreach([&](Symbol s) { Clone(s); });
+        }
     }
 }
 
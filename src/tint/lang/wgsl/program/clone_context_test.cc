@@ -25,6 +25,7 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <memory>
 #include <string>
 #include <unordered_set>
 #include <utility>
@@ -1193,6 +1194,34 @@ TEST_F(ProgramCloneContextTest, CloneNewSymbols_AfterCloneSymbols) {
     EXPECT_EQ(new_c.Name(), "c");
 }
 
+TEST_F(ProgramCloneContextTest, CloneSymbols_OutliveSource) {
+    ProgramBuilder builder;
+    Symbol old_a = builder.Symbols().New("a");
+    Symbol old_b = builder.Symbols().New("b");
+
+    auto original = std::make_unique<Program>(resolver::Resolve(builder));
+
+    ProgramBuilder cloned;
+    Symbol new_a;
+    Symbol new_b;
+    {
+        CloneContext ctx(&cloned, original.get());
+        new_a = ctx.Clone(old_a);
+        new_b = ctx.Clone(old_b);
+    }
+    original.reset();
+
+    EXPECT_EQ(new_a.GenerationID(), cloned.ID());
+    EXPECT_EQ(new_a.Name(), "a");
+    EXPECT_EQ(new_b.Name(), "b");
+    EXPECT_EQ(cloned.Symbols().Get("a"), new_a);
+    EXPECT_EQ(cloned.Symbols().Get("b"), new_b);
+    EXPECT_EQ(cloned.Symbols().New("a").Name(), "a_1");
+
+    Program program(std::move(cloned));
+    EXPECT_EQ(program.Symbols().Get("b"), new_b);
+}
+
 TEST_F(ProgramCloneContextTest, GenerationIDs) {
     ProgramBuilder dst;
     Program src(ProgramBuilder{});
@@ -62,7 +62,8 @@ Program::Program(Program&& program)
     program.moved_ = true;
 }
 
-Program::Program(ProgramBuilder&& builder) {
+Program::Program(ProgramBuilder&& builder)
+    : symbols_(std::make_shared<SymbolTable>(std::move(builder.Symbols()))) {
     id_ = builder.ID();
     highest_node_id_ = builder.LastAllocatedNodeID();
     is_valid_ = builder.IsValid();
@@ -73,7 +74,6 @@ Program::Program(ProgramBuilder&& builder) {
     sem_nodes_ = std::move(builder.SemNodes());
     ast_ = &builder.AST();  // ast::Module is actually a heap allocation.
     sem_ = std::move(builder.Sem());
-    symbols_ = std::move(builder.Symbols());
     diagnostics_.Add(std::move(builder.Diagnostics()));
     builder.MarkAsMoved();
 
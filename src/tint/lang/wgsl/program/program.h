@@ -28,6 +28,7 @@
 #ifndef SRC_TINT_LANG_WGSL_PROGRAM_PROGRAM_H_
 #define SRC_TINT_LANG_WGSL_PROGRAM_PROGRAM_H_
 
+#include <memory>
 #include <string>
 #include <unordered_set>
 
@@ -117,6 +118,13 @@ class Program {
 
     /// @returns a reference to the program's SymbolTable
     const SymbolTable& Symbols() const {
+        AssertNotMoved();
+        return *symbols_;
+    }
+
+    /// @returns the program's SymbolTable, which can be shared by a program built from this program
+    /// with SymbolTable::WrapShared(), so that the table outlives this program.
+    std::shared_ptr<const SymbolTable> SharedSymbols() const {
         AssertNotMoved();
         return symbols_;
     }
@@ -183,7 +191,7 @@ class Program {
     SemNodeAllocator sem_nodes_;
     ast::Module* ast_ = nullptr;
     sem::Info sem_;
-    SymbolTable symbols_{id_};
+    std::shared_ptr<const SymbolTable> symbols_ = std::make_shared<SymbolTable>(id_);
     diag::List diagnostics_;
     bool is_valid_ = false;  // Not valid until it is built
     bool moved_ = false;
@@ -28,9 +28,16 @@
 #ifndef SRC_TINT_LANG_WGSL_READER_OPTIONS_H_
 #define SRC_TINT_LANG_WGSL_READER_OPTIONS_H_
 
+#include <cstdint>
+
 #include "src/tint/lang/wgsl/common/allowed_features.h"
 #include "src/tint/utils/reflection/reflection.h"
 
+// Forward declarations
+namespace tint::resolver {
+class UniformityCache;
+}  // namespace tint::resolver
+
 namespace tint::wgsl::reader {
 
 /// Configuration options used for reading WGSL.
@@ -38,8 +45,17 @@ struct Options {
     /// The extensions and language features that are allowed to be used.
     AllowedFeatures allowed_features{};
 
+    /// The maximum number of threads the resolver may use to analyze function bodies
+    /// concurrently. Functions are only analyzed concurrently if they do not call each other.
+    uint32_t max_resolver_threads = 1;
+
+    /// An optional cache of function uniformity summaries, used to skip the uniformity analysis of
+    /// functions that have already been analyzed while resolving another program. May be shared
+    /// between the parsing of many programs. Not reflected, as it is not part of the configuration.
+    resolver::UniformityCache* uniformity_cache = nullptr;
+
     /// Reflect the fields of this class so that it can be used by tint::ForeachField().
-    TINT_REFLECT(Options, allowed_features);
+    TINT_REFLECT(Options, allowed_features, max_resolver_threads);
 };
 
 }  // namespace tint::wgsl::reader
@@ -27,7 +27,7 @@
 
 #include "src/tint/lang/wgsl/reader/parser/lexer.h"
 
-#include <cctype>
+#include <algorithm>
 #include <charconv>
 #include <cmath>
 #include <cstring>
@@ -40,9 +40,23 @@
 #include "src/tint/lang/core/fluent_types.h"
 #include "src/tint/lang/core/number.h"
 #include "src/tint/utils/ice/ice.h"
+#include "src/tint/utils/math/math.h"
 #include "src/tint/utils/strconv/parse_num.h"
 #include "src/tint/utils/text/unicode.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TINT_LEXER_SSE2 1
+#define TINT_LEXER_NEON 0
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+#define TINT_LEXER_SSE2 0
+#define TINT_LEXER_NEON 1
+#include <arm_neon.h>
+#else
+#define TINT_LEXER_SSE2 0
+#define TINT_LEXER_NEON 0
+#endif
+
 using namespace tint::core::fluent_types;  // NOLINT
 
 namespace tint::wgsl::reader {
@@ -54,9 +68,110 @@ static_assert(sizeof(decltype(tint::Source::FileContent::data[0])) == sizeof(uin
               "tint::wgsl::reader requires the size of a std::string element "
               "to be a single byte");
 
-// A token is ~80bytes. The 4k here comes from looking at the number of tokens in the benchmark
-// programs and being a bit bigger then those need (atan2-const-eval is the outlier here).
-static constexpr size_t kDefaultListSize = 4092;
+// The benchmark programs average between 3 and 5.5 bytes of source per token, with six of the
+// eight below 4 bytes per token. The token list is reserved for 3 bytes per token, so that it is
+// rarely reallocated, and the reservation is capped so that a large program does not reserve
+// megabytes of tokens up front. Past the cap, the list grows as it is filled.
+static constexpr size_t kBytesPerToken = 3;
+static constexpr size_t kMaxReservedTokens = 65536;
+
+/// The classes of characters that the lexer scans over in bulk.
+/// Each provides a scalar predicate and, when available, a SIMD predicate that tests 16 bytes at
+/// once, returning 0xff for each byte that is in the class.
+struct Blank {
+    static bool Scalar(uint8_t c) { return c == ' ' || c == '\t'; }
+#if TINT_LEXER_SSE2
+    static __m128i Simd(__m128i v) {
+        return _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')),
+                            _mm_cmpeq_epi8(v, _mm_set1_epi8('\t')));
+    }
+#elif TINT_LEXER_NEON
+    static uint8x16_t Simd(uint8x16_t v) {
+        return vorrq_u8(vceqq_u8(v, vdupq_n_u8(' ')), vceqq_u8(v, vdupq_n_u8('\t')));
+    }
+#endif
+};
+
+/// ASCII identifier characters: [a-zA-Z0-9_]
+struct AsciiIdentifier {
+    static bool Scalar(uint8_t c) {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
+               c == '_';
+    }
+#if TINT_LEXER_SSE2
+    static __m128i Simd(__m128i v) {
+        // SSE2 only has signed byte comparisons, so the ranges are tested by offsetting each range
+        // to start at -128, and comparing against -128 + the range size.
+        auto in_range = [](__m128i x, int lo, int count) {
+            auto offset = _mm_add_epi8(x, _mm_set1_epi8(static_cast<char>(-128 - lo)));
+            return _mm_cmplt_epi8(offset, _mm_set1_epi8(static_cast<char>(-128 + count)));
+        };
+        // Setting bit 5 maps 'A'..'Z' to 'a'..'z', and no other byte to 'a'..'z'.
+        auto lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+        return _mm_or_si128(_mm_or_si128(in_range(lower, 'a', 26), in_range(v, '0', 10)),
+                            _mm_cmpeq_epi8(v, _mm_set1_epi8('_')));
+    }
+#elif TINT_LEXER_NEON
+    static uint8x16_t Simd(uint8x16_t v) {
+        auto lower = vorrq_u8(v, vdupq_n_u8(0x20));
+        auto alpha = vcltq_u8(vsubq_u8(lower, vdupq_n_u8('a')), vdupq_n_u8(26));
+        auto digit = vcltq_u8(vsubq_u8(v, vdupq_n_u8('0')), vdupq_n_u8(10));
+        return vorrq_u8(vorrq_u8(alpha, digit), vceqq_u8(v, vdupq_n_u8('_')));
+    }
+#endif
+};
+
+/// Characters that do not need to be examined inside a block comment: anything other than '/',
+/// '*' and null.
+struct BlockCommentBody {
+    static bool Scalar(uint8_t c) { return c != '/' && c != '*' && c != 0; }
+#if TINT_LEXER_SSE2
+    static __m128i Simd(__m128i v) {
+        auto special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('/')),
+                                                 _mm_cmpeq_epi8(v, _mm_set1_epi8('*'))),
+                                    _mm_cmpeq_epi8(v, _mm_setzero_si128()));
+        return _mm_xor_si128(special, _mm_set1_epi8(-1));
+    }
+#elif TINT_LEXER_NEON
+    static uint8x16_t Simd(uint8x16_t v) {
+        auto slash_or_star = vorrq_u8(vceqq_u8(v, vdupq_n_u8('/')), vceqq_u8(v, vdupq_n_u8('*')));
+        return vmvnq_u8(vorrq_u8(slash_or_star, vceqzq_u8(v)));
+    }
+#endif
+};
+
+/// @returns the position of the first character at or after @p pos in @p str which is not in the
+/// character class CLASS, or the length of @p str if all the remaining characters are in CLASS.
+template <typename CLASS>
+uint32_t SkipWhile(std::string_view str, uint32_t pos) {
+    const auto* chars = reinterpret_cast<const uint8_t*>(str.data());
+    const auto len = static_cast<uint32_t>(str.size());
+    // Note: The SIMD loads must not read past the end of the line, as the last line of the file is
+    // not necessarily followed by any other characters.
+#if TINT_LEXER_SSE2
+    for (; pos + 16 <= len; pos += 16) {
+        auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + pos));
+        auto mask = static_cast<uint32_t>(_mm_movemask_epi8(CLASS::Simd(v))) ^ 0xffffu;
+        if (mask != 0) {
+            return pos + CountTrailingZeros(mask);
+        }
+    }
+#elif TINT_LEXER_NEON
+    for (; pos + 16 <= len; pos += 16) {
+        auto in_class = CLASS::Simd(vld1q_u8(chars + pos));
+        // Narrow each 0x00 / 0xff byte to a nibble.
+        uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(in_class), 4);
+        uint64_t mask = ~vget_lane_u64(vreinterpret_u64_u8(nibbles), 0);
+        if (mask != 0) {
+            return pos + CountTrailingZeros(mask) / 4;
+        }
+    }
+#endif
+    while (pos < len && CLASS::Scalar(chars[pos])) {
+        pos++;
+    }
+    return pos;
+}
 
 bool read_blankspace(std::string_view str,
                      size_t i,
@@ -108,13 +223,17 @@ uint32_t hex_value(char c) {
 
 }  // namespace
 
-Lexer::Lexer(const Source::File* file) : file_(file), location_{1, 1} {}
+Lexer::Lexer(const Source::File* file) : file_(file), location_{1, 1} {
+    if (!file_->content.lines.empty()) {
+        line_ = file_->content.lines[0];
+    }
+}
 
 Lexer::~Lexer() = default;
 
 std::vector<Token> Lexer::Lex() {
     std::vector<Token> tokens;
-    tokens.reserve(kDefaultListSize);
+    tokens.reserve(std::min(file_->content.data.size() / kBytesPerToken + 1, kMaxReservedTokens));
 
     while (true) {
         tokens.emplace_back(next());
@@ -135,11 +254,7 @@ std::vector<Token> Lexer::Lex() {
 }
 
 std::string_view Lexer::line() const {
-    if (file_->content.lines.size() == 0) {
-        static const char* empty_string = "";
-        return empty_string;
-    }
-    return file_->content.lines[location_.line - 1];
+    return line_;
 }
 
 uint32_t Lexer::pos() const {
@@ -151,14 +266,13 @@ uint32_t Lexer::length() const {
 }
 
 const char& Lexer::at(uint32_t pos) const {
-    auto l = line();
     // Unlike for std::string, if pos == l.size(), indexing `l[pos]` is UB for
     // std::string_view.
-    if (pos >= l.size()) {
+    if (pos >= line_.size()) {
         static const char zero = 0;
         return zero;
     }
-    return l[pos];
+    return line_[pos];
 }
 
 std::string_view Lexer::substr(uint32_t offset, uint32_t count) {
@@ -176,6 +290,8 @@ void Lexer::set_pos(uint32_t pos) {
 void Lexer::advance_line() {
     location_.line++;
     location_.column = 1;
+    line_ = location_.line <= file_->content.lines.size() ? file_->content.lines[location_.line - 1]
+                                                          : std::string_view{};
 }
 
 bool Lexer::is_eof() const {
@@ -191,24 +307,28 @@ Token Lexer::next() {
         return std::move(t.value());
     }
 
-    if (auto t = try_hex_float(); t.has_value() && !t->IsUninitialized()) {
-        return std::move(t.value());
-    }
-
-    if (auto t = try_hex_integer(); t.has_value() && !t->IsUninitialized()) {
-        return std::move(t.value());
-    }
+    // Only attempt to lex the kinds of token that can start with the current character.
+    const auto c = static_cast<uint8_t>(at(pos()));
+    if (is_digit(static_cast<char>(c)) || c == '.') {
+        if (auto t = try_hex_float(); t.has_value() && !t->IsUninitialized()) {
+            return std::move(t.value());
+        }
 
-    if (auto t = try_float(); t.has_value() && !t->IsUninitialized()) {
-        return std::move(t.value());
-    }
+        if (auto t = try_hex_integer(); t.has_value() && !t->IsUninitialized()) {
+            return std::move(t.value());
+        }
 
-    if (auto t = try_integer(); t.has_value() && !t->IsUninitialized()) {
-        return std::move(t.value());
-    }
+        if (auto t = try_float(); t.has_value() && !t->IsUninitialized()) {
+            return std::move(t.value());
+        }
 
-    if (auto t = try_ident(); t.has_value() && !t->IsUninitialized()) {
-        return std::move(t.value());
+        if (auto t = try_integer(); t.has_value() && !t->IsUninitialized()) {
+            return std::move(t.value());
+        }
+    } else if (c >= 0x80 || c == '_' || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z')) {
+        if (auto t = try_ident(); t.has_value() && !t->IsUninitialized()) {
+            return std::move(t.value());
+        }
     }
 
     if (auto t = try_punctuation(); t.has_value() && !t->IsUninitialized()) {
@@ -236,10 +356,10 @@ bool Lexer::is_null() const {
 }
 
 bool Lexer::is_digit(char ch) const {
-    return std::isdigit(static_cast<unsigned char>(ch));
+    return ch >= '0' && ch <= '9';
 }
 bool Lexer::is_hex(char ch) const {
-    return std::isxdigit(static_cast<unsigned char>(ch));
+    return (ch >= '0' && ch <= '9') || (ch >= 'a' && ch <= 'f') || (ch >= 'A' && ch <= 'F');
 }
 
 bool Lexer::matches(uint32_t pos, std::string_view sub_string) {
@@ -265,6 +385,16 @@ std::optional<Token> Lexer::skip_blankspace_and_comments() {
                 continue;
             }
 
+            // Skip over ASCII blankspace in bulk. Only non-ASCII characters need to be decoded to
+            // check for the other blankspace code points.
+            set_pos(SkipWhile<Blank>(line_, pos()));
+            if (is_eol()) {
+                continue;
+            }
+            if (static_cast<uint8_t>(at(pos())) < 0x80) {
+                break;
+            }
+
             bool is_blankspace;
             uint32_t blankspace_size;
             if (!read_blankspace(line(), pos(), &is_blankspace, &blankspace_size)) {
@@ -298,12 +428,12 @@ std::optional<Token> Lexer::skip_blankspace_and_comments() {
 std::optional<Token> Lexer::skip_comment() {
     if (matches(pos(), "//")) {
         // Line comment: ignore everything until the end of line.
-        while (!is_eol()) {
-            if (is_null()) {
-                return Token{Token::Type::kError, begin_source(), "null character found"};
-            }
-            advance();
+        auto rest = line_.substr(pos());
+        if (auto* null = std::memchr(rest.data(), 0, rest.size())) {
+            advance(static_cast<uint32_t>(static_cast<const char*>(null) - rest.data()));
+            return Token{Token::Type::kError, begin_source(), "null character found"};
         }
+        set_pos(length());
         return {};
     }
 
@@ -332,8 +462,9 @@ std::optional<Token> Lexer::skip_comment() {
             } else if (is_null()) {
                 return Token{Token::Type::kError, begin_source(), "null character found"};
             } else {
-                // Anything else: skip and update source location.
-                advance();
+                // Anything else: skip to the next character that may start or end a comment, or
+                // to the end of the line.
+                set_pos(SkipWhile<BlockCommentBody>(line_, pos() + 1));
             }
         }
         if (depth > 0) {
@@ -396,7 +527,7 @@ std::optional<Token> Lexer::try_float() {
         exponent_value_position = end;
 
         bool has_digits = false;
-        while (end < length() && isdigit(at(end))) {
+        while (end < length() && is_digit(at(end))) {
             has_digits = true;
             end++;
         }
@@ -679,7 +810,7 @@ std::optional<Token> Lexer::try_hex_float() {
         // Allow overflow (in uint64_t) when the floating point value magnitude is
         // zero.
         bool has_exponent_digits = false;
-        while (end < length() && isdigit(at(end))) {
+        while (end < length() && is_digit(at(end))) {
             has_exponent_digits = true;
             auto prev_exponent = input_exponent;
             input_exponent = (input_exponent * 10) + dec_value(at(end));
@@ -984,14 +1115,24 @@ std::optional<Token> Lexer::try_ident() {
     auto start = pos();
 
     // Must begin with an XID_Source unicode character, or underscore
-    {
+    if (auto c = static_cast<uint8_t>(at(start)); c < 0x80) {
+        if (c != '_' && !((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'))) {
+            return {};
+        }
+        if (c == '_' && matches(start + 1, '_')) {
+            // Identifiers prefixed with two or more underscores are not allowed.
+            return {};
+        }
+        // Consume start character
+        advance();
+    } else {
         auto* utf8 = reinterpret_cast<const uint8_t*>(&at(pos()));
         auto [code_point, n] = tint::utf8::Decode(utf8, length() - pos());
         if (n == 0) {
             advance();  // Skip the bad byte.
             return Token{Token::Type::kError, source, "invalid UTF-8"};
         }
-        if (code_point != tint::CodePoint('_') && !code_point.IsXIDStart()) {
+        if (!code_point.IsXIDStart()) {
             return {};
         }
         // Consume start codepoint
@@ -999,7 +1140,16 @@ std::optional<Token> Lexer::try_ident() {
     }
 
     while (!is_eol()) {
-        // Must continue with an XID_Continue unicode character
+        // Must continue with an XID_Continue unicode character.
+        // ASCII characters are classified directly, and runs of them are consumed in bulk.
+        if (auto c = static_cast<uint8_t>(at(pos())); c < 0x80) {
+            if (!AsciiIdentifier::Scalar(c)) {
+                break;
+            }
+            set_pos(SkipWhile<AsciiIdentifier>(line_, pos() + 1));
+            continue;
+        }
+
         auto* utf8 = reinterpret_cast<const uint8_t*>(&at(pos()));
         auto [code_point, n] = tint::utf8::Decode(utf8, line().size() - pos());
         if (n == 0) {
@@ -1012,14 +1162,6 @@ std::optional<Token> Lexer::try_ident() {
 
         // Consume continuing codepoint
         advance(static_cast<uint32_t>(n));
-
-        if (pos() - start == 2 && substr(start, 2) == "__") {
-            // Identifiers prefixed with two or more underscores are not allowed.
-            // We check for these in the loop to bail early and prevent quadratic parse time for
-            // long sequences of ____.
-            set_pos(start);
-            return {};
-        }
     }
 
     auto str = substr(start, pos() - start);
@@ -1036,174 +1178,133 @@ std::optional<Token> Lexer::try_punctuation() {
     auto source = begin_source();
     auto type = Token::Type::kUninitialized;
 
-    if (matches(pos(), '@')) {
-        type = Token::Type::kAttr;
-        advance(1);
-    } else if (matches(pos(), '(')) {
-        type = Token::Type::kParenLeft;
-        advance(1);
-    } else if (matches(pos(), ')')) {
-        type = Token::Type::kParenRight;
-        advance(1);
-    } else if (matches(pos(), '[')) {
-        type = Token::Type::kBracketLeft;
-        advance(1);
-    } else if (matches(pos(), ']')) {
-        type = Token::Type::kBracketRight;
-        advance(1);
-    } else if (matches(pos(), '{')) {
-        type = Token::Type::kBraceLeft;
-        advance(1);
-    } else if (matches(pos(), '}')) {
-        type = Token::Type::kBraceRight;
-        advance(1);
-    } else if (matches(pos(), '&')) {
-        if (matches(pos() + 1, '&')) {
-            type = Token::Type::kAndAnd;
+    // Selects the token type `a`, `b` or `c` when the current character is followed by the
+    // character `next_b` or `next_c`, respectively.
+    auto one_or_two = [&](Token::Type a, char next_b, Token::Type b, char next_c = 0,
+                          Token::Type c = Token::Type::kUninitialized) {
+        if (matches(pos() + 1, next_b)) {
+            type = b;
             advance(2);
-        } else if (matches(pos() + 1, '=')) {
-            type = Token::Type::kAndEqual;
+        } else if (next_c != 0 && matches(pos() + 1, next_c)) {
+            type = c;
             advance(2);
         } else {
-            type = Token::Type::kAnd;
+            type = a;
             advance(1);
         }
-    } else if (matches(pos(), '/')) {
-        if (matches(pos() + 1, '=')) {
-            type = Token::Type::kDivisionEqual;
-            advance(2);
-        } else {
-            type = Token::Type::kForwardSlash;
+    };
+
+    switch (at(pos())) {
+        case '@':
+            type = Token::Type::kAttr;
             advance(1);
-        }
-    } else if (matches(pos(), '!')) {
-        if (matches(pos() + 1, '=')) {
-            type = Token::Type::kNotEqual;
-            advance(2);
-        } else {
-            type = Token::Type::kBang;
+            break;
+        case '(':
+            type = Token::Type::kParenLeft;
             advance(1);
-        }
-    } else if (matches(pos(), ':')) {
-        type = Token::Type::kColon;
-        advance(1);
-    } else if (matches(pos(), ',')) {
-        type = Token::Type::kComma;
-        advance(1);
-    } else if (matches(pos(), '=')) {
-        if (matches(pos() + 1, '=')) {
-            type = Token::Type::kEqualEqual;
-            advance(2);
-        } else {
-            type = Token::Type::kEqual;
+            break;
+        case ')':
+            type = Token::Type::kParenRight;
             advance(1);
-        }
-    } else if (matches(pos(), '>')) {
-        if (matches(pos() + 1, '=')) {
-            type = Token::Type::kGreaterThanEqual;
-            advance(2);
-        } else if (matches(pos() + 1, '>')) {
-            if (matches(pos() + 2, '=')) {
+            break;
+        case '[':
+            type = Token::Type::kBracketLeft;
+            advance(1);
+            break;
+        case ']':
+            type = Token::Type::kBracketRight;
+            advance(1);
+            break;
+        case '{':
+            type = Token::Type::kBraceLeft;
+            advance(1);
+            break;
+        case '}':
+            type = Token::Type::kBraceRight;
+            advance(1);
+            break;
+        case '&':
+            one_or_two(Token::Type::kAnd, '&', Token::Type::kAndAnd, '=',
+                       Token::Type::kAndEqual);
+            break;
+        case '/':
+            one_or_two(Token::Type::kForwardSlash, '=', Token::Type::kDivisionEqual);
+            break;
+        case '!':
+            one_or_two(Token::Type::kBang, '=', Token::Type::kNotEqual);
+            break;
+        case ':':
+            type = Token::Type::kColon;
+            advance(1);
+            break;
+        case ',':
+            type = Token::Type::kComma;
+            advance(1);
+            break;
+        case '=':
+            one_or_two(Token::Type::kEqual, '=', Token::Type::kEqualEqual);
+            break;
+        case '>':
+            if (matches(pos() + 1, '>') && matches(pos() + 2, '=')) {
                 type = Token::Type::kShiftRightEqual;
                 advance(3);
             } else {
-                type = Token::Type::kShiftRight;
-                advance(2);
+                one_or_two(Token::Type::kGreaterThan, '=', Token::Type::kGreaterThanEqual, '>',
+                           Token::Type::kShiftRight);
             }
-        } else {
-            type = Token::Type::kGreaterThan;
-            advance(1);
-        }
-    } else if (matches(pos(), '<')) {
-        if (matches(pos() + 1, '=')) {
-            type = Token::Type::kLessThanEqual;
-            advance(2);
-        } else if (matches(pos() + 1, '<')) {
-            if (matches(pos() + 2, '=')) {
+            break;
+        case '<':
+            if (matches(pos() + 1, '<') && matches(pos() + 2, '=')) {
                 type = Token::Type::kShiftLeftEqual;
                 advance(3);
             } else {
-                type = Token::Type::kShiftLeft;
+                one_or_two(Token::Type::kLessThan, '=', Token::Type::kLessThanEqual, '<',
+                           Token::Type::kShiftLeft);
+            }
+            break;
+        case '%':
+            one_or_two(Token::Type::kMod, '=', Token::Type::kModuloEqual);
+            break;
+        case '-':
+            if (matches(pos() + 1, '>')) {
+                type = Token::Type::kArrow;
                 advance(2);
+            } else {
+                one_or_two(Token::Type::kMinus, '-', Token::Type::kMinusMinus, '=',
+                           Token::Type::kMinusEqual);
             }
-        } else {
-            type = Token::Type::kLessThan;
-            advance(1);
-        }
-    } else if (matches(pos(), '%')) {
-        if (matches(pos() + 1, '=')) {
-            type = Token::Type::kModuloEqual;
-            advance(2);
-        } else {
-            type = Token::Type::kMod;
-            advance(1);
-        }
-    } else if (matches(pos(), '-')) {
-        if (matches(pos() + 1, '>')) {
-            type = Token::Type::kArrow;
-            advance(2);
-        } else if (matches(pos() + 1, '-')) {
-            type = Token::Type::kMinusMinus;
-            advance(2);
-        } else if (matches(pos() + 1, '=')) {
-            type = Token::Type::kMinusEqual;
-            advance(2);
-        } else {
-            type = Token::Type::kMinus;
-            advance(1);
-        }
-    } else if (matches(pos(), '.')) {
-        type = Token::Type::kPeriod;
-        advance(1);
-    } else if (matches(pos(), '+')) {
-        if (matches(pos() + 1, '+')) {
-            type = Token::Type::kPlusPlus;
-            advance(2);
-        } else if (matches(pos() + 1, '=')) {
-            type = Token::Type::kPlusEqual;
-            advance(2);
-        } else {
-            type = Token::Type::kPlus;
+            break;
+        case '.':
+            type = Token::Type::kPeriod;
             advance(1);
-        }
-    } else if (matches(pos(), '|')) {
-        if (matches(pos() + 1, '|')) {
-            type = Token::Type::kOrOr;
-            advance(2);
-        } else if (matches(pos() + 1, '=')) {
-            type = Token::Type::kOrEqual;
-            advance(2);
-        } else {
-            type = Token::Type::kOr;
+            break;
+        case '+':
+            one_or_two(Token::Type::kPlus, '+', Token::Type::kPlusPlus, '=',
+                       Token::Type::kPlusEqual);
+            break;
+        case '|':
+            one_or_two(Token::Type::kOr, '|', Token::Type::kOrOr, '=', Token::Type::kOrEqual);
+            break;
+        case ';':
+            type = Token::Type::kSemicolon;
             advance(1);
-        }
-    } else if (matches(pos(), ';')) {
-        type = Token::Type::kSemicolon;
-        advance(1);
-    } else if (matches(pos(), '*')) {
-        if (matches(pos() + 1, '=')) {
-            type = Token::Type::kTimesEqual;
-            advance(2);
-        } else {
-            type = Token::Type::kStar;
+            break;
+        case '*':
+            one_or_two(Token::Type::kStar, '=', Token::Type::kTimesEqual);
+            break;
+        case '~':
+            type = Token::Type::kTilde;
             advance(1);
-        }
-    } else if (matches(pos(), '~')) {
-        type = Token::Type::kTilde;
-        advance(1);
-    } else if (matches(pos(), '_')) {
-        type = Token::Type::kUnderscore;
-        advance(1);
-    } else if (matches(pos(), '^')) {
-        if (matches(pos() + 1, '=')) {
-            type = Token::Type::kXorEqual;
-            advance(2);
-        } else {
-            type = Token::Type::kXor;
+            break;
+        case '_':
+            type = Token::Type::kUnderscore;
             advance(1);
-        }
-    } else {
-        return {};
+            break;
+        case '^':
+            one_or_two(Token::Type::kXor, '=', Token::Type::kXorEqual);
+            break;
+        default:
+            return {};
     }
 
     end_source(source);
@@ -1212,92 +1313,131 @@ std::optional<Token> Lexer::try_punctuation() {
 }
 
 std::optional<Token::Type> Lexer::parse_keyword(std::string_view str) {
-    if (str == "alias") {
-        return Token::Type::kAlias;
-    }
-    if (str == "bitcast") {
-        return Token::Type::kBitcast;
-    }
-    if (str == "break") {
-        return Token::Type::kBreak;
-    }
-    if (str == "case") {
-        return Token::Type::kCase;
-    }
-    if (str == "const") {
-        return Token::Type::kConst;
-    }
-    if (str == "const_assert") {
-        return Token::Type::kConstAssert;
-    }
-    if (str == "continue") {
-        return Token::Type::kContinue;
-    }
-    if (str == "continuing") {
-        return Token::Type::kContinuing;
-    }
-    if (str == "diagnostic") {
-        return Token::Type::kDiagnostic;
-    }
-    if (str == "discard") {
-        return Token::Type::kDiscard;
-    }
-    if (str == "default") {
-        return Token::Type::kDefault;
-    }
-    if (str == "else") {
-        return Token::Type::kElse;
-    }
-    if (str == "enable") {
-        return Token::Type::kEnable;
-    }
-    if (str == "fallthrough") {
-        return Token::Type::kFallthrough;
-    }
-    if (str == "false") {
-        return Token::Type::kFalse;
-    }
-    if (str == "fn") {
-        return Token::Type::kFn;
-    }
-    if (str == "for") {
-        return Token::Type::kFor;
-    }
-    if (str == "if") {
-        return Token::Type::kIf;
-    }
-    if (str == "let") {
-        return Token::Type::kLet;
-    }
-    if (str == "loop") {
-        return Token::Type::kLoop;
-    }
-    if (str == "override") {
-        return Token::Type::kOverride;
-    }
-    if (str == "return") {
-        return Token::Type::kReturn;
-    }
-    if (str == "requires") {
-        return Token::Type::kRequires;
-    }
-    if (str == "struct") {
-        return Token::Type::kStruct;
-    }
-    if (str == "switch") {
-        return Token::Type::kSwitch;
-    }
-    if (str == "true") {
-        return Token::Type::kTrue;
-    }
-    if (str == "var") {
-        return Token::Type::kVar;
-    }
-    if (str == "while") {
-        return Token::Type::kWhile;
-    }
-    if (str == "_") {
-        return Token::Type::kUnderscore;
+    if (str.empty()) {
+        return std::nullopt;
+    }
+    // Switch on the first character, so that each identifier is only compared against the few
+    // keywords that share its first character.
+    switch (str[0]) {
+        case '_':
+            if (str == "_") {
+                return Token::Type::kUnderscore;
+            }
+            break;
+        case 'a':
+            if (str == "alias") {
+                return Token::Type::kAlias;
+            }
+            break;
+        case 'b':
+            if (str == "bitcast") {
+                return Token::Type::kBitcast;
+            }
+            if (str == "break") {
+                return Token::Type::kBreak;
+            }
+            break;
+        case 'c':
+            if (str == "case") {
+                return Token::Type::kCase;
+            }
+            if (str == "const") {
+                return Token::Type::kConst;
+            }
+            if (str == "const_assert") {
+                return Token::Type::kConstAssert;
+            }
+            if (str == "continue") {
+                return Token::Type::kContinue;
+            }
+            if (str == "continuing") {
+                return Token::Type::kContinuing;
+            }
+            break;
+        case 'd':
+            if (str == "default") {
+                return Token::Type::kDefault;
+            }
+            if (str == "diagnostic") {
+                return Token::Type::kDiagnostic;
+            }
+            if (str == "discard") {
+                return Token::Type::kDiscard;
+            }
+            break;
+        case 'e':
+            if (str == "else") {
+                return Token::Type::kElse;
+            }
+            if (str == "enable") {
+                return Token::Type::kEnable;
+            }
+            break;
+        case 'f':
+            if (str == "fallthrough") {
+                return Token::Type::kFallthrough;
+            }
+            if (str == "false") {
+                return Token::Type::kFalse;
+            }
+            if (str == "fn") {
+                return Token::Type::kFn;
+            }
+            if (str == "for") {
+                return Token::Type::kFor;
+            }
+            break;
+        case 'i':
+            if (str == "if") {
+                return Token::Type::kIf;
+            }
+            break;
+        case 'l':
+            if (str == "let") {
+                return Token::Type::kLet;
+            }
+            if (str == "loop") {
+                return Token::Type::kLoop;
+            }
+            break;
+        case 'o':
+            if (str == "override") {
+                return Token::Type::kOverride;
+            }
+            break;
+        case 'r':
+            if (str == "requires") {
+                return Token::Type::kRequires;
+            }
+            if (str == "return") {
+                return Token::Type::kReturn;
+            }
+            break;
+        case 's':
+            if (str == "struct") {
+                return Token::Type::kStruct;
+            }
+            if (str == "switch") {
+                return Token::Type::kSwitch;
+            }
+            break;
+        case 't':
+            if (str == "true") {
+                return Token::Type::kTrue;
+            }
+            break;
+        case 'v':
+            if (str == "var") {
+                return Token::Type::kVar;
+            }
+            break;
+        case 'w':
+            if (str == "while") {
+                return Token::Type::kWhile;
+            }
+            break;
+        default:
+            break;
     }
     return std::nullopt;
 }
@@ -29,6 +29,7 @@
 #define SRC_TINT_LANG_WGSL_READER_PARSER_LEXER_H_
 
 #include <optional>
+#include <string_view>
 #include <vector>
 
 #include "src/tint/lang/wgsl/reader/parser/token.h"
@@ -122,6 +123,8 @@ class Lexer {
     Source::File const* const file_;
     /// The current location within the input
     Source::Location location_;
+    /// The content of the current line
+    std::string_view line_;
 };
 
 }  // namespace tint::wgsl::reader
@@ -92,6 +92,30 @@ TEST_F(LexerTest, Skips_Blankspace_Basic) {
     }
 }
 
+TEST_F(LexerTest, Skips_Blankspace_Long) {
+    // Blankspace which spans multiple 16-byte blocks.
+    Source::File file("", std::string(37, ' ') + "\t\t\t" + "ident" + std::string(20, '\t'));
+    Lexer l(&file);
+
+    auto list = l.Lex();
+    ASSERT_EQ(2u, list.size());
+
+    {
+        auto& t = list[0];
+        EXPECT_TRUE(t.IsIdentifier());
+        EXPECT_EQ(t.source().range.begin.line, 1u);
+        EXPECT_EQ(t.source().range.begin.column, 41u);
+        EXPECT_EQ(t.source().range.end.line, 1u);
+        EXPECT_EQ(t.source().range.end.column, 46u);
+        EXPECT_EQ(t.to_str(), "ident");
+    }
+
+    {
+        auto& t = list[1];
+        EXPECT_TRUE(t.IsEof());
+    }
+}
+
 TEST_F(LexerTest, Skips_Blankspace_Exotic) {
     Source::File file("",                              //
                       kVTab kFF kNL kLS kPS kL2R kR2L  //
@@ -303,6 +327,24 @@ text // nested line comments are ignored /* more text
     }
 }
 
+TEST_F(LexerTest, Skips_Comments_Block_Long) {
+    Source::File file("", R"(/* a block comment which is longer than 32 characters, with * and /
+characters which do not start or end a comment, / * and * / */ident)");
+    Lexer l(&file);
+
+    auto list = l.Lex();
+    ASSERT_EQ(2u, list.size());
+
+    auto& t = list[0];
+    EXPECT_TRUE(t.IsIdentifier());
+    EXPECT_EQ(t.source().range.begin.line, 2u);
+    EXPECT_EQ(t.source().range.begin.column, 63u);
+    EXPECT_EQ(t.source().range.end.line, 2u);
+    EXPECT_EQ(t.source().range.end.column, 68u);
+
+    EXPECT_TRUE(list[1].IsEof());
+}
+
 TEST_F(LexerTest, Skips_Comments_Block_Unterminated) {
     // I had to break up the /* because otherwise the clang readability check
     // errored out saying it could not find the end of a multi-line comment.
@@ -372,6 +414,22 @@ TEST_F(LexerTest, Null_InBlockComment_IsError) {
     EXPECT_EQ(t.to_str(), "null character found");
 }
 
+TEST_F(LexerTest, Null_InLongBlockComment_IsError) {
+    Source::File file("", "/*" + std::string(40, 'x') + std::string(1, '\0') + "*/");
+    Lexer l(&file);
+
+    auto list = l.Lex();
+    ASSERT_EQ(1u, list.size());
+
+    auto& t = list[0];
+    EXPECT_TRUE(t.IsError());
+    EXPECT_EQ(t.source().range.begin.line, 1u);
+    EXPECT_EQ(t.source().range.begin.column, 43u);
+    EXPECT_EQ(t.source().range.end.line, 1u);
+    EXPECT_EQ(t.source().range.end.column, 43u);
+    EXPECT_EQ(t.to_str(), "null character found");
+}
+
 TEST_F(LexerTest, Null_InIdentifier_IsError) {
     // Try inserting a null in an identifier. Other valid token
     // kinds will behave similarly, so use the identifier case
@@ -696,6 +754,8 @@ INSTANTIATE_TEST_SUITE_P(
                     "\xf0\x9d\x96\x99\xf0\x9d\x96\x8e\xf0\x9d\x96\x8b\xf0\x9d\x96\x8e"
                     "\xf0\x9d\x96\x8a\xf0\x9d\x96\x97\x31\x32\x33",
                     43},
+        UnicodeCase{// "abcdefghijklmnopqrstuｉvwx"
+                    "abcdefghijklmnopqrstu\xef\xbd\x89vwx", 27},
     }));
 
 using InvalidUnicodeIdentifierTest = testing::TestWithParam<const char*>;
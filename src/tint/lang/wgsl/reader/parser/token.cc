@@ -217,7 +217,7 @@ Token::Token(Type type, const Source& source, std::string_view view)
     : type_(type), source_(source), value_(view) {}
 
 Token::Token(Type type, const Source& source, const std::string& str)
-    : type_(type), source_(source), value_(str) {}
+    : type_(type), source_(source), value_(std::make_unique<const std::string>(str)) {}
 
 Token::Token(Type type, const Source& source, const char* str)
     : type_(type), source_(source), value_(std::string_view(str)) {}
@@ -241,7 +241,7 @@ bool Token::operator==(std::string_view ident) const {
     if (auto* view = std::get_if<std::string_view>(&value_)) {
         return *view == ident;
     }
-    return std::get<std::string>(value_) == ident;
+    return *std::get<std::unique_ptr<const std::string>>(value_) == ident;
 }
 
 std::string Token::to_str() const {
@@ -263,7 +263,7 @@ std::string Token::to_str() const {
             if (auto* view = std::get_if<std::string_view>(&value_)) {
                 return std::string(*view);
             }
-            return std::get<std::string>(value_);
+            return *std::get<std::unique_ptr<const std::string>>(value_);
         default:
             return "";
     }
@@ -277,7 +277,7 @@ std::string_view Token::to_str_view() const {
     if (auto* view = std::get_if<std::string_view>(&value_)) {
         return *view;
     }
-    auto& s = std::get<std::string>(value_);
+    auto& s = *std::get<std::unique_ptr<const std::string>>(value_);
     return {s.data(), s.length()};
 }
 
@@ -28,6 +28,7 @@
 #ifndef SRC_TINT_LANG_WGSL_READER_PARSER_TOKEN_H_
 #define SRC_TINT_LANG_WGSL_READER_PARSER_TOKEN_H_
 
+#include <memory>
 #include <string>
 #include <string_view>
 #include <variant>
@@ -368,8 +369,10 @@ class Token {
     Type type_ = Type::kError;
     /// The source where the token appeared
     Source source_;
-    /// The value represented by the token
-    std::variant<int64_t, double, std::string, std::string_view> value_;
+    /// The value represented by the token.
+    /// Strings that are not views into the source, such as error messages, are rare, so they are
+    /// held by pointer to keep the token small.
+    std::variant<int64_t, double, std::string_view, std::unique_ptr<const std::string>> value_;
 };
 
 template <typename STREAM, typename = traits::EnableIfIsOStream<STREAM>>
@@ -28,6 +28,7 @@
 #include <string>
 
 #include "src/tint/cmd/bench/bench.h"
+#include "src/tint/lang/wgsl/reader/parser/lexer.h"
 #include "src/tint/lang/wgsl/reader/reader.h"
 
 namespace tint::wgsl::reader {
@@ -49,5 +50,27 @@ void ParseWGSL(benchmark::State& state, std::string input_name) {
 
 TINT_BENCHMARK_PROGRAMS(ParseWGSL);
 
+void LexWGSL(benchmark::State& state, std::string input_name) {
+    auto res = bench::LoadInputFile(input_name);
+    if (res != Success) {
+        state.SkipWithError(res.Failure().reason.Str());
+        return;
+    }
+    size_t num_tokens = 0;
+    for (auto _ : state) {
+        Lexer lexer(&res.Get());
+        auto tokens = lexer.Lex();
+        if (tokens.back().IsError()) {
+            state.SkipWithError(tokens.back().to_str());
+        }
+        num_tokens = tokens.size();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(res->content.data.size()));
+    state.counters["tokens"] = static_cast<double>(num_tokens);
+}
+
+TINT_BENCHMARK_PROGRAMS(LexWGSL);
+
 }  // namespace
 }  // namespace tint::wgsl::reader
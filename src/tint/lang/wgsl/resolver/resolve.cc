@@ -33,8 +33,11 @@
 
 namespace tint::resolver {
 
-Program Resolve(ProgramBuilder& builder, const wgsl::AllowedFeatures& allowed_features) {
-    Resolver resolver(&builder, std::move(allowed_features));
+Program Resolve(ProgramBuilder& builder,
+                const wgsl::AllowedFeatures& allowed_features,
+                uint32_t max_threads,
+                UniformityCache* uniformity_cache) {
+    Resolver resolver(&builder, std::move(allowed_features), max_threads, uniformity_cache);
     resolver.Resolve();
     return Program(std::move(builder));
 }
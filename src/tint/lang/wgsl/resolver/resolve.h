@@ -28,21 +28,30 @@
 #ifndef SRC_TINT_LANG_WGSL_RESOLVER_RESOLVE_H_
 #define SRC_TINT_LANG_WGSL_RESOLVER_RESOLVE_H_
 
+#include <cstdint>
+
 #include "src/tint/lang/wgsl/common/allowed_features.h"
 
 namespace tint {
 class Program;
 class ProgramBuilder;
 }  // namespace tint
+namespace tint::resolver {
+class UniformityCache;
+}  // namespace tint::resolver
 
 namespace tint::resolver {
 
 /// Performs semantic analysis and validation on the program builder @p builder
 /// @param allowed_features the extensions and features that are allowed to be used
+/// @param max_threads the maximum number of threads used to analyze function bodies concurrently
+/// @param uniformity_cache the optional cache of function uniformity summaries
 /// @returns the resolved Program. Program.Diagnostics() may contain validation errors.
 Program Resolve(
     ProgramBuilder& builder,
-    const wgsl::AllowedFeatures& allowed_features = wgsl::AllowedFeatures::Everything());
+    const wgsl::AllowedFeatures& allowed_features = wgsl::AllowedFeatures::Everything(),
+    uint32_t max_threads = 1,
+    UniformityCache* uniformity_cache = nullptr);
 
 }  // namespace tint::resolver
 
@@ -45,6 +45,7 @@
 #include "src/tint/lang/wgsl/program/program_builder.h"
 #include "src/tint/lang/wgsl/resolver/dependency_graph.h"
 #include "src/tint/lang/wgsl/resolver/sem_helper.h"
+#include "src/tint/lang/wgsl/resolver/uniformity.h"
 #include "src/tint/lang/wgsl/resolver/validator.h"
 #include "src/tint/lang/wgsl/sem/block_statement.h"
 #include "src/tint/lang/wgsl/sem/function.h"
@@ -98,7 +99,13 @@ class Resolver {
     /// Constructor
     /// @param builder the program builder
     /// @param allowed_features the extensions and features that are allowed to be used
-    explicit Resolver(ProgramBuilder* builder, const wgsl::AllowedFeatures& allowed_features);
+    /// @param max_threads the maximum number of threads used to analyze function bodies
+    /// concurrently. If 1, then all analysis happens on the calling thread.
+    /// @param uniformity_cache the optional cache of function uniformity summaries
+    explicit Resolver(ProgramBuilder* builder,
+                      const wgsl::AllowedFeatures& allowed_features,
+                      uint32_t max_threads = 1,
+                      UniformityCache* uniformity_cache = nullptr);
 
     /// Destructor
     ~Resolver();
@@ -135,6 +142,11 @@ class Resolver {
     /// @returns the validator for testing
     const Validator* GetValidatorForTesting() const { return &validator_; }
 
+    /// @returns the hit and miss counters of the intrinsic overload cache
+    const core::intrinsic::OverloadCacheStats& IntrinsicCacheStats() const {
+        return intrinsic_table_.CacheStats();
+    }
+
   private:
     /// Resolves the program, without creating final the semantic nodes.
     /// @returns true on success, false on error
@@ -700,6 +712,8 @@ class Resolver {
     SemHelper sem_;
     Validator validator_;
     wgsl::AllowedFeatures allowed_features_;
+    const uint32_t max_threads_;
+    UniformityCache* const uniformity_cache_;
     wgsl::Extensions enabled_extensions_;
     Vector<sem::Function*, 8> entry_points_;
     Hashmap<const core::type::Type*, const Source*, 8> atomic_composite_info_;
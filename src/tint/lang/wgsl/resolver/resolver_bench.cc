@@ -0,0 +1,200 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <optional>
+#include <string>
+
+#include "src/tint/cmd/bench/bench.h"
+#include "src/tint/lang/wgsl/reader/parser/parser.h"
+#include "src/tint/lang/wgsl/resolver/resolver.h"
+#include "src/tint/utils/text/string_stream.h"
+
+namespace tint::resolver {
+namespace {
+
+void ResolveWGSL(benchmark::State& state, std::string input_name) {
+    auto res = bench::LoadInputFile(input_name);
+    if (res != Success) {
+        state.SkipWithError(res.Failure().reason.Str());
+        return;
+    }
+    core::intrinsic::OverloadCacheStats cache_stats;
+    std::optional<wgsl::reader::Parser> parser;
+    for (auto _ : state) {
+        // Only measure the resolver. Parsing, and destruction of the previous iteration's
+        // program, happens with the timer paused.
+        state.PauseTiming();
+        parser.reset();
+        parser.emplace(&res.Get());
+        parser->Parse();
+        state.ResumeTiming();
+
+        Resolver resolver(&parser->builder(), wgsl::AllowedFeatures::Everything());
+        if (!resolver.Resolve()) {
+            state.SkipWithError(resolver.error());
+        }
+        cache_stats.hits += resolver.IntrinsicCacheStats().hits;
+        cache_stats.misses += resolver.IntrinsicCacheStats().misses;
+    }
+    state.counters["overload_cache_hit_rate"] = cache_stats.HitRate();
+}
+
+TINT_BENCHMARK_PROGRAMS(ResolveWGSL);
+
+/// Resolves the program with a UniformityCache that was populated by a prior resolve of the same
+/// program, so that the uniformity analysis of each function is replaced by a cached summary.
+void ResolveWGSLWithUniformityCache(benchmark::State& state, std::string input_name) {
+    auto res = bench::LoadInputFile(input_name);
+    if (res != Success) {
+        state.SkipWithError(res.Failure().reason.Str());
+        return;
+    }
+    UniformityCache cache;
+    std::optional<wgsl::reader::Parser> parser;
+    for (auto _ : state) {
+        state.PauseTiming();
+        parser.reset();
+        parser.emplace(&res.Get());
+        parser->Parse();
+        state.ResumeTiming();
+
+        Resolver resolver(&parser->builder(), wgsl::AllowedFeatures::Everything(),
+                          /* max_threads */ 1, &cache);
+        if (!resolver.Resolve()) {
+            state.SkipWithError(resolver.error());
+        }
+    }
+}
+
+TINT_BENCHMARK_PROGRAMS(ResolveWGSLWithUniformityCache);
+
+/// @returns a large generated WGSL compute shader, resembling a machine-learning kernel, with
+/// @p num_tiles independent tile functions that are called from @p num_tiles / 8 layer functions.
+std::string GenerateKernel(size_t num_tiles) {
+    StringStream ss;
+    ss << R"(
+@group(0) @binding(0) var<storage, read> input_a : array<f32>;
+@group(0) @binding(1) var<storage, read> input_b : array<f32>;
+@group(0) @binding(2) var<storage, read_write> output : array<f32>;
+
+var<workgroup> shared_tile : array<f32, 256>;
+)";
+    for (size_t i = 0; i < num_tiles; i++) {
+        ss << R"(
+fn tile_)" << i << R"((row : u32, col : u32, bias : ptr<function, f32>) -> f32 {
+  var acc = 0.0;
+  for (var k = 0u; k < 64u; k++) {
+    let a = input_a[row * 64u + k];
+    let b = input_b[k * 64u + col];
+    acc = fma(a, b, acc);
+    if (acc > 1000.0) {
+      acc = acc * 0.5;
+    } else if (acc < -1000.0) {
+      break;
+    }
+  }
+  switch (row % 4u) {
+    case 0u: { *bias += shared_tile[col % 256u]; }
+    case 1u, 2u: { *bias -= f32()"
+           << i << R"(); }
+    default: { *bias = max(*bias, acc); }
+  }
+  return clamp(acc + *bias, -1.0, 1.0);
+}
+)";
+    }
+    for (size_t l = 0; l < num_tiles / 8; l++) {
+        ss << "\nfn layer_" << l << "(row : u32, col : u32) -> f32 {\n";
+        ss << "  var bias = 0.0;\n";
+        ss << "  var sum = 0.0;\n";
+        for (size_t i = l * 8; i < l * 8 + 8; i++) {
+            ss << "  sum += tile_" << i << "(row, col, &bias);\n";
+        }
+        ss << "  return sum;\n";
+        ss << "}\n";
+    }
+    ss << R"(
+@compute @workgroup_size(16, 16)
+fn main(@builtin(global_invocation_id) gid : vec3u, @builtin(local_invocation_index) idx : u32) {
+  shared_tile[idx] = input_a[idx];
+  workgroupBarrier();
+  var sum = 0.0;
+)";
+    for (size_t l = 0; l < num_tiles / 8; l++) {
+        ss << "  sum += layer_" << l << "(gid.x, gid.y);\n";
+    }
+    ss << R"(  output[gid.y * 64u + gid.x] = sum;
+}
+)";
+    return ss.str();
+}
+
+/// Resolves a large generated shader, analyzing function bodies with up to state.range(0) threads.
+void ResolveGeneratedKernel(benchmark::State& state) {
+    auto max_threads = static_cast<uint32_t>(state.range(0));
+    Source::File file("kernel.wgsl", GenerateKernel(512));
+    std::optional<wgsl::reader::Parser> parser;
+    for (auto _ : state) {
+        state.PauseTiming();
+        parser.reset();
+        parser.emplace(&file);
+        parser->Parse();
+        state.ResumeTiming();
+
+        Resolver resolver(&parser->builder(), wgsl::AllowedFeatures::Everything(), max_threads);
+        if (!resolver.Resolve()) {
+            state.SkipWithError(resolver.error());
+        }
+    }
+}
+
+BENCHMARK(ResolveGeneratedKernel)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+
+/// Resolves a large generated shader with a UniformityCache that was populated by a prior resolve.
+void ResolveGeneratedKernelWithUniformityCache(benchmark::State& state) {
+    Source::File file("kernel.wgsl", GenerateKernel(512));
+    UniformityCache cache;
+    std::optional<wgsl::reader::Parser> parser;
+    for (auto _ : state) {
+        state.PauseTiming();
+        parser.reset();
+        parser.emplace(&file);
+        parser->Parse();
+        state.ResumeTiming();
+
+        Resolver resolver(&parser->builder(), wgsl::AllowedFeatures::Everything(),
+                          /* max_threads */ 1, &cache);
+        if (!resolver.Resolve()) {
+            state.SkipWithError(resolver.error());
+        }
+    }
+}
+
+BENCHMARK(ResolveGeneratedKernelWithUniformityCache);
+
+}  // namespace
+}  // namespace tint::resolver
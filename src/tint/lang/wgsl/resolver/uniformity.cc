@@ -27,8 +27,14 @@
 
 #include "src/tint/lang/wgsl/resolver/uniformity.h"
 
+#include <algorithm>
+#include <condition_variable>
 #include <limits>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -43,12 +49,15 @@
 #include "src/tint/lang/wgsl/sem/info.h"
 #include "src/tint/lang/wgsl/sem/load.h"
 #include "src/tint/lang/wgsl/sem/loop_statement.h"
+#include "src/tint/lang/wgsl/sem/module.h"
 #include "src/tint/lang/wgsl/sem/statement.h"
 #include "src/tint/lang/wgsl/sem/switch_statement.h"
 #include "src/tint/lang/wgsl/sem/value_constructor.h"
 #include "src/tint/lang/wgsl/sem/value_conversion.h"
 #include "src/tint/lang/wgsl/sem/variable.h"
 #include "src/tint/lang/wgsl/sem/while_statement.h"
+#include "src/tint/utils/bytes/decoder.h"
+#include "src/tint/utils/bytes/encoder.h"
 #include "src/tint/utils/containers/map.h"
 #include "src/tint/utils/containers/scope_stack.h"
 #include "src/tint/utils/containers/unique_vector.h"
@@ -232,6 +241,10 @@ struct FunctionInfo {
     /// The name of the function.
     std::string name;
 
+    /// The identifier of the function's summary in the uniformity cache, if the function was
+    /// cached.
+    std::optional<uint64_t> cache_id;
+
     /// The call site uniformity requirements.
     CallSiteTag callsite_tag;
     /// The function's uniformity effects.
@@ -346,14 +359,31 @@ struct FunctionInfo {
     BlockAllocator<LoopSwitchInfo> loop_switch_info_allocator;
 };
 
+/// Map of function declaration to the function's uniformity analysis results.
+using FunctionInfoMap = Hashmap<const ast::Function*, FunctionInfo, 8>;
+
 /// UniformityGraph is used to analyze the uniformity requirements and effects of functions in a
 /// module.
 class UniformityGraph {
   public:
     /// Constructor.
     /// @param builder the program to analyze
-    explicit UniformityGraph(ProgramBuilder& builder)
-        : b(builder), sem_(b.Sem()), diagnostics_(builder.Diagnostics()) {}
+    /// @param functions the map of analyzed function results
+    /// @param diagnostics the list that diagnostics are added to
+    /// @param cache the optional cache of function summaries
+    /// @param module_fingerprint the fingerprint of the module. Must not be null if @p cache is
+    /// not null.
+    UniformityGraph(const ProgramBuilder& builder,
+                    FunctionInfoMap& functions,
+                    diag::List& diagnostics,
+                    UniformityCache* cache,
+                    const std::string* module_fingerprint)
+        : b(builder),
+          sem_(b.Sem()),
+          diagnostics_(&diagnostics),
+          functions_(functions),
+          cache_(cache),
+          module_fingerprint_(module_fingerprint) {}
 
     /// Destructor.
     ~UniformityGraph() {}
@@ -372,7 +402,7 @@ class UniformityGraph {
         bool success = true;
         for (auto* decl : dependency_graph.ordered_globals) {
             if (auto* func = decl->As<ast::Function>()) {
-                if (!ProcessFunction(func)) {
+                if (!ProcessFunction(func, functions_.Add(func, FunctionInfo(func, b)).value)) {
                     success = false;
                     break;
                 }
@@ -386,17 +416,44 @@ class UniformityGraph {
         return success;
     }
 
+    /// Process a function whose callees have all been processed.
+    /// Used by ConcurrentUniformityAnalysis, which schedules the functions of the module across
+    /// threads.
+    /// @param func the function to process
+    /// @param info the function's info, which must already be in the map of analyzed functions
+    /// @param diagnostics the list that the function's diagnostics are added to
+    /// @param error_mutex the mutex held while reporting an error, as reporting an error also
+    /// traverses the graphs of the called functions
+    /// @returns true if there are no uniformity issues, false otherwise
+    bool ProcessFunction(const ast::Function* func,
+                         FunctionInfo& info,
+                         diag::List& diagnostics,
+                         std::mutex& error_mutex) {
+        diagnostics_ = &diagnostics;
+        error_mutex_ = &error_mutex;
+        return ProcessFunction(func, info);
+    }
+
   private:
     const ProgramBuilder& b;
     const sem::Info& sem_;
-    diag::List& diagnostics_;
+    diag::List* diagnostics_;
 
     /// Map of analyzed function results.
-    Hashmap<const ast::Function*, FunctionInfo, 8> functions_;
+    FunctionInfoMap& functions_;
 
     /// The function currently being analyzed.
     FunctionInfo* current_function_;
 
+    /// If not null, the mutex that is held while reporting an error.
+    std::mutex* error_mutex_ = nullptr;
+
+    /// The optional cache of function summaries.
+    UniformityCache* const cache_;
+
+    /// The fingerprint of the module-scope declarations that affect the analysis of all functions.
+    const std::string* const module_fingerprint_;
+
     /// Create a new node.
     /// @param tag_list a string list that will be used to identify the node for debugging purposes
     /// @param ast the optional AST node that this node corresponds to
@@ -427,12 +484,179 @@ class UniformityGraph {
         return fn->Declaration()->name->symbol.Name();
     }
 
-    /// Process a function.
+    /// Process a function, using the summary from the uniformity cache if the cache holds the
+    /// function.
     /// @param func the function to process
+    /// @param info the function's info
     /// @returns true if there are no uniformity issues, false otherwise
-    bool ProcessFunction(const ast::Function* func) {
-        current_function_ = &functions_.Add(func, FunctionInfo(func, b)).value;
+    bool ProcessFunction(const ast::Function* func, FunctionInfo& info) {
+        current_function_ = &info;
+
+        std::optional<std::string> fingerprint;
+        if (cache_) {
+            fingerprint = Fingerprint(func);
+            if (fingerprint) {
+                if (auto* summary = cache_->Get(*fingerprint); summary && ApplySummary(*summary)) {
+                    return true;
+                }
+            }
+        }
+
+        size_t num_diagnostics = diagnostics_->Count();
+        if (!AnalyzeFunction(func)) {
+            return false;
+        }
+
+        // Only cache functions that raised no diagnostics, as the summary cannot reproduce them.
+        if (fingerprint && diagnostics_->Count() == num_diagnostics) {
+            info.cache_id = cache_->Add(std::move(*fingerprint), Summarize()).id;
+        }
+        return true;
+    }
+
+    /// @returns the fingerprint of @p func that keys the function's summary in the uniformity
+    /// cache, or std::nullopt if the function cannot be cached.
+    std::optional<std::string> Fingerprint(const ast::Function* func) {
+        auto text = SourceText(func);
+        if (text.empty()) {
+            return std::nullopt;
+        }
+
+        auto* sem = sem_.Get(func);
+        StringStream ss;
+        ss << text << "\n" << *module_fingerprint_;
+        if (auto severity = sem->DiagnosticSeverities().Get(
+                wgsl::CoreDiagnosticRule::kDerivativeUniformity)) {
+            ss << "function severity " << *severity << "\n";
+        }
+        for (auto* global : sem->DirectlyReferencedGlobals()) {
+            auto* decl = global->Declaration();
+            ss << "global " << decl->Kind() << " " << decl->name->symbol.NameView() << " "
+               << global->AddressSpace() << " " << global->Access() << " "
+               << global->Type()->FriendlyName() << "\n";
+        }
+        for (auto* call : sem->DirectCalls()) {
+            if (auto* callee = call->Target()->As<sem::Function>()) {
+                auto callee_info = functions_.Get(callee->Declaration());
+                if (!callee_info || !callee_info->cache_id) {
+                    return std::nullopt;  // Callee was not cached.
+                }
+                ss << "call " << *callee_info->cache_id << "\n";
+            }
+        }
+
+        auto fingerprint = ss.str();
+        if (fingerprint.length() > std::numeric_limits<uint16_t>::max()) {
+            return std::nullopt;  // Too large to be encoded.
+        }
+        return fingerprint;
+    }
+
+    /// @returns the source text of @p func from the `fn` keyword to the end of the function body,
+    /// or an empty string if the function does not have source text.
+    static std::string_view SourceText(const ast::Function* func) {
+        if (!func->body) {
+            return {};
+        }
+        auto* file = func->source.file;
+        auto begin = func->source.range.begin;
+        auto end = func->body->source.range.end;
+        if (!file || file != func->body->source.file) {
+            return {};
+        }
+        auto& lines = file->content.lines;
+        if (begin.line == 0 || end.line < begin.line || end.line > lines.size() ||
+            begin.column == 0 || end.column == 0 || begin.column > lines[begin.line - 1].size() ||
+            end.column > lines[end.line - 1].size() + 1) {
+            return {};
+        }
+        auto* start = lines[begin.line - 1].data() + (begin.column - 1);
+        auto* stop = lines[end.line - 1].data() + (end.column - 1);
+        if (stop <= start) {
+            return {};
+        }
+        return std::string_view(start, static_cast<size_t>(stop - start));
+    }
+
+    /// @returns the summary of the current function, for the uniformity cache
+    UniformityCache::Summary Summarize() const {
+        UniformityCache::Summary summary;
+        summary.callsite_tag = static_cast<uint8_t>(current_function_->callsite_tag.tag);
+        summary.callsite_severity = static_cast<uint8_t>(current_function_->callsite_tag.severity);
+        summary.function_tag = static_cast<uint8_t>(current_function_->function_tag);
+        for (auto& param : current_function_->parameters) {
+            UniformityCache::ParameterSummary out;
+            out.tag_direct = static_cast<uint8_t>(param.tag_direct.tag);
+            out.tag_direct_severity = static_cast<uint8_t>(param.tag_direct.severity);
+            out.tag_retval = static_cast<uint8_t>(param.tag_retval.tag);
+            out.pointer_may_become_non_uniform = param.pointer_may_become_non_uniform;
+            for (auto* source : param.ptr_output_source_param_values) {
+                out.ptr_output_source_param_values.push_back(
+                    static_cast<uint32_t>(source->Index()));
+            }
+            for (auto* source : param.ptr_output_source_param_contents) {
+                out.ptr_output_source_param_contents.push_back(
+                    static_cast<uint32_t>(source->Index()));
+            }
+            summary.parameters.push_back(std::move(out));
+        }
+        return summary;
+    }
+
+    /// Applies a summary from the uniformity cache to the current function.
+    /// @param summary the function summary
+    /// @returns false if the summary is not valid for the function, in which case the current
+    /// function is not modified
+    bool ApplySummary(const UniformityCache::Summary& summary) {
+        auto& params = current_function_->parameters;
+        if (summary.parameters.size() != params.Length() ||
+            summary.callsite_tag > CallSiteTag::CallSiteNoRestriction ||
+            summary.function_tag > NoRestriction) {
+            return false;
+        }
+        for (auto& param : summary.parameters) {
+            if (param.tag_direct > ParameterTag::ParameterNoRestriction ||
+                param.tag_retval > ParameterTag::ParameterNoRestriction) {
+                return false;
+            }
+            for (auto idx : param.ptr_output_source_param_values) {
+                if (idx >= params.Length()) {
+                    return false;
+                }
+            }
+            for (auto idx : param.ptr_output_source_param_contents) {
+                if (idx >= params.Length()) {
+                    return false;
+                }
+            }
+        }
 
+        current_function_->cache_id = summary.id;
+        current_function_->callsite_tag = {
+            static_cast<decltype(CallSiteTag::tag)>(summary.callsite_tag),
+            static_cast<wgsl::DiagnosticSeverity>(summary.callsite_severity)};
+        current_function_->function_tag = static_cast<FunctionTag>(summary.function_tag);
+        for (size_t i = 0; i < params.Length(); i++) {
+            auto& in = summary.parameters[i];
+            auto& param = params[i];
+            param.tag_direct = {static_cast<decltype(ParameterTag::tag)>(in.tag_direct),
+                                static_cast<wgsl::DiagnosticSeverity>(in.tag_direct_severity)};
+            param.tag_retval = {static_cast<decltype(ParameterTag::tag)>(in.tag_retval)};
+            param.pointer_may_become_non_uniform = in.pointer_may_become_non_uniform;
+            for (auto idx : in.ptr_output_source_param_values) {
+                param.ptr_output_source_param_values.Push(params[idx].sem);
+            }
+            for (auto idx : in.ptr_output_source_param_contents) {
+                param.ptr_output_source_param_contents.Push(params[idx].sem);
+            }
+        }
+        return true;
+    }
+
+    /// Analyze the current function.
+    /// @param func the function to analyze
+    /// @returns true if there are no uniformity issues, false otherwise
+    bool AnalyzeFunction(const ast::Function* func) {
         // Process function body.
         if (func->body) {
             ProcessStatement(current_function_->cf_start, func->body);
@@ -476,6 +700,15 @@ class UniformityGraph {
             auto traverse = [&](wgsl::DiagnosticSeverity severity) {
                 Traverse(current_function_->RequiredToBeUniform(severity), &reachable);
                 if (reachable.Contains(current_function_->may_be_non_uniform)) {
+                    if (cache_) {
+                        // Cached functions do not have the graphs needed to explain the issue.
+                        // Add a placeholder diagnostic, which makes AnalyzeUniformity() repeat the
+                        // analysis without the cache.
+                        diagnostics_->AddNote(diag::System::Resolver, "uniformity issue", {});
+                        return false;
+                    }
+                    auto lock = error_mutex_ ? std::unique_lock<std::mutex>{*error_mutex_}
+                                             : std::unique_lock<std::mutex>{};
                     MakeError(*current_function_, current_function_->may_be_non_uniform, severity);
                     return false;
                 }
@@ -1831,7 +2064,7 @@ class UniformityGraph {
         auto* control_flow = TraceBackAlongPathUntil(
             non_uniform_source, [](Node* node) { return node->affects_control_flow; });
         if (control_flow) {
-            diagnostics_.AddNote(diag::System::Resolver,
+            diagnostics_->AddNote(diag::System::Resolver,
                                  "control flow depends on possibly non-uniform value",
                                  control_flow->ast->source);
             // TODO(jrprice): There are cases where the function with uniformity requirements is not
@@ -1887,20 +2120,20 @@ class UniformityGraph {
                     ss << "reading from " << var_type(var) << "'" << NameFor(ident)
                        << "' may result in a non-uniform value";
                 }
-                diagnostics_.AddNote(diag::System::Resolver, ss.str(), ident->source);
+                diagnostics_->AddNote(diag::System::Resolver, ss.str(), ident->source);
             },
             [&](const ast::Variable* v) {
                 auto* var = sem_.Get(v);
                 StringStream ss;
                 ss << "reading from " << var_type(var) << "'" << NameFor(v)
                    << "' may result in a non-uniform value";
-                diagnostics_.AddNote(diag::System::Resolver, ss.str(), v->source);
+                diagnostics_->AddNote(diag::System::Resolver, ss.str(), v->source);
             },
             [&](const ast::CallExpression* c) {
                 auto target_name = NameFor(c->target);
                 switch (non_uniform_source->type) {
                     case Node::kFunctionCallReturnValue: {
-                        diagnostics_.AddNote(
+                        diagnostics_->AddNote(
                             diag::System::Resolver,
                             "return value of '" + target_name + "' may be non-uniform", c->source);
                         break;
@@ -1911,21 +2144,21 @@ class UniformityGraph {
                         StringStream ss;
                         ss << "reading from " << var_type(var) << "'" << NameFor(var)
                            << "' may result in a non-uniform value";
-                        diagnostics_.AddNote(diag::System::Resolver, ss.str(),
+                        diagnostics_->AddNote(diag::System::Resolver, ss.str(),
                                              var->Declaration()->source);
                         break;
                     }
                     case Node::kFunctionCallArgumentValue: {
                         auto* arg = c->args[non_uniform_source->arg_index];
                         // TODO(jrprice): Which output? (return value vs another pointer argument).
-                        diagnostics_.AddNote(diag::System::Resolver,
+                        diagnostics_->AddNote(diag::System::Resolver,
                                              "passing non-uniform pointer to '" + target_name +
                                                  "' may produce a non-uniform output",
                                              arg->source);
                         break;
                     }
                     case Node::kFunctionCallPointerArgumentResult: {
-                        diagnostics_.AddNote(
+                        diagnostics_->AddNote(
                             diag::System::Resolver,
                             "contents of pointer may become non-uniform after calling '" +
                                 target_name + "'",
@@ -1939,7 +2172,7 @@ class UniformityGraph {
                 }
             },
             [&](const ast::Expression* e) {
-                diagnostics_.AddNote(diag::System::Resolver,
+                diagnostics_->AddNote(diag::System::Resolver,
                                      "result of expression may be non-uniform", e->source);
             },  //
             TINT_ICE_ON_NO_MATCH);
@@ -1957,7 +2190,7 @@ class UniformityGraph {
             error.system = diag::System::Resolver;
             error.source = source;
             error.message = msg;
-            diagnostics_.Add(std::move(error));
+            diagnostics_->Add(std::move(error));
         };
 
         // Traverse the graph to generate a path from RequiredToBeUniform to the source node.
@@ -2031,11 +2264,287 @@ class UniformityGraph {
     }
 };
 
-}  // namespace
+/// ConcurrentUniformityAnalysis analyzes the functions of a module across multiple threads.
+/// A function is analyzed once all the functions it calls have been analyzed, so functions that do
+/// not depend on each other are analyzed concurrently. The diagnostics of each function are
+/// collected separately and appended to the program's diagnostics in dependency order, so the
+/// output is identical to that of UniformityGraph::Build().
+class ConcurrentUniformityAnalysis {
+  public:
+    /// Constructor.
+    /// @param builder the program to analyze
+    /// @param functions the functions of the module, in dependency order
+    /// @param diagnostics the list that diagnostics are added to
+    /// @param cache the optional cache of function summaries
+    /// @param module_fingerprint the fingerprint of the module, if @p cache is not null
+    ConcurrentUniformityAnalysis(const ProgramBuilder& builder,
+                                 VectorRef<const ast::Function*> functions,
+                                 diag::List& diagnostics,
+                                 UniformityCache* cache,
+                                 const std::string* module_fingerprint)
+        : b(builder),
+          functions_(std::move(functions)),
+          diagnostics_(diagnostics),
+          cache_(cache),
+          module_fingerprint_(module_fingerprint),
+          results_(functions_.Length()) {
+        // Create the function infos up front, so that the map is not modified while analyzing.
+        Hashmap<const ast::Function*, size_t, 64> indices;
+        for (size_t i = 0; i < functions_.Length(); i++) {
+            auto* func = functions_[i];
+            indices.Add(func, i);
+            results_[i].info = &infos_.Add(func, FunctionInfo(func, b)).value;
+        }
 
-bool AnalyzeUniformity(ProgramBuilder& builder, const DependencyGraph& dependency_graph) {
-    UniformityGraph graph(builder);
+        // Each function waits for one notification per call to a user-defined function.
+        for (size_t i = 0; i < functions_.Length(); i++) {
+            for (auto* call : b.Sem().Get(functions_[i])->DirectCalls()) {
+                if (auto* callee = call->Target()->As<sem::Function>()) {
+                    auto callee_idx = indices.Get(callee->Declaration());
+                    TINT_ASSERT(callee_idx);
+                    results_[*callee_idx].callers.Push(i);
+                    results_[i].num_pending_callees++;
+                }
+            }
+            if (results_[i].num_pending_callees == 0) {
+                ready_.Push(i);
+            }
+        }
+        num_remaining_ = functions_.Length();
+    }
+
+    /// Analyzes the functions of the module.
+    /// @param max_threads the maximum number of threads to use, including the calling thread
+    /// @returns true if all uniformity constraints are satisfied, otherwise false
+    bool Run(uint32_t max_threads) {
+        size_t num_workers = std::min<size_t>(max_threads, functions_.Length()) - 1;
+        std::vector<std::thread> workers;
+        workers.reserve(num_workers);
+        for (size_t i = 0; i < num_workers; i++) {
+            workers.emplace_back([&] { Work(); });
+        }
+        Work();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        // Emit the diagnostics in dependency order, up to and including the first failure.
+        for (auto& result : results_) {
+            diagnostics_.Add(result.diagnostics);
+            if (!result.success) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+  private:
+    /// The analysis state of a single function.
+    struct FunctionResult {
+        /// The function's info
+        FunctionInfo* info = nullptr;
+        /// The indices of the functions that call this function, once per call
+        Vector<size_t, 4> callers;
+        /// The number of calls to user-defined functions that have not yet been analyzed
+        size_t num_pending_callees = 0;
+        /// The diagnostics raised by the analysis of the function
+        diag::List diagnostics;
+        /// False if the function failed the uniformity analysis
+        bool success = true;
+    };
+
+    /// Analyzes ready functions until all functions have been analyzed.
+    void Work() {
+        UniformityGraph graph(b, infos_, diagnostics_, cache_, module_fingerprint_);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            cv_.wait(lock, [&] { return !ready_.IsEmpty() || num_remaining_ == 0; });
+            if (num_remaining_ == 0) {
+                return;
+            }
+            size_t idx = ready_.Pop();
+            auto& result = results_[idx];
+
+            // Functions after the first failure are not reported, so don't analyze them.
+            // This includes all the functions that call a function that failed.
+            if (idx < first_failure_) {
+                lock.unlock();
+                result.success = graph.ProcessFunction(functions_[idx], *result.info,
+                                                       result.diagnostics, error_mutex_);
+                lock.lock();
+                if (!result.success) {
+                    first_failure_ = std::min(first_failure_, idx);
+                }
+            }
+
+            for (size_t caller : result.callers) {
+                if (--results_[caller].num_pending_callees == 0) {
+                    ready_.Push(caller);
+                }
+            }
+            num_remaining_--;
+            cv_.notify_all();
+        }
+    }
+
+    const ProgramBuilder& b;
+    const Vector<const ast::Function*, 64> functions_;
+    diag::List& diagnostics_;
+    UniformityCache* const cache_;
+    const std::string* const module_fingerprint_;
+    FunctionInfoMap infos_;
+    std::vector<FunctionResult> results_;
+
+    /// Guards the fields below.
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    Vector<size_t, 64> ready_;
+    size_t num_remaining_ = 0;
+    size_t first_failure_ = std::numeric_limits<size_t>::max();
+
+    /// Held while reporting an error. See UniformityGraph::ProcessFunction().
+    std::mutex error_mutex_;
+};
+
+/// @returns the fingerprint of the module-scope declarations of @p builder that affect the analysis
+/// of every function.
+std::string ModuleFingerprint(ProgramBuilder& builder) {
+    StringStream ss;
+    if (auto severity = builder.Sem().Module()->DiagnosticSeverities().Get(
+            wgsl::CoreDiagnosticRule::kDerivativeUniformity)) {
+        ss << "module severity " << *severity << "\n";
+    }
+    // Identifiers in the function's source text may resolve to any of the module's type
+    // declarations, and the analysis depends on whether types are pointers and on the builtin
+    // attributes of structure members.
+    for (auto* decl : builder.AST().TypeDecls()) {
+        auto* type = builder.Sem().Get(decl);
+        ss << "type " << decl->name->symbol.NameView() << " = " << type->FriendlyName();
+        if (auto* str = type->As<core::type::Struct>()) {
+            ss << " {";
+            for (auto* member : str->Members()) {
+                ss << " " << member->Name().NameView() << " : " << member->Type()->FriendlyName();
+                if (auto builtin = member->Attributes().builtin) {
+                    ss << " @builtin(" << *builtin << ")";
+                }
+                ss << ";";
+            }
+            ss << " }";
+        }
+        ss << "\n";
+    }
+    return ss.str();
+}
+
+/// Analyzes the functions of the program.
+/// @see AnalyzeUniformity()
+bool Analyze(const ProgramBuilder& builder,
+             diag::List& diagnostics,
+             const DependencyGraph& dependency_graph,
+             uint32_t max_threads,
+             UniformityCache* cache,
+             const std::string* module_fingerprint) {
+    if (max_threads > 1 && !TINT_DUMP_UNIFORMITY_GRAPH) {
+        Vector<const ast::Function*, 64> functions;
+        for (auto* decl : dependency_graph.ordered_globals) {
+            if (auto* func = decl->As<ast::Function>()) {
+                functions.Push(func);
+            }
+        }
+        if (functions.Length() > 1) {
+            ConcurrentUniformityAnalysis analysis(builder, std::move(functions), diagnostics,
+                                                  cache, module_fingerprint);
+            return analysis.Run(max_threads);
+        }
+    }
+
+    FunctionInfoMap functions;
+    UniformityGraph graph(builder, functions, diagnostics, cache, module_fingerprint);
     return graph.Build(dependency_graph);
 }
 
+}  // namespace
+
+UniformityCache::UniformityCache() = default;
+
+UniformityCache::~UniformityCache() = default;
+
+const UniformityCache::Summary* UniformityCache::Get(const std::string& fingerprint) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (auto summary = summaries_.Get(fingerprint)) {
+        return summary.value;
+    }
+    return nullptr;
+}
+
+const UniformityCache::Summary& UniformityCache::Add(std::string fingerprint, Summary summary) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return summaries_.GetOrAdd(std::move(fingerprint), [&] {
+        summary.id = next_id_++;
+        return std::move(summary);
+    });
+}
+
+size_t UniformityCache::Count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return summaries_.Count();
+}
+
+Result<SuccessType> UniformityCache::Encode(bytes::Writer& writer) const {
+    std::vector<Entry> entries;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries.reserve(summaries_.Count());
+        for (auto it : summaries_) {
+            entries.push_back(Entry{it.key, it.value});
+        }
+    }
+    // Sort by identifier, so the encoding is deterministic.
+    std::sort(entries.begin(), entries.end(),
+              [](const Entry& a, const Entry& b) { return a.summary.id < b.summary.id; });
+    return bytes::Encode(writer, entries);
+}
+
+Result<SuccessType> UniformityCache::Decode(bytes::Reader& reader) {
+    auto entries = bytes::Decode<std::vector<Entry>>(reader);
+    if (entries != Success) {
+        return entries.Failure();
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (summaries_.Count() != 0) {
+        return Failure{"UniformityCache::Decode() requires an empty cache"};
+    }
+    for (auto& entry : entries.Get()) {
+        next_id_ = std::max(next_id_, entry.summary.id + 1);
+        if (!summaries_.Add(std::move(entry.fingerprint), std::move(entry.summary))) {
+            summaries_.Clear();
+            next_id_ = 0;
+            return Failure{"duplicate UniformityCache entry"};
+        }
+    }
+    return Success;
+}
+
+bool AnalyzeUniformity(ProgramBuilder& builder,
+                       const DependencyGraph& dependency_graph,
+                       uint32_t max_threads,
+                       UniformityCache* cache) {
+    if (!cache) {
+        return Analyze(builder, builder.Diagnostics(), dependency_graph, max_threads, nullptr,
+                       nullptr);
+    }
+
+    // Summaries from the cache do not hold the graphs that are needed to explain a uniformity
+    // diagnostic, so if the analysis raises any diagnostic, repeat it without the cache.
+    auto module_fingerprint = ModuleFingerprint(builder);
+    diag::List diagnostics;
+    if (Analyze(builder, diagnostics, dependency_graph, max_threads, cache, &module_fingerprint) &&
+        diagnostics.Count() == 0) {
+        return true;
+    }
+    return Analyze(builder, builder.Diagnostics(), dependency_graph, max_threads, nullptr,
+                   nullptr);
+}
+
 }  // namespace tint::resolver
@@ -28,6 +28,15 @@
 #ifndef SRC_TINT_LANG_WGSL_RESOLVER_UNIFORMITY_H_
 #define SRC_TINT_LANG_WGSL_RESOLVER_UNIFORMITY_H_
 
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "src/tint/utils/containers/hashmap.h"
+#include "src/tint/utils/reflection/reflection.h"
+#include "src/tint/utils/result/result.h"
+
 // Forward declarations.
 namespace tint::resolver {
 struct DependencyGraph;
@@ -35,17 +44,134 @@ struct DependencyGraph;
 namespace tint {
 class ProgramBuilder;
 }  // namespace tint
+namespace tint::bytes {
+class Reader;
+class Writer;
+}  // namespace tint::bytes
 
 namespace tint::resolver {
 
 /// If true, uniformity analysis failures will be treated as an error, else as a warning.
 constexpr bool kUniformityFailuresAsError = true;
 
+/// UniformityCache holds the uniformity summaries of analyzed functions, so that the analysis of
+/// identical functions can be skipped when resolving other programs.
+///
+/// Summaries are keyed by a fingerprint of the function, which is built from the function's source
+/// text and everything else its analysis depends on: the module-scope variables it references, the
+/// module's type declarations, the uniformity diagnostic severities, and the summaries of the
+/// functions it calls. Functions without source text, and functions that raised a uniformity
+/// diagnostic, are not cached.
+///
+/// A UniformityCache is thread-safe, and can be shared between the resolution of many programs.
+class UniformityCache {
+  public:
+    /// ParameterSummary is the uniformity requirements and effects of a function parameter.
+    struct ParameterSummary {
+        /// The direct uniformity requirement of the parameter.
+        uint8_t tag_direct = 0;
+        /// The diagnostic severity of the direct uniformity requirement.
+        uint8_t tag_direct_severity = 0;
+        /// The uniformity requirement of the parameter with respect to the return value.
+        uint8_t tag_retval = 0;
+        /// True if the function may make the contents of this pointer parameter non-uniform.
+        bool pointer_may_become_non_uniform = false;
+        /// The indices of the parameters whose values are required to be uniform for the contents
+        /// of this pointer parameter to be uniform at function exit.
+        std::vector<uint32_t> ptr_output_source_param_values;
+        /// The indices of the pointer parameters whose contents are required to be uniform for the
+        /// contents of this pointer parameter to be uniform at function exit.
+        std::vector<uint32_t> ptr_output_source_param_contents;
+
+        /// Reflect the fields of this class so that it can be encoded and decoded.
+        TINT_REFLECT(ParameterSummary,
+                     tag_direct,
+                     tag_direct_severity,
+                     tag_retval,
+                     pointer_may_become_non_uniform,
+                     ptr_output_source_param_values,
+                     ptr_output_source_param_contents);
+    };
+
+    /// Summary is the uniformity requirements and effects of a function, as seen by its callers.
+    struct Summary {
+        /// The identifier of the summary in the cache. The fingerprints of calling functions refer
+        /// to the summaries of the functions they call by identifier.
+        uint64_t id = 0;
+        /// The uniformity requirement on the call sites of the function.
+        uint8_t callsite_tag = 0;
+        /// The diagnostic severity of the call site uniformity requirement.
+        uint8_t callsite_severity = 0;
+        /// The uniformity of the function's return value.
+        uint8_t function_tag = 0;
+        /// The summaries of the function's parameters.
+        std::vector<ParameterSummary> parameters;
+
+        /// Reflect the fields of this class so that it can be encoded and decoded.
+        TINT_REFLECT(Summary, id, callsite_tag, callsite_severity, function_tag, parameters);
+    };
+
+    /// Constructor
+    UniformityCache();
+    /// Destructor
+    ~UniformityCache();
+
+    /// @param fingerprint the function fingerprint
+    /// @returns the summary for the function with the given fingerprint, or nullptr if the cache
+    /// does not contain the function. The returned pointer remains valid for the lifetime of the
+    /// cache.
+    const Summary* Get(const std::string& fingerprint) const;
+
+    /// Adds the summary of a function to the cache, assigning it a new identifier.
+    /// If the cache already holds a summary for @p fingerprint then the existing summary is kept.
+    /// @param fingerprint the function fingerprint
+    /// @param summary the function summary
+    /// @returns the summary held by the cache
+    const Summary& Add(std::string fingerprint, Summary summary);
+
+    /// @returns the number of function summaries held by the cache
+    size_t Count() const;
+
+    /// Encodes the cache to @p writer, so it can be restored with Decode().
+    /// @param writer the byte writer
+    /// @returns the result of the write
+    Result<SuccessType> Encode(bytes::Writer& writer) const;
+
+    /// Decodes summaries previously written with Encode() and adds them to the cache.
+    /// The cache must be empty.
+    /// @param reader the byte reader
+    /// @returns success, or a failure if the data could not be decoded
+    Result<SuccessType> Decode(bytes::Reader& reader);
+
+  private:
+    /// An encoded cache entry
+    struct Entry {
+        /// The function fingerprint
+        std::string fingerprint;
+        /// The function summary
+        Summary summary;
+
+        /// Reflect the fields of this class so that it can be encoded and decoded.
+        TINT_REFLECT(Entry, fingerprint, summary);
+    };
+
+    mutable std::mutex mutex_;
+    Hashmap<std::string, Summary, 8> summaries_;
+    uint64_t next_id_ = 0;
+};
+
 /// Analyze the uniformity of a program.
 /// @param builder the program to analyze
 /// @param dependency_graph the dependency-ordered module-scope declarations
+/// @param max_threads the maximum number of threads used to analyze functions concurrently.
+/// Functions are only analyzed concurrently if they do not call each other.
+/// @param cache the optional cache of function summaries, used to skip the analysis of functions
+/// that have already been analyzed, and updated with the summaries of the newly analyzed functions
 /// @returns true if there are no uniformity issues, false otherwise
-bool AnalyzeUniformity(ProgramBuilder& builder, const resolver::DependencyGraph& dependency_graph);
+bool AnalyzeUniformity(ProgramBuilder& builder,
+                       const resolver::DependencyGraph& dependency_graph,
+                       uint32_t max_threads = 1,
+                       UniformityCache* cache = nullptr);
 
 }  // namespace tint::resolver
 
@@ -36,6 +36,8 @@
 #include "src/tint/lang/wgsl/reader/reader.h"
 #include "src/tint/lang/wgsl/resolver/resolve.h"
 #include "src/tint/lang/wgsl/resolver/uniformity.h"
+#include "src/tint/utils/bytes/buffer_writer.h"
+#include "src/tint/utils/bytes/reader.h"
 #include "src/tint/utils/text/string_stream.h"
 
 #include "gmock/gmock.h"
@@ -69,6 +71,8 @@ class UniformityAnalysisTestBase {
     }
 
     /// Parse and resolve a WGSL shader.
+    /// The shader is resolved a second time with the functions analyzed concurrently, which must
+    /// produce identical diagnostics.
     /// @param src the WGSL source code
     /// @param should_pass true if `src` should pass the analysis, otherwise false
     void RunTest(std::string src, bool should_pass) {
@@ -76,6 +80,21 @@ class UniformityAnalysisTestBase {
         options.allowed_features = wgsl::AllowedFeatures::Everything();
         auto file = std::make_unique<Source::File>("test", src);
         auto program = wgsl::reader::Parse(file.get(), options);
+
+        options.max_resolver_threads = 4;
+        auto concurrent = wgsl::reader::Parse(file.get(), options);
+        EXPECT_EQ(concurrent.Diagnostics().Str(), program.Diagnostics().Str());
+
+        // Resolve twice more with a uniformity cache, first populating the cache and then using
+        // it, both of which must also produce identical diagnostics.
+        UniformityCache cache;
+        options.max_resolver_threads = 1;
+        options.uniformity_cache = &cache;
+        auto populate = wgsl::reader::Parse(file.get(), options);
+        EXPECT_EQ(populate.Diagnostics().Str(), program.Diagnostics().Str());
+        auto cached = wgsl::reader::Parse(file.get(), options);
+        EXPECT_EQ(cached.Diagnostics().Str(), program.Diagnostics().Str());
+
         return RunTest(std::move(program), should_pass);
     }
 
@@ -10096,5 +10115,257 @@ test:11:7 note: reading from read_write storage buffer 'non_uniform' may result
 )");
 }
 
+TEST_F(UniformityAnalysisTest, Concurrent_ManyFunctions) {
+    // Generate a chain of independent functions that each call two helpers, where the
+    // non-uniform call is in the middle of the module. The functions after the failure must not
+    // be reported, and the warnings before it must be reported in declaration order.
+    StringStream ss;
+    ss << R"(
+@group(0) @binding(0) var<storage, read_write> non_uniform : i32;
+
+fn helper(i : i32) -> i32 {
+  return i * 2;
+}
+)";
+    for (int i = 0; i < 32; i++) {
+        ss << "\n";
+        if (i == 8 || i == 24) {
+            ss << "@diagnostic(warning, derivative_uniformity)\n";
+        }
+        ss << "fn f" << i << "() {\n";
+        ss << "  if (helper(non_uniform) == " << i << ") {\n";
+        if (i == 8 || i == 16 || i == 24) {
+            ss << "    _ = dpdx(1.0);\n";
+        }
+        ss << "  }\n";
+        ss << "}\n";
+    }
+    RunTest(ss.str(), false);
+    EXPECT_EQ(error_,
+              R"(test:51:9 warning: 'dpdx' must only be called from uniform control flow
+    _ = dpdx(1.0);
+        ^^^^^^^^^
+
+test:50:3 note: control flow depends on possibly non-uniform value
+  if (helper(non_uniform) == 8) {
+  ^^
+
+test:50:14 note: reading from read_write storage buffer 'non_uniform' may result in a non-uniform value
+  if (helper(non_uniform) == 8) {
+             ^^^^^^^^^^^
+
+test:92:9 error: 'dpdx' must only be called from uniform control flow
+    _ = dpdx(1.0);
+        ^^^^^^^^^
+
+test:91:3 note: control flow depends on possibly non-uniform value
+  if (helper(non_uniform) == 16) {
+  ^^
+
+test:91:14 note: reading from read_write storage buffer 'non_uniform' may result in a non-uniform value
+  if (helper(non_uniform) == 16) {
+             ^^^^^^^^^^^
+)");
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Uniformity cache tests
+////////////////////////////////////////////////////////////////////////////////
+
+class UniformityCacheTest : public ::testing::Test {
+  protected:
+    /// Parses and resolves @p src using the uniformity cache.
+    /// @param src the WGSL source code
+    /// @returns the program diagnostics
+    std::string Resolve(std::string src) {
+        wgsl::reader::Options options;
+        options.allowed_features = wgsl::AllowedFeatures::Everything();
+        options.uniformity_cache = &cache_;
+        auto file = std::make_unique<Source::File>("test", src);
+        auto program = wgsl::reader::Parse(file.get(), options);
+        return program.Diagnostics().Str();
+    }
+
+    /// The uniformity cache
+    UniformityCache cache_;
+};
+
+TEST_F(UniformityCacheTest, SharedFunctionsAreCached) {
+    std::string helpers = R"(
+@group(0) @binding(0) var<uniform> u : i32;
+
+fn helper(p : ptr<function, i32>, v : i32) -> i32 {
+  *p = v;
+  return u;
+}
+
+fn barrier_if(v : i32) {
+  if (v == 0) {
+    workgroupBarrier();
+  }
+}
+)";
+
+    EXPECT_EQ(Resolve(helpers + R"(
+@compute @workgroup_size(64)
+fn main() {
+  var x = 0;
+  barrier_if(helper(&x, 1));
+}
+)"),
+              "");
+    EXPECT_EQ(cache_.Count(), 3u);
+
+    // A second program that shares the helpers only adds the new entry point.
+    EXPECT_EQ(Resolve(helpers + R"(
+@compute @workgroup_size(64)
+fn main() {
+  var x = 0;
+  barrier_if(helper(&x, 2));
+}
+)"),
+              "");
+    EXPECT_EQ(cache_.Count(), 4u);
+
+    // Resolving the same program again does not add any entries.
+    EXPECT_EQ(Resolve(helpers + R"(
+@compute @workgroup_size(64)
+fn main() {
+  var x = 0;
+  barrier_if(helper(&x, 2));
+}
+)"),
+              "");
+    EXPECT_EQ(cache_.Count(), 4u);
+}
+
+TEST_F(UniformityCacheTest, ErrorInCallerOfCachedFunction) {
+    std::string helper = R"(
+fn barrier_if(v : i32) {
+  if (v == 0) {
+    workgroupBarrier();
+  }
+}
+)";
+    EXPECT_EQ(Resolve(helper + R"(
+@group(0) @binding(0) var<uniform> u : i32;
+
+@compute @workgroup_size(64)
+fn main() {
+  barrier_if(u);
+}
+)"),
+              "");
+
+    // The error must be reported through the cached function.
+    EXPECT_EQ(Resolve(helper + R"(
+@group(0) @binding(0) var<storage, read_write> s : i32;
+
+@compute @workgroup_size(64)
+fn main() {
+  barrier_if(s);
+}
+)"),
+              R"(test:4:5 error: 'workgroupBarrier' must only be called from uniform control flow
+    workgroupBarrier();
+    ^^^^^^^^^^^^^^^^
+
+test:3:3 note: control flow depends on possibly non-uniform value
+  if (v == 0) {
+  ^^
+
+test:3:7 note: parameter 'v' of 'barrier_if' may be non-uniform
+  if (v == 0) {
+      ^
+
+test:12:14 note: possibly non-uniform value passed here
+  barrier_if(s);
+             ^
+
+test:12:14 note: reading from read_write storage buffer 's' may result in a non-uniform value
+  barrier_if(s);
+             ^
+)");
+}
+
+TEST_F(UniformityCacheTest, ReferencedGlobalChanged) {
+    // The function source text is identical, but the global it references is not.
+    EXPECT_EQ(Resolve(R"(
+@group(0) @binding(0) var<uniform> g : i32;
+
+@compute @workgroup_size(64)
+fn main() {
+  if (g == 0) {
+    workgroupBarrier();
+  }
+}
+)"),
+              "");
+    EXPECT_EQ(Resolve(R"(
+@group(0) @binding(0) var<storage, read_write> g : i32;
+
+@compute @workgroup_size(64)
+fn main() {
+  if (g == 0) {
+    workgroupBarrier();
+  }
+}
+)"),
+              R"(test:7:5 error: 'workgroupBarrier' must only be called from uniform control flow
+    workgroupBarrier();
+    ^^^^^^^^^^^^^^^^
+
+test:6:3 note: control flow depends on possibly non-uniform value
+  if (g == 0) {
+  ^^
+
+test:6:7 note: reading from read_write storage buffer 'g' may result in a non-uniform value
+  if (g == 0) {
+      ^
+)");
+}
+
+TEST_F(UniformityCacheTest, EncodeDecode) {
+    std::string src = R"(
+@group(0) @binding(0) var<uniform> u : i32;
+
+fn helper(p : ptr<function, i32>, q : ptr<function, i32>) {
+  *p = *q + u;
+}
+
+@compute @workgroup_size(64)
+fn main() {
+  var x = 0;
+  var y = 0;
+  helper(&x, &y);
+  if (x == 0) {
+    workgroupBarrier();
+  }
+}
+)";
+    EXPECT_EQ(Resolve(src), "");
+    EXPECT_EQ(cache_.Count(), 2u);
+
+    bytes::BufferWriter writer;
+    ASSERT_EQ(cache_.Encode(writer), Success);
+
+    UniformityCache decoded;
+    bytes::BufferReader reader{writer.BufferString()};
+    ASSERT_EQ(decoded.Decode(reader), Success);
+    EXPECT_EQ(decoded.Count(), 2u);
+
+    // Decoding into a non-empty cache fails.
+    bytes::BufferReader reader2{writer.BufferString()};
+    EXPECT_NE(decoded.Decode(reader2), Success);
+
+    // Resolving with the decoded cache uses the decoded summaries.
+    wgsl::reader::Options options;
+    options.uniformity_cache = &decoded;
+    auto file = std::make_unique<Source::File>("test", src);
+    auto program = wgsl::reader::Parse(file.get(), options);
+    EXPECT_TRUE(program.IsValid()) << program.Diagnostics().Str();
+    EXPECT_EQ(decoded.Count(), 2u);
+}
+
 }  // namespace
 }  // namespace tint::resolver
@@ -42,6 +42,7 @@ tint_add_target(tint_utils_bytes lib
   utils/bytes/buffer_writer.h
   utils/bytes/bytes.cc
   utils/bytes/decoder.h
+  utils/bytes/encoder.h
   utils/bytes/endianness.h
   utils/bytes/reader.cc
   utils/bytes/reader.h
@@ -71,6 +72,7 @@ tint_target_add_dependencies(tint_utils_bytes lib
 tint_add_target(tint_utils_bytes_test test
   utils/bytes/buffer_writer_test.cc
   utils/bytes/decoder_test.cc
+  utils/bytes/encoder_test.cc
   utils/bytes/reader_test.cc
   utils/bytes/swap_test.cc
 )
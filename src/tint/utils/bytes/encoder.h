@@ -0,0 +1,184 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef SRC_TINT_UTILS_BYTES_ENCODER_H_
+#define SRC_TINT_UTILS_BYTES_ENCODER_H_
+
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "src/tint/utils/bytes/writer.h"
+#include "src/tint/utils/reflection/reflection.h"
+
+namespace tint::bytes {
+
+template <typename T, typename = void>
+struct Encoder;
+
+/// Encodes @p value to @p writer, in the format read by bytes::Decode().
+/// @param writer the byte writer
+/// @param value the value to encode
+/// @param args additional arguments used by Encoder<T>::Encode()
+/// @returns the result of the write
+template <typename T, typename... ARGS>
+Result<SuccessType> Encode(Writer& writer, const T& value, ARGS&&... args) {
+    return Encoder<T>::Encode(writer, value, std::forward<ARGS>(args)...);
+}
+
+/// Encoder specialization for integer types
+template <typename T>
+struct Encoder<T, std::enable_if_t<std::is_integral_v<T>>> {
+    /// Encode encodes the integer type to @p writer.
+    /// @param writer the writer to encode to
+    /// @param value the value to encode
+    /// @param endianness the endianness of the integer
+    /// @returns the result of the write
+    static Result<SuccessType> Encode(Writer& writer,
+                                      T value,
+                                      Endianness endianness = Endianness::kLittle) {
+        return writer.Int<T>(value, endianness);
+    }
+};
+
+/// Encoder specialization for floating point types
+template <typename T>
+struct Encoder<T, std::enable_if_t<std::is_floating_point_v<T>>> {
+    /// Encode encodes the floating point type to @p writer.
+    /// @param writer the writer to encode to
+    /// @param value the value to encode
+    /// @returns the result of the write
+    static Result<SuccessType> Encode(Writer& writer, T value) { return writer.Float<T>(value); }
+};
+
+/// Encoder specialization for a uint16_t length prefixed string.
+template <>
+struct Encoder<std::string, void> {
+    /// Encode encodes the string to @p writer.
+    /// @param writer the writer to encode to
+    /// @param value the value to encode
+    /// @returns the result of the write, or an error if the string is too long.
+    static Result<SuccessType> Encode(Writer& writer, std::string_view value) {
+        if (value.length() > std::numeric_limits<uint16_t>::max()) {
+            return Failure{"string too long to encode"};
+        }
+        auto len = writer.Int<uint16_t>(static_cast<uint16_t>(value.length()));
+        if (len != Success || value.empty()) {
+            return len;
+        }
+        return writer.String(value);
+    }
+};
+
+/// Encoder specialization for bool types
+template <>
+struct Encoder<bool, void> {
+    /// Encode encodes the boolean to @p writer.
+    /// @param writer the writer to encode to
+    /// @param value the value to encode
+    /// @returns the result of the write
+    static Result<SuccessType> Encode(Writer& writer, bool value) { return writer.Bool(value); }
+};
+
+/// Encoder specialization for types that use TINT_REFLECT
+template <typename T>
+struct Encoder<T, std::enable_if_t<HasReflection<T>>> {
+    /// Encode encodes the reflected type to @p writer.
+    /// @param writer the writer to encode to
+    /// @param object the object to encode
+    /// @returns the result of the write
+    static Result<SuccessType> Encode(Writer& writer, const T& object) {
+        Result<SuccessType> result = Success;
+        ForeachField(object, [&](const auto& field) {
+            if (result == Success) {
+                result = bytes::Encode(writer, field);
+            }
+        });
+        return result;
+    }
+};
+
+/// Encoder specialization for std::vector
+template <typename V>
+struct Encoder<std::vector<V>, void> {
+    /// Encode encodes the vector to @p writer.
+    /// Each element is prefixed with a `false` stop flag, and the vector is terminated with `true`.
+    /// @param writer the writer to encode to
+    /// @param vector the vector to encode
+    /// @returns the result of the write
+    static Result<SuccessType> Encode(Writer& writer, const std::vector<V>& vector) {
+        for (auto& value : vector) {
+            if (auto res = writer.Bool(false); res != Success) {
+                return res;
+            }
+            if (auto res = bytes::Encode(writer, value); res != Success) {
+                return res;
+            }
+        }
+        return writer.Bool(true);
+    }
+};
+
+/// Encoder specialization for std::optional
+template <typename T>
+struct Encoder<std::optional<T>, void> {
+    /// Encode encodes the optional to @p writer.
+    /// @param writer the writer to encode to
+    /// @param optional the optional to encode
+    /// @returns the result of the write
+    static Result<SuccessType> Encode(Writer& writer, const std::optional<T>& optional) {
+        if (auto res = writer.Bool(optional.has_value()); res != Success || !optional) {
+            return res;
+        }
+        return bytes::Encode(writer, *optional);
+    }
+};
+
+/// Encoder specialization for enum types that have a range defined with TINT_REFLECT_ENUM_RANGE
+template <typename T>
+struct Encoder<T, std::void_t<decltype(tint::EnumRange<T>::kMax)>> {
+    /// Encode encodes the enum type to @p writer.
+    /// @param writer the writer to encode to
+    /// @param value the value to encode
+    /// @param endianness the endianness of the enum
+    /// @returns the result of the write
+    static Result<SuccessType> Encode(Writer& writer,
+                                      T value,
+                                      Endianness endianness = Endianness::kLittle) {
+        using U = std::underlying_type_t<T>;
+        return writer.Int<U>(static_cast<U>(value), endianness);
+    }
+};
+
+}  // namespace tint::bytes
+
+#endif  // SRC_TINT_UTILS_BYTES_ENCODER_H_
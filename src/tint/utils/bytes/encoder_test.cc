@@ -0,0 +1,166 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "src/tint/utils/bytes/encoder.h"
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "src/tint/utils/bytes/buffer_writer.h"
+#include "src/tint/utils/bytes/decoder.h"
+
+namespace tint {
+namespace {
+/// An enum used for encoder tests below.
+enum class TestEnum : uint8_t { A = 2, B = 3, C = 4 };
+}  // namespace
+
+/// Reflect valid value ranges for the TestEnum enum.
+TINT_REFLECT_ENUM_RANGE(TestEnum, A, C);
+
+}  // namespace tint
+
+namespace tint::bytes {
+namespace {
+template <typename... ARGS>
+auto Data(ARGS&&... args) {
+    return std::vector{std::byte{static_cast<uint8_t>(args)}...};
+}
+
+template <size_t N>
+std::vector<std::byte> Bytes(const BufferWriter<N>& writer) {
+    return std::vector<std::byte>(writer.buffer.begin(), writer.buffer.end());
+}
+
+TEST(BytesEncoderTest, Uint8) {
+    BufferWriter writer;
+    EXPECT_EQ(Encode<uint8_t>(writer, 0x10), Success);
+    EXPECT_EQ(Encode<uint8_t>(writer, 0x20), Success);
+    EXPECT_EQ(Bytes(writer), Data(0x10, 0x20));
+}
+
+TEST(BytesEncoderTest, Uint16) {
+    BufferWriter writer;
+    EXPECT_EQ(Encode<uint16_t>(writer, 0x2010), Success);
+    EXPECT_EQ(Encode<uint16_t>(writer, 0x4030, Endianness::kBig), Success);
+    EXPECT_EQ(Bytes(writer), Data(0x10, 0x20, 0x40, 0x30));
+}
+
+TEST(BytesEncoderTest, Uint32) {
+    BufferWriter writer;
+    EXPECT_EQ(Encode<uint32_t>(writer, 0x40302010), Success);
+    EXPECT_EQ(Bytes(writer), Data(0x10, 0x20, 0x30, 0x40));
+}
+
+TEST(BytesEncoderTest, Float) {
+    BufferWriter writer;
+    EXPECT_EQ(Encode<float>(writer, 3.5f), Success);
+    auto reader = BufferReader{writer.BufferString()};
+    EXPECT_EQ(Decode<float>(reader).Get(), 3.5f);
+}
+
+TEST(BytesEncoderTest, Bool) {
+    BufferWriter writer;
+    EXPECT_EQ(Encode(writer, true), Success);
+    EXPECT_EQ(Encode(writer, false), Success);
+    EXPECT_EQ(Bytes(writer), Data(0x01, 0x00));
+}
+
+TEST(BytesEncoderTest, String) {
+    BufferWriter writer;
+    EXPECT_EQ(Encode(writer, std::string("hello")), Success);
+    EXPECT_EQ(Encode(writer, std::string("")), Success);
+    EXPECT_EQ(Bytes(writer), Data(0x5, 0x0, 'h', 'e', 'l', 'l', 'o', 0x0, 0x0));
+}
+
+TEST(BytesEncoderTest, StringTooLong) {
+    BufferWriter writer;
+    EXPECT_NE(Encode(writer, std::string(0x10000, 'x')), Success);
+}
+
+struct S {
+    uint8_t a;
+    uint16_t b;
+    uint32_t c;
+    TINT_REFLECT(S, a, b, c);
+};
+
+TEST(BytesEncoderTest, ReflectedObject) {
+    BufferWriter writer;
+    EXPECT_EQ(Encode(writer, S{0x10, 0x3020, 0x70605040}), Success);
+    EXPECT_EQ(Bytes(writer), Data(0x10, 0x20, 0x30, 0x40, 0x50, 0x60, 0x70));
+}
+
+TEST(BytesEncoderTest, ReflectedEnum) {
+    BufferWriter writer;
+    EXPECT_EQ(Encode(writer, TestEnum::B), Success);
+    EXPECT_EQ(Bytes(writer), Data(0x03));
+}
+
+TEST(BytesEncoderTest, Vector) {
+    BufferWriter writer;
+    EXPECT_EQ(Encode(writer, std::vector<uint8_t>{0x10, 0x30, 0x50}), Success);
+    EXPECT_EQ(Bytes(writer), Data(0x00, 0x10, 0x00, 0x30, 0x00, 0x50, 0x01));
+}
+
+TEST(BytesEncoderTest, Optional) {
+    BufferWriter writer;
+    EXPECT_EQ(Encode(writer, std::optional<uint8_t>{}), Success);
+    EXPECT_EQ(Encode(writer, std::optional<uint8_t>{0x42}), Success);
+    EXPECT_EQ(Bytes(writer), Data(0x00, 0x01, 0x42));
+}
+
+struct Nested {
+    std::vector<S> list;
+    std::optional<std::string> name;
+    TestEnum e;
+    TINT_REFLECT(Nested, list, name, e);
+};
+
+TEST(BytesEncoderTest, RoundTrip) {
+    Nested in{{S{1, 2, 3}, S{4, 5, 6}}, "nested", TestEnum::C};
+    BufferWriter writer;
+    ASSERT_EQ(Encode(writer, in), Success);
+    auto reader = BufferReader{writer.BufferString()};
+    auto out = Decode<Nested>(reader);
+    ASSERT_EQ(out, Success);
+    ASSERT_EQ(out->list.size(), 2u);
+    EXPECT_EQ(out->list[0].a, 1u);
+    EXPECT_EQ(out->list[0].b, 2u);
+    EXPECT_EQ(out->list[0].c, 3u);
+    EXPECT_EQ(out->list[1].a, 4u);
+    EXPECT_EQ(out->list[1].b, 5u);
+    EXPECT_EQ(out->list[1].c, 6u);
+    EXPECT_EQ(out->name, "nested");
+    EXPECT_EQ(out->e, TestEnum::C);
+}
+
+}  // namespace
+}  // namespace tint::bytes
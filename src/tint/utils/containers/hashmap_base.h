@@ -29,9 +29,12 @@
 #define SRC_TINT_UTILS_CONTAINERS_HASHMAP_BASE_H_
 
 #include <algorithm>
+#include <array>
+#include <cstdint>
 #include <functional>
 #include <optional>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 
 #include "src/tint/utils/containers/vector.h"
@@ -41,6 +44,19 @@
 #include "src/tint/utils/memory/aligned_storage.h"
 #include "src/tint/utils/traits/traits.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TINT_HASHMAP_SSE2 1
+#define TINT_HASHMAP_NEON 0
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+#define TINT_HASHMAP_SSE2 0
+#define TINT_HASHMAP_NEON 1
+#include <arm_neon.h>
+#else
+#define TINT_HASHMAP_SSE2 0
+#define TINT_HASHMAP_NEON 0
+#endif
+
 namespace tint {
 
 /// HashmapKey wraps the comparator type for a Hashmap and Hashset.
@@ -163,6 +179,11 @@ auto& operator<<(STREAM& out, const HashmapKey<T>& key) {
 }
 
 /// HashmapBase is the base class for Hashmap and Hashset.
+/// HashmapBase is an open-addressed hash table in the style of a 'Swiss table'. Each slot of the
+/// table has a one-byte control word that holds seven bits of the entry's hash, and lookups scan a
+/// group of kGroupWidth control words at a time (with SSE2 or NEON, when available) before
+/// comparing any keys. Entries are held in nodes that are never moved, so pointers and references
+/// to entries remain valid when the table is rehashed.
 /// @tparam ENTRY is the single record in the map. The entry type must alias 'Key' to the HashmapKey
 /// type, and implement the method `static HashmapKey<...> KeyOf(ENTRY)` to return the key for the
 /// entry.
@@ -170,7 +191,17 @@ template <typename ENTRY, size_t N>
 class HashmapBase {
   protected:
     struct Node;
-    struct Slot;
+
+    /// Ctrl is the control word of a single slot.
+    /// A non-negative control word indicates that the slot holds an entry, and holds the H2 bits
+    /// of the entry's hash. Negative control words are either kEmpty or kDeleted.
+    using Ctrl = int8_t;
+
+    /// The control word of a slot that has never held an entry.
+    static constexpr Ctrl kEmpty = -128;
+
+    /// The control word of a slot that held an entry that has since been removed.
+    static constexpr Ctrl kDeleted = -2;
 
   public:
     /// Entry is the type of a single record in the hashmap.
@@ -182,23 +213,36 @@ class HashmapBase {
     /// Equal is the
     using Equal = typename Key::Equal;
 
+    /// The number of slots that are probed together. The number of slots in the table is always a
+    /// power-of-two multiple of kGroupWidth.
+    static constexpr size_t kGroupWidth = 16;
+
     /// The minimum capacity of the map.
     static constexpr size_t kMinCapacity = std::max<size_t>(N, 8);
 
-    /// The target number of slots, expressed as a fractional percentage of the map capacity.
-    /// e.g. a kLoadFactor of 75, would mean a target slots count of (0.75 * capacity).
-    static constexpr size_t kLoadFactor = 75;
+    /// The maximum number of occupied slots (entries and deleted slots), expressed as a fractional
+    /// percentage of the number of slots. e.g. a kLoadFactor of 87, would mean that the table is
+    /// rehashed once (0.87 * slots) slots are occupied.
+    static constexpr size_t kLoadFactor = 87;
+
+    /// @param num_slots the number of slots in the table.
+    /// @returns the maximum number of slots that can be occupied before the table is rehashed.
+    static constexpr size_t MaxLoad(size_t num_slots) { return (num_slots * kLoadFactor) / 100; }
 
     /// @param capacity the capacity of the map, as total number of entries.
-    /// @returns the target slot vector size to hold @p capacity map entries.
+    /// @returns the number of slots required to hold @p capacity map entries.
     static constexpr size_t NumSlots(size_t capacity) {
-        return (std::max<size_t>(capacity, kMinCapacity) * kLoadFactor) / 100;
+        size_t num_slots = kGroupWidth;
+        while (MaxLoad(num_slots) < std::max<size_t>(capacity, kMinCapacity)) {
+            num_slots *= 2;
+        }
+        return num_slots;
     }
 
     /// Constructor.
     /// Constructs an empty map.
     HashmapBase() {
-        slots_.Resize(slots_.Capacity());
+        ResetTable(kInlineSlots);
         for (auto& node : fixed_) {
             free_.Add(&node);
         }
@@ -225,14 +269,13 @@ class HashmapBase {
     /// Destructor.
     ~HashmapBase() {
         // Call the destructor on all entries in the map.
-        for (size_t slot_idx = 0; slot_idx < slots_.Length(); slot_idx++) {
-            auto* node = slots_[slot_idx].nodes;
-            while (node) {
-                auto next = node->next;
-                node->Destroy();
-                node = next;
+        if constexpr (!std::is_trivially_destructible_v<Entry>) {
+            if (count_ > 0) {
+                ForEachFullSlot(ctrl_, num_slots_,
+                                [&](size_t slot_idx) { Slots()[slot_idx]->Destroy(); });
             }
         }
+        FreeTable();
     }
 
     /// Assignment operator.
@@ -269,26 +312,25 @@ class HashmapBase {
     /// @note the map's capacity is not reduced, as it is assumed that a reused map will likely fill
     /// to a similar size as before.
     void Clear() {
-        for (size_t slot_idx = 0; slot_idx < slots_.Length(); slot_idx++) {
-            auto* node = slots_[slot_idx].nodes;
-            while (node) {
-                auto next = node->next;
+        if (count_ > 0) {
+            ForEachFullSlot(ctrl_, num_slots_, [&](size_t slot_idx) {
+                auto* node = Slots()[slot_idx];
                 node->Destroy();
                 free_.Add(node);
-                node = next;
-            }
-            slots_[slot_idx].nodes = nullptr;
+            });
         }
+        std::fill(ctrl_, ctrl_ + num_slots_, kEmpty);
+        count_ = 0;
+        growth_left_ = MaxLoad(num_slots_);
     }
 
     /// Ensures that the map can hold @p n entries without heap reallocation or rehashing.
     /// @param n the number of entries to ensure can fit in the map without reallocation or
     /// rehashing.
     void Reserve(size_t n) {
-        if (n > capacity_) {
-            size_t count = n - capacity_;
-            free_.Allocate(count);
-            capacity_ += count;
+        ReserveNodes(n);
+        if (MaxLoad(num_slots_) < n) {
+            Rehash(NumSlots(n));
         }
     }
 
@@ -299,9 +341,8 @@ class HashmapBase {
     /// the map is cleared, or the map is destructed.
     template <typename K>
     Entry* GetEntry(K&& key) {
-        HashCode hash = Hash{}(key);
-        auto& slot = slots_[hash % slots_.Length()];
-        return slot.Find(hash, key);
+        size_t slot_idx = Find(Hash{}(key), key);
+        return slot_idx != kNotFound ? &Slots()[slot_idx]->Entry() : nullptr;
     }
 
     /// Looks up an entry with the given key.
@@ -311,9 +352,8 @@ class HashmapBase {
     /// the map is cleared, or the map is destructed.
     template <typename K>
     const Entry* GetEntry(K&& key) const {
-        HashCode hash = Hash{}(key);
-        auto& slot = slots_[hash % slots_.Length()];
-        return slot.Find(hash, key);
+        size_t slot_idx = Find(Hash{}(key), key);
+        return slot_idx != kNotFound ? &Slots()[slot_idx]->Entry() : nullptr;
     }
 
     /// @returns true if the map contains an entry with a key that matches @p key.
@@ -328,20 +368,26 @@ class HashmapBase {
     /// @param key the key to look for.
     template <typename K = Key>
     bool Remove(K&& key) {
-        HashCode hash = Hash{}(key);
-        auto& slot = slots_[hash % slots_.Length()];
-        Node** edge = &slot.nodes;
-        for (auto* node = *edge; node; node = node->next) {
-            if (node->Equals(hash, key)) {
-                *edge = node->next;
-                node->Destroy();
-                free_.Add(node);
-                count_--;
-                return true;
-            }
-            edge = &node->next;
+        size_t slot_idx = Find(Hash{}(key), key);
+        if (slot_idx == kNotFound) {
+            return false;
         }
-        return false;
+        auto* node = Slots()[slot_idx];
+        node->Destroy();
+        free_.Add(node);
+        count_--;
+
+        // A probe sequence only continues past a group if the group has no empty slots. If this
+        // slot's group has an empty slot, then no probe sequence passes through the group, and the
+        // slot can be marked as empty instead of deleted.
+        size_t group_start = slot_idx & ~(kGroupWidth - 1);
+        if (Group{ctrl_ + group_start}.MatchEmpty()) {
+            SetCtrl(slot_idx, kEmpty);
+            growth_left_++;
+        } else {
+            SetCtrl(slot_idx, kDeleted);
+        }
+        return true;
     }
 
     /// Iterator for entries in the map.
@@ -353,15 +399,15 @@ class HashmapBase {
 
       public:
         /// @returns the entry pointed to by this iterator
-        auto& operator->() { return node_->Entry(); }
+        auto& operator->() { return GetNode().Entry(); }
 
         /// @returns a reference to the entry at the iterator
-        auto& operator*() { return node_->Entry(); }
+        auto& operator*() { return GetNode().Entry(); }
 
         /// Increments the iterator
         /// @returns this iterator
         IteratorT& operator++() {
-            node_ = node_->next;
+            slot_++;
             SkipEmptySlots();
             return *this;
         }
@@ -369,30 +415,29 @@ class HashmapBase {
         /// Equality operator
         /// @param other the other iterator to compare this iterator to
         /// @returns true if this iterator is equal to other
-        bool operator==(const IteratorT& other) const { return node_ == other.node_; }
+        bool operator==(const IteratorT& other) const { return slot_ == other.slot_; }
 
         /// Inequality operator
         /// @param other the other iterator to compare this iterator to
         /// @returns true if this iterator is not equal to other
-        bool operator!=(const IteratorT& other) const { return node_ != other.node_; }
+        bool operator!=(const IteratorT& other) const { return slot_ != other.slot_; }
 
       private:
         /// Friend class
         friend class HashmapBase;
 
-        IteratorT(MAP& map, size_t slot, NODE* node) : map_(map), slot_(slot), node_(node) {
-            SkipEmptySlots();
-        }
+        IteratorT(MAP& map, size_t slot) : map_(map), slot_(slot) { SkipEmptySlots(); }
+
+        NODE& GetNode() const { return *map_.Slots()[slot_]; }
 
         void SkipEmptySlots() {
-            while (!node_ && slot_ + 1 < map_.slots_.Length()) {
-                node_ = map_.slots_[++slot_].nodes;
+            while (slot_ < map_.num_slots_ && !IsFull(map_.ctrl_[slot_])) {
+                slot_++;
             }
         }
 
         MAP& map_;
         size_t slot_ = 0;
-        NODE* node_ = nullptr;
     };
 
     /// An immutable key and mutable value iterator
@@ -402,22 +447,22 @@ class HashmapBase {
     using ConstIterator = IteratorT</*IS_CONST*/ true>;
 
     /// @returns an immutable iterator to the start of the map.
-    ConstIterator begin() const { return ConstIterator{*this, 0, slots_.Front().nodes}; }
+    ConstIterator begin() const { return ConstIterator{*this, 0}; }
 
     /// @returns an immutable iterator to the end of the map.
-    ConstIterator end() const { return ConstIterator{*this, slots_.Length(), nullptr}; }
+    ConstIterator end() const { return ConstIterator{*this, num_slots_}; }
 
     /// @returns an iterator to the start of the map.
-    Iterator begin() { return Iterator{*this, 0, slots_.Front().nodes}; }
+    Iterator begin() { return Iterator{*this, 0}; }
 
     /// @returns an iterator to the end of the map.
-    Iterator end() { return Iterator{*this, slots_.Length(), nullptr}; }
+    Iterator end() { return Iterator{*this, num_slots_}; }
 
     /// STL-friendly alias to Entry. Used by gmock.
     using value_type = const Entry&;
 
   protected:
-    /// Node holds an Entry in a linked list.
+    /// Node holds an Entry. Nodes are not moved when the table is rehashed.
     struct Node {
         /// Destructs the entry.
         void Destroy() { Entry().~ENTRY(); }
@@ -441,59 +486,367 @@ class HashmapBase {
             return key.hash == hash && HashmapBase::Equal{}(key.Value(), value);
         }
 
-        /// storage is a buffer that has the same size and alignment as Entry.
-        /// The storage holds a constructed Entry when linked in the slots, and is destructed when
-        /// removed from slots.
-        AlignedStorage<ENTRY> storage;
+        union {
+            /// storage is a buffer that has the same size and alignment as Entry.
+            /// The storage holds a constructed Entry when referenced by a slot, and is destructed
+            /// when removed from the table.
+            AlignedStorage<ENTRY> storage;
 
-        /// next is the next Node in the slot, or in the free list.
-        Node* next;
+            /// next is the next Node in the free list. Only used while the node holds no Entry.
+            Node* next;
+        };
     };
 
+    /// Group is a view of kGroupWidth consecutive control words, used to find the slots of the
+    /// group that match a control word with a single vector comparison.
+    class Group {
+      public:
+        /// BitMask is the set of slots in a group that matched a query.
+        class BitMask {
+          public:
+            /// Constructor
+            /// @param bits the mask bits, with (1 << kShift) bits per slot
+            explicit BitMask(uint64_t bits) : bits_(bits) {}
+
+            /// @returns true if the mask contains at least one slot
+            explicit operator bool() const { return bits_ != 0; }
+
+            /// @returns the index of the lowest slot in the mask, relative to the group start.
+            /// @note the mask must not be empty.
+            size_t Lowest() const { return CountTrailingZeros(bits_) >> kShift; }
+
+            /// Removes the lowest slot from the mask.
+            void ClearLowest() { bits_ &= bits_ - 1; }
+
+          private:
+            uint64_t bits_;
+        };
+
+        /// Constructor
+        /// @param ctrl the pointer to the first of kGroupWidth control words
+        explicit Group(const Ctrl* ctrl) {
+#if TINT_HASHMAP_SSE2
+            ctrl_ = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+#elif TINT_HASHMAP_NEON
+            ctrl_ = vld1q_s8(ctrl);
+#else
+            std::copy(ctrl, ctrl + kGroupWidth, ctrl_.begin());
+#endif
+        }
+
+        /// Sets a single control word of a group, by writing the whole group.
+        /// @param ctrl the pointer to the first of kGroupWidth control words
+        /// @param index the index of the control word in the group
+        /// @param value the new control word
+        static void Set(Ctrl* ctrl, size_t index, Ctrl value) {
+#if TINT_HASHMAP_SSE2
+            const __m128i iota = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+            __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+            __m128i sel = _mm_cmpeq_epi8(iota, _mm_set1_epi8(static_cast<char>(index)));
+            group = _mm_or_si128(_mm_and_si128(sel, _mm_set1_epi8(value)),
+                                 _mm_andnot_si128(sel, group));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(ctrl), group);
+#elif TINT_HASHMAP_NEON
+            const uint8x16_t iota = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+            uint8x16_t sel = vceqq_u8(iota, vdupq_n_u8(static_cast<uint8_t>(index)));
+            vst1q_s8(ctrl, vbslq_s8(sel, vdupq_n_s8(value), vld1q_s8(ctrl)));
+#else
+            ctrl[index] = value;
+#endif
+        }
+
+        /// @param h2 the control word to match
+        /// @returns the slots in the group that have the control word @p h2
+        BitMask Match(Ctrl h2) const {
+#if TINT_HASHMAP_SSE2
+            return ToMask(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_));
+#elif TINT_HASHMAP_NEON
+            return ToMask(vceqq_s8(vdupq_n_s8(h2), ctrl_));
+#else
+            return ToMask([&](Ctrl c) { return c == h2; });
+#endif
+        }
+
+        /// @returns the slots in the group that are empty
+        BitMask MatchEmpty() const { return Match(kEmpty); }
+
+        /// @returns the slots in the group that are empty or deleted
+        BitMask MatchEmptyOrDeleted() const {
+#if TINT_HASHMAP_SSE2
+            // Empty and deleted control words are the only ones with the sign bit set.
+            return BitMask{static_cast<uint32_t>(_mm_movemask_epi8(ctrl_))};
+#elif TINT_HASHMAP_NEON
+            return ToMask(vcltq_s8(ctrl_, vdupq_n_s8(0)));
+#else
+            return ToMask([&](Ctrl c) { return c < 0; });
+#endif
+        }
+
+        /// @returns the slots in the group that hold an entry
+        BitMask MatchFull() const {
+#if TINT_HASHMAP_SSE2
+            return BitMask{static_cast<uint32_t>(_mm_movemask_epi8(ctrl_)) ^ 0xffffu};
+#elif TINT_HASHMAP_NEON
+            return ToMask(vcgeq_s8(ctrl_, vdupq_n_s8(0)));
+#else
+            return ToMask([&](Ctrl c) { return c >= 0; });
+#endif
+        }
+
+      private:
+#if TINT_HASHMAP_SSE2
+        /// The number of mask bits per slot is 1 << kShift.
+        static constexpr uint32_t kShift = 0;
+
+        static BitMask ToMask(__m128i eq) {
+            return BitMask{static_cast<uint32_t>(_mm_movemask_epi8(eq))};
+        }
+
+        __m128i ctrl_;
+#elif TINT_HASHMAP_NEON
+        /// The number of mask bits per slot is 1 << kShift.
+        static constexpr uint32_t kShift = 2;
+
+        static BitMask ToMask(uint8x16_t eq) {
+            // Narrow each 0x00 / 0xff byte to a nibble, then keep a single bit per nibble so that
+            // BitMask::ClearLowest() removes a single slot.
+            uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(eq), 4);
+            uint64_t bits = vget_lane_u64(vreinterpret_u64_u8(nibbles), 0);
+            return BitMask{bits & 0x8888888888888888u};
+        }
+
+        int8x16_t ctrl_;
+#else
+        /// The number of mask bits per slot is 1 << kShift.
+        static constexpr uint32_t kShift = 0;
+
+        template <typename PREDICATE>
+        BitMask ToMask(PREDICATE&& pred) const {
+            uint64_t bits = 0;
+            for (size_t i = 0; i < kGroupWidth; i++) {
+                if (pred(ctrl_[i])) {
+                    bits |= static_cast<uint64_t>(1u) << i;
+                }
+            }
+            return BitMask{bits};
+        }
+
+        std::array<Ctrl, kGroupWidth> ctrl_;
+#endif
+    };
+
+    /// ProbeSequence is the sequence of groups visited when searching for a hash.
+    /// The sequence uses triangular steps, which visits every group of a table with a
+    /// power-of-two number of groups.
+    class ProbeSequence {
+      public:
+        /// Constructor
+        /// @param h1 the H1 bits of the hash
+        /// @param num_slots the number of slots in the table
+        ProbeSequence(size_t h1, size_t num_slots)
+            : mask_(num_slots / kGroupWidth - 1), group_(h1 & mask_) {}
+
+        /// @returns the index of the first slot of the current group
+        size_t Offset() const { return group_ * kGroupWidth; }
+
+        /// Advances to the next group in the sequence
+        void Next() {
+            stride_++;
+            group_ = (group_ + stride_) & mask_;
+        }
+
+      private:
+        size_t mask_;
+        size_t group_;
+        size_t stride_ = 0;
+    };
+
+    /// The number of slots held by the map before allocating a table on the heap.
+    static constexpr size_t kInlineSlots = NumSlots(N);
+
+    /// The number of table bytes used by each slot: a control word and a node pointer.
+    static constexpr size_t kBytesPerSlot = sizeof(Ctrl) + sizeof(Node*);
+
+    /// The value returned by Find() when no entry was found.
+    static constexpr size_t kNotFound = ~static_cast<size_t>(0);
+
+    /// @param ctrl the control word
+    /// @returns true if @p ctrl is the control word of a slot that holds an entry
+    static bool IsFull(Ctrl ctrl) { return ctrl >= 0; }
+
+    /// Calls @p callback with the index of each slot that holds an entry.
+    /// @param ctrl the control words of the table
+    /// @param num_slots the number of slots in the table
+    /// @param callback the function to call with the slot index
+    template <typename CALLBACK>
+    static void ForEachFullSlot(const Ctrl* ctrl, size_t num_slots, CALLBACK&& callback) {
+        for (size_t offset = 0; offset < num_slots; offset += kGroupWidth) {
+            for (auto full = Group{ctrl + offset}.MatchFull(); full; full.ClearLowest()) {
+                callback(offset + full.Lowest());
+            }
+        }
+    }
+
+    /// @param hash the hash code
+    /// @returns @p hash mixed so that all the bits of the hash contribute to both H1 and H2.
+    static uint64_t Mix(HashCode hash) {
+        uint64_t mixed = static_cast<uint64_t>(hash) * 0x9e3779b97f4a7c15u;
+        return mixed ^ (mixed >> 32);
+    }
+
+    /// @param mixed the mixed hash
+    /// @returns the bits of the mixed hash used to select the first probed group
+    static size_t H1(uint64_t mixed) { return static_cast<size_t>(mixed >> 7); }
+
+    /// @param mixed the mixed hash
+    /// @returns the bits of the mixed hash stored in the slot's control word
+    static Ctrl H2(uint64_t mixed) { return static_cast<Ctrl>(mixed & 0x7f); }
+
+    /// @param hash the hash of @p key
+    /// @param key the key to search for
+    /// @returns the index of the slot holding the entry with the key @p key, or kNotFound.
+    template <typename K>
+    size_t Find(HashCode hash, K&& key) const {
+        uint64_t mixed = Mix(hash);
+        Ctrl h2 = H2(mixed);
+        for (ProbeSequence seq{H1(mixed), num_slots_};; seq.Next()) {
+            Group group{ctrl_ + seq.Offset()};
+            for (auto match = group.Match(h2); match; match.ClearLowest()) {
+                size_t slot_idx = seq.Offset() + match.Lowest();
+                if (Slots()[slot_idx]->Equals(hash, key)) {
+                    return slot_idx;
+                }
+            }
+            if (group.MatchEmpty()) {
+                return kNotFound;
+            }
+        }
+    }
+
+    /// @param mixed the mixed hash of the entry to insert
+    /// @returns the index of the first empty or deleted slot in the probe sequence of @p mixed
+    size_t FindInsertSlot(uint64_t mixed) const {
+        for (ProbeSequence seq{H1(mixed), num_slots_};; seq.Next()) {
+            if (auto match = Group{ctrl_ + seq.Offset()}.MatchEmptyOrDeleted()) {
+                return seq.Offset() + match.Lowest();
+            }
+        }
+    }
+
+    /// Assigns @p node to the empty or deleted slot @p slot_idx.
+    /// @param slot_idx the slot index
+    /// @param mixed the mixed hash of the node's entry
+    /// @param node the node
+    void SetSlot(size_t slot_idx, uint64_t mixed, Node* node) {
+        if (ctrl_[slot_idx] == kEmpty) {
+            growth_left_--;
+        }
+        SetCtrl(slot_idx, H2(mixed));
+        Slots()[slot_idx] = node;
+    }
+
+    /// Sets the control word of the slot @p slot_idx to @p ctrl.
+    /// The whole group is written with a single store, so that the next Group load of the same
+    /// group can be forwarded from the store, instead of stalling until the store completes.
+    /// @param slot_idx the slot index
+    /// @param ctrl the new control word
+    void SetCtrl(size_t slot_idx, Ctrl ctrl) {
+        size_t offset = slot_idx & ~(kGroupWidth - 1);
+        Group::Set(ctrl_ + offset, slot_idx - offset, ctrl);
+    }
+
+    /// @returns the slots of the table. The slots follow the control words in memory. A slot
+    /// points to the node holding the entry if the slot's control word is full, otherwise the slot
+    /// is undefined.
+    Node** Slots() const { return Bitcast<Node**>(ctrl_ + num_slots_); }
+
+    /// Replaces the table with an empty table of @p num_slots slots.
+    /// @note this does not destruct or free any entries, nor free the existing table.
+    /// @param num_slots the number of slots. Must be a power-of-two multiple of kGroupWidth.
+    void ResetTable(size_t num_slots) {
+        if (num_slots == kInlineSlots) {
+            ctrl_ = Bitcast<Ctrl*>(inline_table_.data());
+        } else {
+            // num_slots is a multiple of kGroupWidth, so the slots that follow the control words
+            // are suitably aligned.
+            auto* memory = static_cast<std::byte*>(malloc(num_slots * kBytesPerSlot));
+            if (TINT_UNLIKELY(!memory)) {
+                TINT_ICE() << "out of memory";
+                return;
+            }
+            ctrl_ = Bitcast<Ctrl*>(memory);
+        }
+        num_slots_ = num_slots;
+        std::fill(ctrl_, ctrl_ + num_slots, kEmpty);
+        growth_left_ = MaxLoad(num_slots);
+    }
+
+    /// Frees the table, if it was allocated on the heap.
+    void FreeTable() {
+        if (ctrl_ != Bitcast<Ctrl*>(inline_table_.data())) {
+            free(ctrl_);
+        }
+    }
+
+    /// Ensures that there are at least @p n nodes allocated for the map.
+    /// @param n the number of nodes
+    void ReserveNodes(size_t n) {
+        if (n > capacity_) {
+            size_t count = n - capacity_;
+            free_.Allocate(count);
+            capacity_ += count;
+        }
+    }
+
     /// Copies the hashmap @p other into this empty hashmap.
     /// @note This hashmap must be empty before calling
     /// @param other the hashmap to copy
     void Copy(const HashmapBase& other) {
-        Reserve(other.capacity_);
-        slots_.Resize(other.slots_.Length());
-        for (size_t slot_idx = 0; slot_idx < slots_.Length(); slot_idx++) {
-            for (auto* o = other.slots_[slot_idx].nodes; o; o = o->next) {
-                auto* node = free_.Take();
-                new (&node->Entry()) Entry{o->Entry()};
-                slots_[slot_idx].Add(node);
-            }
-        }
-        count_ = other.count_;
+        CopyTable(other, [](Entry& entry) -> const Entry& { return entry; });
     }
 
     /// Moves the the hashmap @p other into this empty hashmap.
     /// @note This hashmap must be empty before calling
     /// @param other the hashmap to move
     void Move(HashmapBase&& other) {
-        Reserve(other.capacity_);
-        slots_.Resize(other.slots_.Length());
-        for (size_t slot_idx = 0; slot_idx < slots_.Length(); slot_idx++) {
-            for (auto* o = other.slots_[slot_idx].nodes; o; o = o->next) {
-                auto* node = free_.Take();
-                new (&node->Entry()) Entry{std::move(o->Entry())};
-                slots_[slot_idx].Add(node);
-            }
+        CopyTable(other, [](Entry& entry) -> Entry&& { return std::move(entry); });
+        other.Clear();
+    }
+
+    /// Populates this empty hashmap with entries constructed from the entries of @p other.
+    /// Both maps use the same hash function, so the control words are copied verbatim.
+    /// @param other the hashmap to copy
+    /// @param get a function that returns the argument used to construct the new entry from
+    /// the entry of @p other
+    template <typename GET>
+    void CopyTable(const HashmapBase& other, GET&& get) {
+        ReserveNodes(other.count_);
+        if (num_slots_ != other.num_slots_) {
+            FreeTable();
+            ResetTable(other.num_slots_);
         }
+        std::copy(other.ctrl_, other.ctrl_ + other.num_slots_, ctrl_);
+        ForEachFullSlot(ctrl_, num_slots_, [&](size_t slot_idx) {
+            auto* node = free_.Take();
+            new (&node->Entry()) Entry{get(other.Slots()[slot_idx]->Entry())};
+            Slots()[slot_idx] = node;
+        });
         count_ = other.count_;
-        other.Clear();
+        growth_left_ = other.growth_left_;
     }
 
     /// EditIndex is the structure returned by EditAt(), used to simplify entry replacement and
     /// insertion.
+    /// @note The map must not be modified between the call to EditAt() and Insert().
     struct EditIndex {
         /// The HashmapBase that created this EditIndex
         HashmapBase& map;
-        /// The slot that will hold the edit.
-        Slot& slot;
         /// The hash of the key, passed to EditAt().
         HashCode hash;
         /// The resolved node entry, or nullptr if EditAt() did not resolve to an existing entry.
         Entry* entry = nullptr;
+        /// The slot to use for Insert(), if #entry is null.
+        size_t insert_slot = kNotFound;
 
         /// Replace will replace the entry with a new Entry built from @p key and @p values.
         /// @note #entry must not be null before calling.
@@ -505,7 +858,7 @@ class HashmapBase {
             *entry = Entry{Key{hash, std::forward<K>(key)}, std::forward<V>(values)...};
         }
 
-        /// Insert will create a new entry using @p key and @p values and insert it into the slot.
+        /// Insert will create a new entry using @p key and @p values and insert it into the table.
         /// The created entry will be assigned to #entry before returning.
         /// @note #entry must be null before calling.
         /// @note the key must not already exist in the map.
@@ -513,8 +866,18 @@ class HashmapBase {
         /// @param values optional additional values to pass to the Entry constructor.
         template <typename K, typename... V>
         void Insert(K&& key, V&&... values) {
+            if (!map.free_.nodes_) {
+                map.free_.Allocate(map.capacity_);
+                map.capacity_ += map.capacity_;
+            }
+            uint64_t mixed = Mix(hash);
+            if (map.growth_left_ == 0 && map.ctrl_[insert_slot] == kEmpty) {
+                // Filling the empty slot would exceed the load factor. Grow the table.
+                map.Grow();
+                insert_slot = map.FindInsertSlot(mixed);
+            }
             auto* node = map.free_.Take();
-            slot.Add(node);
+            map.SetSlot(insert_slot, mixed, node);
             map.count_++;
             entry = &node->Entry();
             new (entry) Entry{Key{hash, std::forward<K>(key)}, std::forward<V>(values)...};
@@ -522,82 +885,80 @@ class HashmapBase {
     };
 
     /// EditAt is a helper for map entry replacement and entry insertion.
-    /// Before indexing, EditAt will ensure there's at least one free node available, potentially
-    /// allocating and rehashing if there's no free nodes available.
-    /// @param key the key used to compute the hash, look up the slot and search for the existing
-    /// node.
+    /// EditAt searches for the existing entry with the key @p key, and if not found, also finds the
+    /// slot that Insert() will use, so that insertion does not need to probe the table again.
+    /// @param key the key used to compute the hash and search for the existing entry.
     /// @returns a EditIndex used to modify or insert a new entry into the map with the given key.
     template <typename K>
     EditIndex EditAt(K&& key) {
-        if (!free_.nodes_) {
-            free_.Allocate(capacity_);
-            capacity_ += capacity_;
-            Rehash();
-        }
         HashCode hash = Hash{}(key);
-        auto& slot = slots_[hash % slots_.Length()];
-        auto* entry = slot.Find(hash, key);
-        return {*this, slot, hash, entry};
-    }
-
-    /// Rehash resizes the slots vector proportionally to the map capacity, and then reinserts the
-    /// nodes so they're linked in the correct slots linked lists.
-    void Rehash() {
-        size_t num_slots = NumSlots(capacity_);
-        decltype(slots_) old_slots;
-        std::swap(slots_, old_slots);
-        slots_.Resize(num_slots);
-        for (size_t old_slot_idx = 0; old_slot_idx < old_slots.Length(); old_slot_idx++) {
-            auto* node = old_slots[old_slot_idx].nodes;
-            while (node) {
-                auto next = node->next;
-                size_t new_slot_idx = node->Key().hash % num_slots;
-                slots_[new_slot_idx].Add(node);
-                node = next;
+        uint64_t mixed = Mix(hash);
+        Ctrl h2 = H2(mixed);
+        size_t insert_slot = kNotFound;
+        for (ProbeSequence seq{H1(mixed), num_slots_};; seq.Next()) {
+            Group group{ctrl_ + seq.Offset()};
+            for (auto match = group.Match(h2); match; match.ClearLowest()) {
+                size_t slot_idx = seq.Offset() + match.Lowest();
+                if (Slots()[slot_idx]->Equals(hash, key)) {
+                    return {*this, hash, &Slots()[slot_idx]->Entry()};
+                }
+            }
+            if (insert_slot == kNotFound) {
+                if (auto free = group.MatchEmptyOrDeleted()) {
+                    insert_slot = seq.Offset() + free.Lowest();
+                }
+            }
+            if (group.MatchEmpty()) {
+                return {*this, hash, nullptr, insert_slot};
             }
         }
     }
 
-    /// Slot holds a linked list of nodes. Nodes are assigned to the slot list by calculating the
-    /// modulo of the entry's hash with the slot_ vector length.
-    struct Slot {
-        /// The linked list of nodes in this slot.
-        Node* nodes = nullptr;
+    /// Grow is called when there are no more free slots in the table. If at least half the
+    /// occupied slots hold entries, then the table is doubled in size, otherwise the table is
+    /// rehashed at the same size to reclaim the deleted slots.
+    void Grow() {
+        size_t num_slots = num_slots_;
+        if (count_ * 2 >= MaxLoad(num_slots)) {
+            num_slots *= 2;
+        }
+        Rehash(num_slots);
+    }
 
-        /// Add adds the node @p node to this slot.
-        /// @note The node must be unlinked from any existing list before calling.
-        /// @param node the node to add.
-        void Add(Node* node) {
-            node->next = nodes;
-            nodes = node;
-        }
-
-        /// @returns the node in the slot with the given hash and key.
-        /// @param hash the key hash to search for.
-        /// @param key the key value to search for.
-        template <typename K>
-        const Entry* Find(HashCode hash, K&& key) const {
-            for (auto* node = nodes; node; node = node->next) {
-                if (node->Equals(hash, key)) {
-                    return &node->Entry();
-                }
-            }
-            return nullptr;
+    /// Rehash resizes the table to @p num_slots slots, and then places the existing nodes in the
+    /// new table. Nodes are not moved, so references to entries remain valid.
+    /// @param num_slots the new number of slots. Must be a power-of-two multiple of kGroupWidth.
+    void Rehash(size_t num_slots) {
+        Ctrl* old_ctrl = ctrl_;
+        Node** old_slots = Slots();
+        size_t old_num_slots = num_slots_;
+        bool old_inline = old_ctrl == Bitcast<Ctrl*>(inline_table_.data());
+
+        // A same-sized rehash of the inline table needs a copy of the old table.
+        decltype(inline_table_) inline_table_copy;
+        if (num_slots == kInlineSlots && old_inline) {
+            inline_table_copy = inline_table_;
+            old_ctrl = Bitcast<Ctrl*>(inline_table_copy.data());
+            old_slots = Bitcast<Node**>(old_ctrl + old_num_slots);
         }
 
-        /// @returns the node in the slot with the given hash and key.
-        /// @param hash the key hash to search for.
-        /// @param key the key value to search for.
-        template <typename K>
-        Entry* Find(HashCode hash, K&& key) {
-            for (auto* node = nodes; node; node = node->next) {
-                if (node->Equals(hash, key)) {
-                    return &node->Entry();
-                }
-            }
-            return nullptr;
+        // The new table holds no deleted slots, so each node takes the first empty slot of its
+        // probe sequence, and the growth budget can be updated once, after all nodes are placed.
+        ResetTable(num_slots);
+        Node** slots = Slots();
+        ForEachFullSlot(old_ctrl, old_num_slots, [&](size_t slot_idx) {
+            auto* node = old_slots[slot_idx];
+            uint64_t mixed = Mix(node->Key().hash);
+            size_t new_slot_idx = FindInsertSlot(mixed);
+            SetCtrl(new_slot_idx, H2(mixed));
+            slots[new_slot_idx] = node;
+        });
+        growth_left_ = MaxLoad(num_slots) - count_;
+
+        if (!old_inline) {
+            free(old_ctrl);
         }
-    };
+    }
 
     /// Free holds a linked list of nodes which are currently not used by entries in the map, and a
     /// linked list of node allocations.
@@ -630,7 +991,6 @@ class HashmapBase {
         Node* Take() {
             auto* node = nodes_;
             nodes_ = node->next;
-            node->next = nullptr;
             return node;
         }
 
@@ -669,14 +1029,21 @@ class HashmapBase {
     /// The fixed-size array of nodes, used for the first kMinCapacity entries of the map, before
     /// allocating from the heap.
     std::array<Node, kMinCapacity> fixed_;
-    /// The vector of slots. Each slot holds a linked list of nodes which hold entries in the map.
-    Vector<Slot, NumSlots(N)> slots_;
+    /// The inline table, used until the table needs more than kInlineSlots slots. Laid out like a
+    /// heap-allocated table. Groups are aligned so that a group load never spans two cache lines.
+    alignas(kGroupWidth) std::array<std::byte, kInlineSlots * kBytesPerSlot> inline_table_;
+    /// The control words of the table. One per slot, followed by the slots.
+    Ctrl* ctrl_ = nullptr;
+    /// The number of slots in the table.
+    size_t num_slots_ = 0;
     /// The linked list of free nodes, and node allocations from the heap.
     FreeNodes free_;
     /// The total number of nodes, including free nodes (kMinCapacity + heap-allocated)
     size_t capacity_ = kMinCapacity;
     /// The total number of nodes that currently hold map entries.
     size_t count_ = 0;
+    /// The number of empty slots that can be filled before the table needs to grow.
+    size_t growth_left_ = 0;
 };
 
 }  // namespace tint
@@ -0,0 +1,169 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "src/tint/utils/containers/hashmap.h"
+#include "src/tint/utils/containers/hashset.h"
+
+namespace tint {
+namespace {
+
+/// @returns @p count distinct keys, in a pseudo-random order
+std::vector<int> MakeKeys(size_t count) {
+    std::vector<int> keys(count);
+    uint32_t x = 0x1234567;
+    for (auto& key : keys) {
+        x = x * 1664525u + 1013904223u;
+        key = static_cast<int>(x >> 1);
+    }
+    return keys;
+}
+
+void HashmapAdd(::benchmark::State& state) {
+    auto keys = MakeKeys(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        Hashmap<int, int, 8> map;
+        for (int key : keys) {
+            map.Add(key, key);
+        }
+        ::benchmark::DoNotOptimize(map.Count());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(HashmapAdd)->RangeMultiplier(8)->Range(8, 32768);
+
+void HashmapGetHit(::benchmark::State& state) {
+    auto keys = MakeKeys(static_cast<size_t>(state.range(0)));
+    Hashmap<int, int, 8> map;
+    for (int key : keys) {
+        map.Add(key, key);
+    }
+    for (auto _ : state) {
+        for (int key : keys) {
+            ::benchmark::DoNotOptimize(map.Get(key));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(HashmapGetHit)->RangeMultiplier(8)->Range(8, 32768);
+
+void HashmapGetMiss(::benchmark::State& state) {
+    auto keys = MakeKeys(static_cast<size_t>(state.range(0)) * 2);
+    Hashmap<int, int, 8> map;
+    for (size_t i = 0; i < keys.size(); i += 2) {
+        map.Add(keys[i], keys[i]);
+    }
+    for (auto _ : state) {
+        for (size_t i = 1; i < keys.size(); i += 2) {
+            ::benchmark::DoNotOptimize(map.Get(keys[i]));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(HashmapGetMiss)->RangeMultiplier(8)->Range(8, 32768);
+
+void HashmapStringKeys(::benchmark::State& state) {
+    std::vector<std::string> keys;
+    for (int key : MakeKeys(static_cast<size_t>(state.range(0)))) {
+        keys.push_back("key_" + std::to_string(key));
+    }
+    for (auto _ : state) {
+        Hashmap<std::string, size_t, 8> map;
+        for (auto& key : keys) {
+            map.GetOrAdd(key, [&] { return map.Count(); });
+        }
+        for (auto& key : keys) {
+            ::benchmark::DoNotOptimize(map.Get(key));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(HashmapStringKeys)->RangeMultiplier(8)->Range(8, 4096);
+
+void HashmapAddRemove(::benchmark::State& state) {
+    // Keeps a sliding window of entries in the map, which exercises the reuse of removed slots.
+    auto keys = MakeKeys(static_cast<size_t>(state.range(0)) * 4);
+    size_t window = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        Hashmap<int, int, 8> map;
+        for (size_t i = 0; i < keys.size(); i++) {
+            map.Add(keys[i], keys[i]);
+            if (i >= window) {
+                map.Remove(keys[i - window]);
+            }
+        }
+        ::benchmark::DoNotOptimize(map.Count());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 4);
+}
+
+BENCHMARK(HashmapAddRemove)->RangeMultiplier(8)->Range(8, 4096);
+
+void HashmapIterate(::benchmark::State& state) {
+    auto keys = MakeKeys(static_cast<size_t>(state.range(0)));
+    Hashmap<int, int, 8> map;
+    for (int key : keys) {
+        map.Add(key, key);
+    }
+    for (auto _ : state) {
+        int sum = 0;
+        for (auto& entry : map) {
+            sum += entry.value;
+        }
+        ::benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(HashmapIterate)->RangeMultiplier(8)->Range(8, 32768);
+
+void HashsetPointers(::benchmark::State& state) {
+    std::vector<int> objects(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        Hashset<const int*, 8> set;
+        for (auto& object : objects) {
+            set.Add(&object);
+        }
+        for (auto& object : objects) {
+            ::benchmark::DoNotOptimize(set.Contains(&object));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(HashsetPointers)->RangeMultiplier(8)->Range(8, 32768);
+
+}  // namespace
+}  // namespace tint
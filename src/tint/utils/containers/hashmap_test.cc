@@ -32,6 +32,7 @@
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <vector>
 
 #include "gmock/gmock.h"
 
@@ -411,6 +412,83 @@ TEST(Hashmap, GetOrAdd_CreateAddsSameKeyedValue) {
     EXPECT_EQ(map.Get(42), "expected-value");
 }
 
+TEST(Hashmap, EntryReferencesStableAcrossRehash) {
+    Hashmap<int, std::string, 4> map;
+    std::string& zero = map.GetOrAdd(0, [] { return "zero"; });
+    std::vector<std::string*> values;
+    for (int i = 1; i < 1000; i++) {
+        values.push_back(&map.GetOrAdd(i, [&] { return std::to_string(i); }));
+    }
+    EXPECT_EQ(&zero, &*map.Get(0));
+    EXPECT_EQ(zero, "zero");
+    for (int i = 1; i < 1000; i++) {
+        EXPECT_EQ(values[static_cast<size_t>(i - 1)], &*map.Get(i));
+    }
+}
+
+TEST(Hashmap, CollidingHashes) {
+    struct ConstantHasher {
+        HashCode operator()(int) const { return 42; }
+    };
+    Hashmap<int, int, 8, ConstantHasher> map;
+    for (int i = 0; i < 100; i++) {
+        ASSERT_TRUE(map.Add(i, i * 10)) << "i: " << i;
+    }
+    for (int i = 0; i < 100; i += 2) {
+        ASSERT_TRUE(map.Remove(i)) << "i: " << i;
+    }
+    EXPECT_EQ(map.Count(), 50u);
+    for (int i = 0; i < 100; i++) {
+        if (i & 1) {
+            EXPECT_EQ(map.Get(i), i * 10) << "i: " << i;
+        } else {
+            EXPECT_FALSE(map.Get(i)) << "i: " << i;
+        }
+    }
+}
+
+TEST(Hashmap, AddRemoveChurn) {
+    // Repeatedly adding and removing entries leaves deleted slots in the table, which must be
+    // reclaimed when the table is rehashed.
+    Hashmap<int, int, 8> map;
+    for (int i = 0; i < 100000; i++) {
+        ASSERT_TRUE(map.Add(i, i)) << "i: " << i;
+        if (i >= 4) {
+            ASSERT_TRUE(map.Remove(i - 4)) << "i: " << i;
+        }
+        ASSERT_LE(map.Count(), 5u);
+    }
+    EXPECT_EQ(map.Count(), 4u);
+    EXPECT_THAT(map.Keys(), testing::UnorderedElementsAre(99996, 99997, 99998, 99999));
+}
+
+TEST(Hashmap, Reserve) {
+    Hashmap<int, int, 8> map;
+    map.Reserve(100);
+    std::vector<int*> values;
+    for (int i = 0; i < 100; i++) {
+        values.push_back(&map.GetOrAddZero(i));
+    }
+    for (int i = 0; i < 100; i++) {
+        EXPECT_EQ(values[static_cast<size_t>(i)], &*map.Get(i));
+    }
+}
+
+TEST(Hashmap, ClearResetsCount) {
+    Hashmap<int, int, 8> map;
+    for (int i = 0; i < 20; i++) {
+        map.Add(i, i);
+    }
+    map.Clear();
+    EXPECT_EQ(map.Count(), 0u);
+    EXPECT_TRUE(map.IsEmpty());
+    EXPECT_EQ(map.begin(), map.end());
+    for (int i = 0; i < 20; i++) {
+        EXPECT_TRUE(map.Add(i, i));
+    }
+    EXPECT_EQ(map.Count(), 20u);
+}
+
 TEST(Hashmap, Soak) {
     std::mt19937 rnd;
     std::unordered_map<std::string, std::string> reference;
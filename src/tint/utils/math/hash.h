@@ -97,7 +97,10 @@ struct Hasher<T*> {
         hash ^= static_cast<uint32_t>(TINT_HASH_SEED);
 #endif
         if constexpr (sizeof(hash) > 4) {
-            return static_cast<HashCode>(hash >> 4 | hash >> 32);
+            // Fold the upper bits into the lower bits with an XOR. An OR would force the bits of
+            // the lower half that are set in the upper half, and collapse many pointers onto the
+            // same hash.
+            return static_cast<HashCode>((hash >> 4) ^ (hash >> 32));
         } else {
             return static_cast<HashCode>(hash >> 4);
         }
@@ -89,6 +89,22 @@ inline constexpr uint32_t Log2(uint64_t value) {
     return 64;
 }
 
+/// @param value the input value. Must not be zero.
+/// @returns the number of trailing zero bits of @p value
+inline constexpr uint32_t CountTrailingZeros(uint64_t value) {
+#if defined(__clang__) || defined(__GNUC__)
+    return static_cast<uint32_t>(__builtin_ctzll(value));
+#endif
+
+    // Non intrinsic (slow) path. Supports constexpr evaluation.
+    for (uint32_t bit = 0; bit < 64; bit++) {
+        if (value & (static_cast<uint64_t>(1u) << bit)) {
+            return bit;
+        }
+    }
+    return 64;
+}
+
 /// @param value the input value
 /// @returns the next power of two number greater or equal to @p value
 inline constexpr uint64_t NextPowerOfTwo(uint64_t value) {
@@ -102,6 +102,28 @@ TEST(MathTests, Log2) {
     static_assert(Log2(0x8000000000000000u) == 63u);
 }
 
+TEST(MathTests, CountTrailingZeros) {
+    EXPECT_EQ(CountTrailingZeros(1), 0u);
+    EXPECT_EQ(CountTrailingZeros(2), 1u);
+    EXPECT_EQ(CountTrailingZeros(3), 0u);
+    EXPECT_EQ(CountTrailingZeros(4), 2u);
+    EXPECT_EQ(CountTrailingZeros(6), 1u);
+    EXPECT_EQ(CountTrailingZeros(0x80000000u), 31u);
+    EXPECT_EQ(CountTrailingZeros(0x100000000u), 32u);
+    EXPECT_EQ(CountTrailingZeros(0x8000000000000000u), 63u);
+    EXPECT_EQ(CountTrailingZeros(0xffffffffffffffffu), 0u);
+
+    static_assert(CountTrailingZeros(1) == 0u);
+    static_assert(CountTrailingZeros(2) == 1u);
+    static_assert(CountTrailingZeros(3) == 0u);
+    static_assert(CountTrailingZeros(4) == 2u);
+    static_assert(CountTrailingZeros(6) == 1u);
+    static_assert(CountTrailingZeros(0x80000000u) == 31u);
+    static_assert(CountTrailingZeros(0x100000000u) == 32u);
+    static_assert(CountTrailingZeros(0x8000000000000000u) == 63u);
+    static_assert(CountTrailingZeros(0xffffffffffffffffu) == 0u);
+}
+
 TEST(MathTests, NextPowerOfTwo) {
     EXPECT_EQ(NextPowerOfTwo(0), 1u);
     EXPECT_EQ(NextPowerOfTwo(1), 1u);
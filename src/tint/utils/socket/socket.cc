@@ -39,9 +39,12 @@
 #include <netinet/tcp.h>
 #include <sys/select.h>
 #include <sys/socket.h>
+#include <sys/stat.h>
 #include <sys/time.h>
+#include <sys/un.h>
 #include <unistd.h>
 #include <cstdio>
+#include <cstring>
 #endif
 
 #if TINT_BUILD_IS_WIN
@@ -240,9 +243,11 @@ class Impl : public Socket {
         Lock([&](SOCKET socket, const addrinfo*) {
             if (socket != InvalidSocket) {
                 Init();
-                if (auto sock = ::accept(socket, nullptr, nullptr); s >= 0) {
+                if (auto sock = ::accept(socket, nullptr, nullptr); sock != InvalidSocket) {
                     out = std::make_shared<Impl>(sock);
                     out->SetOptions();
+                } else {
+                    Term();
                 }
             }
         });
@@ -255,6 +260,27 @@ class Impl : public Socket {
     RWMutex mutex;
 };
 
+#if !TINT_BUILD_IS_WIN
+/// Creates a Unix domain socket, and fills @p addr with the address of @p path.
+/// @returns the socket, or nullptr if the path is too long or the socket could not be created.
+std::shared_ptr<Impl> CreateUnix(const char* path, sockaddr_un* addr) {
+    *addr = {};
+    addr->sun_family = AF_UNIX;
+    auto len = strlen(path);
+    if (len == 0 || len >= sizeof(addr->sun_path)) {
+        return nullptr;
+    }
+    memcpy(addr->sun_path, path, len);
+
+    auto socket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (socket == InvalidSocket) {
+        return nullptr;
+    }
+    Init();
+    return std::make_shared<Impl>(socket);
+}
+#endif  // !TINT_BUILD_IS_WIN
+
 }  // anonymous namespace
 
 Socket::~Socket() = default;
@@ -270,7 +296,7 @@ std::shared_ptr<Socket> Socket::Listen(const char* address, const char* port) {
             return;
         }
 
-        if (listen(socket, 0) != 0) {
+        if (listen(socket, SOMAXCONN) != 0) {
             impl.reset();
             return;
         }
@@ -336,4 +362,57 @@ std::shared_ptr<Socket> Socket::Connect(const char* address,
     return out->IsOpen() ? out : nullptr;
 }
 
+std::shared_ptr<Socket> Socket::ListenUnix([[maybe_unused]] const char* path) {
+#if TINT_BUILD_IS_WIN
+    return nullptr;
+#else
+    sockaddr_un addr;
+    auto impl = CreateUnix(path, &addr);
+    if (!impl) {
+        return nullptr;
+    }
+
+    // Remove the socket of a previous server that did not shut down cleanly, but never any other
+    // kind of file.
+    struct stat st;
+    if (stat(path, &st) == 0 && S_ISSOCK(st.st_mode)) {
+        unlink(path);
+    }
+
+    impl->Lock([&](SOCKET socket, const addrinfo*) {
+        if (bind(socket, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0) {
+            impl.reset();
+            return;
+        }
+
+        if (listen(socket, SOMAXCONN) != 0) {
+            impl.reset();
+            return;
+        }
+    });
+    return impl;
+#endif
+}
+
+std::shared_ptr<Socket> Socket::ConnectUnix([[maybe_unused]] const char* path) {
+#if TINT_BUILD_IS_WIN
+    return nullptr;
+#else
+    sockaddr_un addr;
+    auto impl = CreateUnix(path, &addr);
+    if (!impl) {
+        return nullptr;
+    }
+
+    bool connected = false;
+    impl->Lock([&](SOCKET socket, const addrinfo*) {
+        connected = ::connect(socket, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) == 0;
+    });
+    if (!connected) {
+        return nullptr;
+    }
+    return impl->IsOpen() ? impl : nullptr;
+#endif
+}
+
 }  // namespace tint::socket
@@ -32,7 +32,7 @@
 
 namespace tint::socket {
 
-/// Socket provides an OS abstraction to a TCP socket.
+/// Socket provides an OS abstraction to a TCP or Unix domain socket.
 class Socket {
   public:
     /// Connects to the given TCP address and port.
@@ -54,6 +54,20 @@ class Socket {
     /// @returns the Socket that listens for connections
     static std::shared_ptr<Socket> Listen(const char* address, const char* port);
 
+    /// Connects to the Unix domain socket at the given path.
+    /// @param path the file system path of the socket
+    /// @returns the connected Socket, or nullptr on failure or if Unix domain sockets are not
+    ///          supported by the platform
+    static std::shared_ptr<Socket> ConnectUnix(const char* path);
+
+    /// Begins listening for connections on a Unix domain socket at the given path. Any stale
+    /// socket file left at the path by a previous process is replaced.
+    /// Call Accept() on the returned Socket to block and wait for a connection.
+    /// @param path the file system path of the socket
+    /// @returns the Socket that listens for connections, or nullptr on failure or if Unix domain
+    ///          sockets are not supported by the platform
+    static std::shared_ptr<Socket> ListenUnix(const char* path);
+
     /// Destructor
     virtual ~Socket();
 
@@ -82,3 +82,28 @@ tint_target_add_dependencies(tint_utils_symbol_test test
 tint_target_add_external_dependencies(tint_utils_symbol_test test
   "gtest"
 )
+
+################################################################################
+# Target:    tint_utils_symbol_bench
+# Kind:      bench
+################################################################################
+tint_add_target(tint_utils_symbol_bench bench
+  utils/symbol/symbol_table_bench.cc
+)
+
+tint_target_add_dependencies(tint_utils_symbol_bench bench
+  tint_utils_containers
+  tint_utils_ice
+  tint_utils_id
+  tint_utils_macros
+  tint_utils_math
+  tint_utils_memory
+  tint_utils_rtti
+  tint_utils_symbol
+  tint_utils_text
+  tint_utils_traits
+)
+
+tint_target_add_external_dependencies(tint_utils_symbol_bench bench
+  "google-benchmark"
+)
@@ -27,6 +27,8 @@
 
 #include "src/tint/utils/symbol/symbol_table.h"
 
+#include <string>
+
 #include "src/tint/utils/ice/ice.h"
 
 namespace tint {
@@ -42,51 +44,108 @@ SymbolTable& SymbolTable::operator=(SymbolTable&&) = default;
 Symbol SymbolTable::Register(std::string_view name) {
     TINT_ASSERT(!name.empty());
 
-    auto& it = name_to_symbol_.GetOrAddZeroEntry(name);
-    if (it.value) {
-        return Symbol{it.value, generation_id_, it.key};
+    Name key{name};
+    if (wrapped_) {
+        if (auto* entry = wrapped_->Find(key)) {
+            return Symbol{entry->value.symbol, generation_id_, entry->key->view};
+        }
+    }
+
+    auto& it = name_to_symbol_.GetOrAddZeroEntry(key);
+    if (it.value.symbol) {
+        return Symbol{it.value.symbol, generation_id_, it.key->view};
     }
 
     auto view = Allocate(name);
-    it.key = view;
-    it.value = next_symbol_++;
-    return Symbol{it.value, generation_id_, view};
+    it.key = Name{view, key.hash};
+    it.value.symbol = next_symbol_++;
+    return Symbol{it.value.symbol, generation_id_, view};
 }
 
 Symbol SymbolTable::Get(std::string_view name) const {
-    if (auto* entry = name_to_symbol_.GetEntry(name)) {
-        return Symbol{entry->value, generation_id_, entry->key};
+    if (auto* entry = Find(Name{name})) {
+        return Symbol{entry->value.symbol, generation_id_, entry->key->view};
     }
     return Symbol{};
 }
 
-Symbol SymbolTable::New(std::string_view prefix_view /* = "" */) {
-    std::string prefix;
-    if (prefix_view.empty()) {
+Symbol SymbolTable::New(std::string_view prefix /* = "" */) {
+    if (prefix.empty()) {
         prefix = "tint_symbol";
-    } else {
-        prefix = std::string(prefix_view);
     }
 
-    auto& it = name_to_symbol_.GetOrAddZeroEntry(prefix);
-    if (it.value == 0) {
+    auto& it = FindOrAdd(Name{prefix});
+    if (it.value.symbol == 0) {
         // prefix is a unique name
         auto view = Allocate(prefix);
-        it.key = view;
-        it.value = next_symbol_++;
-        return Symbol{it.value, generation_id_, view};
+        it.key = Name{view, it.key->hash};
+        it.value.symbol = next_symbol_++;
+        return Symbol{it.value.symbol, generation_id_, view};
     }
 
-    size_t& i = last_prefix_to_index_.GetOrAddZero(prefix);
+    // Build the name in a single buffer, replacing only the numerical suffix on each attempt.
     std::string name;
-    do {
-        ++i;
-        name = prefix + "_" + std::to_string(i);
-    } while (name_to_symbol_.Contains(name));
+    name.reserve(prefix.length() + 12);
+    name.append(prefix);
+    name.push_back('_');
+    size_t prefix_length = name.length();
+
+    uint32_t suffix = it.value.last_suffix;
+    auto next_candidate = [&] {
+        name.resize(prefix_length);
+        name.append(std::to_string(++suffix));
+        return Name{name};
+    };
+    Name candidate = next_candidate();
+    while (Find(candidate)) {
+        candidate = next_candidate();
+    }
+    it.value.last_suffix = suffix;
 
     auto view = Allocate(name);
-    auto id = name_to_symbol_.Add(view, next_symbol_++);
-    return Symbol{id.value, generation_id_, view};
+    auto id = name_to_symbol_.Add(Name{view, candidate.hash}, NameInfo{next_symbol_++, 0});
+    return Symbol{id.value.symbol, generation_id_, view};
+}
+
+const SymbolTable::NameMap::Entry* SymbolTable::Find(const Name& name) const {
+    for (auto* table = this; table; table = table->wrapped_) {
+        if (auto* entry = table->name_to_symbol_.GetEntry(name)) {
+            return entry;
+        }
+    }
+    return nullptr;
+}
+
+SymbolTable::NameMap::Entry& SymbolTable::FindOrAdd(const Name& name) {
+    auto& it = name_to_symbol_.GetOrAddZeroEntry(name);
+    if (it.value.symbol == 0 && wrapped_) {
+        if (auto* entry = wrapped_->Find(name)) {
+            // Copy the entry of the wrapped table, so that it can be modified by this table.
+            // The name is owned by the wrapped table, which outlives this table.
+            it.key = entry->key;
+            it.value = entry->value;
+        }
+    }
+    return it;
+}
+
+bool SymbolTable::IsShareable() const {
+    size_t depth = 0;
+    for (auto* table = this; table->wrapped_; table = table->wrapped_) {
+        if (!table->wrapped_owner_ || ++depth >= kMaxSharedDepth) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SymbolTable::IsShadowed(const SymbolTable* table, const Name& name) const {
+    for (auto* outer = this; outer != table; outer = outer->wrapped_) {
+        if (outer->name_to_symbol_.Contains(name)) {
+            return true;
+        }
+    }
+    return false;
 }
 
 std::string_view SymbolTable::Allocate(std::string_view name) {
@@ -97,7 +156,8 @@ std::string_view SymbolTable::Allocate(std::string_view name) {
         return {};
     }
 
-    memcpy(name_mem, name.data(), name.length() + 1);
+    memcpy(name_mem, name.data(), name.length());
+    name_mem[name.length()] = '\0';
     return {name_mem, name.length()};
 }
 
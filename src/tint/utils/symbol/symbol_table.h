@@ -28,9 +28,12 @@
 #ifndef SRC_TINT_UTILS_SYMBOL_SYMBOL_TABLE_H_
 #define SRC_TINT_UTILS_SYMBOL_SYMBOL_TABLE_H_
 
+#include <memory>
 #include <string>
+#include <string_view>
 
 #include "src/tint/utils/containers/hashmap.h"
+#include "src/tint/utils/math/hash.h"
 #include "src/tint/utils/memory/bump_allocator.h"
 #include "src/tint/utils/symbol/symbol.h"
 
@@ -56,18 +59,46 @@ class SymbolTable {
     /// @returns a symbol table to hold symbols which point to the allocated names in @p o.
     /// The symbol table after Wrap is intended to temporarily extend the objects of an existing
     /// immutable SymbolTable.
-    /// @warning As the copied objects are owned by @p o, @p o must not be destructed or assigned
-    /// while using this symbol table.
+    /// The returned table references the names of @p o instead of copying them, so Wrap() is O(1).
+    /// Entries of @p o are only copied into the returned table when they are modified.
+    /// @warning As the referenced names are owned by @p o, and the returned table holds a pointer to
+    /// @p o, @p o must not be destructed, moved or assigned while using this symbol table. Use
+    /// WrapShared() to extend a table that may not outlive the returned table.
     /// @param o the immutable SymbolTable to extend
     static SymbolTable Wrap(const SymbolTable& o) {
         SymbolTable out(o.generation_id_);
         out.next_symbol_ = o.next_symbol_;
-        out.name_to_symbol_ = o.name_to_symbol_;
-        out.last_prefix_to_index_ = o.last_prefix_to_index_;
-        out.generation_id_ = o.generation_id_;
+        out.wrapped_ = &o;
         return out;
     }
 
+    /// @returns a symbol table with the generation identifier @p generation_id, which extends @p o
+    /// like Wrap(), and shares the ownership of @p o. The symbols of @p o are symbols of the
+    /// returned table, with the same values and names.
+    /// @param o the immutable SymbolTable to extend. Must be shareable.
+    /// @param generation_id the identifier of the program that owns the returned table
+    /// @see IsShareable()
+    static SymbolTable WrapShared(std::shared_ptr<const SymbolTable> o,
+                                  tint::GenerationID generation_id) {
+        SymbolTable out(generation_id);
+        out.next_symbol_ = o->next_symbol_;
+        out.wrapped_ = o.get();
+        out.wrapped_owner_ = std::move(o);
+        return out;
+    }
+
+    /// @returns true if this table can be passed to WrapShared(). A table is shareable if it owns
+    /// all the tables that it wraps, and it wraps fewer than kMaxSharedDepth tables.
+    bool IsShareable() const;
+
+    /// The maximum number of tables that a shareable table can wrap. Looking up a name that is not
+    /// held by a table searches each of the tables that it wraps, so deeper tables are copied
+    /// instead of shared.
+    static constexpr size_t kMaxSharedDepth = 4;
+
+    /// @returns true if no symbols have been added to the table, or to the tables that it wraps.
+    bool IsEmpty() const { return next_symbol_ == 1; }
+
     /// Registers a name into the symbol table, returning the Symbol.
     /// @param name the name to register
     /// @returns the symbol representing the given name
@@ -91,8 +122,13 @@ class SymbolTable {
     /// signature: `void(Symbol)`
     template <typename F>
     void Foreach(F&& callback) const {
-        for (auto& it : name_to_symbol_) {
-            callback(Symbol{it.value, generation_id_, it.key});
+        for (auto* table = this; table; table = table->wrapped_) {
+            for (auto& it : table->name_to_symbol_) {
+                if (IsShadowed(table, it.key.Value())) {
+                    continue;  // Entry was copied into an outer table
+                }
+                callback(Symbol{it.value.symbol, generation_id_, it.key->view});
+            }
         }
     }
 
@@ -103,14 +139,70 @@ class SymbolTable {
     SymbolTable(const SymbolTable&) = delete;
     SymbolTable& operator=(const SymbolTable& other) = delete;
 
+    /// Name is the key of the symbol table's map, holding a symbol name and its precomputed hash.
+    struct Name {
+        /// Constructor
+        /// @param v the symbol name
+        explicit Name(std::string_view v) : view(v), hash(Hash(v)) {}
+
+        /// Constructor
+        /// @param v the symbol name
+        /// @param h the precomputed hash of @p v
+        Name(std::string_view v, tint::HashCode h) : view(v), hash(h) {}
+
+        /// @returns the precomputed hash of the name
+        tint::HashCode HashCode() const { return hash; }
+
+        /// Equality operator
+        /// @param other the other name
+        /// @returns true if this name is equal to @p other
+        bool operator==(const Name& other) const {
+            return hash == other.hash && view == other.view;
+        }
+
+        /// The symbol name
+        std::string_view view;
+        /// The hash of #view
+        tint::HashCode hash;
+    };
+
+    /// NameInfo is the value of the symbol table's map.
+    struct NameInfo {
+        /// The symbol value, or 0 if the name has not been assigned a symbol.
+        uint32_t symbol = 0;
+        /// The last numerical suffix used by New() when this name was used as a prefix.
+        uint32_t last_suffix = 0;
+    };
+
+    /// The map of symbol name to symbol information
+    using NameMap = Hashmap<Name, NameInfo, 0>;
+
+    /// @returns the entry for @p name held by this table, or by the wrapped tables, or nullptr if
+    /// @p name has not been registered.
+    /// @param name the name to look up
+    const NameMap::Entry* Find(const Name& name) const;
+
+    /// @returns the entry for @p name held by this table, adding a new entry if this table does not
+    /// yet hold one. If the name is held by a wrapped table, then the wrapped table's entry is
+    /// copied into this table.
+    /// @param name the name to look up
+    NameMap::Entry& FindOrAdd(const Name& name);
+
+    /// @returns true if @p name is also held by a table in the wrap chain from this table up to,
+    /// but not including, @p table.
+    /// @param table a table in the wrap chain that holds @p name
+    /// @param name the name to look up
+    bool IsShadowed(const SymbolTable* table, const Name& name) const;
+
     std::string_view Allocate(std::string_view name);
 
     // The value to be associated to the next registered symbol table entry.
     uint32_t next_symbol_ = 1;
 
-    Hashmap<std::string_view, uint32_t, 0> name_to_symbol_;
-    Hashmap<std::string, size_t, 0> last_prefix_to_index_;
+    NameMap name_to_symbol_;
     tint::GenerationID generation_id_;
+    const SymbolTable* wrapped_ = nullptr;
+    std::shared_ptr<const SymbolTable> wrapped_owner_;
 
     tint::BumpAllocator name_allocator_;
 };
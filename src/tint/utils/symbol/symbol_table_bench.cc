@@ -0,0 +1,103 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "src/tint/utils/symbol/symbol_table.h"
+
+namespace tint {
+namespace {
+
+/// @returns @p count distinct identifier names
+std::vector<std::string> MakeNames(size_t count) {
+    std::vector<std::string> names(count);
+    for (size_t i = 0; i < count; i++) {
+        names[i] = "identifier_name_" + std::to_string(i);
+    }
+    return names;
+}
+
+void SymbolTableRegister(::benchmark::State& state) {
+    auto names = MakeNames(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        SymbolTable table{GenerationID::New()};
+        for (auto& name : names) {
+            ::benchmark::DoNotOptimize(table.Register(name));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(SymbolTableRegister)->Arg(64)->Arg(1024);
+
+void SymbolTableNew(::benchmark::State& state) {
+    for (auto _ : state) {
+        SymbolTable table{GenerationID::New()};
+        for (int64_t i = 0; i < state.range(0); i++) {
+            ::benchmark::DoNotOptimize(table.New());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(SymbolTableNew)->Arg(64)->Arg(1024);
+
+void SymbolTableCloneSymbols(::benchmark::State& state) {
+    auto names = MakeNames(static_cast<size_t>(state.range(0)));
+    SymbolTable src{GenerationID::New()};
+    for (auto& name : names) {
+        src.Register(name);
+    }
+    for (auto _ : state) {
+        SymbolTable dst{GenerationID::New()};
+        src.Foreach([&](Symbol s) { ::benchmark::DoNotOptimize(dst.New(s.NameView())); });
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(SymbolTableCloneSymbols)->Arg(64)->Arg(1024);
+
+void SymbolTableWrap(::benchmark::State& state) {
+    auto names = MakeNames(static_cast<size_t>(state.range(0)));
+    SymbolTable src{GenerationID::New()};
+    for (auto& name : names) {
+        src.Register(name);
+    }
+    for (auto _ : state) {
+        auto wrapped = SymbolTable::Wrap(src);
+        ::benchmark::DoNotOptimize(wrapped.Get(names[0]));
+        ::benchmark::DoNotOptimize(wrapped.New("tmp"));
+    }
+}
+
+BENCHMARK(SymbolTableWrap)->Arg(64)->Arg(1024);
+
+}  // namespace
+}  // namespace tint
@@ -49,6 +49,87 @@ TEST_F(SymbolTableTest, DeduplicatesNames) {
     EXPECT_EQ(Symbol(1, generation_id, "name"), s.Register("name"));
 }
 
+TEST_F(SymbolTableTest, NewUniqueNames) {
+    auto generation_id = GenerationID::New();
+    SymbolTable s{generation_id};
+    EXPECT_EQ(Symbol(1, generation_id, "name"), s.New("name"));
+    EXPECT_EQ(Symbol(2, generation_id, "name_1"), s.New("name"));
+    EXPECT_EQ(Symbol(3, generation_id, "name_2"), s.Register("name_2"));
+    EXPECT_EQ(Symbol(4, generation_id, "name_3"), s.New("name"));
+    EXPECT_EQ(Symbol(5, generation_id, "tint_symbol"), s.New());
+    EXPECT_EQ(Symbol(6, generation_id, "tint_symbol_1"), s.New());
+}
+
+TEST_F(SymbolTableTest, Wrap) {
+    auto generation_id = GenerationID::New();
+    SymbolTable a{generation_id};
+    EXPECT_EQ(Symbol(1, generation_id, "name"), a.New("name"));
+    EXPECT_EQ(Symbol(2, generation_id, "name_1"), a.New("name"));
+
+    auto b = SymbolTable::Wrap(a);
+    EXPECT_EQ(Symbol(1, generation_id, "name"), b.Get("name"));
+    EXPECT_EQ(Symbol(2, generation_id, "name_1"), b.Register("name_1"));
+    EXPECT_EQ(Symbol(3, generation_id, "name_2"), b.New("name"));
+    EXPECT_EQ(Symbol(4, generation_id, "other"), b.Register("other"));
+
+    // The wrapped table is not modified
+    EXPECT_EQ(Symbol(), a.Get("name_2"));
+    EXPECT_EQ(Symbol(), a.Get("other"));
+    EXPECT_EQ(Symbol(3, generation_id, "name_2"), a.New("name"));
+
+    size_t count = 0;
+    b.Foreach([&](Symbol) { count++; });
+    EXPECT_EQ(count, 4u);
+}
+
+TEST_F(SymbolTableTest, WrapShared) {
+    auto a_id = GenerationID::New();
+    auto a = std::make_shared<SymbolTable>(a_id);
+    EXPECT_EQ(Symbol(1, a_id, "name"), a->New("name"));
+    EXPECT_EQ(Symbol(2, a_id, "name_1"), a->New("name"));
+
+    auto b_id = GenerationID::New();
+    auto b = SymbolTable::WrapShared(a, b_id);
+    a = nullptr;  // The wrapped table is kept alive by b
+
+    EXPECT_EQ(b.GenerationID(), b_id);
+    EXPECT_EQ(Symbol(1, b_id, "name"), b.Get("name"));
+    EXPECT_EQ(Symbol(2, b_id, "name_1"), b.Register("name_1"));
+    EXPECT_EQ(Symbol(3, b_id, "name_2"), b.New("name"));
+    EXPECT_EQ(Symbol(4, b_id, "other"), b.Register("other"));
+
+    size_t count = 0;
+    b.Foreach([&](Symbol) { count++; });
+    EXPECT_EQ(count, 4u);
+}
+
+TEST_F(SymbolTableTest, IsShareable) {
+    auto table = std::make_shared<SymbolTable>(GenerationID::New());
+    EXPECT_TRUE(table->IsShareable());
+
+    for (size_t depth = 1; depth < SymbolTable::kMaxSharedDepth; depth++) {
+        table = std::make_shared<SymbolTable>(SymbolTable::WrapShared(table, GenerationID::New()));
+        EXPECT_TRUE(table->IsShareable());
+    }
+    table = std::make_shared<SymbolTable>(SymbolTable::WrapShared(table, GenerationID::New()));
+    EXPECT_FALSE(table->IsShareable());
+
+    // A table that wraps a table without owning it cannot be shared.
+    SymbolTable a{GenerationID::New()};
+    auto b = SymbolTable::Wrap(a);
+    EXPECT_FALSE(b.IsShareable());
+}
+
+TEST_F(SymbolTableTest, IsEmpty) {
+    auto a = std::make_shared<SymbolTable>(GenerationID::New());
+    EXPECT_TRUE(a->IsEmpty());
+    a->Register("name");
+    EXPECT_FALSE(a->IsEmpty());
+
+    auto b = SymbolTable::WrapShared(a, GenerationID::New());
+    EXPECT_FALSE(b.IsEmpty());
+}
+
 TEST_F(SymbolTableTest, AssertsForBlankString) {
     EXPECT_FATAL_FAILURE(
         {